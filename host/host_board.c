@@ -0,0 +1,127 @@
+/**
+  ******************************************************************************
+  * @file    host_board.c
+  * @brief   Host replacement of the board level functions used by the LCD
+  *          driver: GPIO and clock setup, ILI9341 bus and SDRAM.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this driver:
+--------------------------
+   - BSP_SDRAM_Init() maps the SDRAM at its target address, so the frame
+     buffer addresses of stm32f429i_discovery_sdram.h can be used as is.
+   - The drivers keep addresses in uint32_t: the program must be linked
+     without PIE so that fonts and bitmaps sit below 4 GB, see
+     host/README.md.
+
+------------------------------------------------------------------------------*/
+
+/* Includes ------------------------------------------------------------------*/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include "stm32f429i_discovery_sdram.h"
+#include "ili9341.h"
+
+#ifndef MAP_FIXED_NOREPLACE
+ #define MAP_FIXED_NOREPLACE    0x100000
+#endif
+
+/** @addtogroup HOST
+  * @{
+  */
+
+/** @defgroup HOST_BOARD HOST BOARD
+  * @{
+  */
+
+/** @defgroup HOST_BOARD_Private_Variables HOST BOARD Private Variables
+  * @{
+  */
+static uint8_t SdramMapped = 0;
+/**
+  * @}
+  */
+
+/** @defgroup HOST_BOARD_Private_Functions HOST BOARD Private Functions
+  * @{
+  */
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+  (void)GPIOx;
+  (void)GPIO_Init;
+}
+
+HAL_StatusTypeDef HAL_RCCEx_PeriphCLKConfig(RCC_PeriphCLKInitTypeDef *PeriphClkInit)
+{
+  (void)PeriphClkInit;
+  return HAL_OK;
+}
+
+/* The ILI9341 only receives its init sequence: the pixels come from the LTDC */
+void LCD_IO_Init(void)
+{
+}
+
+void LCD_IO_WriteData(uint16_t RegValue)
+{
+  (void)RegValue;
+}
+
+void LCD_IO_WriteReg(uint8_t Reg)
+{
+  (void)Reg;
+}
+
+uint32_t LCD_IO_ReadData(uint16_t RegValue, uint8_t ReadSize)
+{
+  (void)RegValue;
+  (void)ReadSize;
+  return 0;
+}
+
+void LCD_Delay(uint32_t Delay)
+{
+  (void)Delay;
+}
+
+/**
+  * @brief  Maps the SDRAM at SDRAM_DEVICE_ADDR, cleared to zero.
+  * @retval SDRAM status
+  */
+uint8_t BSP_SDRAM_Init(void)
+{
+  void *p;
+
+  if(SdramMapped)
+  {
+    return SDRAM_OK;
+  }
+
+  p = mmap((void *)(uintptr_t)SDRAM_DEVICE_ADDR, SDRAM_DEVICE_SIZE, PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+  if(p != (void *)(uintptr_t)SDRAM_DEVICE_ADDR)
+  {
+    fprintf(stderr, "host: cannot map the SDRAM at 0x%08lX\n", (unsigned long)SDRAM_DEVICE_ADDR);
+    abort();
+  }
+  SdramMapped = 1;
+
+  return SDRAM_OK;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
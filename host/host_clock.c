@@ -0,0 +1,530 @@
+/**
+  ******************************************************************************
+  * @file    host_clock.c
+  * @brief   Host virtual clock: the target timing functions and the mbed
+  *          threads of host/mbed.h run on simulated time, as a discrete
+  *          event simulation.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this driver:
+--------------------------
+   - Build it with the code to run, see host/README.md. HAL_Delay(),
+     HAL_GetTick(), wait_ms(), thread_sleep_for(), us_ticker_read() and the
+     ThisThread, Kernel::Clock, Timer, Thread and Mutex of host/mbed.h then
+     use the virtual time, starting at 0.
+   - Time only moves when every thread sleeps or waits: a sleep takes no
+     time on the host, an hour of firmware runs as fast as its code does.
+   - HOST_CLOCK_Schedule() runs a function at a time, for instance a fault
+     injection. HOST_CLOCK_SetEnd() stops the program at a time.
+   - Models of the devices read HOST_CLOCK_Now(), as
+     HOST_GYRO_SetClock(HOST_CLOCK_Now).
+
+2. Driver description:
+---------------------
+   - Each simulated thread is a host thread, but only one runs at a time,
+     until it sleeps, yields, waits for a mutex or ends. The next one is
+     the first due, then the highest priority, then the first to have gone
+     to sleep: a run is the same whatever the load of the host.
+   - Starting a thread of higher priority, or releasing a mutex it waits
+     for, switches to it at once, as the RTOS would. There is no
+     preemption otherwise: a critical section has nothing to mask.
+   - Events due at the same time as a thread run first. They run on the
+     thread that gave up the processor and must not sleep nor wait.
+   - A loop that polls the time never ends unless HOST_CLOCK_SetPollCost()
+     gives the time a read of the clock takes.
+   - When every thread waits for a mutex the program aborts.
+
+------------------------------------------------------------------------------*/
+
+/* Includes ------------------------------------------------------------------*/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host_clock.h"
+
+/** @addtogroup HOST
+  * @{
+  */
+
+/** @defgroup HOST_CLOCK HOST CLOCK
+  * @{
+  */
+
+/** @defgroup HOST_CLOCK_Private_TypesDefinitions HOST CLOCK Private TypesDefinitions
+  * @{
+  */
+typedef struct
+{
+  pthread_t      Handle;
+  pthread_cond_t Turn;       /* Signalled when it runs */
+  uint8_t        State;
+  uint64_t       Time;       /* When it may run again, CLOCK_READY */
+  uint64_t       Order;      /* When it became ready   */
+  int32_t        Priority;
+  const HOST_CLOCK_MutexTypeDef *pWaiting;
+  void         (*pEntry)(void *);
+  void          *pContext;
+}CLOCK_ThreadTypeDef;
+
+typedef struct
+{
+  uint64_t Time;
+  uint64_t Order;
+  void   (*pEvent)(void *);
+  void    *pContext;
+}CLOCK_EventTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup HOST_CLOCK_Private_Defines HOST CLOCK Private Defines
+  * @{
+  */
+#define CLOCK_RUNNING         1
+#define CLOCK_READY           2
+#define CLOCK_BLOCKED         3
+#define CLOCK_DONE            4
+
+#define CLOCK_PRIORITY_NORMAL 24    /* osPriorityNormal, main() */
+/**
+  * @}
+  */
+
+/** @defgroup HOST_CLOCK_Private_Variables HOST CLOCK Private Variables
+  * @{
+  */
+static pthread_mutex_t ClockLock = PTHREAD_MUTEX_INITIALIZER;
+static CLOCK_ThreadTypeDef ClockThreads[HOST_CLOCK_MAX_THREADS] =
+{
+  [0] = { .Turn = PTHREAD_COND_INITIALIZER, .State = CLOCK_RUNNING, .Priority = CLOCK_PRIORITY_NORMAL }
+};
+static uint32_t ClockThreadCount = 1;
+static int32_t  ClockCurrent = 0;
+static __thread int32_t ClockSelf = 0;
+
+static CLOCK_EventTypeDef ClockEvents[HOST_CLOCK_MAX_EVENTS];
+static uint32_t ClockEventCount = 0;
+
+static uint64_t ClockNow = 0;
+static uint64_t ClockOrder = 0;
+static uint64_t ClockEnd = UINT64_MAX;
+static void   (*ClockEndCallback)(void) = NULL;
+static uint64_t ClockPollCost = 0;
+static HOST_CLOCK_StatsTypeDef ClockStats;
+/**
+  * @}
+  */
+
+/** @defgroup HOST_CLOCK_Private_FunctionPrototypes HOST CLOCK Private FunctionPrototypes
+  * @{
+  */
+static void  CLOCK_Schedule(void);
+static void  CLOCK_Switch(int32_t Next);
+static void  CLOCK_Stop(void);
+static void *CLOCK_Start(void *pArgument);
+/**
+  * @}
+  */
+
+/** @defgroup HOST_CLOCK_Private_Functions HOST CLOCK Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Gets the virtual time.
+  * @retval Nanoseconds
+  */
+uint64_t HOST_CLOCK_Now(void)
+{
+  return ClockNow;
+}
+
+/**
+  * @brief  Lets the other threads run for a time.
+  */
+void HOST_CLOCK_Sleep(uint64_t Nanoseconds)
+{
+  HOST_CLOCK_SleepUntil(ClockNow + Nanoseconds);
+}
+
+/**
+  * @brief  Lets the other threads run up to a time.
+  * @param  Time: nanoseconds, a time gone only yields
+  */
+void HOST_CLOCK_SleepUntil(uint64_t Time)
+{
+  CLOCK_ThreadTypeDef *pSelf = &ClockThreads[ClockSelf];
+
+  pSelf->State = CLOCK_READY;
+  pSelf->Time  = (Time > ClockNow) ? Time : ClockNow;
+  pSelf->Order = ++ClockOrder;
+  ClockStats.Sleeps++;
+  CLOCK_Schedule();
+}
+
+/**
+  * @brief  Lets the threads of the same priority ready now run first.
+  */
+void HOST_CLOCK_Yield(void)
+{
+  HOST_CLOCK_SleepUntil(ClockNow);
+}
+
+/**
+  * @brief  Starts a simulated thread.
+  * @param  pEntry: runs in the thread, given pContext
+  * @param  Priority: osPriority value, main() being osPriorityNormal
+  * @retval Thread number, -1 on error
+  */
+int32_t HOST_CLOCK_Spawn(void (*pEntry)(void *), void *pContext, int32_t Priority)
+{
+  CLOCK_ThreadTypeDef *pThread;
+  int32_t id;
+
+  if(ClockThreadCount == HOST_CLOCK_MAX_THREADS)
+  {
+    return -1;
+  }
+  id = (int32_t)ClockThreadCount;
+  pThread = &ClockThreads[id];
+  memset(pThread, 0, sizeof(*pThread));
+  pthread_cond_init(&pThread->Turn, NULL);
+  pThread->State    = CLOCK_READY;
+  pThread->Time     = ClockNow;
+  pThread->Order    = ++ClockOrder;
+  pThread->Priority = Priority;
+  pThread->pEntry   = pEntry;
+  pThread->pContext = pContext;
+  if(pthread_create(&pThread->Handle, NULL, CLOCK_Start, (void *)(intptr_t)id) != 0)
+  {
+    pthread_cond_destroy(&pThread->Turn);
+    return -1;
+  }
+  pthread_detach(pThread->Handle);
+  ClockThreadCount++;
+
+  if(Priority > ClockThreads[ClockSelf].Priority)
+  {
+    HOST_CLOCK_Yield();
+  }
+  return id;
+}
+
+/**
+  * @brief  Takes a mutex, waiting for it if another thread holds it.
+  */
+void HOST_CLOCK_Lock(HOST_CLOCK_MutexTypeDef *pMutex)
+{
+  CLOCK_ThreadTypeDef *pSelf = &ClockThreads[ClockSelf];
+
+  while((pMutex->Owner >= 0) && (pMutex->Owner != ClockSelf))
+  {
+    pSelf->State    = CLOCK_BLOCKED;
+    pSelf->pWaiting = pMutex;
+    CLOCK_Schedule();
+  }
+  pMutex->Owner = ClockSelf;
+  pMutex->Count++;
+}
+
+/**
+  * @brief  Takes a mutex if no other thread holds it.
+  * @retval 1 if taken, 0 otherwise
+  */
+uint8_t HOST_CLOCK_TryLock(HOST_CLOCK_MutexTypeDef *pMutex)
+{
+  if((pMutex->Owner >= 0) && (pMutex->Owner != ClockSelf))
+  {
+    return 0;
+  }
+  pMutex->Owner = ClockSelf;
+  pMutex->Count++;
+  return 1;
+}
+
+/**
+  * @brief  Releases a mutex, switching to a waiting thread of higher
+  *         priority.
+  */
+void HOST_CLOCK_Unlock(HOST_CLOCK_MutexTypeDef *pMutex)
+{
+  uint8_t preempt = 0;
+  uint32_t i;
+
+  if((pMutex->Owner != ClockSelf) || (pMutex->Count == 0))
+  {
+    return;
+  }
+  if(--pMutex->Count > 0)
+  {
+    return;
+  }
+  pMutex->Owner = -1;
+  for(i = 0; i < ClockThreadCount; i++)
+  {
+    if((ClockThreads[i].State == CLOCK_BLOCKED) && (ClockThreads[i].pWaiting == pMutex))
+    {
+      ClockThreads[i].State    = CLOCK_READY;
+      ClockThreads[i].Time     = ClockNow;
+      ClockThreads[i].Order    = ++ClockOrder;
+      ClockThreads[i].pWaiting = NULL;
+      if(ClockThreads[i].Priority > ClockThreads[ClockSelf].Priority)
+      {
+        preempt = 1;
+      }
+    }
+  }
+  if(preempt)
+  {
+    HOST_CLOCK_Yield();
+  }
+}
+
+/**
+  * @brief  Runs a function at a time of the virtual clock.
+  * @param  Time: nanoseconds, a time gone meaning the next switch
+  * @retval 1 if scheduled, 0 if HOST_CLOCK_MAX_EVENTS are waiting
+  */
+uint8_t HOST_CLOCK_Schedule(uint64_t Time, void (*pEvent)(void *), void *pContext)
+{
+  CLOCK_EventTypeDef *pEntry;
+
+  if(ClockEventCount == HOST_CLOCK_MAX_EVENTS)
+  {
+    return 0;
+  }
+  pEntry = &ClockEvents[ClockEventCount++];
+  pEntry->Time     = (Time > ClockNow) ? Time : ClockNow;
+  pEntry->Order    = ++ClockOrder;
+  pEntry->pEvent   = pEvent;
+  pEntry->pContext = pContext;
+  return 1;
+}
+
+/**
+  * @brief  Ends the program when the time would go past Time.
+  * @param  pEnd: called first, at Time, NULL if none
+  */
+void HOST_CLOCK_SetEnd(uint64_t Time, void (*pEnd)(void))
+{
+  ClockEnd = Time;
+  ClockEndCallback = pEnd;
+}
+
+/**
+  * @brief  Sets the time a read of the clock takes: HAL_GetTick(),
+  *         us_ticker_read() and Kernel::Clock::now() then sleep that long.
+  * @param  Nanoseconds: 0, the default, for none
+  */
+void HOST_CLOCK_SetPollCost(uint64_t Nanoseconds)
+{
+  ClockPollCost = Nanoseconds;
+}
+
+/**
+  * @brief  A read of the clock, see HOST_CLOCK_SetPollCost().
+  */
+void HOST_CLOCK_Poll(void)
+{
+  if(ClockPollCost > 0)
+  {
+    HOST_CLOCK_Sleep(ClockPollCost);
+  }
+}
+
+/**
+  * @brief  Gets the clock counters.
+  */
+void HOST_CLOCK_GetStats(HOST_CLOCK_StatsTypeDef *pStats)
+{
+  *pStats = ClockStats;
+}
+
+/**
+  * @brief  Milliseconds since the start, as the SysTick count.
+  */
+uint32_t HAL_GetTick(void)
+{
+  HOST_CLOCK_Poll();
+  return (uint32_t)(ClockNow / 1000000);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  HOST_CLOCK_Sleep((uint64_t)Delay * 1000000);
+}
+
+/* As stm32f429i_discovery.c, which replaces HAL_Delay() with it */
+void wait_ms(int ms)
+{
+  HOST_CLOCK_Sleep((ms > 0) ? (uint64_t)ms * 1000000 : 0);
+}
+
+void thread_sleep_for(uint32_t millisec)
+{
+  HOST_CLOCK_Sleep((uint64_t)millisec * 1000000);
+}
+
+/**
+  * @brief  Microseconds since the start, wrapping as the 32-bit us ticker.
+  */
+uint32_t us_ticker_read(void)
+{
+  HOST_CLOCK_Poll();
+  return (uint32_t)(ClockNow / 1000);
+}
+
+/**
+  * @brief  Gives the processor to the next thread or event due, the
+  *         calling thread having set its state.
+  */
+static void CLOCK_Schedule(void)
+{
+  CLOCK_ThreadTypeDef *pThread;
+  CLOCK_EventTypeDef event;
+  int32_t next;
+  uint32_t i, first;
+
+  for(;;)
+  {
+    next = -1;
+    for(i = 0; i < ClockThreadCount; i++)
+    {
+      pThread = &ClockThreads[i];
+      if(pThread->State != CLOCK_READY)
+      {
+        continue;
+      }
+      if((next < 0) || (pThread->Time < ClockThreads[next].Time) ||
+         ((pThread->Time == ClockThreads[next].Time) &&
+          ((pThread->Priority > ClockThreads[next].Priority) ||
+           ((pThread->Priority == ClockThreads[next].Priority) && (pThread->Order < ClockThreads[next].Order)))))
+      {
+        next = (int32_t)i;
+      }
+    }
+
+    /* Events before the threads due at the same time */
+    if(ClockEventCount > 0)
+    {
+      first = 0;
+      for(i = 1; i < ClockEventCount; i++)
+      {
+        if((ClockEvents[i].Time < ClockEvents[first].Time) ||
+           ((ClockEvents[i].Time == ClockEvents[first].Time) && (ClockEvents[i].Order < ClockEvents[first].Order)))
+        {
+          first = i;
+        }
+      }
+      if((next < 0) || (ClockEvents[first].Time <= ClockThreads[next].Time))
+      {
+        event = ClockEvents[first];
+        ClockEvents[first] = ClockEvents[--ClockEventCount];
+        if(event.Time > ClockEnd)
+        {
+          CLOCK_Stop();
+        }
+        ClockNow = (event.Time > ClockNow) ? event.Time : ClockNow;
+        ClockStats.Events++;
+        event.pEvent(event.pContext);
+        continue;
+      }
+    }
+
+    if(next < 0)
+    {
+      fprintf(stderr, "host: every thread waits for a mutex at %llu ns\n", (unsigned long long)ClockNow);
+      fflush(NULL);
+      abort();
+    }
+    if(ClockThreads[next].Time > ClockEnd)
+    {
+      CLOCK_Stop();
+    }
+    ClockNow = (ClockThreads[next].Time > ClockNow) ? ClockThreads[next].Time : ClockNow;
+    CLOCK_Switch(next);
+    return;
+  }
+}
+
+/**
+  * @brief  Runs a thread, the calling one waiting for its next turn unless
+  *         it ended.
+  */
+static void CLOCK_Switch(int32_t Next)
+{
+  CLOCK_ThreadTypeDef *pSelf = &ClockThreads[ClockSelf];
+
+  ClockThreads[Next].State = CLOCK_RUNNING;
+  if(Next == ClockSelf)
+  {
+    return;
+  }
+  ClockStats.Switches++;
+
+  pthread_mutex_lock(&ClockLock);
+  ClockCurrent = Next;
+  pthread_cond_signal(&ClockThreads[Next].Turn);
+  if(pSelf->State != CLOCK_DONE)
+  {
+    while(ClockCurrent != ClockSelf)
+    {
+      pthread_cond_wait(&pSelf->Turn, &ClockLock);
+    }
+  }
+  pthread_mutex_unlock(&ClockLock);
+}
+
+/**
+  * @brief  End of the simulated time.
+  */
+static void CLOCK_Stop(void)
+{
+  ClockNow = ClockEnd;
+  if(ClockEndCallback != NULL)
+  {
+    ClockEndCallback();
+  }
+  fflush(NULL);
+  exit(0);
+}
+
+/**
+  * @brief  Host thread of a simulated thread: waits for its first turn.
+  */
+static void *CLOCK_Start(void *pArgument)
+{
+  CLOCK_ThreadTypeDef *pSelf;
+
+  ClockSelf = (int32_t)(intptr_t)pArgument;
+  pSelf = &ClockThreads[ClockSelf];
+
+  pthread_mutex_lock(&ClockLock);
+  while(ClockCurrent != ClockSelf)
+  {
+    pthread_cond_wait(&pSelf->Turn, &ClockLock);
+  }
+  pthread_mutex_unlock(&ClockLock);
+
+  pSelf->pEntry(pSelf->pContext);
+
+  pSelf->State = CLOCK_DONE;
+  CLOCK_Schedule();
+  return NULL;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
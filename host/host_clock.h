@@ -0,0 +1,107 @@
+/**
+  ******************************************************************************
+  * @file    host_clock.h
+  * @brief   This file contains the functions prototypes of the host virtual
+  *          clock: simulated time, threads run one at a time, and events.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __HOST_CLOCK_H
+#define __HOST_CLOCK_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/** @addtogroup HOST
+  * @{
+  */
+
+/** @addtogroup HOST_CLOCK
+  * @{
+  */
+
+/** @defgroup HOST_CLOCK_Exported_Types HOST CLOCK Exported Types
+  * @{
+  */
+
+/**
+  * @brief  Recursive mutex of the simulated threads, see Mutex in mbed.h
+  */
+typedef struct
+{
+  int32_t  Owner;          /*!< Thread holding it, -1 if none, HOST_CLOCK_MUTEX_INIT   */
+  uint32_t Count;          /*!< Times it was locked by Owner                           */
+}HOST_CLOCK_MutexTypeDef;
+
+/**
+  * @brief  Clock counters
+  */
+typedef struct
+{
+  uint64_t Switches;       /*!< Changes of the running thread                          */
+  uint64_t Sleeps;         /*!< Sleeps and yields                                      */
+  uint64_t Events;         /*!< HOST_CLOCK_Schedule() events run                       */
+}HOST_CLOCK_StatsTypeDef;
+
+/**
+  * @}
+  */
+
+/** @defgroup HOST_CLOCK_Exported_Constants HOST CLOCK Exported Constants
+  * @{
+  */
+#define HOST_CLOCK_MAX_THREADS    16
+#define HOST_CLOCK_MAX_EVENTS     64
+#define HOST_CLOCK_MUTEX_INIT     { -1, 0 }
+/**
+  * @}
+  */
+
+/** @defgroup HOST_CLOCK_Exported_Functions HOST CLOCK Exported Functions
+  * @{
+  */
+uint64_t HOST_CLOCK_Now(void);
+void     HOST_CLOCK_Sleep(uint64_t Nanoseconds);
+void     HOST_CLOCK_SleepUntil(uint64_t Time);
+void     HOST_CLOCK_Yield(void);
+int32_t  HOST_CLOCK_Spawn(void (*pEntry)(void *), void *pContext, int32_t Priority);
+
+void     HOST_CLOCK_Lock(HOST_CLOCK_MutexTypeDef *pMutex);
+uint8_t  HOST_CLOCK_TryLock(HOST_CLOCK_MutexTypeDef *pMutex);
+void     HOST_CLOCK_Unlock(HOST_CLOCK_MutexTypeDef *pMutex);
+
+uint8_t  HOST_CLOCK_Schedule(uint64_t Time, void (*pEvent)(void *), void *pContext);
+void     HOST_CLOCK_SetEnd(uint64_t Time, void (*pEnd)(void));
+void     HOST_CLOCK_SetPollCost(uint64_t Nanoseconds);
+void     HOST_CLOCK_Poll(void);
+
+void     HOST_CLOCK_GetStats(HOST_CLOCK_StatsTypeDef *pStats);
+
+/* Target timing functions, on the virtual clock */
+uint32_t HAL_GetTick(void);
+void     HAL_Delay(uint32_t Delay);
+void     wait_ms(int ms);
+void     thread_sleep_for(uint32_t millisec);
+uint32_t us_ticker_read(void);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HOST_CLOCK_H */
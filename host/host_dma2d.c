@@ -0,0 +1,1015 @@
+/**
+  ******************************************************************************
+  * @file    host_dma2d.c
+  * @brief   Host replacement of stm32f429i_discovery_dma2d.c: the DMA2D
+  *          transfers are emulated by the CPU, in RAM.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this driver:
+--------------------------
+   - Same API as stm32f429i_discovery_dma2d.c, build one or the other.
+   - The transfers run synchronously at submission: every fence is reached
+     when the submission function returns and the queue is always idle.
+   - HOST_DMA2D_GetCounters() gives the transfers, pixels and bytes moved
+     since HOST_DMA2D_ResetCounters().
+   - The SSE2, SSSE3 and AVX2 kernels are used when the compiler targets
+     them (e.g. -march=native). Define HOST_DMA2D_NO_SIMD to build the
+     scalar reference: both give the same pixels.
+
+2. Driver description:
+---------------------
+   - Each line goes through the stages of the DMA2D: foreground and
+     background pixel format conversion to ARGB8888 line buffers, alpha
+     mode, blender, then output pixel format conversion.
+   - The pixel conversions follow the DMA2D: input channels are expanded by
+     replicating their high bits, output channels are truncated. Blending
+     uses the formula of the reference manual with 8-bit alphas and
+     truncating divisions; the SIMD blender divides in single precision,
+     which is exact for these operand ranges.
+   - CLUTs are expanded to ARGB8888 once per transfer.
+   - Sub-byte inputs (L4, A4) hold their first pixel in the low nibble.
+   - Transfers wider than the NLR pixel per line field are dropped and
+     counted as errors.
+
+------------------------------------------------------------------------------*/
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "stm32f429i_discovery_dma2d.h"
+#include "stm32f429i_discovery_sdram.h"
+#include "host_lcd.h"
+
+#if !defined(HOST_DMA2D_NO_SIMD) && defined(__SSE2__)
+ #define DMA2D_SSE2
+ #include <emmintrin.h>
+#endif
+#if defined(DMA2D_SSE2) && defined(__SSSE3__)
+ #define DMA2D_SSSE3
+ #include <tmmintrin.h>
+#endif
+#if defined(DMA2D_SSE2) && defined(__AVX2__)
+ #define DMA2D_AVX2
+ #include <immintrin.h>
+#endif
+
+/** @addtogroup HOST
+  * @{
+  */
+
+/** @defgroup HOST_DMA2D HOST DMA2D
+  * @{
+  */
+
+/** @defgroup HOST_DMA2D_Private_Defines HOST DMA2D Private Defines
+  * @{
+  */
+#define DMA2D_MAX_WIDTH                0x3FFF      /* NLR pixel per line field */
+/**
+  * @}
+  */
+
+/** @defgroup HOST_DMA2D_Private_Variables HOST DMA2D Private Variables
+  * @{
+  */
+static uint32_t Dma2dHead = 0;
+static uint32_t Dma2dErrors = 0;
+static HOST_LCD_CountersTypeDef Dma2dCounters;
+
+/* ARGB8888 line buffers between the stages, and expanded CLUTs */
+static uint32_t FgLine[DMA2D_MAX_WIDTH];
+static uint32_t BgLine[DMA2D_MAX_WIDTH];
+static uint32_t FgClut[256];
+static uint32_t BgClut[256];
+/**
+  * @}
+  */
+
+/** @defgroup HOST_DMA2D_Private_FunctionPrototypes HOST DMA2D Private FunctionPrototypes
+  * @{
+  */
+static uint32_t DMA2D_InputBits(uint32_t ColorMode);
+static uint32_t DMA2D_OutputBytes(uint32_t ColorMode);
+static void     DMA2D_LoadCLUT(const DMA2D_LayerTypeDef *pLayer, uint32_t *pClut);
+static uint32_t DMA2D_ReadPixel(const DMA2D_LayerTypeDef *pLayer, const uint32_t *pClut, const uint8_t *pLine, uint32_t Xpos);
+static void     DMA2D_LoadLine(const DMA2D_LayerTypeDef *pLayer, const uint32_t *pClut, uint32_t Width, uint32_t Line, uint32_t *pOut);
+static void     DMA2D_LoadRGB888(const uint8_t *pSrc, uint32_t Width, uint32_t *pOut);
+static void     DMA2D_LoadRGB565(const uint8_t *pSrc, uint32_t Width, uint32_t *pOut);
+static void     DMA2D_LoadARGB4444(const uint8_t *pSrc, uint32_t Width, uint32_t *pOut);
+static void     DMA2D_LoadL8(const uint8_t *pSrc, uint32_t Width, const uint32_t *pClut, uint32_t *pOut);
+static void     DMA2D_ApplyAlpha(uint32_t *pLine, uint32_t Width, uint32_t AlphaMode, uint32_t Color);
+static void     DMA2D_BlendLine(const uint32_t *pFg, uint32_t *pBg, uint32_t Width);
+static uint32_t DMA2D_BlendPixel(uint32_t Fg, uint32_t Bg);
+static void     DMA2D_StoreLine(const uint32_t *pLine, uint32_t Width, uint8_t *pDst, uint32_t ColorMode);
+static uint32_t DMA2D_SdramBits(uint32_t Address, uint32_t Bits);
+static void     DMA2D_Count(uint32_t Width, uint32_t Height, uint32_t ReadBits, uint32_t SdramReadBits, uint32_t DstAddress, uint32_t DstColorMode);
+/**
+  * @}
+  */
+
+/** @defgroup HOST_DMA2D_Private_Functions HOST DMA2D Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Initializes the DMA2D command queue.
+  */
+void BSP_DMA2D_Init(void)
+{
+  Dma2dHead = 0;
+  Dma2dErrors = 0;
+}
+
+/**
+  * @brief  Does a register to memory fill.
+  * @param  DstAddress: address of the first pixel
+  * @param  DstOffset: pixels skipped at the end of each line
+  * @param  DstColorMode: output color mode, DMA2D_ARGB8888 ... DMA2D_ARGB4444
+  * @param  Width: rectangle width
+  * @param  Height: rectangle height
+  * @param  Color: fill color code ARGB(8-8-8-8)
+  * @retval Fence of the transfer
+  */
+DMA2D_FenceTypeDef BSP_DMA2D_Fill(uint32_t DstAddress, uint32_t DstOffset, uint32_t DstColorMode, uint32_t Width, uint32_t Height, uint32_t Color)
+{
+  uint32_t bpp = DMA2D_OutputBytes(DstColorMode);
+  uint8_t *dst = (uint8_t *)(uintptr_t)DstAddress;
+  uint32_t x, y;
+
+  if((Width == 0) || (Height == 0))
+  {
+    return Dma2dHead;
+  }
+  if(Width > DMA2D_MAX_WIDTH)
+  {
+    Dma2dErrors++;
+    return ++Dma2dHead;
+  }
+
+  /* Truncate the color as the output converter does, then repeat the first line */
+  for(x = 0; x < Width; x++)
+  {
+    FgLine[x] = Color;
+  }
+  DMA2D_StoreLine(FgLine, Width, dst, DstColorMode);
+  for(y = 1; y < Height; y++)
+  {
+    memcpy(dst + y * (Width + DstOffset) * bpp, dst, Width * bpp);
+  }
+
+  DMA2D_Count(Width, Height, 0, 0, DstAddress, DstColorMode);
+  return ++Dma2dHead;
+}
+
+/**
+  * @brief  Does a memory to memory copy without pixel format conversion.
+  * @param  SrcAddress: address of the first source pixel
+  * @param  SrcOffset: pixels skipped at the end of each source line
+  * @param  DstAddress: address of the first destination pixel
+  * @param  DstOffset: pixels skipped at the end of each destination line
+  * @param  ColorMode: color mode of both images, DMA2D_ARGB8888 ... DMA2D_ARGB4444
+  * @param  Width: rectangle width
+  * @param  Height: rectangle height
+  * @retval Fence of the transfer
+  */
+DMA2D_FenceTypeDef BSP_DMA2D_Copy(uint32_t SrcAddress, uint32_t SrcOffset, uint32_t DstAddress, uint32_t DstOffset, uint32_t ColorMode, uint32_t Width, uint32_t Height)
+{
+  uint32_t bpp = DMA2D_OutputBytes(ColorMode);
+  const uint8_t *src = (const uint8_t *)(uintptr_t)SrcAddress;
+  uint8_t *dst = (uint8_t *)(uintptr_t)DstAddress;
+  uint32_t y;
+
+  if((Width == 0) || (Height == 0))
+  {
+    return Dma2dHead;
+  }
+  if(Width > DMA2D_MAX_WIDTH)
+  {
+    Dma2dErrors++;
+    return ++Dma2dHead;
+  }
+
+  for(y = 0; y < Height; y++)
+  {
+    memmove(dst, src, Width * bpp);
+    src += (Width + SrcOffset) * bpp;
+    dst += (Width + DstOffset) * bpp;
+  }
+
+  DMA2D_Count(Width, Height, bpp * 8, DMA2D_SdramBits(SrcAddress, bpp * 8), DstAddress, ColorMode);
+  return ++Dma2dHead;
+}
+
+/**
+  * @brief  Does a memory to memory transfer with pixel format conversion.
+  * @param  pFg: source image
+  * @param  DstAddress: address of the first destination pixel
+  * @param  DstOffset: pixels skipped at the end of each destination line
+  * @param  DstColorMode: output color mode, DMA2D_ARGB8888 ... DMA2D_ARGB4444
+  * @param  Width: rectangle width
+  * @param  Height: rectangle height
+  * @retval Fence of the transfer
+  */
+DMA2D_FenceTypeDef BSP_DMA2D_Convert(const DMA2D_LayerTypeDef *pFg, uint32_t DstAddress, uint32_t DstOffset, uint32_t DstColorMode, uint32_t Width, uint32_t Height)
+{
+  uint32_t bpp = DMA2D_OutputBytes(DstColorMode);
+  uint8_t *dst = (uint8_t *)(uintptr_t)DstAddress;
+  uint32_t y;
+
+  if((Width == 0) || (Height == 0))
+  {
+    return Dma2dHead;
+  }
+  if(Width > DMA2D_MAX_WIDTH)
+  {
+    Dma2dErrors++;
+    return ++Dma2dHead;
+  }
+
+  DMA2D_LoadCLUT(pFg, FgClut);
+  for(y = 0; y < Height; y++)
+  {
+    DMA2D_LoadLine(pFg, FgClut, Width, y, FgLine);
+    DMA2D_StoreLine(FgLine, Width, dst, DstColorMode);
+    dst += (Width + DstOffset) * bpp;
+  }
+
+  DMA2D_Count(Width, Height, DMA2D_InputBits(pFg->ColorMode),
+              DMA2D_SdramBits(pFg->Address, DMA2D_InputBits(pFg->ColorMode)), DstAddress, DstColorMode);
+  return ++Dma2dHead;
+}
+
+/**
+  * @brief  Blends a foreground over a background image.
+  * @param  pFg: foreground image
+  * @param  pBg: background image, may be the destination itself
+  * @param  DstAddress: address of the first destination pixel
+  * @param  DstOffset: pixels skipped at the end of each destination line
+  * @param  DstColorMode: output color mode, DMA2D_ARGB8888 ... DMA2D_ARGB4444
+  * @param  Width: rectangle width
+  * @param  Height: rectangle height
+  * @retval Fence of the transfer
+  */
+DMA2D_FenceTypeDef BSP_DMA2D_Blend(const DMA2D_LayerTypeDef *pFg, const DMA2D_LayerTypeDef *pBg, uint32_t DstAddress, uint32_t DstOffset, uint32_t DstColorMode, uint32_t Width, uint32_t Height)
+{
+  uint32_t bpp = DMA2D_OutputBytes(DstColorMode);
+  uint8_t *dst = (uint8_t *)(uintptr_t)DstAddress;
+  uint32_t y;
+
+  if((Width == 0) || (Height == 0))
+  {
+    return Dma2dHead;
+  }
+  if(Width > DMA2D_MAX_WIDTH)
+  {
+    Dma2dErrors++;
+    return ++Dma2dHead;
+  }
+
+  DMA2D_LoadCLUT(pFg, FgClut);
+  DMA2D_LoadCLUT(pBg, BgClut);
+  for(y = 0; y < Height; y++)
+  {
+    /* Both lines are read before the write: the background may be the output */
+    DMA2D_LoadLine(pFg, FgClut, Width, y, FgLine);
+    DMA2D_LoadLine(pBg, BgClut, Width, y, BgLine);
+    DMA2D_BlendLine(FgLine, BgLine, Width);
+    DMA2D_StoreLine(BgLine, Width, dst, DstColorMode);
+    dst += (Width + DstOffset) * bpp;
+  }
+
+  DMA2D_Count(Width, Height, DMA2D_InputBits(pFg->ColorMode) + DMA2D_InputBits(pBg->ColorMode),
+              DMA2D_SdramBits(pFg->Address, DMA2D_InputBits(pFg->ColorMode)) +
+              DMA2D_SdramBits(pBg->Address, DMA2D_InputBits(pBg->ColorMode)), DstAddress, DstColorMode);
+  return ++Dma2dHead;
+}
+
+/**
+  * @brief  Gets the fence of the last queued transfer.
+  * @retval Fence
+  */
+DMA2D_FenceTypeDef BSP_DMA2D_GetLastFence(void)
+{
+  return Dma2dHead;
+}
+
+/**
+  * @brief  Checks if a fence has been reached.
+  * @param  Fence: fence returned by a submission function
+  * @retval 1, the transfers are done at submission
+  */
+uint8_t BSP_DMA2D_IsComplete(DMA2D_FenceTypeDef Fence)
+{
+  (void)Fence;
+  return 1;
+}
+
+/**
+  * @brief  Waits until a fence has been reached.
+  * @param  Fence: fence returned by a submission function
+  */
+void BSP_DMA2D_Wait(DMA2D_FenceTypeDef Fence)
+{
+  (void)Fence;
+}
+
+/**
+  * @brief  Checks if all the queued transfers are done.
+  * @retval 1, the queue is always empty
+  */
+uint8_t BSP_DMA2D_IsIdle(void)
+{
+  return 1;
+}
+
+/**
+  * @brief  Waits until all the queued transfers are done.
+  */
+void BSP_DMA2D_WaitIdle(void)
+{
+}
+
+/**
+  * @brief  Gets the number of transfers dropped on a DMA2D error.
+  * @retval Error count
+  */
+uint32_t BSP_DMA2D_GetErrorCount(void)
+{
+  return Dma2dErrors;
+}
+
+/**
+  * @brief  Forces the next indexed transfers to reload their CLUT.
+  * @note   The CLUT is read at each transfer, nothing to do.
+  */
+void BSP_DMA2D_InvalidateCLUT(void)
+{
+}
+
+/**
+  * @brief  Converts an ARGB8888 color to a pixel of the output color mode,
+  *         as expected by the OCOLR register in register to memory mode.
+  * @param  Color: color code ARGB(8-8-8-8)
+  * @param  ColorMode: output color mode
+  * @retval Encoded color
+  */
+uint32_t BSP_DMA2D_EncodeColor(uint32_t Color, uint32_t ColorMode)
+{
+  uint32_t alpha = (Color >> 24) & 0xFF;
+  uint32_t red   = (Color >> 16) & 0xFF;
+  uint32_t green = (Color >> 8) & 0xFF;
+  uint32_t blue  = Color & 0xFF;
+
+  switch(ColorMode)
+  {
+  case DMA2D_RGB888:
+    return Color & 0x00FFFFFF;
+
+  case DMA2D_RGB565:
+    return ((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3);
+
+  case DMA2D_ARGB1555:
+    return ((alpha >> 7) << 15) | ((red >> 3) << 10) | ((green >> 3) << 5) | (blue >> 3);
+
+  case DMA2D_ARGB4444:
+    return ((alpha >> 4) << 12) | ((red >> 4) << 8) | ((green >> 4) << 4) | (blue >> 4);
+
+  case DMA2D_ARGB8888:
+  default:
+    return Color;
+  }
+}
+
+/**
+  * @brief  Handles DMA2D interrupt request: nothing to do on the host.
+  */
+void BSP_DMA2D_IRQHandler(void)
+{
+}
+
+/**
+  * @brief  Gets the DMA2D counters.
+  * @param  pCounters: counters to fill in, BytesChanged and Nanoseconds are 0
+  */
+void HOST_DMA2D_GetCounters(HOST_LCD_CountersTypeDef *pCounters)
+{
+  *pCounters = Dma2dCounters;
+}
+
+/**
+  * @brief  Resets the DMA2D counters.
+  */
+void HOST_DMA2D_ResetCounters(void)
+{
+  memset(&Dma2dCounters, 0, sizeof(Dma2dCounters));
+}
+
+/**
+  * @brief  Gets the pixel size of an input color mode.
+  * @param  ColorMode: CM_ARGB8888 ... CM_A4
+  * @retval Bits per pixel
+  */
+static uint32_t DMA2D_InputBits(uint32_t ColorMode)
+{
+  switch(ColorMode)
+  {
+  case CM_ARGB8888:
+    return 32;
+  case CM_RGB888:
+    return 24;
+  case CM_RGB565:
+  case CM_ARGB1555:
+  case CM_ARGB4444:
+  case CM_AL88:
+    return 16;
+  case CM_L8:
+  case CM_AL44:
+  case CM_A8:
+    return 8;
+  default:
+    return 4;
+  }
+}
+
+/**
+  * @brief  Gets the pixel size of an output color mode.
+  * @param  ColorMode: DMA2D_ARGB8888 ... DMA2D_ARGB4444
+  * @retval Bytes per pixel
+  */
+static uint32_t DMA2D_OutputBytes(uint32_t ColorMode)
+{
+  switch(ColorMode)
+  {
+  case DMA2D_ARGB8888:
+    return 4;
+  case DMA2D_RGB888:
+    return 3;
+  default:
+    return 2;
+  }
+}
+
+/**
+  * @brief  Expands the CLUT of an indexed image to ARGB8888.
+  * @param  pLayer: source image
+  * @param  pClut: 256 entries
+  */
+static void DMA2D_LoadCLUT(const DMA2D_LayerTypeDef *pLayer, uint32_t *pClut)
+{
+  const uint8_t *p = (const uint8_t *)(uintptr_t)pLayer->CLUTAddress;
+  uint32_t i;
+
+  switch(pLayer->ColorMode)
+  {
+  case CM_L8:
+  case CM_AL44:
+  case CM_AL88:
+  case CM_L4:
+    break;
+  default:
+    return;
+  }
+
+  memset(pClut, 0, 256 * sizeof(uint32_t));
+  for(i = 0; (i < pLayer->CLUTSize) && (i < 256); i++)
+  {
+    if(pLayer->CLUTColorMode == 0)
+    {
+      pClut[i] = p[4 * i] | (p[4 * i + 1] << 8) | (p[4 * i + 2] << 16) | ((uint32_t)p[4 * i + 3] << 24);
+    }
+    else
+    {
+      pClut[i] = 0xFF000000 | p[3 * i] | (p[3 * i + 1] << 8) | (p[3 * i + 2] << 16);
+    }
+  }
+}
+
+/**
+  * @brief  Reads a pixel of a source line, converted to ARGB8888.
+  * @param  pLayer: source image
+  * @param  pClut: expanded CLUT of indexed images
+  * @param  pLine: first byte of the line
+  * @param  Xpos: pixel column
+  * @retval Color code ARGB(8-8-8-8)
+  */
+static uint32_t DMA2D_ReadPixel(const DMA2D_LayerTypeDef *pLayer, const uint32_t *pClut, const uint8_t *pLine, uint32_t Xpos)
+{
+  uint32_t bits = DMA2D_InputBits(pLayer->ColorMode);
+  const uint8_t *p = pLine + (Xpos * bits) / 8;
+  uint32_t nibble = ((Xpos * bits) & 4) ? (p[0] >> 4) : (p[0] & 0xF);
+  uint32_t a, r, g, b, v;
+
+  switch(pLayer->ColorMode)
+  {
+  case CM_ARGB8888:
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+  case CM_RGB888:
+    return 0xFF000000 | p[0] | (p[1] << 8) | (p[2] << 16);
+  case CM_RGB565:
+    v = p[0] | (p[1] << 8);
+    a = 0xFF;
+    r = (v >> 11) & 0x1F; r = (r << 3) | (r >> 2);
+    g = (v >> 5) & 0x3F;  g = (g << 2) | (g >> 4);
+    b = v & 0x1F;         b = (b << 3) | (b >> 2);
+    break;
+  case CM_ARGB1555:
+    v = p[0] | (p[1] << 8);
+    a = (v & 0x8000) ? 0xFF : 0;
+    r = (v >> 10) & 0x1F; r = (r << 3) | (r >> 2);
+    g = (v >> 5) & 0x1F;  g = (g << 3) | (g >> 2);
+    b = v & 0x1F;         b = (b << 3) | (b >> 2);
+    break;
+  case CM_ARGB4444:
+    v = p[0] | (p[1] << 8);
+    a = ((v >> 12) & 0xF) * 0x11;
+    r = ((v >> 8) & 0xF) * 0x11;
+    g = ((v >> 4) & 0xF) * 0x11;
+    b = (v & 0xF) * 0x11;
+    break;
+  case CM_A8:
+  case CM_A4:
+    return ((bits == 8) ? ((uint32_t)p[0] << 24) : ((nibble * 0x11) << 24)) | (pLayer->Color & 0x00FFFFFF);
+  case CM_L8:
+    return pClut[p[0]];
+  case CM_L4:
+    return pClut[nibble];
+  case CM_AL44:
+    /* The CLUT alpha is replaced by the pixel one */
+    return ((uint32_t)((p[0] >> 4) * 0x11) << 24) | (pClut[p[0] & 0xF] & 0x00FFFFFF);
+  default:
+    return ((uint32_t)p[1] << 24) | (pClut[p[0]] & 0x00FFFFFF);
+  }
+
+  return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+/**
+  * @brief  Foreground or background converter: reads a source line to
+  *         ARGB8888 and applies the alpha mode.
+  * @param  pLayer: source image
+  * @param  pClut: expanded CLUT of indexed images
+  * @param  Width: transfer width
+  * @param  Line: line of the transfer
+  * @param  pOut: Width ARGB8888 pixels
+  */
+static void DMA2D_LoadLine(const DMA2D_LayerTypeDef *pLayer, const uint32_t *pClut, uint32_t Width, uint32_t Line, uint32_t *pOut)
+{
+  uint32_t bits = DMA2D_InputBits(pLayer->ColorMode);
+  uint64_t start = (uint64_t)Line * (Width + pLayer->Offset) * bits;
+  const uint8_t *p = (const uint8_t *)(uintptr_t)pLayer->Address + start / 8;
+  uint32_t x;
+
+  switch(pLayer->ColorMode)
+  {
+  case CM_ARGB8888:
+    memcpy(pOut, p, Width * 4);
+    break;
+  case CM_RGB888:
+    DMA2D_LoadRGB888(p, Width, pOut);
+    break;
+  case CM_RGB565:
+    DMA2D_LoadRGB565(p, Width, pOut);
+    break;
+  case CM_ARGB4444:
+    DMA2D_LoadARGB4444(p, Width, pOut);
+    break;
+  case CM_L8:
+    DMA2D_LoadL8(p, Width, pClut, pOut);
+    break;
+  default:
+    /* A line of a 4-bit image may start on the high nibble */
+    for(x = 0; x < Width; x++)
+    {
+      pOut[x] = DMA2D_ReadPixel(pLayer, pClut, p, x + (uint32_t)(start & 4) / 4);
+    }
+    break;
+  }
+
+  DMA2D_ApplyAlpha(pOut, Width, pLayer->AlphaMode, pLayer->Color);
+}
+
+/**
+  * @brief  Converts RGB888 pixels to ARGB8888.
+  * @param  pSrc: source pixels
+  * @param  Width: number of pixels
+  * @param  pOut: ARGB8888 pixels
+  */
+static void DMA2D_LoadRGB888(const uint8_t *pSrc, uint32_t Width, uint32_t *pOut)
+{
+  uint32_t x = 0;
+
+#if defined(DMA2D_SSSE3)
+  const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+  const __m128i alpha = _mm_set1_epi32(0xFF000000);
+
+  /* 16 bytes are loaded for 4 pixels: stop before reading past the line */
+  for(; x + 6 <= Width; x += 4)
+  {
+    __m128i v = _mm_loadu_si128((const __m128i *)(pSrc + 3 * x));
+    _mm_storeu_si128((__m128i *)(pOut + x), _mm_or_si128(_mm_shuffle_epi8(v, shuffle), alpha));
+  }
+#endif
+
+  for(; x < Width; x++)
+  {
+    pOut[x] = 0xFF000000 | pSrc[3 * x] | (pSrc[3 * x + 1] << 8) | (pSrc[3 * x + 2] << 16);
+  }
+}
+
+/**
+  * @brief  Converts RGB565 pixels to ARGB8888.
+  * @param  pSrc: source pixels
+  * @param  Width: number of pixels
+  * @param  pOut: ARGB8888 pixels
+  */
+static void DMA2D_LoadRGB565(const uint8_t *pSrc, uint32_t Width, uint32_t *pOut)
+{
+  uint32_t x = 0, v, r, g, b;
+
+#if defined(DMA2D_SSE2)
+  const __m128i mask5 = _mm_set1_epi16(0x1F);
+  const __m128i mask6 = _mm_set1_epi16(0x3F);
+  const __m128i alpha = _mm_set1_epi16((short)0xFF00);
+
+  for(; x + 8 <= Width; x += 8)
+  {
+    __m128i px = _mm_loadu_si128((const __m128i *)(pSrc + 2 * x));
+    __m128i r5 = _mm_srli_epi16(px, 11);
+    __m128i g6 = _mm_and_si128(_mm_srli_epi16(px, 5), mask6);
+    __m128i b5 = _mm_and_si128(px, mask5);
+    __m128i r8 = _mm_or_si128(_mm_slli_epi16(r5, 3), _mm_srli_epi16(r5, 2));
+    __m128i g8 = _mm_or_si128(_mm_slli_epi16(g6, 2), _mm_srli_epi16(g6, 4));
+    __m128i b8 = _mm_or_si128(_mm_slli_epi16(b5, 3), _mm_srli_epi16(b5, 2));
+    __m128i gb = _mm_or_si128(_mm_slli_epi16(g8, 8), b8);
+    __m128i ar = _mm_or_si128(alpha, r8);
+    _mm_storeu_si128((__m128i *)(pOut + x), _mm_unpacklo_epi16(gb, ar));
+    _mm_storeu_si128((__m128i *)(pOut + x + 4), _mm_unpackhi_epi16(gb, ar));
+  }
+#endif
+
+  for(; x < Width; x++)
+  {
+    v = pSrc[2 * x] | (pSrc[2 * x + 1] << 8);
+    r = (v >> 11) & 0x1F; r = (r << 3) | (r >> 2);
+    g = (v >> 5) & 0x3F;  g = (g << 2) | (g >> 4);
+    b = v & 0x1F;         b = (b << 3) | (b >> 2);
+    pOut[x] = 0xFF000000 | (r << 16) | (g << 8) | b;
+  }
+}
+
+/**
+  * @brief  Converts ARGB4444 pixels to ARGB8888.
+  * @param  pSrc: source pixels
+  * @param  Width: number of pixels
+  * @param  pOut: ARGB8888 pixels
+  */
+static void DMA2D_LoadARGB4444(const uint8_t *pSrc, uint32_t Width, uint32_t *pOut)
+{
+  uint32_t x = 0, v;
+
+#if defined(DMA2D_SSE2)
+  const __m128i low = _mm_set1_epi16(0x0F0F);
+
+  for(; x + 8 <= Width; x += 8)
+  {
+    /* Split the nibbles in bytes (B,R in one vector, G,A in the other) and replicate them */
+    __m128i px = _mm_loadu_si128((const __m128i *)(pSrc + 2 * x));
+    __m128i br = _mm_and_si128(px, low);
+    __m128i ga = _mm_and_si128(_mm_srli_epi16(px, 4), low);
+    br = _mm_or_si128(br, _mm_slli_epi16(br, 4));
+    ga = _mm_or_si128(ga, _mm_slli_epi16(ga, 4));
+    _mm_storeu_si128((__m128i *)(pOut + x), _mm_unpacklo_epi8(br, ga));
+    _mm_storeu_si128((__m128i *)(pOut + x + 4), _mm_unpackhi_epi8(br, ga));
+  }
+#endif
+
+  for(; x < Width; x++)
+  {
+    v = pSrc[2 * x] | (pSrc[2 * x + 1] << 8);
+    pOut[x] = ((((v >> 12) & 0xF) * 0x11) << 24) | ((((v >> 8) & 0xF) * 0x11) << 16) |
+              ((((v >> 4) & 0xF) * 0x11) << 8) | ((v & 0xF) * 0x11);
+  }
+}
+
+/**
+  * @brief  Converts L8 pixels to ARGB8888.
+  * @param  pSrc: source pixels
+  * @param  Width: number of pixels
+  * @param  pClut: expanded CLUT
+  * @param  pOut: ARGB8888 pixels
+  */
+static void DMA2D_LoadL8(const uint8_t *pSrc, uint32_t Width, const uint32_t *pClut, uint32_t *pOut)
+{
+  uint32_t x = 0;
+
+#if defined(DMA2D_AVX2)
+  for(; x + 8 <= Width; x += 8)
+  {
+    __m256i index = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(pSrc + x)));
+    _mm256_storeu_si256((__m256i *)(pOut + x), _mm256_i32gather_epi32((const int *)pClut, index, 4));
+  }
+#endif
+
+  for(; x < Width; x++)
+  {
+    pOut[x] = pClut[pSrc[x]];
+  }
+}
+
+/**
+  * @brief  Applies an alpha mode to ARGB8888 pixels.
+  * @param  pLine: pixels
+  * @param  Width: number of pixels
+  * @param  AlphaMode: DMA2D_NO_MODIF_ALPHA, DMA2D_REPLACE_ALPHA or DMA2D_COMBINE_ALPHA
+  * @param  Color: constant alpha in bits 31:24
+  */
+static void DMA2D_ApplyAlpha(uint32_t *pLine, uint32_t Width, uint32_t AlphaMode, uint32_t Color)
+{
+  uint32_t alpha = Color >> 24;
+  uint32_t x = 0, a;
+
+  if(AlphaMode == DMA2D_REPLACE_ALPHA)
+  {
+    for(x = 0; x < Width; x++)
+    {
+      pLine[x] = (pLine[x] & 0x00FFFFFF) | (alpha << 24);
+    }
+  }
+  else if(AlphaMode == DMA2D_COMBINE_ALPHA)
+  {
+#if defined(DMA2D_SSE2)
+    const __m128i rgb = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i ca = _mm_set1_epi32(alpha);
+
+    for(; x + 4 <= Width; x += 4)
+    {
+      /* The product fits in the low 16 bits of each 32-bit lane */
+      __m128i px = _mm_loadu_si128((const __m128i *)(pLine + x));
+      __m128i m = _mm_mullo_epi16(_mm_srli_epi32(px, 24), ca);
+      m = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(m, one), _mm_srli_epi32(m, 8)), 8);
+      _mm_storeu_si128((__m128i *)(pLine + x), _mm_or_si128(_mm_and_si128(px, rgb), _mm_slli_epi32(m, 24)));
+    }
+#endif
+    for(; x < Width; x++)
+    {
+      a = ((pLine[x] >> 24) * alpha) / 255;
+      pLine[x] = (pLine[x] & 0x00FFFFFF) | (a << 24);
+    }
+  }
+}
+
+/**
+  * @brief  Blender: blends a foreground line over a background line.
+  * @param  pFg: foreground ARGB8888 pixels
+  * @param  pBg: background ARGB8888 pixels, replaced by the result
+  * @param  Width: number of pixels
+  */
+static void DMA2D_BlendLine(const uint32_t *pFg, uint32_t *pBg, uint32_t Width)
+{
+  uint32_t x = 0;
+
+#if defined(DMA2D_AVX2)
+  const __m256i one8  = _mm256_set1_epi32(1);
+  const __m256i byte8 = _mm256_set1_epi32(0xFF);
+  const __m256i zero8 = _mm256_setzero_si256();
+
+  for(; x + 8 <= Width; x += 8)
+  {
+    __m256i fg = _mm256_loadu_si256((const __m256i *)(pFg + x));
+    __m256i bg = _mm256_loadu_si256((const __m256i *)(pBg + x));
+    __m256i afg = _mm256_srli_epi32(fg, 24);
+    __m256i abg = _mm256_srli_epi32(bg, 24);
+    __m256i amult = _mm256_mullo_epi16(afg, abg);
+    __m256i aout, weights, out;
+    __m256 divisor;
+    int shift;
+
+    amult = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(amult, one8), _mm256_srli_epi32(amult, 8)), 8);
+    aout = _mm256_sub_epi32(_mm256_add_epi32(afg, abg), amult);
+    divisor = _mm256_cvtepi32_ps(aout);
+
+    /* Low 16 bits: foreground weight, high 16 bits: background weight */
+    weights = _mm256_or_si256(afg, _mm256_slli_epi32(_mm256_sub_epi32(abg, amult), 16));
+    out = _mm256_slli_epi32(aout, 24);
+    for(shift = 0; shift < 24; shift += 8)
+    {
+      __m256i c = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(fg, shift), byte8),
+                                  _mm256_slli_epi32(_mm256_and_si256(_mm256_srli_epi32(bg, shift), byte8), 16));
+      __m256i n = _mm256_madd_epi16(c, weights);
+      __m256i q = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(n), divisor));
+      out = _mm256_or_si256(out, _mm256_slli_epi32(q, shift));
+    }
+
+    _mm256_storeu_si256((__m256i *)(pBg + x), _mm256_andnot_si256(_mm256_cmpeq_epi32(aout, zero8), out));
+  }
+#endif
+
+#if defined(DMA2D_SSE2)
+  {
+    const __m128i one  = _mm_set1_epi32(1);
+    const __m128i byte = _mm_set1_epi32(0xFF);
+    const __m128i zero = _mm_setzero_si128();
+
+    for(; x + 4 <= Width; x += 4)
+    {
+      __m128i fg = _mm_loadu_si128((const __m128i *)(pFg + x));
+      __m128i bg = _mm_loadu_si128((const __m128i *)(pBg + x));
+      __m128i afg = _mm_srli_epi32(fg, 24);
+      __m128i abg = _mm_srli_epi32(bg, 24);
+      __m128i amult = _mm_mullo_epi16(afg, abg);
+      __m128i aout, weights, out;
+      __m128 divisor;
+      int shift;
+
+      amult = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(amult, one), _mm_srli_epi32(amult, 8)), 8);
+      aout = _mm_sub_epi32(_mm_add_epi32(afg, abg), amult);
+      divisor = _mm_cvtepi32_ps(aout);
+
+      weights = _mm_or_si128(afg, _mm_slli_epi32(_mm_sub_epi32(abg, amult), 16));
+      out = _mm_slli_epi32(aout, 24);
+      for(shift = 0; shift < 24; shift += 8)
+      {
+        __m128i c = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(fg, shift), byte),
+                                 _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(bg, shift), byte), 16));
+        __m128i n = _mm_madd_epi16(c, weights);
+        __m128i q = _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(n), divisor));
+        out = _mm_or_si128(out, _mm_slli_epi32(q, shift));
+      }
+
+      _mm_storeu_si128((__m128i *)(pBg + x), _mm_andnot_si128(_mm_cmpeq_epi32(aout, zero), out));
+    }
+  }
+#endif
+
+  for(; x < Width; x++)
+  {
+    pBg[x] = DMA2D_BlendPixel(pFg[x], pBg[x]);
+  }
+}
+
+/**
+  * @brief  Blends two ARGB8888 pixels.
+  * @param  Fg: foreground color
+  * @param  Bg: background color
+  * @retval Color code ARGB(8-8-8-8)
+  */
+static uint32_t DMA2D_BlendPixel(uint32_t Fg, uint32_t Bg)
+{
+  uint32_t afg = Fg >> 24, abg = Bg >> 24;
+  uint32_t amult = (afg * abg) / 255;
+  uint32_t aout = afg + abg - amult;
+  uint32_t color = 0, shift, cfg, cbg;
+
+  if(aout == 0)
+  {
+    return 0;
+  }
+
+  for(shift = 0; shift < 24; shift += 8)
+  {
+    cfg = (Fg >> shift) & 0xFF;
+    cbg = (Bg >> shift) & 0xFF;
+    color |= ((cfg * afg + cbg * abg - cbg * amult) / aout) << shift;
+  }
+
+  return (aout << 24) | color;
+}
+
+/**
+  * @brief  Output converter: writes ARGB8888 pixels in the output color mode.
+  * @param  pLine: ARGB8888 pixels
+  * @param  Width: number of pixels
+  * @param  pDst: first output pixel
+  * @param  ColorMode: output color mode
+  */
+static void DMA2D_StoreLine(const uint32_t *pLine, uint32_t Width, uint8_t *pDst, uint32_t ColorMode)
+{
+  uint32_t x = 0, v;
+
+  if(ColorMode == DMA2D_ARGB8888)
+  {
+    memcpy(pDst, pLine, Width * 4);
+    return;
+  }
+
+  if(ColorMode == DMA2D_RGB888)
+  {
+#if defined(DMA2D_SSSE3)
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+    /* 16 bytes are stored for 4 pixels: stop before writing past the line */
+    for(; x + 6 <= Width; x += 4)
+    {
+      __m128i px = _mm_loadu_si128((const __m128i *)(pLine + x));
+      _mm_storeu_si128((__m128i *)(pDst + 3 * x), _mm_shuffle_epi8(px, shuffle));
+    }
+#endif
+    for(; x < Width; x++)
+    {
+      pDst[3 * x]     = pLine[x];
+      pDst[3 * x + 1] = pLine[x] >> 8;
+      pDst[3 * x + 2] = pLine[x] >> 16;
+    }
+    return;
+  }
+
+#if defined(DMA2D_SSE2)
+  for(; x + 8 <= Width; x += 8)
+  {
+    __m128i px0 = _mm_loadu_si128((const __m128i *)(pLine + x));
+    __m128i px1 = _mm_loadu_si128((const __m128i *)(pLine + x + 4));
+    __m128i v0, v1;
+
+    if(ColorMode == DMA2D_RGB565)
+    {
+      v0 = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(px0, 8), _mm_set1_epi32(0xF800)),
+                                     _mm_and_si128(_mm_srli_epi32(px0, 5), _mm_set1_epi32(0x07E0))),
+                        _mm_and_si128(_mm_srli_epi32(px0, 3), _mm_set1_epi32(0x001F)));
+      v1 = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(px1, 8), _mm_set1_epi32(0xF800)),
+                                     _mm_and_si128(_mm_srli_epi32(px1, 5), _mm_set1_epi32(0x07E0))),
+                        _mm_and_si128(_mm_srli_epi32(px1, 3), _mm_set1_epi32(0x001F)));
+    }
+    else if(ColorMode == DMA2D_ARGB1555)
+    {
+      v0 = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(px0, 16), _mm_set1_epi32(0x8000)),
+                                     _mm_and_si128(_mm_srli_epi32(px0, 9), _mm_set1_epi32(0x7C00))),
+                        _mm_or_si128(_mm_and_si128(_mm_srli_epi32(px0, 6), _mm_set1_epi32(0x03E0)),
+                                     _mm_and_si128(_mm_srli_epi32(px0, 3), _mm_set1_epi32(0x001F))));
+      v1 = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(px1, 16), _mm_set1_epi32(0x8000)),
+                                     _mm_and_si128(_mm_srli_epi32(px1, 9), _mm_set1_epi32(0x7C00))),
+                        _mm_or_si128(_mm_and_si128(_mm_srli_epi32(px1, 6), _mm_set1_epi32(0x03E0)),
+                                     _mm_and_si128(_mm_srli_epi32(px1, 3), _mm_set1_epi32(0x001F))));
+    }
+    else
+    {
+      v0 = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(px0, 16), _mm_set1_epi32(0xF000)),
+                                     _mm_and_si128(_mm_srli_epi32(px0, 12), _mm_set1_epi32(0x0F00))),
+                        _mm_or_si128(_mm_and_si128(_mm_srli_epi32(px0, 8), _mm_set1_epi32(0x00F0)),
+                                     _mm_and_si128(_mm_srli_epi32(px0, 4), _mm_set1_epi32(0x000F))));
+      v1 = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(px1, 16), _mm_set1_epi32(0xF000)),
+                                     _mm_and_si128(_mm_srli_epi32(px1, 12), _mm_set1_epi32(0x0F00))),
+                        _mm_or_si128(_mm_and_si128(_mm_srli_epi32(px1, 8), _mm_set1_epi32(0x00F0)),
+                                     _mm_and_si128(_mm_srli_epi32(px1, 4), _mm_set1_epi32(0x000F))));
+    }
+
+    /* Sign extend the 16-bit results so that the saturating pack keeps them */
+    v0 = _mm_srai_epi32(_mm_slli_epi32(v0, 16), 16);
+    v1 = _mm_srai_epi32(_mm_slli_epi32(v1, 16), 16);
+    _mm_storeu_si128((__m128i *)(pDst + 2 * x), _mm_packs_epi32(v0, v1));
+  }
+#endif
+
+  for(; x < Width; x++)
+  {
+    v = BSP_DMA2D_EncodeColor(pLine[x], ColorMode);
+    pDst[2 * x]     = v;
+    pDst[2 * x + 1] = v >> 8;
+  }
+}
+
+/**
+  * @brief  Keeps the bits per pixel of an image that is in the SDRAM.
+  * @param  Address: image address
+  * @param  Bits: bits per pixel
+  * @retval Bits, or 0 for an image in internal memory
+  */
+static uint32_t DMA2D_SdramBits(uint32_t Address, uint32_t Bits)
+{
+  return ((Address >= SDRAM_DEVICE_ADDR) && (Address - SDRAM_DEVICE_ADDR < SDRAM_DEVICE_SIZE)) ? Bits : 0;
+}
+
+/**
+  * @brief  Accounts a transfer.
+  * @param  Width: transfer width
+  * @param  Height: transfer height
+  * @param  ReadBits: bits read per pixel
+  * @param  SdramReadBits: part of ReadBits read from the SDRAM
+  * @param  DstAddress: address of the first destination pixel
+  * @param  DstColorMode: output color mode
+  */
+static void DMA2D_Count(uint32_t Width, uint32_t Height, uint32_t ReadBits, uint32_t SdramReadBits, uint32_t DstAddress, uint32_t DstColorMode)
+{
+  uint64_t pixels = (uint64_t)Width * Height;
+
+  Dma2dCounters.Transfers++;
+  Dma2dCounters.PixelsWritten     += pixels;
+  Dma2dCounters.BytesRead         += (pixels * ReadBits + 7) / 8;
+  Dma2dCounters.BytesWritten      += pixels * DMA2D_OutputBytes(DstColorMode);
+  Dma2dCounters.SdramBytesRead    += (pixels * SdramReadBits + 7) / 8;
+  Dma2dCounters.SdramBytesWritten += (pixels * DMA2D_SdramBits(DstAddress, 8 * DMA2D_OutputBytes(DstColorMode))) / 8;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
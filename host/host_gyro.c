@@ -0,0 +1,922 @@
+/**
+  ******************************************************************************
+  * @file    host_gyro.c
+  * @brief   Host model of the L3GD20 gyroscope behind GYRO_IO_Read() and
+  *          GYRO_IO_Write(): register map, output data at the ODR on a
+  *          virtual clock, FIFO, INT1 thresholds and fault injection.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this driver:
+--------------------------
+   - Build l3gd20.c and the acquisition code with this file instead of the
+     GYRO_IO functions of stm32f429i_discovery.c, see host/README.md. The
+     driver and initializeGyro() then configure the model as the chip.
+   - HOST_GYRO_SetSource() gives the angular rate: HOST_GYRO_SineSource()
+     with a HOST_GYRO_SineTypeDef, HOST_GYRO_TraceSource() with a recording,
+     or any function of the time. Without a source the board lies still.
+   - Time only goes on when told: HOST_GYRO_SetTime(), or the clock given to
+     HOST_GYRO_SetClock(), read on each transfer. The samples due up to that
+     time are produced then, one per ODR period, none being skipped.
+   - HOST_GYRO_InjectFault() starts a fault for a duration of the virtual
+     clock. HOST_GYRO_GetStats() gives the transfers, their time on the bus
+     and the samples produced, lost or stalled.
+
+2. Driver description:
+---------------------
+   - WHO_AM_I, CTRL_REG1 to CTRL_REG5, REFERENCE, STATUS, OUT_X/Y/Z,
+     FIFO_CTRL, FIFO_SRC and the INT1 registers are modelled. OUT_TEMP
+     reads 0. The high-pass filter and block data update are not modelled:
+     CTRL_REG2, REFERENCE and the BDU bit are only kept.
+   - ODR 95, 190, 380 or 760 Hz from CTRL_REG1 DR, full scale and byte
+     order from CTRL_REG4. Samples are produced while PD is set and an axis
+     is enabled; a disabled axis reads 0. The first sample comes one period
+     after power up, without the turn-on time of the chip.
+   - FIFO, 32 samples, in the five FIFO_CTRL modes. Stream-to-FIFO and
+     bypass-to-stream switch on an INT1 event. The OUT registers then read
+     the oldest sample, taken out after OUT_Z_H, and multiple byte reads
+     wrap from OUT_Z_H to OUT_X_L. A full FIFO reads FSS 31 with OVRN set.
+   - INT1 compares the absolute value of each axis with its 15-bit
+     threshold, with AND/OR combination, latching and the duration and
+     WAIT of INT1_DURATION, counted in samples. The INT1 and INT2 pins
+     follow CTRL_REG3; HOST_GYRO_PinCallback() is called on each change.
+
+------------------------------------------------------------------------------*/
+
+/* Includes ------------------------------------------------------------------*/
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32f429i_discovery.h"
+#include "host_gyro.h"
+
+/** @addtogroup HOST
+  * @{
+  */
+
+/** @defgroup HOST_GYRO HOST GYRO
+  * @{
+  */
+
+/** @defgroup HOST_GYRO_Private_Defines HOST GYRO Private Defines
+  * @{
+  */
+#define GYRO_REGISTERS        0x40
+#define GYRO_FIFO_SIZE        32
+
+#define CTRL_REG1_PD          0x08
+#define CTRL_REG1_AXES        0x07
+#define CTRL_REG3_I1_INT1     0x80
+#define CTRL_REG3_H_LACTIVE   0x20
+#define CTRL_REG3_I2_DRDY     0x08
+#define CTRL_REG3_I2_WTM      0x04
+#define CTRL_REG3_I2_ORUN     0x02
+#define CTRL_REG3_I2_EMPTY    0x01
+#define CTRL_REG4_BLE         0x40
+#define CTRL_REG4_FS          0x30
+#define CTRL_REG5_BOOT        0x80
+#define CTRL_REG5_FIFO_EN     0x40
+
+#define STATUS_ZYXOR          0x80
+#define STATUS_ZYXDA          0x08
+#define STATUS_AXES_DA        0x07
+
+#define FIFO_CTRL_WTM         0x1F
+#define FIFO_MODE_BYPASS      0
+#define FIFO_MODE_FIFO        1
+#define FIFO_MODE_STREAM      2
+#define FIFO_MODE_STREAM_FIFO 3
+#define FIFO_MODE_BYPASS_STREAM 4
+#define FIFO_SRC_WTM          0x80
+#define FIFO_SRC_OVRN         0x40
+#define FIFO_SRC_EMPTY        0x20
+
+#define INT1_CFG_AND          0x80
+#define INT1_CFG_LIR          0x40
+#define INT1_CFG_EVENTS       0x3F
+#define INT1_SRC_IA           0x40
+#define INT1_DURATION_WAIT    0x80
+#define INT1_DURATION_D       0x7F
+/**
+  * @}
+  */
+
+/** @defgroup HOST_GYRO_Private_Variables HOST GYRO Private Variables
+  * @{
+  */
+static const float GyroOdr[4] = { 95.0f, 190.0f, 380.0f, 760.0f };
+
+/* Power-on values: CTRL_REG1 has the axes enabled, powered down */
+static uint8_t  GyroRegs[GYRO_REGISTERS] = { [L3GD20_CTRL_REG1_ADDR] = CTRL_REG1_AXES };
+static uint8_t  GyroStatus = 0;
+static int16_t  GyroOut[3];
+static int16_t  GyroFifo[GYRO_FIFO_SIZE][3];
+static uint32_t GyroFifoFirst = 0;
+static uint32_t GyroFifoLevel = 0;
+static uint8_t  GyroFifoStopped = 0;
+static uint8_t  GyroTriggered = 0;
+
+static uint8_t  GyroInt1Active = 0;
+static uint8_t  GyroInt1Src = 0;
+static uint32_t GyroInt1Count = 0;
+static uint32_t GyroInt1Off = 0;
+static uint8_t  GyroPins[2] = { 0, 0 };
+
+static uint8_t  GyroRunning = 0;
+static double   GyroPeriod = 0;
+static uint64_t GyroStart = 0;
+static uint64_t GyroIndex = 0;
+static uint64_t GyroNow = 0;
+static int32_t  GyroPpm = 0;
+static int16_t  GyroBias[3] = { 0, 0, 0 };
+
+static uint64_t GyroStallUntil = 0;
+static uint64_t GyroStuckUntil = 0;
+static uint64_t GyroBusUntil = 0;
+static uint64_t GyroBurstUntil = 0;
+
+static HOST_GYRO_SourceTypeDef GyroSource = NULL;
+static void *GyroContext = NULL;
+static uint64_t (*GyroClock)(void) = NULL;
+static HOST_GYRO_StatsTypeDef GyroStats;
+/**
+  * @}
+  */
+
+/** @defgroup HOST_GYRO_Private_FunctionPrototypes HOST GYRO Private FunctionPrototypes
+  * @{
+  */
+static void     GYRO_Sync(void);
+static void     GYRO_Run(void);
+static void     GYRO_Configure(void);
+static void     GYRO_Produce(uint64_t Time);
+static void     GYRO_Store(const int16_t *pSample);
+static void     GYRO_Interrupt(const int16_t *pSample);
+static void     GYRO_UpdatePins(void);
+static uint8_t  GYRO_FifoMode(void);
+static uint8_t  GYRO_FifoSource(void);
+static uint8_t  GYRO_ReadRegister(uint8_t Address);
+static void     GYRO_WriteRegister(uint8_t Address, uint8_t Value);
+static uint8_t  GYRO_NextAddress(uint8_t Address);
+static void     GYRO_Account(uint16_t Bytes, uint8_t Read);
+/**
+  * @}
+  */
+
+/** @defgroup HOST_GYRO_Private_Functions HOST GYRO Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Powers the model up again: registers, FIFO, time, faults and
+  *         counters. The source, clock, bias and rate error are kept.
+  */
+void HOST_GYRO_Reset(void)
+{
+  memset(GyroRegs, 0, sizeof(GyroRegs));
+  GyroRegs[L3GD20_CTRL_REG1_ADDR] = CTRL_REG1_AXES;
+  GyroStatus = 0;
+  memset(GyroOut, 0, sizeof(GyroOut));
+  GyroFifoFirst = 0;
+  GyroFifoLevel = 0;
+  GyroFifoStopped = 0;
+  GyroTriggered = 0;
+  GyroInt1Active = 0;
+  GyroInt1Src = 0;
+  GyroInt1Count = 0;
+  GyroInt1Off = 0;
+  GyroPins[0] = 0;
+  GyroPins[1] = 0;
+  GyroRunning = 0;
+  GyroNow = 0;
+  GyroStallUntil = 0;
+  GyroStuckUntil = 0;
+  GyroBusUntil = 0;
+  GyroBurstUntil = 0;
+  memset(&GyroStats, 0, sizeof(GyroStats));
+  GYRO_Configure();
+}
+
+/**
+  * @brief  Sets the signal source.
+  * @param  pSource: NULL for a board lying still
+  * @param  pContext: given to pSource
+  */
+void HOST_GYRO_SetSource(HOST_GYRO_SourceTypeDef pSource, void *pContext)
+{
+  GyroSource = pSource;
+  GyroContext = pContext;
+}
+
+/**
+  * @brief  Sine source, the axes a third of a period apart.
+  * @param  pContext: HOST_GYRO_SineTypeDef
+  */
+uint8_t HOST_GYRO_SineSource(void *pContext, uint64_t Time, float *pDps)
+{
+  HOST_GYRO_SineTypeDef *pSine = (HOST_GYRO_SineTypeDef *)pContext;
+  double phase = 2.0 * M_PI * pSine->Frequency * (Time * 1e-9);
+  uint32_t axis;
+
+  for(axis = 0; axis < 3; axis++)
+  {
+    pDps[axis] = pSine->Offset[axis] + pSine->Amplitude[axis] * (float)sin(phase + axis * (2.0 * M_PI / 3.0));
+    if(pSine->Noise > 0)
+    {
+      /* xorshift32 */
+      pSine->Seed ^= pSine->Seed << 13;
+      pSine->Seed ^= pSine->Seed >> 17;
+      pSine->Seed ^= pSine->Seed << 5;
+      pDps[axis] += pSine->Noise * ((float)pSine->Seed / 2147483648.0f - 1.0f);
+    }
+  }
+  return 1;
+}
+
+/**
+  * @brief  Recorded source, the sample of the recording at each time.
+  * @param  pContext: HOST_GYRO_TraceTypeDef
+  * @retval 0 past the end of a recording that does not loop
+  */
+uint8_t HOST_GYRO_TraceSource(void *pContext, uint64_t Time, float *pDps)
+{
+  const HOST_GYRO_TraceTypeDef *pTrace = (const HOST_GYRO_TraceTypeDef *)pContext;
+  uint64_t index = (uint64_t)(Time * 1e-9 * pTrace->RateHz);
+  uint32_t axis;
+
+  if(pTrace->Count == 0)
+  {
+    return 0;
+  }
+  if(index >= pTrace->Count)
+  {
+    if(!pTrace->Loop)
+    {
+      return 0;
+    }
+    index %= pTrace->Count;
+  }
+  for(axis = 0; axis < 3; axis++)
+  {
+    pDps[axis] = pTrace->pSamples[3 * index + axis] * pTrace->Sensitivity;
+  }
+  return 1;
+}
+
+/**
+  * @brief  Sets the zero-rate level of each axis.
+  * @param  pBias: X, Y, Z, in LSB of the output
+  */
+void HOST_GYRO_SetBias(const int16_t *pBias)
+{
+  memcpy(GyroBias, pBias, sizeof(GyroBias));
+}
+
+/**
+  * @brief  Sets the error of the ODR of the chip, up to 10 % on the L3GD20.
+  * @param  Ppm: parts per million, positive for a slower rate
+  */
+void HOST_GYRO_SetRateError(int32_t Ppm)
+{
+  GYRO_Sync();
+  GyroPpm = Ppm;
+  GYRO_Configure();
+}
+
+/**
+  * @brief  Sets the clock read on each transfer.
+  * @param  pNow: virtual time in nanoseconds, NULL to use HOST_GYRO_SetTime()
+  */
+void HOST_GYRO_SetClock(uint64_t (*pNow)(void))
+{
+  GyroClock = pNow;
+  GYRO_Sync();
+}
+
+/**
+  * @brief  Moves the virtual time on, producing the samples due.
+  * @param  Nanoseconds: ignored if before the current time
+  */
+void HOST_GYRO_SetTime(uint64_t Nanoseconds)
+{
+  if(Nanoseconds > GyroNow)
+  {
+    GyroNow = Nanoseconds;
+  }
+  GYRO_Run();
+}
+
+/**
+  * @brief  Gets the virtual time.
+  * @retval Nanoseconds
+  */
+uint64_t HOST_GYRO_GetTime(void)
+{
+  GYRO_Sync();
+  return GyroNow;
+}
+
+/**
+  * @brief  Starts a fault, from the current time.
+  * @param  Fault: HOST_GYRO_FAULT_STALL, HOST_GYRO_FAULT_STUCK,
+  *         HOST_GYRO_FAULT_BUS or HOST_GYRO_FAULT_OVERRUN, which produces
+  *         at once the samples of the next Duration, as a reader stalled
+  *         that long would find them
+  * @param  Duration: nanoseconds
+  */
+void HOST_GYRO_InjectFault(uint8_t Fault, uint64_t Duration)
+{
+  GYRO_Sync();
+  switch(Fault)
+  {
+  case HOST_GYRO_FAULT_STALL:
+    GyroStallUntil = GyroNow + Duration;
+    break;
+  case HOST_GYRO_FAULT_STUCK:
+    GyroStuckUntil = GyroNow + Duration;
+    break;
+  case HOST_GYRO_FAULT_BUS:
+    GyroBusUntil = GyroNow + Duration;
+    break;
+  case HOST_GYRO_FAULT_OVERRUN:
+    GyroBurstUntil = GyroNow + Duration;
+    GYRO_Run();
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+  * @brief  Gets the level of an interrupt pin.
+  * @param  IntPin: L3GD20_INT1 or L3GD20_INT2
+  * @retval 1 high, 0 low
+  */
+uint8_t HOST_GYRO_GetPin(uint8_t IntPin)
+{
+  GYRO_Sync();
+  return GyroPins[IntPin & 0x01];
+}
+
+/**
+  * @brief  An interrupt pin changed, as the time went on or on a transfer.
+  * @param  IntPin: L3GD20_INT1 or L3GD20_INT2
+  * @param  State: 1 high, 0 low
+  */
+__weak void HOST_GYRO_PinCallback(uint8_t IntPin, uint8_t State)
+{
+  (void)IntPin;
+  (void)State;
+}
+
+/**
+  * @brief  Gets the model counters.
+  */
+void HOST_GYRO_GetStats(HOST_GYRO_StatsTypeDef *pStats)
+{
+  GYRO_Sync();
+  *pStats = GyroStats;
+}
+
+/**
+  * @brief  Clears the model counters.
+  */
+void HOST_GYRO_ResetStats(void)
+{
+  memset(&GyroStats, 0, sizeof(GyroStats));
+}
+
+/**
+  * @brief  Nothing to configure: the chip select and the pins are the model.
+  */
+void GYRO_IO_Init(void)
+{
+  GYRO_Sync();
+}
+
+void GYRO_IO_DeInit(void)
+{
+}
+
+/**
+  * @brief  Writes registers of the model.
+  * @param  pBuffer: Pointer to the buffer containing the data to be written to the Gyroscope.
+  * @param  WriteAddr: Gyroscope's internal address to write to.
+  * @param  NumByteToWrite: Number of bytes to write, GYRO_IO_MAX_SIZE at most.
+  */
+void GYRO_IO_Write(uint8_t* pBuffer, uint8_t WriteAddr, uint16_t NumByteToWrite)
+{
+  uint16_t i;
+
+  if(NumByteToWrite > GYRO_IO_MAX_SIZE)
+  {
+    NumByteToWrite = GYRO_IO_MAX_SIZE;
+  }
+  GYRO_Sync();
+  GYRO_Account(NumByteToWrite, 0);
+  if(GyroNow < GyroBusUntil)
+  {
+    GyroStats.BusErrors++;
+    return;
+  }
+
+  WriteAddr &= (GYRO_REGISTERS - 1);
+  for(i = 0; i < NumByteToWrite; i++)
+  {
+    GYRO_WriteRegister(WriteAddr, pBuffer[i]);
+    WriteAddr = GYRO_NextAddress(WriteAddr);
+  }
+  GYRO_UpdatePins();
+}
+
+/**
+  * @brief  Reads registers of the model.
+  * @param  pBuffer: Pointer to the buffer that receives the data read from the Gyroscope.
+  * @param  ReadAddr: Gyroscope's internal address to read from.
+  * @param  NumByteToRead: Number of bytes to read from the Gyroscope, GYRO_IO_MAX_SIZE at most.
+  */
+void GYRO_IO_Read(uint8_t* pBuffer, uint8_t ReadAddr, uint16_t NumByteToRead)
+{
+  uint16_t i;
+
+  if(NumByteToRead > GYRO_IO_MAX_SIZE)
+  {
+    NumByteToRead = GYRO_IO_MAX_SIZE;
+  }
+  GYRO_Sync();
+  GYRO_Account(NumByteToRead, 1);
+  if(GyroNow < GyroBusUntil)
+  {
+    /* MISO pulled high */
+    memset(pBuffer, 0xFF, NumByteToRead);
+    GyroStats.BusErrors++;
+    return;
+  }
+
+  ReadAddr &= (GYRO_REGISTERS - 1);
+  for(i = 0; i < NumByteToRead; i++)
+  {
+    pBuffer[i] = GYRO_ReadRegister(ReadAddr);
+    ReadAddr = GYRO_NextAddress(ReadAddr);
+  }
+  GYRO_UpdatePins();
+}
+
+/**
+  * @brief  Catches up with the clock, if any.
+  */
+static void GYRO_Sync(void)
+{
+  uint64_t now;
+
+  if(GyroClock != NULL)
+  {
+    now = GyroClock();
+    if(now > GyroNow)
+    {
+      GyroNow = now;
+    }
+  }
+  GYRO_Run();
+}
+
+/**
+  * @brief  Produces the samples due, up to the current time or the end of an
+  *         overrun fault.
+  */
+static void GYRO_Run(void)
+{
+  uint64_t limit = (GyroBurstUntil > GyroNow) ? GyroBurstUntil : GyroNow;
+  uint64_t due;
+
+  while(GyroRunning)
+  {
+    due = GyroStart + (uint64_t)((GyroIndex + 1) * GyroPeriod);
+    if(due > limit)
+    {
+      break;
+    }
+    GYRO_Produce(due);
+    GyroIndex++;
+  }
+  GYRO_UpdatePins();
+}
+
+/**
+  * @brief  Takes CTRL_REG1 and the rate error into account. The period
+  *         counts from the last sample, or from power up.
+  */
+static void GYRO_Configure(void)
+{
+  uint8_t ctrl1 = GyroRegs[L3GD20_CTRL_REG1_ADDR];
+  uint8_t running = ((ctrl1 & CTRL_REG1_PD) != 0) && ((ctrl1 & CTRL_REG1_AXES) != 0);
+  double period = 1e9 / GyroOdr[ctrl1 >> 6] * (1.0 + GyroPpm * 1e-6);
+
+  if(running && !GyroRunning)
+  {
+    GyroStart = GyroNow;
+    GyroIndex = 0;
+  }
+  else if(running && (period != GyroPeriod))
+  {
+    GyroStart += (uint64_t)(GyroIndex * GyroPeriod);
+    GyroIndex = 0;
+  }
+  GyroRunning = running;
+  GyroPeriod = period;
+}
+
+/**
+  * @brief  Output data of one period.
+  * @param  Time: when it is due
+  */
+static void GYRO_Produce(uint64_t Time)
+{
+  static const uint8_t enable[3] = { L3GD20_X_ENABLE, L3GD20_Y_ENABLE, L3GD20_Z_ENABLE };
+  static const float sensitivity[4] =
+  {
+    L3GD20_SENSITIVITY_250DPS, L3GD20_SENSITIVITY_500DPS, L3GD20_SENSITIVITY_2000DPS, L3GD20_SENSITIVITY_2000DPS
+  };
+  float dps[3] = { 0.0f, 0.0f, 0.0f };
+  float lsb;
+  int16_t sample[3];
+  uint32_t axis;
+
+  GyroStats.Samples++;
+  if(Time < GyroStallUntil)
+  {
+    GyroStats.Stalled++;
+    return;
+  }
+
+  if(Time < GyroStuckUntil)
+  {
+    memcpy(sample, GyroOut, sizeof(sample));
+  }
+  else
+  {
+    if((GyroSource != NULL) && !GyroSource(GyroContext, Time, dps))
+    {
+      return;
+    }
+    for(axis = 0; axis < 3; axis++)
+    {
+      if((GyroRegs[L3GD20_CTRL_REG1_ADDR] & enable[axis]) == 0)
+      {
+        sample[axis] = 0;
+        continue;
+      }
+      /* Sensitivities are in mdps per LSB */
+      lsb = dps[axis] * 1000.0f / sensitivity[(GyroRegs[L3GD20_CTRL_REG4_ADDR] & CTRL_REG4_FS) >> 4] + GyroBias[axis];
+      lsb = (lsb > 32767.0f) ? 32767.0f : ((lsb < -32768.0f) ? -32768.0f : lsb);
+      sample[axis] = (int16_t)lrintf(lsb);
+    }
+  }
+
+  memcpy(GyroOut, sample, sizeof(GyroOut));
+  if(GyroStatus & STATUS_ZYXDA)
+  {
+    GyroStatus |= STATUS_ZYXOR | ((GyroStatus & STATUS_AXES_DA) << 4);
+  }
+  GyroStatus |= STATUS_ZYXDA | STATUS_AXES_DA;
+
+  GYRO_Interrupt(sample);
+  GYRO_Store(sample);
+}
+
+/**
+  * @brief  Puts a sample in the FIFO, as its mode says.
+  */
+static void GYRO_Store(const int16_t *pSample)
+{
+  switch(GYRO_FifoMode())
+  {
+  case FIFO_MODE_FIFO:
+    if(GyroFifoLevel == GYRO_FIFO_SIZE)
+    {
+      GyroFifoStopped = 1;
+    }
+    if(GyroFifoStopped)
+    {
+      GyroStats.Lost++;
+      return;
+    }
+    break;
+  case FIFO_MODE_STREAM:
+    if(GyroFifoLevel == GYRO_FIFO_SIZE)
+    {
+      /* The oldest sample is overwritten */
+      GyroFifoFirst = (GyroFifoFirst + 1) % GYRO_FIFO_SIZE;
+      GyroFifoLevel--;
+      GyroStats.Lost++;
+    }
+    break;
+  default:
+    return;
+  }
+  memcpy(GyroFifo[(GyroFifoFirst + GyroFifoLevel) % GYRO_FIFO_SIZE], pSample, sizeof(GyroFifo[0]));
+  GyroFifoLevel++;
+}
+
+/**
+  * @brief  INT1 threshold events on a new sample.
+  */
+static void GYRO_Interrupt(const int16_t *pSample)
+{
+  uint8_t cfg = GyroRegs[L3GD20_INT1_CFG_ADDR];
+  uint8_t enabled = cfg & INT1_CFG_EVENTS;
+  uint8_t duration = GyroRegs[L3GD20_INT1_DURATION_ADDR] & INT1_DURATION_D;
+  uint8_t events = 0, active;
+  uint32_t axis, threshold, magnitude;
+
+  if(enabled == 0)
+  {
+    return;
+  }
+  for(axis = 0; axis < 3; axis++)
+  {
+    threshold = ((uint32_t)(GyroRegs[L3GD20_INT1_TSH_XH_ADDR + 2 * axis] & 0x7F) << 8) |
+                GyroRegs[L3GD20_INT1_TSH_XL_ADDR + 2 * axis];
+    magnitude = (uint32_t)abs(pSample[axis]);
+    if(magnitude > threshold)
+    {
+      events |= (uint8_t)(0x02 << (2 * axis));
+    }
+    else if(magnitude < threshold)
+    {
+      events |= (uint8_t)(0x01 << (2 * axis));
+    }
+  }
+  events &= enabled;
+  active = (cfg & INT1_CFG_AND) ? (events == enabled) : (events != 0);
+
+  if(active)
+  {
+    GyroInt1Off = 0;
+    if(GyroInt1Count < duration)
+    {
+      GyroInt1Count++;
+    }
+    if(!GyroInt1Active && (GyroInt1Count >= duration))
+    {
+      GyroInt1Active = 1;
+      GyroInt1Src = INT1_SRC_IA | events;
+      GyroTriggered = 1;
+      GyroStats.Int1Events++;
+    }
+    else if(GyroInt1Active && !(cfg & INT1_CFG_LIR))
+    {
+      GyroInt1Src = INT1_SRC_IA | events;
+    }
+    return;
+  }
+
+  GyroInt1Count = 0;
+  if(!GyroInt1Active)
+  {
+    GyroInt1Src = events;
+    return;
+  }
+  if(cfg & INT1_CFG_LIR)
+  {
+    /* Kept until INT1_SRC is read */
+    return;
+  }
+  if((GyroRegs[L3GD20_INT1_DURATION_ADDR] & INT1_DURATION_WAIT) && (++GyroInt1Off < duration))
+  {
+    return;
+  }
+  GyroInt1Active = 0;
+  GyroInt1Off = 0;
+  GyroInt1Src = events;
+}
+
+/**
+  * @brief  Sets the INT1 and INT2 pins from CTRL_REG3, calling
+  *         HOST_GYRO_PinCallback() on each change.
+  */
+static void GYRO_UpdatePins(void)
+{
+  uint8_t ctrl3 = GyroRegs[L3GD20_CTRL_REG3_ADDR];
+  uint8_t source = GYRO_FifoSource();
+  uint8_t pins[2], i;
+
+  pins[L3GD20_INT1] = (ctrl3 & CTRL_REG3_I1_INT1) && GyroInt1Active;
+  pins[L3GD20_INT2] = ((ctrl3 & CTRL_REG3_I2_DRDY) && (GyroStatus & STATUS_ZYXDA)) ||
+                      ((ctrl3 & CTRL_REG3_I2_WTM) && (source & FIFO_SRC_WTM)) ||
+                      ((ctrl3 & CTRL_REG3_I2_ORUN) && (source & FIFO_SRC_OVRN)) ||
+                      ((ctrl3 & CTRL_REG3_I2_EMPTY) && (source & FIFO_SRC_EMPTY));
+  for(i = 0; i < 2; i++)
+  {
+    if(ctrl3 & CTRL_REG3_H_LACTIVE)
+    {
+      pins[i] = !pins[i];
+    }
+    if(pins[i] != GyroPins[i])
+    {
+      GyroPins[i] = pins[i];
+      HOST_GYRO_PinCallback(i, pins[i]);
+    }
+  }
+}
+
+/**
+  * @brief  FIFO mode in effect, the trigger taken into account.
+  * @retval FIFO_MODE_BYPASS, FIFO_MODE_FIFO or FIFO_MODE_STREAM
+  */
+static uint8_t GYRO_FifoMode(void)
+{
+  if((GyroRegs[L3GD20_CTRL_REG5_ADDR] & CTRL_REG5_FIFO_EN) == 0)
+  {
+    return FIFO_MODE_BYPASS;
+  }
+  switch(GyroRegs[L3GD20_FIFO_CTRL_REG_ADDR] >> 5)
+  {
+  case FIFO_MODE_FIFO:
+    return FIFO_MODE_FIFO;
+  case FIFO_MODE_STREAM:
+    return FIFO_MODE_STREAM;
+  case FIFO_MODE_STREAM_FIFO:
+    return GyroTriggered ? FIFO_MODE_FIFO : FIFO_MODE_STREAM;
+  case FIFO_MODE_BYPASS_STREAM:
+    return GyroTriggered ? FIFO_MODE_STREAM : FIFO_MODE_BYPASS;
+  default:
+    return FIFO_MODE_BYPASS;
+  }
+}
+
+/**
+  * @brief  FIFO_SRC value.
+  */
+static uint8_t GYRO_FifoSource(void)
+{
+  uint8_t source = (GyroFifoLevel == GYRO_FIFO_SIZE) ? (FIFO_SRC_OVRN | 0x1F) : (uint8_t)GyroFifoLevel;
+
+  if(GyroFifoLevel >= (GyroRegs[L3GD20_FIFO_CTRL_REG_ADDR] & FIFO_CTRL_WTM))
+  {
+    source |= FIFO_SRC_WTM;
+  }
+  if(GyroFifoLevel == 0)
+  {
+    source |= FIFO_SRC_EMPTY;
+  }
+  return source;
+}
+
+/**
+  * @brief  Reads a register, with the side effects of the chip.
+  */
+static uint8_t GYRO_ReadRegister(uint8_t Address)
+{
+  const int16_t *sample;
+  uint32_t axis;
+  uint8_t value, high;
+
+  switch(Address)
+  {
+  case L3GD20_WHO_AM_I_ADDR:
+    return I_AM_L3GD20;
+  case L3GD20_OUT_TEMP_ADDR:
+    return 0;
+  case L3GD20_STATUS_REG_ADDR:
+    return GyroStatus;
+  case L3GD20_FIFO_SRC_REG_ADDR:
+    return GYRO_FifoSource();
+  case L3GD20_INT1_SRC_ADDR:
+    value = GyroInt1Src;
+    if((GyroRegs[L3GD20_INT1_CFG_ADDR] & INT1_CFG_LIR) && GyroInt1Active)
+    {
+      GyroInt1Active = 0;
+      GyroInt1Count = 0;
+      GyroInt1Src = 0;
+    }
+    return value;
+  case L3GD20_OUT_X_L_ADDR:
+  case L3GD20_OUT_X_H_ADDR:
+  case L3GD20_OUT_Y_L_ADDR:
+  case L3GD20_OUT_Y_H_ADDR:
+  case L3GD20_OUT_Z_L_ADDR:
+  case L3GD20_OUT_Z_H_ADDR:
+    axis = (Address - L3GD20_OUT_X_L_ADDR) / 2;
+    high = Address & 0x01;
+    if(GyroRegs[L3GD20_CTRL_REG4_ADDR] & CTRL_REG4_BLE)
+    {
+      high = !high;
+    }
+    sample = ((GYRO_FifoMode() != FIFO_MODE_BYPASS) && (GyroFifoLevel > 0)) ? GyroFifo[GyroFifoFirst] : GyroOut;
+    value = high ? (uint8_t)((uint16_t)sample[axis] >> 8) : (uint8_t)sample[axis];
+
+    /* The second byte of an axis ends its read */
+    if(Address & 0x01)
+    {
+      GyroStatus &= (uint8_t)~((0x01 | 0x10) << axis);
+      if((GyroStatus & STATUS_AXES_DA) == 0)
+      {
+        GyroStatus = 0;
+      }
+    }
+    if((Address == L3GD20_OUT_Z_H_ADDR) && (sample != GyroOut))
+    {
+      GyroFifoFirst = (GyroFifoFirst + 1) % GYRO_FIFO_SIZE;
+      GyroFifoLevel--;
+    }
+    return value;
+  default:
+    return GyroRegs[Address];
+  }
+}
+
+/**
+  * @brief  Writes a register, read-only ones being left as they are.
+  */
+static void GYRO_WriteRegister(uint8_t Address, uint8_t Value)
+{
+  switch(Address)
+  {
+  case L3GD20_WHO_AM_I_ADDR:
+  case L3GD20_OUT_TEMP_ADDR:
+  case L3GD20_STATUS_REG_ADDR:
+  case L3GD20_OUT_X_L_ADDR:
+  case L3GD20_OUT_X_H_ADDR:
+  case L3GD20_OUT_Y_L_ADDR:
+  case L3GD20_OUT_Y_H_ADDR:
+  case L3GD20_OUT_Z_L_ADDR:
+  case L3GD20_OUT_Z_H_ADDR:
+  case L3GD20_FIFO_SRC_REG_ADDR:
+  case L3GD20_INT1_SRC_ADDR:
+    break;
+  case L3GD20_CTRL_REG1_ADDR:
+    GyroRegs[Address] = Value;
+    GYRO_Configure();
+    break;
+  case L3GD20_CTRL_REG5_ADDR:
+    /* BOOT reloads the trimming values and clears itself */
+    GyroRegs[Address] = Value & (uint8_t)~CTRL_REG5_BOOT;
+    if((Value & CTRL_REG5_FIFO_EN) == 0)
+    {
+      GyroFifoLevel = 0;
+    }
+    break;
+  case L3GD20_FIFO_CTRL_REG_ADDR:
+    GyroRegs[Address] = Value;
+    GyroFifoStopped = 0;
+    GyroTriggered = 0;
+    if(GYRO_FifoMode() == FIFO_MODE_BYPASS)
+    {
+      GyroFifoLevel = 0;
+    }
+    break;
+  default:
+    if(Address >= L3GD20_WHO_AM_I_ADDR)
+    {
+      GyroRegs[Address] = Value;
+    }
+    break;
+  }
+}
+
+/**
+  * @brief  Next address of a multiple byte transfer: with the FIFO enabled
+  *         it wraps from OUT_Z_H back to OUT_X_L.
+  */
+static uint8_t GYRO_NextAddress(uint8_t Address)
+{
+  if((Address == L3GD20_OUT_Z_H_ADDR) && (GyroRegs[L3GD20_CTRL_REG5_ADDR] & CTRL_REG5_FIFO_EN))
+  {
+    return L3GD20_OUT_X_L_ADDR;
+  }
+  return (Address + 1) & (GYRO_REGISTERS - 1);
+}
+
+/**
+  * @brief  Counts a transfer and its time on the bus.
+  * @param  Bytes: register bytes, the address byte is added
+  */
+static void GYRO_Account(uint16_t Bytes, uint8_t Read)
+{
+  GyroStats.Transfers++;
+  if(Read)
+  {
+    GyroStats.BytesRead += Bytes;
+  }
+  else
+  {
+    GyroStats.BytesWritten += Bytes;
+  }
+  GyroStats.BusNanoseconds += (uint64_t)(1 + Bytes) * 8 * 1000000000ULL / HOST_GYRO_SPI_HZ;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
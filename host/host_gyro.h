@@ -0,0 +1,132 @@
+/**
+  ******************************************************************************
+  * @file    host_gyro.h
+  * @brief   This file contains the functions prototypes of the host L3GD20
+  *          model: signal sources, virtual clock and fault injection.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __HOST_GYRO_H
+#define __HOST_GYRO_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "l3gd20.h"
+
+/** @addtogroup HOST
+  * @{
+  */
+
+/** @addtogroup HOST_GYRO
+  * @{
+  */
+
+/** @defgroup HOST_GYRO_Exported_Types HOST GYRO Exported Types
+  * @{
+  */
+
+/**
+  * @brief  Signal source: the angular rate at a time of the virtual clock.
+  *         Returns 0 when there is no more signal: no sample is produced.
+  */
+typedef uint8_t (*HOST_GYRO_SourceTypeDef)(void *pContext, uint64_t Time, float *pDps);
+
+/**
+  * @brief  Context of HOST_GYRO_SineSource()
+  */
+typedef struct
+{
+  float    Amplitude[3];   /*!< Peak angular rate of X, Y, Z, dps                       */
+  float    Offset[3];      /*!< Constant angular rate added, dps                        */
+  float    Frequency;      /*!< Hz, a tremor is 3 to 12 Hz                              */
+  float    Noise;          /*!< Peak of a uniform noise added to each axis, dps         */
+  uint32_t Seed;           /*!< Noise generator state, not 0                            */
+}HOST_GYRO_SineTypeDef;
+
+/**
+  * @brief  Context of HOST_GYRO_TraceSource(): a recording, played from time 0
+  */
+typedef struct
+{
+  const int16_t *pSamples; /*!< X, Y, Z triples                                         */
+  uint32_t Count;          /*!< Number of triples                                       */
+  float    RateHz;         /*!< Rate of the recording                                   */
+  float    Sensitivity;    /*!< dps per LSB of the recording                            */
+  uint8_t  Loop;           /*!< 1 to start again at the end                             */
+}HOST_GYRO_TraceTypeDef;
+
+/**
+  * @brief  Model counters, since HOST_GYRO_Reset() or HOST_GYRO_ResetStats()
+  */
+typedef struct
+{
+  uint32_t Transfers;      /*!< GYRO_IO_Read() and GYRO_IO_Write() calls                */
+  uint64_t BytesRead;      /*!< Register bytes read                                     */
+  uint64_t BytesWritten;   /*!< Register bytes written                                  */
+  uint64_t BusNanoseconds; /*!< Time the transfers take on SPI5, address bytes included */
+  uint32_t Samples;        /*!< Output data periods, at the ODR                         */
+  uint32_t Lost;           /*!< Samples overwritten or not stored, the FIFO being full  */
+  uint32_t Stalled;        /*!< Samples not produced, HOST_GYRO_FAULT_STALL             */
+  uint32_t BusErrors;      /*!< Transfers failed, HOST_GYRO_FAULT_BUS                   */
+  uint32_t Int1Events;     /*!< INT1_SRC IA rising edges                                */
+}HOST_GYRO_StatsTypeDef;
+
+/**
+  * @}
+  */
+
+/** @defgroup HOST_GYRO_Exported_Constants HOST GYRO Exported Constants
+  * @{
+  */
+#define HOST_GYRO_SPI_HZ          5625000   /* SPI5, APB2 90 MHz divided by 16 */
+
+/* Faults, for HOST_GYRO_InjectFault() */
+#define HOST_GYRO_FAULT_STALL     ((uint8_t)0x01)  /* No sample produced              */
+#define HOST_GYRO_FAULT_STUCK     ((uint8_t)0x02)  /* Samples repeat the last output  */
+#define HOST_GYRO_FAULT_BUS       ((uint8_t)0x03)  /* Reads give 0xFF, writes lost    */
+#define HOST_GYRO_FAULT_OVERRUN   ((uint8_t)0x04)  /* Samples of the period at once   */
+/**
+  * @}
+  */
+
+/** @defgroup HOST_GYRO_Exported_Functions HOST GYRO Exported Functions
+  * @{
+  */
+void     HOST_GYRO_Reset(void);
+void     HOST_GYRO_SetSource(HOST_GYRO_SourceTypeDef pSource, void *pContext);
+uint8_t  HOST_GYRO_SineSource(void *pContext, uint64_t Time, float *pDps);
+uint8_t  HOST_GYRO_TraceSource(void *pContext, uint64_t Time, float *pDps);
+void     HOST_GYRO_SetBias(const int16_t *pBias);
+void     HOST_GYRO_SetRateError(int32_t Ppm);
+
+void     HOST_GYRO_SetClock(uint64_t (*pNow)(void));
+void     HOST_GYRO_SetTime(uint64_t Nanoseconds);
+uint64_t HOST_GYRO_GetTime(void);
+
+void     HOST_GYRO_InjectFault(uint8_t Fault, uint64_t Duration);
+uint8_t  HOST_GYRO_GetPin(uint8_t IntPin);
+void     HOST_GYRO_PinCallback(uint8_t IntPin, uint8_t State);
+
+void     HOST_GYRO_GetStats(HOST_GYRO_StatsTypeDef *pStats);
+void     HOST_GYRO_ResetStats(void);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HOST_GYRO_H */
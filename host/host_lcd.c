@@ -0,0 +1,613 @@
+/**
+  ******************************************************************************
+  * @file    host_lcd.c
+  * @brief   Host LCD backend: emulation of the LTDC HAL functions, frame
+  *          dumps for golden image comparisons and draw call counters.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this driver:
+--------------------------
+   - Build the BSP LCD drivers with host_board.c, host_dma2d.c and this file
+     instead of the mbed HAL, see host/README.md. BSP_LCD_Init() and the
+     LCD_DISCO_F429ZI class are then used as on the target.
+   - HOST_LCD_WriteFramePPM() saves what the panel would show, the layers
+     blended by the LTDC. HOST_LCD_WriteLayerPPM() saves one frame buffer.
+   - HOST_LCD_CompareFramePPM() counts the pixels that differ from a golden
+     image saved before.
+   - Surround draw calls with HOST_LCD_BeginMeasure() and
+     HOST_LCD_EndMeasure() to get their time, DMA2D traffic and the number
+     of SDRAM bytes they changed.
+
+2. Driver description:
+---------------------
+   - The LTDC shadow registers are modelled: the layer configuration set by
+     the _NoReload functions and __HAL_LTDC_LAYER_ENABLE() is only used after
+     HAL_LTDC_Relaod(). Both reload types apply at once, a frame dump being
+     the next vertical blanking.
+   - The CLUT is not modelled: L8, AL44 and AL88 layers show as gray levels.
+   - Dithering is not modelled.
+
+------------------------------------------------------------------------------*/
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "host_lcd.h"
+
+/** @addtogroup HOST
+  * @{
+  */
+
+/** @defgroup HOST_LCD HOST LCD
+  * @{
+  */
+
+/** @defgroup HOST_LCD_Private_TypesDefinitions HOST LCD Private TypesDefinitions
+  * @{
+  */
+typedef struct
+{
+  LTDC_LayerCfgTypeDef Cfg;
+  uint8_t  Enabled;
+  uint8_t  KeyingEnabled;
+  uint32_t KeyColor;
+}HOST_LTDC_LayerTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup HOST_LCD_Private_Variables HOST LCD Private Variables
+  * @{
+  */
+static LTDC_HandleTypeDef *LtdcHandle = NULL;
+static HOST_LTDC_LayerTypeDef LtdcShadow[MAX_LAYER_NUMBER];
+static HOST_LTDC_LayerTypeDef LtdcActive[MAX_LAYER_NUMBER];
+
+static uint8_t *SdramSnapshot = NULL;
+static struct timespec MeasureStart;
+/**
+  * @}
+  */
+
+/** @defgroup HOST_LCD_Private_FunctionPrototypes HOST LCD Private FunctionPrototypes
+  * @{
+  */
+static void     LTDC_Reload(void);
+static uint32_t LTDC_ReadPixel(uint32_t PixelFormat, const uint8_t *p);
+static uint32_t LTDC_PixelBytes(uint32_t PixelFormat);
+static uint32_t LTDC_GetWidth(void);
+static uint32_t LTDC_GetHeight(void);
+static uint8_t  WritePPM(const char *pPath, const uint32_t *pPixels, uint32_t Width, uint32_t Height);
+/**
+  * @}
+  */
+
+/** @defgroup HOST_LCD_Private_Functions HOST LCD Private Functions
+  * @{
+  */
+
+HAL_StatusTypeDef HAL_LTDC_Init(LTDC_HandleTypeDef *hltdc)
+{
+  LtdcHandle = hltdc;
+  memset(LtdcShadow, 0, sizeof(LtdcShadow));
+  memset(LtdcActive, 0, sizeof(LtdcActive));
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_ConfigLayer(LTDC_HandleTypeDef *hltdc, LTDC_LayerCfgTypeDef *pLayerCfg, uint32_t LayerIdx)
+{
+  /* The HAL enables the layer as well */
+  hltdc->LayerCfg[LayerIdx] = *pLayerCfg;
+  LtdcShadow[LayerIdx].Enabled = 1;
+  return HAL_LTDC_Relaod(hltdc, LTDC_SRCR_IMR);
+}
+
+HAL_StatusTypeDef HAL_LTDC_SetWindowSize_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t XSize, uint32_t YSize, uint32_t LayerIdx)
+{
+  LTDC_LayerCfgTypeDef *pLayerCfg = &hltdc->LayerCfg[LayerIdx];
+
+  /* The image width is also the line pitch, as in the HAL */
+  pLayerCfg->WindowX1    = XSize + pLayerCfg->WindowX0;
+  pLayerCfg->WindowY1    = YSize + pLayerCfg->WindowY0;
+  pLayerCfg->ImageWidth  = XSize;
+  pLayerCfg->ImageHeight = YSize;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_SetWindowPosition_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t X0, uint32_t Y0, uint32_t LayerIdx)
+{
+  LTDC_LayerCfgTypeDef *pLayerCfg = &hltdc->LayerCfg[LayerIdx];
+
+  pLayerCfg->WindowX0 = X0;
+  pLayerCfg->WindowX1 = X0 + pLayerCfg->ImageWidth;
+  pLayerCfg->WindowY0 = Y0;
+  pLayerCfg->WindowY1 = Y0 + pLayerCfg->ImageHeight;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_SetAlpha_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t Alpha, uint32_t LayerIdx)
+{
+  hltdc->LayerCfg[LayerIdx].Alpha = Alpha;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_SetAddress_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t Address, uint32_t LayerIdx)
+{
+  hltdc->LayerCfg[LayerIdx].FBStartAdress = Address;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_ConfigColorKeying_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t RGBValue, uint32_t LayerIdx)
+{
+  (void)hltdc;
+  LtdcShadow[LayerIdx].KeyColor = RGBValue & 0x00FFFFFF;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_EnableColorKeying_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx)
+{
+  (void)hltdc;
+  LtdcShadow[LayerIdx].KeyingEnabled = 1;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_DisableColorKeying_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx)
+{
+  (void)hltdc;
+  LtdcShadow[LayerIdx].KeyingEnabled = 0;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_SetWindowSize(LTDC_HandleTypeDef *hltdc, uint32_t XSize, uint32_t YSize, uint32_t LayerIdx)
+{
+  HAL_LTDC_SetWindowSize_NoReload(hltdc, XSize, YSize, LayerIdx);
+  return HAL_LTDC_Relaod(hltdc, LTDC_SRCR_IMR);
+}
+
+HAL_StatusTypeDef HAL_LTDC_SetWindowPosition(LTDC_HandleTypeDef *hltdc, uint32_t X0, uint32_t Y0, uint32_t LayerIdx)
+{
+  HAL_LTDC_SetWindowPosition_NoReload(hltdc, X0, Y0, LayerIdx);
+  return HAL_LTDC_Relaod(hltdc, LTDC_SRCR_IMR);
+}
+
+HAL_StatusTypeDef HAL_LTDC_SetAlpha(LTDC_HandleTypeDef *hltdc, uint32_t Alpha, uint32_t LayerIdx)
+{
+  HAL_LTDC_SetAlpha_NoReload(hltdc, Alpha, LayerIdx);
+  return HAL_LTDC_Relaod(hltdc, LTDC_SRCR_IMR);
+}
+
+HAL_StatusTypeDef HAL_LTDC_SetAddress(LTDC_HandleTypeDef *hltdc, uint32_t Address, uint32_t LayerIdx)
+{
+  HAL_LTDC_SetAddress_NoReload(hltdc, Address, LayerIdx);
+  return HAL_LTDC_Relaod(hltdc, LTDC_SRCR_IMR);
+}
+
+HAL_StatusTypeDef HAL_LTDC_ConfigColorKeying(LTDC_HandleTypeDef *hltdc, uint32_t RGBValue, uint32_t LayerIdx)
+{
+  HAL_LTDC_ConfigColorKeying_NoReload(hltdc, RGBValue, LayerIdx);
+  return HAL_LTDC_Relaod(hltdc, LTDC_SRCR_IMR);
+}
+
+HAL_StatusTypeDef HAL_LTDC_EnableColorKeying(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx)
+{
+  HAL_LTDC_EnableColorKeying_NoReload(hltdc, LayerIdx);
+  return HAL_LTDC_Relaod(hltdc, LTDC_SRCR_IMR);
+}
+
+HAL_StatusTypeDef HAL_LTDC_DisableColorKeying(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx)
+{
+  HAL_LTDC_DisableColorKeying_NoReload(hltdc, LayerIdx);
+  return HAL_LTDC_Relaod(hltdc, LTDC_SRCR_IMR);
+}
+
+HAL_StatusTypeDef HAL_LTDC_EnableDither(LTDC_HandleTypeDef *hltdc)
+{
+  (void)hltdc;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_LTDC_Relaod(LTDC_HandleTypeDef *hltdc, uint32_t ReloadType)
+{
+  (void)ReloadType;
+  LtdcHandle = hltdc;
+  LTDC_Reload();
+  return HAL_OK;
+}
+
+void HOST_LTDC_SetLayerEnable(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx, uint8_t Enable)
+{
+  (void)hltdc;
+  LtdcShadow[LayerIdx].Enabled = Enable;
+}
+
+/**
+  * @brief  Gets the frame the panel would show.
+  * @param  pFrame: BSP_LCD_GetXSize() * BSP_LCD_GetYSize() ARGB8888 pixels
+  * @retval LCD_ERROR if the LTDC is not initialized
+  */
+uint8_t HOST_LCD_GetFrame(uint32_t *pFrame)
+{
+  const HOST_LTDC_LayerTypeDef *pLayer;
+  const uint8_t *line;
+  uint32_t width, height, x, y, layer, pixel, alpha, color, shift;
+
+  if(LtdcHandle == NULL)
+  {
+    return LCD_ERROR;
+  }
+  width  = LTDC_GetWidth();
+  height = LTDC_GetHeight();
+
+  for(y = 0; y < height; y++)
+  {
+    for(x = 0; x < width; x++)
+    {
+      color = 0xFF000000 | (LtdcHandle->Init.Backcolor.Red << 16) | (LtdcHandle->Init.Backcolor.Green << 8) | LtdcHandle->Init.Backcolor.Blue;
+
+      for(layer = 0; layer < MAX_LAYER_NUMBER; layer++)
+      {
+        pLayer = &LtdcActive[layer];
+        if(!pLayer->Enabled ||
+           (x < pLayer->Cfg.WindowX0) || (x >= pLayer->Cfg.WindowX1) ||
+           (y < pLayer->Cfg.WindowY0) || (y >= pLayer->Cfg.WindowY1))
+        {
+          continue;
+        }
+
+        line  = (const uint8_t *)(uintptr_t)pLayer->Cfg.FBStartAdress +
+                (y - pLayer->Cfg.WindowY0) * pLayer->Cfg.ImageWidth * LTDC_PixelBytes(pLayer->Cfg.PixelFormat);
+        pixel = LTDC_ReadPixel(pLayer->Cfg.PixelFormat, line + (x - pLayer->Cfg.WindowX0) * LTDC_PixelBytes(pLayer->Cfg.PixelFormat));
+
+        /* Color keyed pixels are transparent */
+        if(pLayer->KeyingEnabled && ((pixel & 0x00FFFFFF) == pLayer->KeyColor))
+        {
+          continue;
+        }
+
+        alpha = pLayer->Cfg.Alpha;
+        if(pLayer->Cfg.BlendingFactor1 == LTDC_BLENDING_FACTOR1_PAxCA)
+        {
+          alpha = ((pixel >> 24) * alpha) / 255;
+        }
+
+        for(shift = 0; shift < 24; shift += 8)
+        {
+          color = (color & ~(0xFFUL << shift)) |
+                  (((((pixel >> shift) & 0xFF) * alpha + ((color >> shift) & 0xFF) * (255 - alpha)) / 255) << shift);
+        }
+      }
+
+      pFrame[y * width + x] = color;
+    }
+  }
+
+  return LCD_OK;
+}
+
+/**
+  * @brief  Saves the frame the panel would show as a binary PPM file.
+  * @param  pPath: file name
+  * @retval LCD_ERROR if the LTDC is not initialized or the file can't be written
+  */
+uint8_t HOST_LCD_WriteFramePPM(const char *pPath)
+{
+  uint32_t *frame;
+  uint8_t ret = LCD_ERROR;
+
+  if(LtdcHandle == NULL)
+  {
+    return LCD_ERROR;
+  }
+
+  frame = malloc(LTDC_GetWidth() * LTDC_GetHeight() * sizeof(uint32_t));
+  if(frame != NULL)
+  {
+    HOST_LCD_GetFrame(frame);
+    ret = WritePPM(pPath, frame, LTDC_GetWidth(), LTDC_GetHeight());
+    free(frame);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Saves a layer frame buffer as a binary PPM file, alpha ignored.
+  * @param  LayerIndex: layer index
+  * @param  pPath: file name
+  * @retval LCD_ERROR if the layer is not configured or the file can't be written
+  */
+uint8_t HOST_LCD_WriteLayerPPM(uint32_t LayerIndex, const char *pPath)
+{
+  const LTDC_LayerCfgTypeDef *pCfg;
+  const uint8_t *p;
+  uint32_t *pixels;
+  uint32_t i, count;
+  uint8_t ret = LCD_ERROR;
+
+  if((LtdcHandle == NULL) || (LayerIndex >= MAX_LAYER_NUMBER))
+  {
+    return LCD_ERROR;
+  }
+  pCfg  = &LtdcActive[LayerIndex].Cfg;
+  count = pCfg->ImageWidth * pCfg->ImageHeight;
+  if(count == 0)
+  {
+    return LCD_ERROR;
+  }
+
+  pixels = malloc(count * sizeof(uint32_t));
+  if(pixels != NULL)
+  {
+    p = (const uint8_t *)(uintptr_t)pCfg->FBStartAdress;
+    for(i = 0; i < count; i++)
+    {
+      pixels[i] = LTDC_ReadPixel(pCfg->PixelFormat, p + i * LTDC_PixelBytes(pCfg->PixelFormat));
+    }
+    ret = WritePPM(pPath, pixels, pCfg->ImageWidth, pCfg->ImageHeight);
+    free(pixels);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Compares the frame the panel would show with a PPM file.
+  * @param  pPath: golden image, written by HOST_LCD_WriteFramePPM()
+  * @retval Number of pixels that differ, -1 if the file can't be read or
+  *         has not the size of the panel
+  */
+int32_t HOST_LCD_CompareFramePPM(const char *pPath)
+{
+  FILE *f;
+  uint32_t *frame;
+  uint8_t rgb[3];
+  unsigned width, height, maxval;
+  uint32_t i;
+  int32_t diff = -1;
+
+  if(LtdcHandle == NULL)
+  {
+    return -1;
+  }
+
+  f = fopen(pPath, "rb");
+  if(f == NULL)
+  {
+    return -1;
+  }
+
+  frame = malloc(LTDC_GetWidth() * LTDC_GetHeight() * sizeof(uint32_t));
+  if((frame != NULL) &&
+     (fscanf(f, "P6 %u %u %u", &width, &height, &maxval) == 3) && (fgetc(f) != EOF) &&
+     (width == LTDC_GetWidth()) && (height == LTDC_GetHeight()) && (maxval == 255))
+  {
+    HOST_LCD_GetFrame(frame);
+    for(diff = 0, i = 0; i < width * height; i++)
+    {
+      if(fread(rgb, 3, 1, f) != 1)
+      {
+        diff = -1;
+        break;
+      }
+      if((frame[i] & 0x00FFFFFF) != (((uint32_t)rgb[0] << 16) | (rgb[1] << 8) | rgb[2]))
+      {
+        diff++;
+      }
+    }
+  }
+
+  free(frame);
+  fclose(f);
+  return diff;
+}
+
+/**
+  * @brief  Starts measuring draw calls: resets the counters and takes a copy
+  *         of the SDRAM, outside of the measured time.
+  */
+void HOST_LCD_BeginMeasure(void)
+{
+  if(SdramSnapshot == NULL)
+  {
+    SdramSnapshot = malloc(SDRAM_DEVICE_SIZE);
+  }
+  if(SdramSnapshot != NULL)
+  {
+    memcpy(SdramSnapshot, (const void *)(uintptr_t)SDRAM_DEVICE_ADDR, SDRAM_DEVICE_SIZE);
+  }
+
+  HOST_DMA2D_ResetCounters();
+  clock_gettime(CLOCK_MONOTONIC, &MeasureStart);
+}
+
+/**
+  * @brief  Ends measuring draw calls.
+  * @param  pCounters: cost of the calls since HOST_LCD_BeginMeasure()
+  */
+void HOST_LCD_EndMeasure(HOST_LCD_CountersTypeDef *pCounters)
+{
+  struct timespec end;
+  const uint64_t *now, *before;
+  uint64_t changed;
+  uint32_t i, byte;
+
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  HOST_DMA2D_GetCounters(pCounters);
+  pCounters->Nanoseconds = (uint64_t)(end.tv_sec - MeasureStart.tv_sec) * 1000000000ULL + end.tv_nsec - MeasureStart.tv_nsec;
+  pCounters->BytesChanged = 0;
+
+  if(SdramSnapshot != NULL)
+  {
+    now    = (const uint64_t *)(uintptr_t)SDRAM_DEVICE_ADDR;
+    before = (const uint64_t *)SdramSnapshot;
+    for(i = 0; i < SDRAM_DEVICE_SIZE / 8; i++)
+    {
+      changed = now[i] ^ before[i];
+      for(byte = 0; changed != 0; byte++, changed >>= 8)
+      {
+        pCounters->BytesChanged += ((changed & 0xFF) != 0);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Applies the shadow layer configuration.
+  */
+static void LTDC_Reload(void)
+{
+  uint32_t layer;
+
+  for(layer = 0; layer < MAX_LAYER_NUMBER; layer++)
+  {
+    LtdcShadow[layer].Cfg = LtdcHandle->LayerCfg[layer];
+    LtdcActive[layer] = LtdcShadow[layer];
+  }
+}
+
+/**
+  * @brief  Reads a frame buffer pixel.
+  * @param  PixelFormat: layer pixel format
+  * @param  p: pixel address
+  * @retval Color code ARGB(8-8-8-8)
+  */
+static uint32_t LTDC_ReadPixel(uint32_t PixelFormat, const uint8_t *p)
+{
+  uint32_t v, a, r, g, b;
+
+  switch(PixelFormat)
+  {
+  case LTDC_PIXEL_FORMAT_ARGB8888:
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+  case LTDC_PIXEL_FORMAT_RGB888:
+    return 0xFF000000 | p[0] | (p[1] << 8) | (p[2] << 16);
+  case LTDC_PIXEL_FORMAT_RGB565:
+    v = p[0] | (p[1] << 8);
+    a = 0xFF;
+    r = (v >> 11) & 0x1F; r = (r << 3) | (r >> 2);
+    g = (v >> 5) & 0x3F;  g = (g << 2) | (g >> 4);
+    b = v & 0x1F;         b = (b << 3) | (b >> 2);
+    break;
+  case LTDC_PIXEL_FORMAT_ARGB1555:
+    v = p[0] | (p[1] << 8);
+    a = (v & 0x8000) ? 0xFF : 0;
+    r = (v >> 10) & 0x1F; r = (r << 3) | (r >> 2);
+    g = (v >> 5) & 0x1F;  g = (g << 3) | (g >> 2);
+    b = v & 0x1F;         b = (b << 3) | (b >> 2);
+    break;
+  case LTDC_PIXEL_FORMAT_ARGB4444:
+    v = p[0] | (p[1] << 8);
+    a = ((v >> 12) & 0xF) * 0x11;
+    r = ((v >> 8) & 0xF) * 0x11;
+    g = ((v >> 4) & 0xF) * 0x11;
+    b = (v & 0xF) * 0x11;
+    break;
+  case LTDC_PIXEL_FORMAT_AL44:
+    a = (p[0] >> 4) * 0x11;
+    r = g = b = (p[0] & 0xF) * 0x11;
+    break;
+  case LTDC_PIXEL_FORMAT_AL88:
+    a = p[1];
+    r = g = b = p[0];
+    break;
+  default:
+    a = 0xFF;
+    r = g = b = p[0];
+    break;
+  }
+
+  return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+/**
+  * @brief  Gets the pixel size of a layer pixel format.
+  * @param  PixelFormat: layer pixel format
+  * @retval Bytes per pixel
+  */
+static uint32_t LTDC_PixelBytes(uint32_t PixelFormat)
+{
+  switch(PixelFormat)
+  {
+  case LTDC_PIXEL_FORMAT_ARGB8888:
+    return 4;
+  case LTDC_PIXEL_FORMAT_RGB888:
+    return 3;
+  case LTDC_PIXEL_FORMAT_L8:
+  case LTDC_PIXEL_FORMAT_AL44:
+    return 1;
+  default:
+    return 2;
+  }
+}
+
+/**
+  * @brief  Gets the active width configured by HAL_LTDC_Init().
+  * @retval Width in pixels
+  */
+static uint32_t LTDC_GetWidth(void)
+{
+  return LtdcHandle->Init.AccumulatedActiveW - LtdcHandle->Init.AccumulatedHBP;
+}
+
+/**
+  * @brief  Gets the active height configured by HAL_LTDC_Init().
+  * @retval Height in pixels
+  */
+static uint32_t LTDC_GetHeight(void)
+{
+  return LtdcHandle->Init.AccumulatedActiveH - LtdcHandle->Init.AccumulatedVBP;
+}
+
+/**
+  * @brief  Writes ARGB8888 pixels to a binary PPM file.
+  * @param  pPath: file name
+  * @param  pPixels: pixels, line after line
+  * @param  Width: image width
+  * @param  Height: image height
+  * @retval LCD_ERROR if the file can't be written
+  */
+static uint8_t WritePPM(const char *pPath, const uint32_t *pPixels, uint32_t Width, uint32_t Height)
+{
+  FILE *f = fopen(pPath, "wb");
+  uint8_t rgb[3];
+  uint32_t i;
+  int ok;
+
+  if(f == NULL)
+  {
+    return LCD_ERROR;
+  }
+
+  ok = fprintf(f, "P6\n%lu %lu\n255\n", (unsigned long)Width, (unsigned long)Height) > 0;
+  for(i = 0; ok && (i < Width * Height); i++)
+  {
+    rgb[0] = pPixels[i] >> 16;
+    rgb[1] = pPixels[i] >> 8;
+    rgb[2] = pPixels[i];
+    ok = fwrite(rgb, 3, 1, f) == 1;
+  }
+
+  if(fclose(f) != 0)
+  {
+    ok = 0;
+  }
+  return ok ? LCD_OK : LCD_ERROR;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -0,0 +1,83 @@
+/**
+  ******************************************************************************
+  * @file    host_lcd.h
+  * @brief   This file contains the functions prototypes of the host LCD
+  *          backend: frame dumps and draw call counters.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __HOST_LCD_H
+#define __HOST_LCD_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery_lcd.h"
+
+/** @addtogroup HOST
+  * @{
+  */
+
+/** @addtogroup HOST_LCD
+  * @{
+  */
+
+/** @defgroup HOST_LCD_Exported_Types HOST LCD Exported Types
+  * @{
+  */
+
+/**
+  * @brief  Cost of the drawing done between HOST_LCD_BeginMeasure() and
+  *         HOST_LCD_EndMeasure()
+  */
+typedef struct
+{
+  uint32_t Transfers;      /*!< DMA2D transfers                                         */
+  uint64_t PixelsWritten;  /*!< Pixels written by the DMA2D                             */
+  uint64_t BytesRead;      /*!< Bytes read by the DMA2D, foreground and background      */
+  uint64_t BytesWritten;   /*!< Bytes written by the DMA2D                              */
+  uint64_t SdramBytesRead;    /*!< Part of BytesRead read from the SDRAM                 */
+  uint64_t SdramBytesWritten; /*!< Part of BytesWritten written to the SDRAM             */
+  uint64_t BytesChanged;   /*!< SDRAM bytes whose value changed, CPU stores included    */
+  uint64_t Nanoseconds;    /*!< Time spent drawing                                      */
+}HOST_LCD_CountersTypeDef;
+
+/**
+  * @}
+  */
+
+/** @defgroup HOST_LCD_Exported_Functions HOST LCD Exported Functions
+  * @{
+  */
+uint8_t  HOST_LCD_GetFrame(uint32_t *pFrame);
+uint8_t  HOST_LCD_WriteFramePPM(const char *pPath);
+uint8_t  HOST_LCD_WriteLayerPPM(uint32_t LayerIndex, const char *pPath);
+int32_t  HOST_LCD_CompareFramePPM(const char *pPath);
+
+void     HOST_LCD_BeginMeasure(void);
+void     HOST_LCD_EndMeasure(HOST_LCD_CountersTypeDef *pCounters);
+
+/* Counters of the host DMA2D, see host_dma2d.c */
+void     HOST_DMA2D_GetCounters(HOST_LCD_CountersTypeDef *pCounters);
+void     HOST_DMA2D_ResetCounters(void);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HOST_LCD_H */
@@ -0,0 +1,174 @@
+/**
+  ******************************************************************************
+  * @file    mbed.h
+  * @brief   Host replacement of the mbed OS header: the few definitions used
+  *          by the LCD class and the user interface, the timing and the
+  *          threads running on the virtual clock of host_clock.c, see
+  *          host/README.md. main.cpp needs more and does not build with it.
+  ******************************************************************************
+  */
+
+#ifndef MBED_H
+#define MBED_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "stm32f4xx_hal.h"
+#include "host_clock.h"
+
+#define MBED_ASSERT(expr)    assert(expr)
+
+#ifdef __cplusplus
+
+#include <chrono>
+#include <functional>
+
+using namespace std::chrono_literals;
+
+/* CMSIS-RTOS2 values, compared by HOST_CLOCK_Spawn() */
+typedef enum {
+    osPriorityIdle        = 1,
+    osPriorityLow         = 8,
+    osPriorityBelowNormal = 16,
+    osPriorityNormal      = 24,
+    osPriorityAboveNormal = 32,
+    osPriorityHigh        = 40,
+    osPriorityRealtime    = 48,
+} osPriority;
+
+typedef int32_t osStatus;
+#define osOK               0
+#define osError            -1
+#define osErrorNoMemory    -5
+
+namespace Kernel {
+
+struct Clock {
+    using duration = std::chrono::milliseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<Clock>;
+    static constexpr bool is_steady = true;
+
+    static time_point now()
+    {
+        HOST_CLOCK_Poll();
+        return time_point(duration(HOST_CLOCK_Now() / 1000000));
+    }
+};
+
+} // namespace Kernel
+
+namespace ThisThread {
+
+template <typename Rep, typename Period>
+inline void sleep_for(std::chrono::duration<Rep, Period> rel_time)
+{
+    HOST_CLOCK_Sleep(std::chrono::duration_cast<std::chrono::nanoseconds>(rel_time).count());
+}
+
+inline void sleep_until(Kernel::Clock::time_point abs_time)
+{
+    HOST_CLOCK_SleepUntil((uint64_t)abs_time.time_since_epoch().count() * 1000000);
+}
+
+inline void yield()
+{
+    HOST_CLOCK_Yield();
+}
+
+} // namespace ThisThread
+
+class Mutex {
+public:
+    Mutex() : _mutex(HOST_CLOCK_MUTEX_INIT) {}
+    explicit Mutex(const char *name) : _mutex(HOST_CLOCK_MUTEX_INIT) { (void)name; }
+
+    void lock() { HOST_CLOCK_Lock(&_mutex); }
+    bool trylock() { return HOST_CLOCK_TryLock(&_mutex) != 0; }
+    void unlock() { HOST_CLOCK_Unlock(&_mutex); }
+
+private:
+    HOST_CLOCK_MutexTypeDef _mutex;
+};
+
+// Threads only switch when they sleep or wait: there is nothing to mask
+class CriticalSectionLock {
+public:
+    CriticalSectionLock() {}
+};
+
+class Thread {
+public:
+    Thread(osPriority priority = osPriorityNormal, uint32_t stack_size = 0,
+           unsigned char *stack_mem = nullptr, const char *name = nullptr)
+        : _priority(priority), _id(-1)
+    {
+        (void)stack_size;
+        (void)stack_mem;
+        (void)name;
+    }
+
+    osStatus start(std::function<void()> task)
+    {
+        if (_id >= 0) {
+            return osError;
+        }
+        _task = task;
+        _id = HOST_CLOCK_Spawn(Run, this, _priority);
+        return (_id < 0) ? osErrorNoMemory : osOK;
+    }
+
+private:
+    static void Run(void *pContext) { static_cast<Thread *>(pContext)->_task(); }
+
+    osPriority _priority;
+    int32_t _id;
+    std::function<void()> _task;
+};
+
+class Timer {
+public:
+    Timer() : _running(false), _start(0), _elapsed(0) {}
+
+    void start()
+    {
+        if (!_running) {
+            _start = HOST_CLOCK_Now();
+            _running = true;
+        }
+    }
+
+    void stop()
+    {
+        if (_running) {
+            _elapsed += HOST_CLOCK_Now() - _start;
+            _running = false;
+        }
+    }
+
+    void reset()
+    {
+        _start = HOST_CLOCK_Now();
+        _elapsed = 0;
+    }
+
+    std::chrono::microseconds elapsed_time() const
+    {
+        HOST_CLOCK_Poll();
+        uint64_t ns = _elapsed + (_running ? HOST_CLOCK_Now() - _start : 0);
+        return std::chrono::microseconds(ns / 1000);
+    }
+
+private:
+    bool _running;
+    uint64_t _start;
+    uint64_t _elapsed;
+};
+
+#endif /* __cplusplus */
+
+#endif /* MBED_H */
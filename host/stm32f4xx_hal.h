@@ -0,0 +1,283 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal.h
+  * @brief   Host replacement of the STM32F4 HAL header: the subset of types,
+  *          constants and functions used by the BSP LCD, DMA2D and raster
+  *          drivers, so that they build and run on a PC.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this file:
+--------------------------
+   - It is found before the mbed HAL when host/ is first on the include path,
+     see host/README.md.
+   - Only what the drivers reference is declared. The GPIO, RCC and clock
+     functions do nothing, the LTDC functions are emulated by host_lcd.c.
+
+2. Driver description:
+---------------------
+   - The constants keep the values of the STM32F4 HAL, so the pixel format
+     and color mode codes stay interchangeable as on the target.
+   - Register level macros such as __HAL_LTDC_LAYER_ENABLE() are mapped on
+     host functions: the LTDC shadow registers are modelled, a configuration
+     becomes visible at the next reload.
+
+------------------------------------------------------------------------------*/
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_HAL_H
+#define __STM32F4xx_HAL_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+
+/* Exported types ------------------------------------------------------------*/
+#define __IO    volatile
+#define __weak  __attribute__((weak))
+
+typedef enum
+{
+  HAL_OK       = 0x00,
+  HAL_ERROR    = 0x01,
+  HAL_BUSY     = 0x02,
+  HAL_TIMEOUT  = 0x03
+}HAL_StatusTypeDef;
+
+typedef enum
+{
+  DISABLE = 0,
+  ENABLE = !DISABLE
+}FunctionalState;
+
+typedef enum
+{
+  RESET = 0,
+  SET = !RESET
+}FlagStatus, ITStatus;
+
+typedef enum
+{
+  GPIO_PIN_RESET = 0,
+  GPIO_PIN_SET
+}GPIO_PinState;
+
+/* Peripherals are never dereferenced on the host */
+typedef struct { uint32_t Reserved; } GPIO_TypeDef;
+typedef struct { uint32_t Reserved; } LTDC_TypeDef;
+typedef struct { uint32_t Reserved; } DMA2D_TypeDef;
+typedef struct { uint32_t Reserved; } SPI_TypeDef;
+typedef struct { uint32_t Reserved; } I2C_TypeDef;
+
+typedef struct
+{
+  uint32_t Pin;
+  uint32_t Mode;
+  uint32_t Pull;
+  uint32_t Speed;
+  uint32_t Alternate;
+}GPIO_InitTypeDef;
+
+typedef struct
+{
+  uint32_t PLLSAIN;
+  uint32_t PLLSAIQ;
+  uint32_t PLLSAIR;
+}RCC_PLLSAIInitTypeDef;
+
+typedef struct
+{
+  uint32_t PeriphClockSelection;
+  RCC_PLLSAIInitTypeDef PLLSAI;
+  uint32_t PLLSAIDivR;
+}RCC_PeriphCLKInitTypeDef;
+
+typedef struct
+{
+  uint8_t Blue;
+  uint8_t Green;
+  uint8_t Red;
+  uint8_t Reserved;
+}LTDC_ColorTypeDef;
+
+typedef struct
+{
+  uint32_t HSPolarity;
+  uint32_t VSPolarity;
+  uint32_t DEPolarity;
+  uint32_t PCPolarity;
+  uint32_t HorizontalSync;
+  uint32_t VerticalSync;
+  uint32_t AccumulatedHBP;
+  uint32_t AccumulatedVBP;
+  uint32_t AccumulatedActiveW;
+  uint32_t AccumulatedActiveH;
+  uint32_t TotalWidth;
+  uint32_t TotalHeigh;
+  LTDC_ColorTypeDef Backcolor;
+}LTDC_InitTypeDef;
+
+typedef struct
+{
+  uint32_t WindowX0;
+  uint32_t WindowX1;
+  uint32_t WindowY0;
+  uint32_t WindowY1;
+  uint32_t PixelFormat;
+  uint32_t Alpha;
+  uint32_t Alpha0;
+  uint32_t BlendingFactor1;
+  uint32_t BlendingFactor2;
+  uint32_t FBStartAdress;
+  uint32_t ImageWidth;
+  uint32_t ImageHeight;
+  LTDC_ColorTypeDef Backcolor;
+}LTDC_LayerCfgTypeDef;
+
+typedef struct
+{
+  LTDC_TypeDef         *Instance;
+  LTDC_InitTypeDef     Init;
+  LTDC_LayerCfgTypeDef LayerCfg[2];
+  uint32_t             State;
+  uint32_t             ErrorCode;
+}LTDC_HandleTypeDef;
+
+/* Only referenced by prototypes of the SDRAM driver */
+typedef struct { uint32_t CommandMode; uint32_t CommandTarget; uint32_t AutoRefreshNumber; uint32_t ModeRegisterDefinition; } FMC_SDRAM_CommandTypeDef;
+typedef struct { void *Instance; } SDRAM_HandleTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define GPIOA                         ((GPIO_TypeDef *)0)
+#define GPIOB                         ((GPIO_TypeDef *)0)
+#define GPIOC                         ((GPIO_TypeDef *)0)
+#define GPIOD                         ((GPIO_TypeDef *)0)
+#define GPIOE                         ((GPIO_TypeDef *)0)
+#define GPIOF                         ((GPIO_TypeDef *)0)
+#define GPIOG                         ((GPIO_TypeDef *)0)
+#define LTDC                          ((LTDC_TypeDef *)0)
+#define DMA2D                         ((DMA2D_TypeDef *)0)
+
+#define GPIO_PIN_0                    ((uint16_t)0x0001)
+#define GPIO_PIN_1                    ((uint16_t)0x0002)
+#define GPIO_PIN_2                    ((uint16_t)0x0004)
+#define GPIO_PIN_3                    ((uint16_t)0x0008)
+#define GPIO_PIN_4                    ((uint16_t)0x0010)
+#define GPIO_PIN_5                    ((uint16_t)0x0020)
+#define GPIO_PIN_6                    ((uint16_t)0x0040)
+#define GPIO_PIN_7                    ((uint16_t)0x0080)
+#define GPIO_PIN_8                    ((uint16_t)0x0100)
+#define GPIO_PIN_9                    ((uint16_t)0x0200)
+#define GPIO_PIN_10                   ((uint16_t)0x0400)
+#define GPIO_PIN_11                   ((uint16_t)0x0800)
+#define GPIO_PIN_12                   ((uint16_t)0x1000)
+#define GPIO_PIN_13                   ((uint16_t)0x2000)
+#define GPIO_PIN_14                   ((uint16_t)0x4000)
+#define GPIO_PIN_15                   ((uint16_t)0x8000)
+#define GPIO_MODE_AF_PP               ((uint32_t)0x00000002)
+#define GPIO_NOPULL                   ((uint32_t)0x00000000)
+#define GPIO_SPEED_FAST               ((uint32_t)0x00000002)
+#define GPIO_AF9_LTDC                 ((uint8_t)0x09)
+#define GPIO_AF14_LTDC                ((uint8_t)0x0E)
+
+#define RCC_PERIPHCLK_LTDC            ((uint32_t)0x00000008)
+#define RCC_PLLSAIDIVR_8              ((uint32_t)0x00020000)
+
+#define LTDC_HSPOLARITY_AL            ((uint32_t)0x00000000)
+#define LTDC_VSPOLARITY_AL            ((uint32_t)0x00000000)
+#define LTDC_DEPOLARITY_AL            ((uint32_t)0x00000000)
+#define LTDC_PCPOLARITY_IPC           ((uint32_t)0x00000000)
+
+#define LTDC_PIXEL_FORMAT_ARGB8888    ((uint32_t)0x00000000)
+#define LTDC_PIXEL_FORMAT_RGB888      ((uint32_t)0x00000001)
+#define LTDC_PIXEL_FORMAT_RGB565      ((uint32_t)0x00000002)
+#define LTDC_PIXEL_FORMAT_ARGB1555    ((uint32_t)0x00000003)
+#define LTDC_PIXEL_FORMAT_ARGB4444    ((uint32_t)0x00000004)
+#define LTDC_PIXEL_FORMAT_L8          ((uint32_t)0x00000005)
+#define LTDC_PIXEL_FORMAT_AL44        ((uint32_t)0x00000006)
+#define LTDC_PIXEL_FORMAT_AL88        ((uint32_t)0x00000007)
+
+#define LTDC_BLENDING_FACTOR1_CA      ((uint32_t)0x00000400)
+#define LTDC_BLENDING_FACTOR1_PAxCA   ((uint32_t)0x00000600)
+#define LTDC_BLENDING_FACTOR2_CA      ((uint32_t)0x00000005)
+#define LTDC_BLENDING_FACTOR2_PAxCA   ((uint32_t)0x00000007)
+
+#define LTDC_SRCR_IMR                 ((uint32_t)0x00000001)
+#define LTDC_SRCR_VBR                 ((uint32_t)0x00000002)
+
+#define DMA2D_ARGB8888                ((uint32_t)0x00000000)
+#define DMA2D_RGB888                  ((uint32_t)0x00000001)
+#define DMA2D_RGB565                  ((uint32_t)0x00000002)
+#define DMA2D_ARGB1555                ((uint32_t)0x00000003)
+#define DMA2D_ARGB4444                ((uint32_t)0x00000004)
+
+#define CM_ARGB8888                   ((uint32_t)0x00000000)
+#define CM_RGB888                     ((uint32_t)0x00000001)
+#define CM_RGB565                     ((uint32_t)0x00000002)
+#define CM_ARGB1555                   ((uint32_t)0x00000003)
+#define CM_ARGB4444                   ((uint32_t)0x00000004)
+#define CM_L8                         ((uint32_t)0x00000005)
+#define CM_AL44                       ((uint32_t)0x00000006)
+#define CM_AL88                       ((uint32_t)0x00000007)
+#define CM_L4                         ((uint32_t)0x00000008)
+#define CM_A8                         ((uint32_t)0x00000009)
+#define CM_A4                         ((uint32_t)0x0000000A)
+
+#define DMA2D_NO_MODIF_ALPHA          ((uint32_t)0x00000000)
+#define DMA2D_REPLACE_ALPHA           ((uint32_t)0x00000001)
+#define DMA2D_COMBINE_ALPHA           ((uint32_t)0x00000002)
+
+/* Exported macro ------------------------------------------------------------*/
+#define __HAL_RCC_GPIOA_CLK_ENABLE()
+#define __HAL_RCC_GPIOB_CLK_ENABLE()
+#define __HAL_RCC_GPIOC_CLK_ENABLE()
+#define __HAL_RCC_GPIOD_CLK_ENABLE()
+#define __HAL_RCC_GPIOE_CLK_ENABLE()
+#define __HAL_RCC_GPIOF_CLK_ENABLE()
+#define __HAL_RCC_GPIOG_CLK_ENABLE()
+#define __HAL_RCC_LTDC_CLK_ENABLE()
+#define __HAL_RCC_DMA2D_CLK_ENABLE()
+
+#define __HAL_LTDC_LAYER_ENABLE(__HANDLE__, __LAYER__)   HOST_LTDC_SetLayerEnable((__HANDLE__), (__LAYER__), 1)
+#define __HAL_LTDC_LAYER_DISABLE(__HANDLE__, __LAYER__)  HOST_LTDC_SetLayerEnable((__HANDLE__), (__LAYER__), 0)
+#define __HAL_LTDC_RELOAD_CONFIG(__HANDLE__)             HAL_LTDC_Relaod((__HANDLE__), LTDC_SRCR_IMR)
+
+#define __DSB()
+
+/* Exported functions --------------------------------------------------------*/
+void              HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+HAL_StatusTypeDef HAL_RCCEx_PeriphCLKConfig(RCC_PeriphCLKInitTypeDef *PeriphClkInit);
+void              HAL_Delay(uint32_t Delay);
+uint32_t          HAL_GetTick(void);
+
+HAL_StatusTypeDef HAL_LTDC_Init(LTDC_HandleTypeDef *hltdc);
+HAL_StatusTypeDef HAL_LTDC_ConfigLayer(LTDC_HandleTypeDef *hltdc, LTDC_LayerCfgTypeDef *pLayerCfg, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_SetWindowSize(LTDC_HandleTypeDef *hltdc, uint32_t XSize, uint32_t YSize, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_SetWindowPosition(LTDC_HandleTypeDef *hltdc, uint32_t X0, uint32_t Y0, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_SetAlpha(LTDC_HandleTypeDef *hltdc, uint32_t Alpha, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_SetAddress(LTDC_HandleTypeDef *hltdc, uint32_t Address, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_ConfigColorKeying(LTDC_HandleTypeDef *hltdc, uint32_t RGBValue, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_EnableColorKeying(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_DisableColorKeying(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_EnableDither(LTDC_HandleTypeDef *hltdc);
+HAL_StatusTypeDef HAL_LTDC_Relaod(LTDC_HandleTypeDef *hltdc, uint32_t ReloadType);
+HAL_StatusTypeDef HAL_LTDC_SetWindowSize_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t XSize, uint32_t YSize, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_SetWindowPosition_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t X0, uint32_t Y0, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_SetAlpha_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t Alpha, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_SetAddress_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t Address, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_ConfigColorKeying_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t RGBValue, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_EnableColorKeying_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx);
+HAL_StatusTypeDef HAL_LTDC_DisableColorKeying_NoReload(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx);
+void              HOST_LTDC_SetLayerEnable(LTDC_HandleTypeDef *hltdc, uint32_t LayerIdx, uint8_t Enable);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F4xx_HAL_H */
@@ -18,9 +18,9 @@
 
 #include "LCD_DISCO_F429ZI.h"
 
-#define LCD_FRAME_BUFFER_LAYER0                  (LCD_FRAME_BUFFER+0x130000)
-#define LCD_FRAME_BUFFER_LAYER1                  LCD_FRAME_BUFFER
-#define CONVERTED_FRAME_BUFFER                   (LCD_FRAME_BUFFER+0x260000)
+#define LCD_FRAME_BUFFER_LAYER0                  SDRAM_LCD_LAYER0_ADDR
+#define LCD_FRAME_BUFFER_LAYER1                  SDRAM_LCD_LAYER1_ADDR
+#define CONVERTED_FRAME_BUFFER                   SDRAM_LCD_CONVERTED_ADDR
 
 // Constructor
 LCD_DISCO_F429ZI::LCD_DISCO_F429ZI()
@@ -0,0 +1,109 @@
+/* Copyright (c) 2010-2011 mbed.org, MIT License
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+* and associated documentation files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use, copy, modify, merge, publish,
+* distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or
+* substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+* BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+* DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TS_DISCO_F429ZI.h"
+
+// Constructor
+TS_DISCO_F429ZI::TS_DISCO_F429ZI()
+  : _int(PA_15, PullUp), _timestamp(0), _dropped(0)
+{
+
+}
+
+// Destructor
+TS_DISCO_F429ZI::~TS_DISCO_F429ZI()
+{
+  _int.fall(NULL);
+}
+
+//=================================================================================================================
+// Public methods
+//=================================================================================================================
+
+uint8_t TS_DISCO_F429ZI::Start(uint16_t XSize, uint16_t YSize, uint8_t Threshold)
+{
+  uint8_t status = BSP_TS_FifoInit(XSize, YSize, Threshold);
+
+  if (status == TS_OK) {
+    _int.fall(callback(this, &TS_DISCO_F429ZI::Interrupt));
+    // The line may have gone low before the callback was set
+    if (_int.read() == 0) {
+      Interrupt();
+    }
+  }
+  return status;
+}
+
+void TS_DISCO_F429ZI::SetCalibration(const TS_CalibrationTypeDef &Calibration)
+{
+  // The drain maps the samples from the I2C interrupt
+  CriticalSectionLock lock;
+  BSP_TS_SetCalibration(&Calibration);
+}
+
+uint8_t TS_DISCO_F429ZI::Calibrate(const TS_PointTypeDef *pRaw, const TS_PointTypeDef *pScreen)
+{
+  TS_CalibrationTypeDef calibration;
+
+  if (BSP_TS_ComputeCalibration(pRaw, pScreen, &calibration) != TS_OK) {
+    return TS_ERROR;
+  }
+  SetCalibration(calibration);
+  return TS_OK;
+}
+
+bool TS_DISCO_F429ZI::GetEvent(TS_EventTypeDef &Event)
+{
+  return _events.pop(Event);
+}
+
+uint32_t TS_DISCO_F429ZI::GetDropped(void)
+{
+  return _dropped;
+}
+
+//=================================================================================================================
+// Private methods
+//=================================================================================================================
+
+void TS_DISCO_F429ZI::Interrupt(void)
+{
+  _timestamp = us_ticker_read();
+  // A drain running already reads what raised the line, or ends with it low
+  BSP_TS_FifoDrainStart(_timestamp, Drained, this);
+}
+
+// From the I2C interrupt
+void TS_DISCO_F429ZI::Drained(const TS_EventTypeDef *pEvents, uint32_t Count, void *pContext)
+{
+  TS_DISCO_F429ZI *ts = (TS_DISCO_F429ZI *)pContext;
+  uint32_t i;
+
+  for (i = 0; i < Count; i++) {
+    if (ts->_events.full()) {
+      ts->_dropped++;
+    } else {
+      ts->_events.push(pEvents[i]);
+    }
+  }
+
+  // Level interrupt: the line stays low while the FIFO is above the threshold
+  if (ts->_int.read() == 0) {
+    ts->Interrupt();
+  }
+}
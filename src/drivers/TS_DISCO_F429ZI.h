@@ -0,0 +1,119 @@
+/* Copyright (c) 2010-2011 mbed.org, MIT License
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+* and associated documentation files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use, copy, modify, merge, publish,
+* distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or
+* substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+* BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+* DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef __TS_DISCO_F429ZI_H
+#define __TS_DISCO_F429ZI_H
+
+#ifdef TARGET_DISCO_F429ZI
+
+#include "mbed.h"
+#include "stm32f429i_discovery_ts.h"
+
+/*
+  This class drives the touch screen (STMPE811) present on DISCO_F429ZI board.
+
+  The STMPE811 fills its FIFO on its own and pulls its interrupt line once
+  Threshold samples are waiting, or on touch and release. The interrupt takes
+  a timestamp and queues the FIFO read on the I2C bus, ahead of the EEPROM;
+  the calibrated events are queued for the UI from the I2C interrupt. No
+  thread waits on the bus. A sample is at most Threshold samples, about
+  Threshold ms, late.
+
+  Usage:
+
+  #include "mbed.h"
+  #include "TS_DISCO_F429ZI.h"
+
+  TS_DISCO_F429ZI ts;
+
+  int main()
+  {
+      TS_EventTypeDef event;
+
+      ts.Start(240, 320);
+      while(1)
+      {
+          while(ts.GetEvent(event))
+          {
+              if(event.Event == TS_EVENT_DOWN)
+              {
+                  button_pressed(event.X, event.Y);
+              }
+          }
+          ThisThread::sleep_for(20ms);
+      }
+  }
+*/
+class TS_DISCO_F429ZI
+{
+
+public:
+  static const uint32_t MAX_EVENTS = 64;
+
+  //! Constructor
+  TS_DISCO_F429ZI();
+
+  //! Destructor
+  ~TS_DISCO_F429ZI();
+
+  /**
+    * @brief  Starts the interrupt driven acquisition.
+    * @param  XSize: The maximum X size of the TS area on LCD
+    * @param  YSize: The maximum Y size of the TS area on LCD
+    * @param  Threshold: FIFO threshold, 1 to TS_FIFO_BURST samples
+    * @retval TS_OK if the STMPE811 answered
+    */
+  uint8_t Start(uint16_t XSize, uint16_t YSize, uint8_t Threshold = 4);
+
+  /**
+    * @brief  Sets the raw to screen mapping.
+    */
+  void SetCalibration(const TS_CalibrationTypeDef &Calibration);
+
+  /**
+    * @brief  Sets the mapping that takes 3 raw positions to 3 screen positions.
+    * @retval TS_ERROR if the points are aligned
+    */
+  uint8_t Calibrate(const TS_PointTypeDef *pRaw, const TS_PointTypeDef *pScreen);
+
+  /**
+    * @brief  Gets the oldest event, does not access the I2C bus.
+    * @retval false if there is none
+    */
+  bool GetEvent(TS_EventTypeDef &Event);
+
+  /**
+    * @brief  Gets the number of events lost because the queue was full.
+    */
+  uint32_t GetDropped(void);
+
+private:
+  void Interrupt(void);
+  static void Drained(const TS_EventTypeDef *pEvents, uint32_t Count, void *pContext);
+
+  InterruptIn _int;
+  CircularBuffer<TS_EventTypeDef, MAX_EVENTS> _events;
+  volatile uint32_t _timestamp;
+  uint32_t _dropped;
+};
+
+#else
+#error "This class must be used with DISCO_F429ZI board only."
+#endif // TARGET_DISCO_F429ZI
+
+#endif
@@ -1,10 +1,9 @@
 /**
   ******************************************************************************
-  * @file    Font12.c
-  * @author  MCD Application Team
-  * @version V1.0.0
-  * @date    18-February-2014
-  * @brief   This file provides text Font12 for STM32xx-EVAL's LCD driver. 
+  * @file    font12.c
+  * @brief   Font12 glyphs, 7x12 cells, 1 bpp, 681 bytes of bitmap.
+  *          Generated by tools/fontgen from the STMicroelectronics
+  *          tables, do not edit.
   ******************************************************************************
   * @attention
   *
@@ -35,1430 +34,893 @@
   ******************************************************************************
   */
 
-/* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
-/** @addtogroup Utilities
-  * @{
-  */
-  
-/** @addtogroup STM32_EVAL
-  * @{
-  */ 
-
-/** @addtogroup Common
-  * @{
-  */
-
-/** @addtogroup FONTS
-  * @brief      This file provides text Font12 for STM32xx-EVAL's LCD driver.
-  * @{
-  */  
-
-/** @defgroup FONTS_Private_Types
-  * @{
-  */ 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Defines
-  * @{
-  */
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Macros
-  * @{
-  */
-/**
-  * @}
-  */ 
-  
-
-/** @defgroup FONTS_Private_Variables
-  * @{
-  */
-// 
-//  Font data for Courier New 12pt
-// 
-
-const uint8_t Font12_Table[] = 
+static const uint8_t Font12_Bitmap[] =
 {
-	// @0 ' ' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @12 '!' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @24 '"' (7 pixels wide)
-	0x00, //        
-	0x6C, //  ## ## 
-	0x48, //  #  #  
-	0x48, //  #  #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @36 '#' (7 pixels wide)
-	0x00, //        
-	0x14, //    # # 
-	0x14, //    # # 
-	0x28, //   # #  
-	0x7C, //  ##### 
-	0x28, //   # #  
-	0x7C, //  ##### 
-	0x28, //   # #  
-	0x50, //  # #   
-	0x50, //  # #   
-	0x00, //        
-	0x00, //        
-
-	// @48 '$' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x38, //   ###  
-	0x40, //  #     
-	0x40, //  #     
-	0x38, //   ###  
-	0x48, //  #  #  
-	0x70, //  ###   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-
-	// @60 '%' (7 pixels wide)
-	0x00, //        
-	0x20, //   #    
-	0x50, //  # #   
-	0x20, //   #    
-	0x0C, //     ## 
-	0x70, //  ###   
-	0x08, //     #  
-	0x14, //    # # 
-	0x08, //     #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @72 '&' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x20, //   #    
-	0x20, //   #    
-	0x54, //  # # # 
-	0x48, //  #  #  
-	0x34, //   ## # 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @84 ''' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @96 '(' (7 pixels wide)
-	0x00, //        
-	0x08, //     #  
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x08, //     #  
-	0x00, //        
-
-	// @108 ')' (7 pixels wide)
-	0x00, //        
-	0x20, //   #    
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x20, //   #    
-	0x00, //        
-
-	// @120 '*' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x10, //    #   
-	0x28, //   # #  
-	0x28, //   # #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @132 '+' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0xFE, // #######
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @144 ',' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x10, //    #   
-	0x30, //   ##   
-	0x20, //   #    
-	0x00, //        
-
-	// @156 '-' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @168 '.' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x30, //   ##   
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @180 '/' (7 pixels wide)
-	0x00, //        
-	0x04, //      # 
-	0x04, //      # 
-	0x08, //     #  
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x20, //   #    
-	0x40, //  #     
-	0x00, //        
-	0x00, //        
-
-	// @192 '0' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @204 '1' (7 pixels wide)
-	0x00, //        
-	0x30, //   ##   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @216 '2' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x04, //      # 
-	0x08, //     #  
-	0x10, //    #   
-	0x20, //   #    
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @228 '3' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x04, //      # 
-	0x18, //    ##  
-	0x04, //      # 
-	0x04, //      # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @240 '4' (7 pixels wide)
-	0x00, //        
-	0x0C, //     ## 
-	0x14, //    # # 
-	0x14, //    # # 
-	0x24, //   #  # 
-	0x44, //  #   # 
-	0x7E, //  ######
-	0x04, //      # 
-	0x0E, //     ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @252 '5' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x20, //   #    
-	0x20, //   #    
-	0x38, //   ###  
-	0x04, //      # 
-	0x04, //      # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @264 '6' (7 pixels wide)
-	0x00, //        
-	0x1C, //    ### 
-	0x20, //   #    
-	0x40, //  #     
-	0x78, //  ####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @276 '7' (7 pixels wide)
-	0x00, //        
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0x04, //      # 
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @288 '8' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @300 '9' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x04, //      # 
-	0x08, //     #  
-	0x70, //  ###   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @312 ':' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x30, //   ##   
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x30, //   ##   
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @324 ';' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x18, //    ##  
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x30, //   ##   
-	0x20, //   #    
-	0x00, //        
-	0x00, //        
-
-	// @336 '<' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x0C, //     ## 
-	0x10, //    #   
-	0x60, //  ##    
-	0x80, // #      
-	0x60, //  ##    
-	0x10, //    #   
-	0x0C, //     ## 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @348 '=' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x7C, //  ##### 
-	0x00, //        
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @360 '>' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0xC0, // ##     
-	0x20, //   #    
-	0x18, //    ##  
-	0x04, //      # 
-	0x18, //    ##  
-	0x20, //   #    
-	0xC0, // ##     
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @372 '?' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x18, //    ##  
-	0x24, //   #  # 
-	0x04, //      # 
-	0x08, //     #  
-	0x10, //    #   
-	0x00, //        
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @384 '@' (7 pixels wide)
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x4C, //  #  ## 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x4C, //  #  ## 
-	0x40, //  #     
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-
-	// @396 'A' (7 pixels wide)
-	0x00, //        
-	0x30, //   ##   
-	0x10, //    #   
-	0x28, //   # #  
-	0x28, //   # #  
-	0x28, //   # #  
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @408 'B' (7 pixels wide)
-	0x00, //        
-	0xF8, // #####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xF8, // #####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @420 'C' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x40, //  #     
-	0x40, //  #     
-	0x40, //  #     
-	0x40, //  #     
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @432 'D' (7 pixels wide)
-	0x00, //        
-	0xF0, // ####   
-	0x48, //  #  #  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x48, //  #  #  
-	0xF0, // ####   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @444 'E' (7 pixels wide)
-	0x00, //        
-	0xFC, // ###### 
-	0x44, //  #   # 
-	0x50, //  # #   
-	0x70, //  ###   
-	0x50, //  # #   
-	0x40, //  #     
-	0x44, //  #   # 
-	0xFC, // ###### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @456 'F' (7 pixels wide)
-	0x00, //        
-	0x7E, //  ######
-	0x22, //   #   #
-	0x28, //   # #  
-	0x38, //   ###  
-	0x28, //   # #  
-	0x20, //   #    
-	0x20, //   #    
-	0x70, //  ###   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @468 'G' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x40, //  #     
-	0x40, //  #     
-	0x4E, //  #  ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @480 'H' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @492 'I' (7 pixels wide)
-	0x00, //        
-	0x7C, //  ##### 
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @504 'J' (7 pixels wide)
-	0x00, //        
-	0x3C, //   #### 
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x48, //  #  #  
-	0x48, //  #  #  
-	0x48, //  #  #  
-	0x30, //   ##   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @516 'K' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x48, //  #  #  
-	0x50, //  # #   
-	0x70, //  ###   
-	0x48, //  #  #  
-	0x44, //  #   # 
-	0xE6, // ###  ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @528 'L' (7 pixels wide)
-	0x00, //        
-	0x70, //  ###   
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x24, //   #  # 
-	0x24, //   #  # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @540 'M' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x6C, //  ## ## 
-	0x6C, //  ## ## 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @552 'N' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x64, //  ##  # 
-	0x64, //  ##  # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x4C, //  #  ## 
-	0xEC, // ### ## 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @564 'O' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @576 'P' (7 pixels wide)
-	0x00, //        
-	0x78, //  ####  
-	0x24, //   #  # 
-	0x24, //   #  # 
-	0x24, //   #  # 
-	0x38, //   ###  
-	0x20, //   #    
-	0x20, //   #    
-	0x70, //  ###   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @588 'Q' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x1C, //    ### 
-	0x00, //        
-	0x00, //        
-
-	// @600 'R' (7 pixels wide)
-	0x00, //        
-	0xF8, // #####  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x48, //  #  #  
-	0x44, //  #   # 
-	0xE2, // ###   #
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @612 'S' (7 pixels wide)
-	0x00, //        
-	0x34, //   ## # 
-	0x4C, //  #  ## 
-	0x40, //  #     
-	0x38, //   ###  
-	0x04, //      # 
-	0x04, //      # 
-	0x64, //  ##  # 
-	0x58, //  # ##  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @624 'T' (7 pixels wide)
-	0x00, //        
-	0xFE, // #######
-	0x92, // #  #  #
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @636 'U' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @648 'V' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x28, //   # #  
-	0x28, //   # #  
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @660 'W' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x28, //   # #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @672 'X' (7 pixels wide)
-	0x00, //        
-	0xC6, // ##   ##
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x10, //    #   
-	0x10, //    #   
-	0x28, //   # #  
-	0x44, //  #   # 
-	0xC6, // ##   ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @684 'Y' (7 pixels wide)
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x28, //   # #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @696 'Z' (7 pixels wide)
-	0x00, //        
-	0x7C, //  ##### 
-	0x44, //  #   # 
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @708 '[' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x38, //   ###  
-	0x00, //        
-
-	// @720 '\' (7 pixels wide)
-	0x00, //        
-	0x40, //  #     
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x00, //        
-	0x00, //        
-
-	// @732 ']' (7 pixels wide)
-	0x00, //        
-	0x38, //   ###  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x38, //   ###  
-	0x00, //        
-
-	// @744 '^' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x28, //   # #  
-	0x44, //  #   # 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @756 '_' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xFE, // #######
-
-	// @768 '`' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x08, //     #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @780 'a' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3E, //   #####
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @792 'b' (7 pixels wide)
-	0x00, //        
-	0xC0, // ##     
-	0x40, //  #     
-	0x58, //  # ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xF8, // #####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @804 'c' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x40, //  #     
-	0x40, //  #     
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @816 'd' (7 pixels wide)
-	0x00, //        
-	0x0C, //     ## 
-	0x04, //      # 
-	0x34, //   ## # 
-	0x4C, //  #  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3E, //   #####
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @828 'e' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x40, //  #     
-	0x40, //  #     
-	0x3C, //   #### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @840 'f' (7 pixels wide)
-	0x00, //        
-	0x1C, //    ### 
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @852 'g' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x36, //   ## ##
-	0x4C, //  #  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x04, //      # 
-	0x38, //   ###  
-	0x00, //        
-
-	// @864 'h' (7 pixels wide)
-	0x00, //        
-	0xC0, // ##     
-	0x40, //  #     
-	0x58, //  # ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @876 'i' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x00, //        
-	0x70, //  ###   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @888 'j' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x00, //        
-	0x78, //  ####  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x08, //     #  
-	0x70, //  ###   
-	0x00, //        
-
-	// @900 'k' (7 pixels wide)
-	0x00, //        
-	0xC0, // ##     
-	0x40, //  #     
-	0x5C, //  # ### 
-	0x48, //  #  #  
-	0x70, //  ###   
-	0x50, //  # #   
-	0x48, //  #  #  
-	0xDC, // ## ### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @912 'l' (7 pixels wide)
-	0x00, //        
-	0x30, //   ##   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @924 'm' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xE8, // ### #  
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0xFE, // #######
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @936 'n' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xD8, // ## ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0xEE, // ### ###
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @948 'o' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x38, //   ###  
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @960 'p' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xD8, // ## ##  
-	0x64, //  ##  # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x40, //  #     
-	0xE0, // ###    
-	0x00, //        
-
-	// @972 'q' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x36, //   ## ##
-	0x4C, //  #  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x3C, //   #### 
-	0x04, //      # 
-	0x0E, //     ###
-	0x00, //        
-
-	// @984 'r' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x6C, //  ## ## 
-	0x30, //   ##   
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @996 's' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x3C, //   #### 
-	0x44, //  #   # 
-	0x38, //   ###  
-	0x04, //      # 
-	0x44, //  #   # 
-	0x78, //  ####  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1008 't' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x20, //   #    
-	0x7C, //  ##### 
-	0x20, //   #    
-	0x20, //   #    
-	0x20, //   #    
-	0x22, //   #   #
-	0x1C, //    ### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1020 'u' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xCC, // ##  ## 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x4C, //  #  ## 
-	0x36, //   ## ##
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1032 'v' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x44, //  #   # 
-	0x28, //   # #  
-	0x28, //   # #  
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1044 'w' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x54, //  # # # 
-	0x28, //   # #  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1056 'x' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xCC, // ##  ## 
-	0x48, //  #  #  
-	0x30, //   ##   
-	0x30, //   ##   
-	0x48, //  #  #  
-	0xCC, // ##  ## 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1068 'y' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0xEE, // ### ###
-	0x44, //  #   # 
-	0x24, //   #  # 
-	0x28, //   # #  
-	0x18, //    ##  
-	0x10, //    #   
-	0x10, //    #   
-	0x78, //  ####  
-	0x00, //        
-
-	// @1080 'z' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x7C, //  ##### 
-	0x48, //  #  #  
-	0x10, //    #   
-	0x20, //   #    
-	0x44, //  #   # 
-	0x7C, //  ##### 
-	0x00, //        
-	0x00, //        
-	0x00, //        
-
-	// @1092 '{' (7 pixels wide)
-	0x00, //        
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x00, //        
-
-	// @1104 '|' (7 pixels wide)
-	0x00, //        
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x00, //        
-	0x00, //        
-
-	// @1116 '}' (7 pixels wide)
-	0x00, //        
-	0x20, //   #    
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x08, //     #  
-	0x10, //    #   
-	0x10, //    #   
-	0x10, //    #   
-	0x20, //   #    
-	0x00, //        
+  /* '!' */
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x00,
+  0x00,
+  0x80,
+  /* '"' */
+  0xD8,
+  0x90,
+  0x90,
+  /* '#' */
+  0x28,
+  0x28,
+  0x50,
+  0xF8,
+  0x50,
+  0xF8,
+  0x50,
+  0xA0,
+  0xA0,
+  /* '$' */
+  0x20,
+  0x70,
+  0x80,
+  0x80,
+  0x70,
+  0x90,
+  0xE0,
+  0x20,
+  0x20,
+  /* '%' */
+  0x40,
+  0xA0,
+  0x40,
+  0x18,
+  0xE0,
+  0x10,
+  0x28,
+  0x10,
+  /* '&' */
+  0x30,
+  0x40,
+  0x40,
+  0xA8,
+  0x90,
+  0x68,
+  /* ''' */
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  /* '(' */
+  0x40,
+  0x40,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x40,
+  0x40,
+  /* ')' */
+  0x80,
+  0x80,
+  0x40,
+  0x40,
+  0x40,
+  0x40,
+  0x40,
+  0x40,
+  0x80,
+  0x80,
+  /* '*' */
+  0x20,
+  0xF8,
+  0x20,
+  0x50,
+  0x50,
+  /* '+' */
+  0x10,
+  0x10,
+  0x10,
+  0xFE,
+  0x10,
+  0x10,
+  0x10,
+  /* ',' */
+  0x60,
+  0x40,
+  0xC0,
+  0x80,
+  /* '-' */
+  0xF8,
+  /* '.' */
+  0xC0,
+  0xC0,
+  /* '/' */
+  0x08,
+  0x08,
+  0x10,
+  0x10,
+  0x20,
+  0x20,
+  0x40,
+  0x40,
+  0x80,
+  /* '0' */
+  0x70,
+  0x88,
+  0x88,
+  0x88,
+  0x88,
+  0x88,
+  0x88,
+  0x70,
+  /* '1' */
+  0x60,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0xF8,
+  /* '2' */
+  0x70,
+  0x88,
+  0x08,
+  0x10,
+  0x20,
+  0x40,
+  0x88,
+  0xF8,
+  /* '3' */
+  0x70,
+  0x88,
+  0x08,
+  0x30,
+  0x08,
+  0x08,
+  0x88,
+  0x70,
+  /* '4' */
+  0x18,
+  0x28,
+  0x28,
+  0x48,
+  0x88,
+  0xFC,
+  0x08,
+  0x1C,
+  /* '5' */
+  0x78,
+  0x40,
+  0x40,
+  0x70,
+  0x08,
+  0x08,
+  0x88,
+  0x70,
+  /* '6' */
+  0x38,
+  0x40,
+  0x80,
+  0xF0,
+  0x88,
+  0x88,
+  0x88,
+  0x70,
+  /* '7' */
+  0xF8,
+  0x88,
+  0x08,
+  0x10,
+  0x10,
+  0x10,
+  0x20,
+  0x20,
+  /* '8' */
+  0x70,
+  0x88,
+  0x88,
+  0x70,
+  0x88,
+  0x88,
+  0x88,
+  0x70,
+  /* '9' */
+  0x70,
+  0x88,
+  0x88,
+  0x88,
+  0x78,
+  0x08,
+  0x10,
+  0xE0,
+  /* ':' */
+  0xC0,
+  0xC0,
+  0x00,
+  0x00,
+  0xC0,
+  0xC0,
+  /* ';' */
+  0x60,
+  0x60,
+  0x00,
+  0x00,
+  0x60,
+  0xC0,
+  0x80,
+  /* '<' */
+  0x0C,
+  0x10,
+  0x60,
+  0x80,
+  0x60,
+  0x10,
+  0x0C,
+  /* '=' */
+  0xF8,
+  0x00,
+  0xF8,
+  /* '>' */
+  0xC0,
+  0x20,
+  0x18,
+  0x04,
+  0x18,
+  0x20,
+  0xC0,
+  /* '?' */
+  0x60,
+  0x90,
+  0x10,
+  0x20,
+  0x40,
+  0x00,
+  0xC0,
+  /* '@' */
+  0x70,
+  0x88,
+  0x88,
+  0x98,
+  0xA8,
+  0xA8,
+  0x98,
+  0x80,
+  0x88,
+  0x70,
+  /* 'A' */
+  0x30,
+  0x10,
+  0x28,
+  0x28,
+  0x28,
+  0x7C,
+  0x44,
+  0xEE,
+  /* 'B' */
+  0xF8,
+  0x44,
+  0x44,
+  0x78,
+  0x44,
+  0x44,
+  0x44,
+  0xF8,
+  /* 'C' */
+  0x78,
+  0x88,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x88,
+  0x70,
+  /* 'D' */
+  0xF0,
+  0x48,
+  0x44,
+  0x44,
+  0x44,
+  0x44,
+  0x48,
+  0xF0,
+  /* 'E' */
+  0xFC,
+  0x44,
+  0x50,
+  0x70,
+  0x50,
+  0x40,
+  0x44,
+  0xFC,
+  /* 'F' */
+  0xFC,
+  0x44,
+  0x50,
+  0x70,
+  0x50,
+  0x40,
+  0x40,
+  0xE0,
+  /* 'G' */
+  0x78,
+  0x88,
+  0x80,
+  0x80,
+  0x9C,
+  0x88,
+  0x88,
+  0x70,
+  /* 'H' */
+  0xEE,
+  0x44,
+  0x44,
+  0x7C,
+  0x44,
+  0x44,
+  0x44,
+  0xEE,
+  /* 'I' */
+  0xF8,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0xF8,
+  /* 'J' */
+  0x78,
+  0x10,
+  0x10,
+  0x10,
+  0x90,
+  0x90,
+  0x90,
+  0x60,
+  /* 'K' */
+  0xEE,
+  0x44,
+  0x48,
+  0x50,
+  0x70,
+  0x48,
+  0x44,
+  0xE6,
+  /* 'L' */
+  0xE0,
+  0x40,
+  0x40,
+  0x40,
+  0x40,
+  0x48,
+  0x48,
+  0xF8,
+  /* 'M' */
+  0xEE,
+  0x6C,
+  0x6C,
+  0x54,
+  0x54,
+  0x44,
+  0x44,
+  0xEE,
+  /* 'N' */
+  0xEE,
+  0x64,
+  0x64,
+  0x54,
+  0x54,
+  0x54,
+  0x4C,
+  0xEC,
+  /* 'O' */
+  0x70,
+  0x88,
+  0x88,
+  0x88,
+  0x88,
+  0x88,
+  0x88,
+  0x70,
+  /* 'P' */
+  0xF0,
+  0x48,
+  0x48,
+  0x48,
+  0x70,
+  0x40,
+  0x40,
+  0xE0,
+  /* 'Q' */
+  0x70,
+  0x88,
+  0x88,
+  0x88,
+  0x88,
+  0x88,
+  0x88,
+  0x70,
+  0x38,
+  /* 'R' */
+  0xF8,
+  0x44,
+  0x44,
+  0x44,
+  0x78,
+  0x48,
+  0x44,
+  0xE2,
+  /* 'S' */
+  0x68,
+  0x98,
+  0x80,
+  0x70,
+  0x08,
+  0x08,
+  0xC8,
+  0xB0,
+  /* 'T' */
+  0xFE,
+  0x92,
+  0x10,
+  0x10,
+  0x10,
+  0x10,
+  0x10,
+  0x38,
+  /* 'U' */
+  0xEE,
+  0x44,
+  0x44,
+  0x44,
+  0x44,
+  0x44,
+  0x44,
+  0x38,
+  /* 'V' */
+  0xEE,
+  0x44,
+  0x44,
+  0x28,
+  0x28,
+  0x28,
+  0x10,
+  0x10,
+  /* 'W' */
+  0xEE,
+  0x44,
+  0x44,
+  0x54,
+  0x54,
+  0x54,
+  0x54,
+  0x28,
+  /* 'X' */
+  0xC6,
+  0x44,
+  0x28,
+  0x10,
+  0x10,
+  0x28,
+  0x44,
+  0xC6,
+  /* 'Y' */
+  0xEE,
+  0x44,
+  0x28,
+  0x28,
+  0x10,
+  0x10,
+  0x10,
+  0x38,
+  /* 'Z' */
+  0xF8,
+  0x88,
+  0x10,
+  0x20,
+  0x20,
+  0x40,
+  0x88,
+  0xF8,
+  /* '[' */
+  0xE0,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0xE0,
+  /* '\\' */
+  0x80,
+  0x40,
+  0x40,
+  0x40,
+  0x20,
+  0x20,
+  0x10,
+  0x10,
+  0x10,
+  /* ']' */
+  0xE0,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0xE0,
+  /* '^' */
+  0x20,
+  0x20,
+  0x50,
+  0x88,
+  /* '_' */
+  0xFE,
+  /* '`' */
+  0x80,
+  0x40,
+  /* 'a' */
+  0x70,
+  0x88,
+  0x78,
+  0x88,
+  0x88,
+  0x7C,
+  /* 'b' */
+  0xC0,
+  0x40,
+  0x58,
+  0x64,
+  0x44,
+  0x44,
+  0x44,
+  0xF8,
+  /* 'c' */
+  0x78,
+  0x88,
+  0x80,
+  0x80,
+  0x88,
+  0x70,
+  /* 'd' */
+  0x18,
+  0x08,
+  0x68,
+  0x98,
+  0x88,
+  0x88,
+  0x88,
+  0x7C,
+  /* 'e' */
+  0x70,
+  0x88,
+  0xF8,
+  0x80,
+  0x80,
+  0x78,
+  /* 'f' */
+  0x38,
+  0x40,
+  0xF8,
+  0x40,
+  0x40,
+  0x40,
+  0x40,
+  0xF8,
+  /* 'g' */
+  0x6C,
+  0x98,
+  0x88,
+  0x88,
+  0x88,
+  0x78,
+  0x08,
+  0x70,
+  /* 'h' */
+  0xC0,
+  0x40,
+  0x58,
+  0x64,
+  0x44,
+  0x44,
+  0x44,
+  0xEE,
+  /* 'i' */
+  0x20,
+  0x00,
+  0xE0,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0xF8,
+  /* 'j' */
+  0x20,
+  0x00,
+  0xF0,
+  0x10,
+  0x10,
+  0x10,
+  0x10,
+  0x10,
+  0x10,
+  0xE0,
+  /* 'k' */
+  0xC0,
+  0x40,
+  0x5C,
+  0x48,
+  0x70,
+  0x50,
+  0x48,
+  0xDC,
+  /* 'l' */
+  0x60,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0xF8,
+  /* 'm' */
+  0xE8,
+  0x54,
+  0x54,
+  0x54,
+  0x54,
+  0xFE,
+  /* 'n' */
+  0xD8,
+  0x64,
+  0x44,
+  0x44,
+  0x44,
+  0xEE,
+  /* 'o' */
+  0x70,
+  0x88,
+  0x88,
+  0x88,
+  0x88,
+  0x70,
+  /* 'p' */
+  0xD8,
+  0x64,
+  0x44,
+  0x44,
+  0x44,
+  0x78,
+  0x40,
+  0xE0,
+  /* 'q' */
+  0x6C,
+  0x98,
+  0x88,
+  0x88,
+  0x88,
+  0x78,
+  0x08,
+  0x1C,
+  /* 'r' */
+  0xD8,
+  0x60,
+  0x40,
+  0x40,
+  0x40,
+  0xF8,
+  /* 's' */
+  0x78,
+  0x88,
+  0x70,
+  0x08,
+  0x88,
+  0xF0,
+  /* 't' */
+  0x40,
+  0xF8,
+  0x40,
+  0x40,
+  0x40,
+  0x44,
+  0x38,
+  /* 'u' */
+  0xCC,
+  0x44,
+  0x44,
+  0x44,
+  0x4C,
+  0x36,
+  /* 'v' */
+  0xEE,
+  0x44,
+  0x44,
+  0x28,
+  0x28,
+  0x10,
+  /* 'w' */
+  0xEE,
+  0x44,
+  0x54,
+  0x54,
+  0x54,
+  0x28,
+  /* 'x' */
+  0xCC,
+  0x48,
+  0x30,
+  0x30,
+  0x48,
+  0xCC,
+  /* 'y' */
+  0xEE,
+  0x44,
+  0x24,
+  0x28,
+  0x18,
+  0x10,
+  0x10,
+  0x78,
+  /* 'z' */
+  0xF8,
+  0x90,
+  0x20,
+  0x40,
+  0x88,
+  0xF8,
+  /* '{' */
+  0x20,
+  0x40,
+  0x40,
+  0x40,
+  0x40,
+  0x80,
+  0x40,
+  0x40,
+  0x40,
+  0x20,
+  /* '|' */
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  /* '}' */
+  0x80,
+  0x40,
+  0x40,
+  0x40,
+  0x40,
+  0x20,
+  0x40,
+  0x40,
+  0x40,
+  0x80,
+  /* '~' */
+  0x48,
+  0xB0,
+};
 
-	// @1128 '~' (7 pixels wide)
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x24, //   #  # 
-	0x58, //  # ##  
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
-	0x00, //        
+static const sGLYPH Font12_Glyphs[] =
+{
+  /* Offset, XOffset, YOffset, Width, Height */
+  {     0,  0,  0,  0,  0 }, /* ' ' */
+  {     0,  3,  1,  1,  8 }, /* '!' */
+  {     8,  1,  1,  5,  3 }, /* '"' */
+  {    11,  1,  1,  5,  9 }, /* '#' */
+  {    20,  1,  1,  4,  9 }, /* '$' */
+  {    29,  1,  1,  5,  8 }, /* '%' */
+  {    37,  1,  3,  5,  6 }, /* '&' */
+  {    43,  3,  1,  1,  4 }, /* ''' */
+  {    47,  3,  1,  2, 10 }, /* '(' */
+  {    57,  2,  1,  2, 10 }, /* ')' */
+  {    67,  1,  1,  5,  5 }, /* '*' */
+  {    72,  0,  2,  7,  7 }, /* '+' */
+  {    79,  2,  7,  3,  4 }, /* ',' */
+  {    83,  1,  5,  5,  1 }, /* '-' */
+  {    84,  2,  7,  2,  2 }, /* '.' */
+  {    86,  1,  1,  5,  9 }, /* '/' */
+  {    95,  1,  1,  5,  8 }, /* '0' */
+  {   103,  1,  1,  5,  8 }, /* '1' */
+  {   111,  1,  1,  5,  8 }, /* '2' */
+  {   119,  1,  1,  5,  8 }, /* '3' */
+  {   127,  1,  1,  6,  8 }, /* '4' */
+  {   135,  1,  1,  5,  8 }, /* '5' */
+  {   143,  1,  1,  5,  8 }, /* '6' */
+  {   151,  1,  1,  5,  8 }, /* '7' */
+  {   159,  1,  1,  5,  8 }, /* '8' */
+  {   167,  1,  1,  5,  8 }, /* '9' */
+  {   175,  2,  3,  2,  6 }, /* ':' */
+  {   181,  2,  3,  3,  7 }, /* ';' */
+  {   188,  0,  2,  6,  7 }, /* '<' */
+  {   195,  1,  4,  5,  3 }, /* '=' */
+  {   198,  0,  2,  6,  7 }, /* '>' */
+  {   205,  2,  2,  4,  7 }, /* '?' */
+  {   212,  1,  0,  5, 10 }, /* '@' */
+  {   222,  0,  1,  7,  8 }, /* 'A' */
+  {   230,  0,  1,  6,  8 }, /* 'B' */
+  {   238,  1,  1,  5,  8 }, /* 'C' */
+  {   246,  0,  1,  6,  8 }, /* 'D' */
+  {   254,  0,  1,  6,  8 }, /* 'E' */
+  {   262,  1,  1,  6,  8 }, /* 'F' */
+  {   270,  1,  1,  6,  8 }, /* 'G' */
+  {   278,  0,  1,  7,  8 }, /* 'H' */
+  {   286,  1,  1,  5,  8 }, /* 'I' */
+  {   294,  1,  1,  5,  8 }, /* 'J' */
+  {   302,  0,  1,  7,  8 }, /* 'K' */
+  {   310,  1,  1,  5,  8 }, /* 'L' */
+  {   318,  0,  1,  7,  8 }, /* 'M' */
+  {   326,  0,  1,  7,  8 }, /* 'N' */
+  {   334,  1,  1,  5,  8 }, /* 'O' */
+  {   342,  1,  1,  5,  8 }, /* 'P' */
+  {   350,  1,  1,  5,  9 }, /* 'Q' */
+  {   359,  0,  1,  7,  8 }, /* 'R' */
+  {   367,  1,  1,  5,  8 }, /* 'S' */
+  {   375,  0,  1,  7,  8 }, /* 'T' */
+  {   383,  0,  1,  7,  8 }, /* 'U' */
+  {   391,  0,  1,  7,  8 }, /* 'V' */
+  {   399,  0,  1,  7,  8 }, /* 'W' */
+  {   407,  0,  1,  7,  8 }, /* 'X' */
+  {   415,  0,  1,  7,  8 }, /* 'Y' */
+  {   423,  1,  1,  5,  8 }, /* 'Z' */
+  {   431,  2,  1,  3, 10 }, /* '[' */
+  {   441,  1,  1,  4,  9 }, /* '\\' */
+  {   450,  2,  1,  3, 10 }, /* ']' */
+  {   460,  1,  1,  5,  4 }, /* '^' */
+  {   464,  0, 11,  7,  1 }, /* '_' */
+  {   465,  3,  1,  2,  2 }, /* '`' */
+  {   467,  1,  3,  6,  6 }, /* 'a' */
+  {   473,  0,  1,  6,  8 }, /* 'b' */
+  {   481,  1,  3,  5,  6 }, /* 'c' */
+  {   487,  1,  1,  6,  8 }, /* 'd' */
+  {   495,  1,  3,  5,  6 }, /* 'e' */
+  {   501,  1,  1,  5,  8 }, /* 'f' */
+  {   509,  1,  3,  6,  8 }, /* 'g' */
+  {   517,  0,  1,  7,  8 }, /* 'h' */
+  {   525,  1,  1,  5,  8 }, /* 'i' */
+  {   533,  1,  1,  4, 10 }, /* 'j' */
+  {   543,  0,  1,  6,  8 }, /* 'k' */
+  {   551,  1,  1,  5,  8 }, /* 'l' */
+  {   559,  0,  3,  7,  6 }, /* 'm' */
+  {   565,  0,  3,  7,  6 }, /* 'n' */
+  {   571,  1,  3,  5,  6 }, /* 'o' */
+  {   577,  0,  3,  6,  8 }, /* 'p' */
+  {   585,  1,  3,  6,  8 }, /* 'q' */
+  {   593,  1,  3,  5,  6 }, /* 'r' */
+  {   599,  1,  3,  5,  6 }, /* 's' */
+  {   605,  1,  2,  6,  7 }, /* 't' */
+  {   612,  0,  3,  7,  6 }, /* 'u' */
+  {   618,  0,  3,  7,  6 }, /* 'v' */
+  {   624,  0,  3,  7,  6 }, /* 'w' */
+  {   630,  0,  3,  6,  6 }, /* 'x' */
+  {   636,  0,  3,  7,  8 }, /* 'y' */
+  {   644,  1,  3,  5,  6 }, /* 'z' */
+  {   650,  2,  1,  3, 10 }, /* '{' */
+  {   660,  3,  1,  1,  9 }, /* '|' */
+  {   669,  2,  1,  3, 10 }, /* '}' */
+  {   679,  1,  5,  5,  2 }, /* '~' */
 };
 
 sFONT Font12 = {
-  Font12_Table,
+  Font12_Bitmap,
+  Font12_Glyphs,
   7, /* Width */
   12, /* Height */
+  32, /* FirstChar */
+  95, /* GlyphCount */
+  1, /* Bpp */
 };
-
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Function_Prototypes
-  * @{
-  */ 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Functions
-  * @{
-  */
-    
-/**
-  * @}
-  */
-  
-/**
-  * @}
-  */ 
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */  
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
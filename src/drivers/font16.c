@@ -1,10 +1,9 @@
 /**
   ******************************************************************************
   * @file    font16.c
-  * @author  MCD Application Team
-  * @version V1.0.0
-  * @date    18-February-2014
-  * @brief   This file provides text font16 for STM32xx-EVAL's LCD driver. 
+  * @brief   Font16 glyphs, 11x16 cells, 1 bpp, 1173 bytes of bitmap.
+  *          Generated by tools/fontgen from the STMicroelectronics
+  *          tables, do not edit.
   ******************************************************************************
   * @attention
   *
@@ -35,1810 +34,1037 @@
   ******************************************************************************
   */
 
-/* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
-/** @addtogroup Utilities
-  * @{
-  */
-  
-/** @addtogroup STM32_EVAL
-  * @{
-  */ 
-
-/** @addtogroup Common
-  * @{
-  */
-
-/** @addtogroup FONTS
-  * @brief      This file provides text font16 for STM32xx-EVAL's LCD driver.
-  * @{
-  */  
-
-/** @defgroup FONTS_Private_Types
-  * @{
-  */ 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Defines
-  * @{
-  */
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Macros
-  * @{
-  */
-/**
-  * @}
-  */ 
-  
-
-/** @defgroup FONTS_Private_Variables
-  * @{
-  */
-// 
-//  Font data for Courier New 12pt
-// 
-
-const uint8_t Font16_Table[] = 
+static const uint8_t Font16_Bitmap[] =
 {
-	// @0 ' ' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @32 '!' (11 pixels wide)
-	0x00, 0x00, //            
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @64 '"' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1D, 0xC0, //    ### ### 
-	0x1D, 0xC0, //    ### ### 
-	0x08, 0x80, //     #   #  
-	0x08, 0x80, //     #   #  
-	0x08, 0x80, //     #   #  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @96 '#' (11 pixels wide)
-	0x00, 0x00, //            
-	0x0D, 0x80, //     ## ##  
-	0x0D, 0x80, //     ## ##  
-	0x0D, 0x80, //     ## ##  
-	0x0D, 0x80, //     ## ##  
-	0x3F, 0xC0, //   ######## 
-	0x1B, 0x00, //    ## ##   
-	0x3F, 0xC0, //   ######## 
-	0x1B, 0x00, //    ## ##   
-	0x1B, 0x00, //    ## ##   
-	0x1B, 0x00, //    ## ##   
-	0x1B, 0x00, //    ## ##   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @128 '$' (11 pixels wide)
-	0x04, 0x00, //      #     
-	0x1F, 0x80, //    ######  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x38, 0x00, //   ###      
-	0x1E, 0x00, //    ####    
-	0x0F, 0x00, //     ####   
-	0x03, 0x80, //       ###  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x3F, 0x00, //   ######   
-	0x04, 0x00, //      #     
-	0x04, 0x00, //      #     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @160 '%' (11 pixels wide)
-	0x00, 0x00, //            
-	0x18, 0x00, //    ##      
-	0x24, 0x00, //   #  #     
-	0x24, 0x00, //   #  #     
-	0x18, 0xC0, //    ##   ## 
-	0x07, 0x80, //      ####  
-	0x1E, 0x00, //    ####    
-	0x31, 0x80, //   ##   ##  
-	0x02, 0x40, //       #  # 
-	0x02, 0x40, //       #  # 
-	0x01, 0x80, //        ##  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @192 '&' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x0F, 0x00, //     ####   
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x0C, 0x00, //     ##     
-	0x1D, 0x80, //    ### ##  
-	0x37, 0x00, //   ## ###   
-	0x33, 0x00, //   ##  ##   
-	0x1D, 0x80, //    ### ##  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @224 ''' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x07, 0x00, //      ###   
-	0x07, 0x00, //      ###   
-	0x02, 0x00, //       #    
-	0x02, 0x00, //       #    
-	0x02, 0x00, //       #    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @256 '(' (11 pixels wide)
-	0x00, 0x00, //            
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x06, 0x00, //      ##    
-	0x0E, 0x00, //     ###    
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0E, 0x00, //     ###    
-	0x06, 0x00, //      ##    
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @288 ')' (11 pixels wide)
-	0x00, 0x00, //            
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x0C, 0x00, //     ##     
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x0C, 0x00, //     ##     
-	0x1C, 0x00, //    ###     
-	0x18, 0x00, //    ##      
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @320 '*' (11 pixels wide)
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x3F, 0xC0, //   ######## 
-	0x3F, 0xC0, //   ######## 
-	0x0F, 0x00, //     ####   
-	0x1F, 0x80, //    ######  
-	0x19, 0x80, //    ##  ##  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @352 '+' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x04, 0x00, //      #     
-	0x04, 0x00, //      #     
-	0x04, 0x00, //      #     
-	0x3F, 0x80, //   #######  
-	0x04, 0x00, //      #     
-	0x04, 0x00, //      #     
-	0x04, 0x00, //      #     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @384 ',' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x04, 0x00, //      #     
-	0x0C, 0x00, //     ##     
-	0x08, 0x00, //     #      
-	0x08, 0x00, //     #      
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @416 '-' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x3F, 0x80, //   #######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @448 '.' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @480 '/' (11 pixels wide)
-	0x00, 0xC0, //         ## 
-	0x00, 0xC0, //         ## 
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x06, 0x00, //      ##    
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @512 '0' (11 pixels wide)
-	0x00, 0x00, //            
-	0x0E, 0x00, //     ###    
-	0x1B, 0x00, //    ## ##   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x1B, 0x00, //    ## ##   
-	0x0E, 0x00, //     ###    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @544 '1' (11 pixels wide)
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x3E, 0x00, //   #####    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x3F, 0xC0, //   ######## 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @576 '2' (11 pixels wide)
-	0x00, 0x00, //            
-	0x0F, 0x00, //     ####   
-	0x19, 0x80, //    ##  ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x03, 0x00, //       ##   
-	0x06, 0x00, //      ##    
-	0x0C, 0x00, //     ##     
-	0x18, 0x00, //    ##      
-	0x30, 0x00, //   ##       
-	0x3F, 0x80, //   #######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @608 '3' (11 pixels wide)
-	0x00, 0x00, //            
-	0x3F, 0x00, //   ######   
-	0x61, 0x80, //  ##    ##  
-	0x01, 0x80, //        ##  
-	0x03, 0x00, //       ##   
-	0x1F, 0x00, //    #####   
-	0x03, 0x80, //       ###  
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x61, 0x80, //  ##    ##  
-	0x3F, 0x00, //   ######   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @640 '4' (11 pixels wide)
-	0x00, 0x00, //            
-	0x07, 0x00, //      ###   
-	0x07, 0x00, //      ###   
-	0x0F, 0x00, //     ####   
-	0x0B, 0x00, //     # ##   
-	0x1B, 0x00, //    ## ##   
-	0x13, 0x00, //    #  ##   
-	0x33, 0x00, //   ##  ##   
-	0x3F, 0x80, //   #######  
-	0x03, 0x00, //       ##   
-	0x0F, 0x80, //     #####  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @672 '5' (11 pixels wide)
-	0x00, 0x00, //            
-	0x1F, 0x80, //    ######  
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x1F, 0x00, //    #####   
-	0x11, 0x80, //    #   ##  
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x21, 0x80, //   #    ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @704 '6' (11 pixels wide)
-	0x00, 0x00, //            
-	0x07, 0x80, //      ####  
-	0x1C, 0x00, //    ###     
-	0x18, 0x00, //    ##      
-	0x30, 0x00, //   ##       
-	0x37, 0x00, //   ## ###   
-	0x39, 0x80, //   ###  ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x19, 0x80, //    ##  ##  
-	0x0F, 0x00, //     ####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @736 '7' (11 pixels wide)
-	0x00, 0x00, //            
-	0x7F, 0x00, //  #######   
-	0x43, 0x00, //  #    ##   
-	0x03, 0x00, //       ##   
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @768 '8' (11 pixels wide)
-	0x00, 0x00, //            
-	0x1F, 0x00, //    #####   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @800 '9' (11 pixels wide)
-	0x00, 0x00, //            
-	0x1E, 0x00, //    ####    
-	0x33, 0x00, //   ##  ##   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x33, 0x80, //   ##  ###  
-	0x1D, 0x80, //    ### ##  
-	0x01, 0x80, //        ##  
-	0x03, 0x00, //       ##   
-	0x07, 0x00, //      ###   
-	0x3C, 0x00, //   ####     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @832 ':' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @864 ';' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x04, 0x00, //      #     
-	0x08, 0x00, //     #      
-	0x08, 0x00, //     #      
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @896 '<' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0xC0, //         ## 
-	0x03, 0x00, //       ##   
-	0x04, 0x00, //      #     
-	0x18, 0x00, //    ##      
-	0x60, 0x00, //  ##        
-	0x18, 0x00, //    ##      
-	0x04, 0x00, //      #     
-	0x03, 0x00, //       ##   
-	0x00, 0xC0, //         ## 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @928 '=' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0xC0, //  ######### 
-	0x00, 0x00, //            
-	0x7F, 0xC0, //  ######### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @960 '>' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x60, 0x00, //  ##        
-	0x18, 0x00, //    ##      
-	0x04, 0x00, //      #     
-	0x03, 0x00, //       ##   
-	0x00, 0xC0, //         ## 
-	0x03, 0x00, //       ##   
-	0x04, 0x00, //      #     
-	0x18, 0x00, //    ##      
-	0x60, 0x00, //  ##        
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @992 '?' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x00, //    #####   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x01, 0x80, //        ##  
-	0x07, 0x00, //      ###   
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1024 '@' (11 pixels wide)
-	0x00, 0x00, //            
-	0x0E, 0x00, //     ###    
-	0x11, 0x00, //    #   #   
-	0x21, 0x00, //   #    #   
-	0x21, 0x00, //   #    #   
-	0x27, 0x00, //   #  ###   
-	0x29, 0x00, //   # #  #   
-	0x29, 0x00, //   # #  #   
-	0x27, 0x00, //   #  ###   
-	0x20, 0x00, //   #        
-	0x11, 0x00, //    #   #   
-	0x0E, 0x00, //     ###    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1056 'A' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x3F, 0x00, //   ######   
-	0x0F, 0x00, //     ####   
-	0x09, 0x00, //     #  #   
-	0x19, 0x80, //    ##  ##  
-	0x19, 0x80, //    ##  ##  
-	0x1F, 0x80, //    ######  
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x79, 0xE0, //  ####  ####
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1088 'B' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0x00, //  #######   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x3F, 0x00, //   ######   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x7F, 0x00, //  #######   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1120 'C' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x40, //    ##### # 
-	0x30, 0xC0, //   ##    ## 
-	0x60, 0x40, //  ##      # 
-	0x60, 0x00, //  ##        
-	0x60, 0x00, //  ##        
-	0x60, 0x00, //  ##        
-	0x60, 0x40, //  ##      # 
-	0x30, 0x80, //   ##    #  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1152 'D' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0x00, //  #######   
-	0x31, 0x80, //   ##   ##  
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x31, 0x80, //   ##   ##  
-	0x7F, 0x00, //  #######   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1184 'E' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0x80, //  ########  
-	0x30, 0x80, //   ##    #  
-	0x30, 0x80, //   ##    #  
-	0x32, 0x00, //   ##  #    
-	0x3E, 0x00, //   #####    
-	0x32, 0x00, //   ##  #    
-	0x30, 0x80, //   ##    #  
-	0x30, 0x80, //   ##    #  
-	0x7F, 0x80, //  ########  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1216 'F' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0xC0, //  ######### 
-	0x30, 0x40, //   ##     # 
-	0x30, 0x40, //   ##     # 
-	0x32, 0x00, //   ##  #    
-	0x3E, 0x00, //   #####    
-	0x32, 0x00, //   ##  #    
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x7C, 0x00, //  #####     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1248 'G' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1E, 0x80, //    #### #  
-	0x31, 0x80, //   ##   ##  
-	0x60, 0x80, //  ##     #  
-	0x60, 0x00, //  ##        
-	0x60, 0x00, //  ##        
-	0x67, 0xC0, //  ##  ##### 
-	0x61, 0x80, //  ##    ##  
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1280 'H' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0xC0, //  #### #### 
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x3F, 0x80, //   #######  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x7B, 0xC0, //  #### #### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1312 'I' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x3F, 0xC0, //   ######## 
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x3F, 0xC0, //   ######## 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1344 'J' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0xC0, //    ####### 
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x63, 0x00, //  ##   ##   
-	0x63, 0x00, //  ##   ##   
-	0x63, 0x00, //  ##   ##   
-	0x3E, 0x00, //   #####    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1376 'K' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0xC0, //  #### #### 
-	0x31, 0x80, //   ##   ##  
-	0x33, 0x00, //   ##  ##   
-	0x36, 0x00, //   ## ##    
-	0x3C, 0x00, //   ####     
-	0x3E, 0x00, //   #####    
-	0x33, 0x00, //   ##  ##   
-	0x31, 0x80, //   ##   ##  
-	0x79, 0xC0, //  ####  ### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1408 'L' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7E, 0x00, //  ######    
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x40, //    ##    # 
-	0x18, 0x40, //    ##    # 
-	0x18, 0x40, //    ##    # 
-	0x7F, 0xC0, //  ######### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1440 'M' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0xE0, 0xE0, // ###     ###
-	0x60, 0xC0, //  ##     ## 
-	0x71, 0xC0, //  ###   ### 
-	0x7B, 0xC0, //  #### #### 
-	0x6A, 0xC0, //  ## # # ## 
-	0x6E, 0xC0, //  ## ### ## 
-	0x64, 0xC0, //  ##  #  ## 
-	0x60, 0xC0, //  ##     ## 
-	0xFB, 0xE0, // ##### #####
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1472 'N' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x73, 0xC0, //  ###  #### 
-	0x31, 0x80, //   ##   ##  
-	0x39, 0x80, //   ###  ##  
-	0x3D, 0x80, //   #### ##  
-	0x35, 0x80, //   ## # ##  
-	0x37, 0x80, //   ## ####  
-	0x33, 0x80, //   ##  ###  
-	0x31, 0x80, //   ##   ##  
-	0x79, 0x80, //  ####  ##  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1504 'O' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x00, //    #####   
-	0x31, 0x80, //   ##   ##  
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1536 'P' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0x00, //  #######   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x3F, 0x00, //   ######   
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x7E, 0x00, //  ######    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1568 'Q' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x00, //    #####   
-	0x31, 0x80, //   ##   ##  
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x0C, 0xC0, //     ##  ## 
-	0x1F, 0x80, //    ######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1600 'R' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0x00, //  #######   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x3E, 0x00, //   #####    
-	0x33, 0x00, //   ##  ##   
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x7C, 0xE0, //  #####  ###
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1632 'S' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x80, //    ######  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x38, 0x00, //   ###      
-	0x1F, 0x00, //    #####   
-	0x03, 0x80, //       ###  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x3F, 0x00, //   ######   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1664 'T' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0x80, //  ########  
-	0x4C, 0x80, //  #  ##  #  
-	0x4C, 0x80, //  #  ##  #  
-	0x4C, 0x80, //  #  ##  #  
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x3F, 0x00, //   ######   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1696 'U' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0xC0, //  #### #### 
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1728 'V' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0xC0, //  #### #### 
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x1B, 0x00, //    ## ##   
-	0x1B, 0x00, //    ## ##   
-	0x1B, 0x00, //    ## ##   
-	0x0A, 0x00, //     # #    
-	0x0E, 0x00, //     ###    
-	0x0E, 0x00, //     ###    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1760 'W' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0xFB, 0xE0, // ##### #####
-	0x60, 0xC0, //  ##     ## 
-	0x64, 0xC0, //  ##  #  ## 
-	0x6E, 0xC0, //  ## ### ## 
-	0x6E, 0xC0, //  ## ### ## 
-	0x2A, 0x80, //   # # # #  
-	0x3B, 0x80, //   ### ###  
-	0x3B, 0x80, //   ### ###  
-	0x31, 0x80, //   ##   ##  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1792 'X' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0xC0, //  #### #### 
-	0x31, 0x80, //   ##   ##  
-	0x1B, 0x00, //    ## ##   
-	0x0E, 0x00, //     ###    
-	0x0E, 0x00, //     ###    
-	0x0E, 0x00, //     ###    
-	0x1B, 0x00, //    ## ##   
-	0x31, 0x80, //   ##   ##  
-	0x7B, 0xC0, //  #### #### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1824 'Y' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x79, 0xE0, //  ####  ####
-	0x30, 0xC0, //   ##    ## 
-	0x19, 0x80, //    ##  ##  
-	0x0F, 0x00, //     ####   
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x1F, 0x80, //    ######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1856 'Z' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x3F, 0x80, //   #######  
-	0x21, 0x80, //   #    ##  
-	0x23, 0x00, //   #   ##   
-	0x06, 0x00, //      ##    
-	0x04, 0x00, //      #     
-	0x0C, 0x00, //     ##     
-	0x18, 0x80, //    ##   #  
-	0x30, 0x80, //   ##    #  
-	0x3F, 0x80, //   #######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1888 '[' (11 pixels wide)
-	0x00, 0x00, //            
-	0x07, 0x80, //      ####  
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x07, 0x80, //      ####  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1920 '\' (11 pixels wide)
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x06, 0x00, //      ##    
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x00, 0xC0, //         ## 
-	0x00, 0xC0, //         ## 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1952 ']' (11 pixels wide)
-	0x00, 0x00, //            
-	0x1E, 0x00, //    ####    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x1E, 0x00, //    ####    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @1984 '^' (11 pixels wide)
-	0x04, 0x00, //      #     
-	0x0A, 0x00, //     # #    
-	0x0A, 0x00, //     # #    
-	0x11, 0x00, //    #   #   
-	0x20, 0x80, //   #     #  
-	0x20, 0x80, //   #     #  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2016 '_' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0xFF, 0xE0, // ###########
-
-	// @2048 '`' (11 pixels wide)
-	0x08, 0x00, //     #      
-	0x04, 0x00, //      #     
-	0x02, 0x00, //       #    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2080 'a' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x00, //    #####   
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x1F, 0x80, //    ######  
-	0x31, 0x80, //   ##   ##  
-	0x33, 0x80, //   ##  ###  
-	0x1D, 0xC0, //    ### ### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2112 'b' (11 pixels wide)
-	0x00, 0x00, //            
-	0x70, 0x00, //  ###       
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x37, 0x00, //   ## ###   
-	0x39, 0x80, //   ###  ##  
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x39, 0x80, //   ###  ##  
-	0x77, 0x00, //  ### ###   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2144 'c' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1E, 0x80, //    #### #  
-	0x31, 0x80, //   ##   ##  
-	0x60, 0x80, //  ##     #  
-	0x60, 0x00, //  ##        
-	0x60, 0x80, //  ##     #  
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2176 'd' (11 pixels wide)
-	0x00, 0x00, //            
-	0x03, 0x80, //       ###  
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x1D, 0x80, //    ### ##  
-	0x33, 0x80, //   ##  ###  
-	0x61, 0x80, //  ##    ##  
-	0x61, 0x80, //  ##    ##  
-	0x61, 0x80, //  ##    ##  
-	0x33, 0x80, //   ##  ###  
-	0x1D, 0xC0, //    ### ### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2208 'e' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x00, //    #####   
-	0x31, 0x80, //   ##   ##  
-	0x60, 0xC0, //  ##     ## 
-	0x7F, 0xC0, //  ######### 
-	0x60, 0x00, //  ##        
-	0x30, 0xC0, //   ##    ## 
-	0x1F, 0x80, //    ######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2240 'f' (11 pixels wide)
-	0x00, 0x00, //            
-	0x07, 0xE0, //      ######
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x3F, 0x80, //   #######  
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x3F, 0x80, //   #######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2272 'g' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1D, 0xC0, //    ### ### 
-	0x33, 0x80, //   ##  ###  
-	0x61, 0x80, //  ##    ##  
-	0x61, 0x80, //  ##    ##  
-	0x61, 0x80, //  ##    ##  
-	0x33, 0x80, //   ##  ###  
-	0x1D, 0x80, //    ### ##  
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2304 'h' (11 pixels wide)
-	0x00, 0x00, //            
-	0x70, 0x00, //  ###       
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x37, 0x00, //   ## ###   
-	0x39, 0x80, //   ###  ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x7B, 0xC0, //  #### #### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2336 'i' (11 pixels wide)
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x00, 0x00, //            
-	0x1E, 0x00, //    ####    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x3F, 0xC0, //   ######## 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2368 'j' (11 pixels wide)
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x00, 0x00, //            
-	0x3F, 0x00, //   ######   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x03, 0x00, //       ##   
-	0x3E, 0x00, //   #####    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2400 'k' (11 pixels wide)
-	0x00, 0x00, //            
-	0x70, 0x00, //  ###       
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x37, 0x80, //   ## ####  
-	0x36, 0x00, //   ## ##    
-	0x3C, 0x00, //   ####     
-	0x3C, 0x00, //   ####     
-	0x36, 0x00, //   ## ##    
-	0x33, 0x00, //   ##  ##   
-	0x77, 0xC0, //  ### ##### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2432 'l' (11 pixels wide)
-	0x00, 0x00, //            
-	0x1E, 0x00, //    ####    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x3F, 0xC0, //   ######## 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2464 'm' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7F, 0x80, //  ########  
-	0x36, 0xC0, //   ## ## ## 
-	0x36, 0xC0, //   ## ## ## 
-	0x36, 0xC0, //   ## ## ## 
-	0x36, 0xC0, //   ## ## ## 
-	0x36, 0xC0, //   ## ## ## 
-	0x76, 0xE0, //  ### ## ###
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2496 'n' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x77, 0x00, //  ### ###   
-	0x39, 0x80, //   ###  ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x7B, 0xC0, //  #### #### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2528 'o' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x00, //    #####   
-	0x31, 0x80, //   ##   ##  
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x60, 0xC0, //  ##     ## 
-	0x31, 0x80, //   ##   ##  
-	0x1F, 0x00, //    #####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2560 'p' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x77, 0x00, //  ### ###   
-	0x39, 0x80, //   ###  ##  
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x30, 0xC0, //   ##    ## 
-	0x39, 0x80, //   ###  ##  
-	0x37, 0x00, //   ## ###   
-	0x30, 0x00, //   ##       
-	0x30, 0x00, //   ##       
-	0x7C, 0x00, //  #####     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2592 'q' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1D, 0xC0, //    ### ### 
-	0x33, 0x80, //   ##  ###  
-	0x61, 0x80, //  ##    ##  
-	0x61, 0x80, //  ##    ##  
-	0x61, 0x80, //  ##    ##  
-	0x33, 0x80, //   ##  ###  
-	0x1D, 0x80, //    ### ##  
-	0x01, 0x80, //        ##  
-	0x01, 0x80, //        ##  
-	0x07, 0xC0, //      ##### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2624 'r' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0x80, //  #### ###  
-	0x1C, 0xC0, //    ###  ## 
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x7F, 0x00, //  #######   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2656 's' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x1F, 0x80, //    ######  
-	0x31, 0x80, //   ##   ##  
-	0x3C, 0x00, //   ####     
-	0x1F, 0x00, //    #####   
-	0x03, 0x80, //       ###  
-	0x31, 0x80, //   ##   ##  
-	0x3F, 0x00, //   ######   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2688 't' (11 pixels wide)
-	0x00, 0x00, //            
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x7F, 0x00, //  #######   
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x00, //    ##      
-	0x18, 0x80, //    ##   #  
-	0x0F, 0x00, //     ####   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2720 'u' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x73, 0x80, //  ###  ###  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x33, 0x80, //   ##  ###  
-	0x1D, 0xC0, //    ### ### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2752 'v' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0xC0, //  #### #### 
-	0x31, 0x80, //   ##   ##  
-	0x31, 0x80, //   ##   ##  
-	0x1B, 0x00, //    ## ##   
-	0x1B, 0x00, //    ## ##   
-	0x0E, 0x00, //     ###    
-	0x0E, 0x00, //     ###    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2784 'w' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0xF1, 0xE0, // ####   ####
-	0x60, 0xC0, //  ##     ## 
-	0x64, 0xC0, //  ##  #  ## 
-	0x6E, 0xC0, //  ## ### ## 
-	0x3B, 0x80, //   ### ###  
-	0x3B, 0x80, //   ### ###  
-	0x31, 0x80, //   ##   ##  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2816 'x' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x7B, 0xC0, //  #### #### 
-	0x1B, 0x00, //    ## ##   
-	0x0E, 0x00, //     ###    
-	0x0E, 0x00, //     ###    
-	0x0E, 0x00, //     ###    
-	0x1B, 0x00, //    ## ##   
-	0x7B, 0xC0, //  #### #### 
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2848 'y' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x79, 0xE0, //  ####  ####
-	0x30, 0xC0, //   ##    ## 
-	0x19, 0x80, //    ##  ##  
-	0x19, 0x80, //    ##  ##  
-	0x0B, 0x00, //     # ##   
-	0x0F, 0x00, //     ####   
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x0C, 0x00, //     ##     
-	0x3E, 0x00, //   #####    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2880 'z' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x3F, 0x80, //   #######  
-	0x21, 0x80, //   #    ##  
-	0x03, 0x00, //       ##   
-	0x0E, 0x00, //     ###    
-	0x18, 0x00, //    ##      
-	0x30, 0x80, //   ##    #  
-	0x3F, 0x80, //   #######  
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2912 '{' (11 pixels wide)
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x18, 0x00, //    ##      
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x0C, 0x00, //     ##     
-	0x06, 0x00, //      ##    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2944 '|' (11 pixels wide)
-	0x00, 0x00, //            
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-
-	// @2976 '}' (11 pixels wide)
-	0x00, 0x00, //            
-	0x0C, 0x00, //     ##     
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x03, 0x00, //       ##   
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x06, 0x00, //      ##    
-	0x0C, 0x00, //     ##     
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
+  /* '!' */
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0x00,
+  0xC0,
+  /* '"' */
+  0xEE,
+  0xEE,
+  0x44,
+  0x44,
+  0x44,
+  /* '#' */
+  0x36,
+  0x36,
+  0x36,
+  0x36,
+  0xFF,
+  0x6C,
+  0xFF,
+  0x6C,
+  0x6C,
+  0x6C,
+  0x6C,
+  /* '$' */
+  0x10,
+  0x7E,
+  0xC6,
+  0xC6,
+  0xE0,
+  0x78,
+  0x3C,
+  0x0E,
+  0xC6,
+  0xC6,
+  0xFC,
+  0x10,
+  0x10,
+  /* '%' */
+  0x60,
+  0x90,
+  0x90,
+  0x63,
+  0x1E,
+  0x78,
+  0xC6,
+  0x09,
+  0x09,
+  0x06,
+  /* '&' */
+  0x3C,
+  0x60,
+  0x60,
+  0x60,
+  0x30,
+  0x76,
+  0xDC,
+  0xCC,
+  0x76,
+  /* ''' */
+  0xE0,
+  0xE0,
+  0x40,
+  0x40,
+  0x40,
+  /* '(' */
+  0x30,
+  0x30,
+  0x60,
+  0xE0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xE0,
+  0x60,
+  0x30,
+  0x30,
+  /* ')' */
+  0xC0,
+  0xC0,
+  0x60,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x60,
+  0xE0,
+  0xC0,
+  /* '*' */
+  0x18,
+  0x18,
+  0xFF,
+  0xFF,
+  0x3C,
+  0x7E,
+  0x66,
+  /* '+' */
+  0x10,
+  0x10,
+  0x10,
+  0xFE,
+  0x10,
+  0x10,
+  0x10,
+  /* ',' */
+  0x60,
+  0x40,
+  0xC0,
+  0x80,
+  0x80,
+  /* '-' */
+  0xFE,
+  /* '.' */
+  0xC0,
+  0xC0,
+  /* '/' */
+  0x03,
+  0x03,
+  0x06,
+  0x06,
+  0x0C,
+  0x0C,
+  0x18,
+  0x30,
+  0x30,
+  0x60,
+  0x60,
+  0xC0,
+  0xC0,
+  /* '0' */
+  0x38,
+  0x6C,
+  0xC6,
+  0xC6,
+  0xC6,
+  0xC6,
+  0xC6,
+  0xC6,
+  0x6C,
+  0x38,
+  /* '1' */
+  0x18,
+  0xF8,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0xFF,
+  /* '2' */
+  0x3C,
+  0x66,
+  0xC6,
+  0xC6,
+  0x0C,
+  0x18,
+  0x30,
+  0x60,
+  0xC0,
+  0xFE,
+  /* '3' */
+  0x7E,
+  0xC3,
+  0x03,
+  0x06,
+  0x3E,
+  0x07,
+  0x03,
+  0x03,
+  0xC3,
+  0x7E,
+  /* '4' */
+  0x1C,
+  0x1C,
+  0x3C,
+  0x2C,
+  0x6C,
+  0x4C,
+  0xCC,
+  0xFE,
+  0x0C,
+  0x3E,
+  /* '5' */
+  0x7E,
+  0x60,
+  0x60,
+  0x60,
+  0x7C,
+  0x46,
+  0x06,
+  0x06,
+  0x86,
+  0x7C,
+  /* '6' */
+  0x1E,
+  0x70,
+  0x60,
+  0xC0,
+  0xDC,
+  0xE6,
+  0xC6,
+  0xC6,
+  0x66,
+  0x3C,
+  /* '7' */
+  0xFE,
+  0x86,
+  0x06,
+  0x0C,
+  0x0C,
+  0x0C,
+  0x0C,
+  0x18,
+  0x18,
+  0x18,
+  /* '8' */
+  0x7C,
+  0xC6,
+  0xC6,
+  0xC6,
+  0x7C,
+  0xC6,
+  0xC6,
+  0xC6,
+  0xC6,
+  0x7C,
+  /* '9' */
+  0x78,
+  0xCC,
+  0xC6,
+  0xC6,
+  0xCE,
+  0x76,
+  0x06,
+  0x0C,
+  0x1C,
+  0xF0,
+  /* ':' */
+  0xC0,
+  0xC0,
+  0x00,
+  0x00,
+  0x00,
+  0xC0,
+  0xC0,
+  /* ';' */
+  0x30,
+  0x30,
+  0x00,
+  0x00,
+  0x00,
+  0x60,
+  0x40,
+  0x80,
+  0x80,
+  /* '<' */
+  0x01, 0x80,
+  0x06, 0x00,
+  0x08, 0x00,
+  0x30, 0x00,
+  0xC0, 0x00,
+  0x30, 0x00,
+  0x08, 0x00,
+  0x06, 0x00,
+  0x01, 0x80,
+  /* '=' */
+  0xFF, 0x80,
+  0x00, 0x00,
+  0xFF, 0x80,
+  /* '>' */
+  0xC0, 0x00,
+  0x30, 0x00,
+  0x08, 0x00,
+  0x06, 0x00,
+  0x01, 0x80,
+  0x06, 0x00,
+  0x08, 0x00,
+  0x30, 0x00,
+  0xC0, 0x00,
+  /* '?' */
+  0x7C,
+  0xC6,
+  0xC6,
+  0x06,
+  0x1C,
+  0x30,
+  0x30,
+  0x00,
+  0x30,
+  /* '@' */
+  0x38,
+  0x44,
+  0x84,
+  0x84,
+  0x9C,
+  0xA4,
+  0xA4,
+  0x9C,
+  0x80,
+  0x44,
+  0x38,
+  /* 'A' */
+  0x7E, 0x00,
+  0x1E, 0x00,
+  0x12, 0x00,
+  0x33, 0x00,
+  0x33, 0x00,
+  0x3F, 0x00,
+  0x61, 0x80,
+  0x61, 0x80,
+  0xF3, 0xC0,
+  /* 'B' */
+  0xFE,
+  0x63,
+  0x63,
+  0x63,
+  0x7E,
+  0x63,
+  0x63,
+  0x63,
+  0xFE,
+  /* 'C' */
+  0x3E, 0x80,
+  0x61, 0x80,
+  0xC0, 0x80,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0xC0, 0x80,
+  0x61, 0x00,
+  0x3E, 0x00,
+  /* 'D' */
+  0xFE, 0x00,
+  0x63, 0x00,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x63, 0x00,
+  0xFE, 0x00,
+  /* 'E' */
+  0xFF,
+  0x61,
+  0x61,
+  0x64,
+  0x7C,
+  0x64,
+  0x61,
+  0x61,
+  0xFF,
+  /* 'F' */
+  0xFF, 0x80,
+  0x60, 0x80,
+  0x60, 0x80,
+  0x64, 0x00,
+  0x7C, 0x00,
+  0x64, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0xF8, 0x00,
+  /* 'G' */
+  0x3D, 0x00,
+  0x63, 0x00,
+  0xC1, 0x00,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0xCF, 0x80,
+  0xC3, 0x00,
+  0x63, 0x00,
+  0x3E, 0x00,
+  /* 'H' */
+  0xF7, 0x80,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x7F, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0xF7, 0x80,
+  /* 'I' */
+  0xFF,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0xFF,
+  /* 'J' */
+  0x3F, 0x80,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0xC6, 0x00,
+  0xC6, 0x00,
+  0xC6, 0x00,
+  0x7C, 0x00,
+  /* 'K' */
+  0xF7, 0x80,
+  0x63, 0x00,
+  0x66, 0x00,
+  0x6C, 0x00,
+  0x78, 0x00,
+  0x7C, 0x00,
+  0x66, 0x00,
+  0x63, 0x00,
+  0xF3, 0x80,
+  /* 'L' */
+  0xFC, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x80,
+  0x30, 0x80,
+  0x30, 0x80,
+  0xFF, 0x80,
+  /* 'M' */
+  0xE0, 0xE0,
+  0x60, 0xC0,
+  0x71, 0xC0,
+  0x7B, 0xC0,
+  0x6A, 0xC0,
+  0x6E, 0xC0,
+  0x64, 0xC0,
+  0x60, 0xC0,
+  0xFB, 0xE0,
+  /* 'N' */
+  0xE7, 0x80,
+  0x63, 0x00,
+  0x73, 0x00,
+  0x7B, 0x00,
+  0x6B, 0x00,
+  0x6F, 0x00,
+  0x67, 0x00,
+  0x63, 0x00,
+  0xF3, 0x00,
+  /* 'O' */
+  0x3E, 0x00,
+  0x63, 0x00,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0x63, 0x00,
+  0x3E, 0x00,
+  /* 'P' */
+  0xFE,
+  0x63,
+  0x63,
+  0x63,
+  0x63,
+  0x7E,
+  0x60,
+  0x60,
+  0xFC,
+  /* 'Q' */
+  0x3E, 0x00,
+  0x63, 0x00,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0x63, 0x00,
+  0x3E, 0x00,
+  0x19, 0x80,
+  0x3F, 0x00,
+  /* 'R' */
+  0xFE, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x7C, 0x00,
+  0x66, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0xF9, 0xC0,
+  /* 'S' */
+  0x7E,
+  0xC6,
+  0xC6,
+  0xE0,
+  0x7C,
+  0x0E,
+  0xC6,
+  0xC6,
+  0xFC,
+  /* 'T' */
+  0xFF,
+  0x99,
+  0x99,
+  0x99,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x7E,
+  /* 'U' */
+  0xF7, 0x80,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x3E, 0x00,
+  /* 'V' */
+  0xF7, 0x80,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x36, 0x00,
+  0x36, 0x00,
+  0x36, 0x00,
+  0x14, 0x00,
+  0x1C, 0x00,
+  0x1C, 0x00,
+  /* 'W' */
+  0xFB, 0xE0,
+  0x60, 0xC0,
+  0x64, 0xC0,
+  0x6E, 0xC0,
+  0x6E, 0xC0,
+  0x2A, 0x80,
+  0x3B, 0x80,
+  0x3B, 0x80,
+  0x31, 0x80,
+  /* 'X' */
+  0xF7, 0x80,
+  0x63, 0x00,
+  0x36, 0x00,
+  0x1C, 0x00,
+  0x1C, 0x00,
+  0x1C, 0x00,
+  0x36, 0x00,
+  0x63, 0x00,
+  0xF7, 0x80,
+  /* 'Y' */
+  0xF3, 0xC0,
+  0x61, 0x80,
+  0x33, 0x00,
+  0x1E, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x3F, 0x00,
+  /* 'Z' */
+  0xFE,
+  0x86,
+  0x8C,
+  0x18,
+  0x10,
+  0x30,
+  0x62,
+  0xC2,
+  0xFE,
+  /* '[' */
+  0xF0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xF0,
+  /* '\\' */
+  0xC0,
+  0xC0,
+  0x60,
+  0x60,
+  0x30,
+  0x30,
+  0x18,
+  0x0C,
+  0x0C,
+  0x06,
+  0x06,
+  0x03,
+  0x03,
+  /* ']' */
+  0xF0,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0xF0,
+  /* '^' */
+  0x10,
+  0x28,
+  0x28,
+  0x44,
+  0x82,
+  0x82,
+  /* '_' */
+  0xFF, 0xE0,
+  /* '`' */
+  0x80,
+  0x40,
+  0x20,
+  /* 'a' */
+  0x7C,
+  0x06,
+  0x06,
+  0x7E,
+  0xC6,
+  0xCE,
+  0x77,
+  /* 'b' */
+  0xE0, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0x6E, 0x00,
+  0x73, 0x00,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x73, 0x00,
+  0xEE, 0x00,
+  /* 'c' */
+  0x3D,
+  0x63,
+  0xC1,
+  0xC0,
+  0xC1,
+  0x63,
+  0x3E,
+  /* 'd' */
+  0x07, 0x00,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x3B, 0x00,
+  0x67, 0x00,
+  0xC3, 0x00,
+  0xC3, 0x00,
+  0xC3, 0x00,
+  0x67, 0x00,
+  0x3B, 0x80,
+  /* 'e' */
+  0x3E, 0x00,
+  0x63, 0x00,
+  0xC1, 0x80,
+  0xFF, 0x80,
+  0xC0, 0x00,
+  0x61, 0x80,
+  0x3F, 0x00,
+  /* 'f' */
+  0x1F, 0x80,
+  0x30, 0x00,
+  0x30, 0x00,
+  0xFE, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0xFE, 0x00,
+  /* 'g' */
+  0x3B, 0x80,
+  0x67, 0x00,
+  0xC3, 0x00,
+  0xC3, 0x00,
+  0xC3, 0x00,
+  0x67, 0x00,
+  0x3B, 0x00,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x3E, 0x00,
+  /* 'h' */
+  0xE0, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0x6E, 0x00,
+  0x73, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0xF7, 0x80,
+  /* 'i' */
+  0x18,
+  0x18,
+  0x00,
+  0x78,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0xFF,
+  /* 'j' */
+  0x18,
+  0x18,
+  0x00,
+  0xFC,
+  0x0C,
+  0x0C,
+  0x0C,
+  0x0C,
+  0x0C,
+  0x0C,
+  0x0C,
+  0x0C,
+  0xF8,
+  /* 'k' */
+  0xE0, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0x6F, 0x00,
+  0x6C, 0x00,
+  0x78, 0x00,
+  0x78, 0x00,
+  0x6C, 0x00,
+  0x66, 0x00,
+  0xEF, 0x80,
+  /* 'l' */
+  0x78,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0xFF,
+  /* 'm' */
+  0xFF, 0x00,
+  0x6D, 0x80,
+  0x6D, 0x80,
+  0x6D, 0x80,
+  0x6D, 0x80,
+  0x6D, 0x80,
+  0xED, 0xC0,
+  /* 'n' */
+  0xEE, 0x00,
+  0x73, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0xF7, 0x80,
+  /* 'o' */
+  0x3E, 0x00,
+  0x63, 0x00,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0x63, 0x00,
+  0x3E, 0x00,
+  /* 'p' */
+  0xEE, 0x00,
+  0x73, 0x00,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x73, 0x00,
+  0x6E, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0xF8, 0x00,
+  /* 'q' */
+  0x3B, 0x80,
+  0x67, 0x00,
+  0xC3, 0x00,
+  0xC3, 0x00,
+  0xC3, 0x00,
+  0x67, 0x00,
+  0x3B, 0x00,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x0F, 0x80,
+  /* 'r' */
+  0xF7, 0x00,
+  0x39, 0x80,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0xFE, 0x00,
+  /* 's' */
+  0x7E,
+  0xC6,
+  0xF0,
+  0x7C,
+  0x0E,
+  0xC6,
+  0xFC,
+  /* 't' */
+  0x30,
+  0x30,
+  0x30,
+  0xFE,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x31,
+  0x1E,
+  /* 'u' */
+  0xE7, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x67, 0x00,
+  0x3B, 0x80,
+  /* 'v' */
+  0xF7, 0x80,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x36, 0x00,
+  0x36, 0x00,
+  0x1C, 0x00,
+  0x1C, 0x00,
+  /* 'w' */
+  0xF1, 0xE0,
+  0x60, 0xC0,
+  0x64, 0xC0,
+  0x6E, 0xC0,
+  0x3B, 0x80,
+  0x3B, 0x80,
+  0x31, 0x80,
+  /* 'x' */
+  0xF7, 0x80,
+  0x36, 0x00,
+  0x1C, 0x00,
+  0x1C, 0x00,
+  0x1C, 0x00,
+  0x36, 0x00,
+  0xF7, 0x80,
+  /* 'y' */
+  0xF3, 0xC0,
+  0x61, 0x80,
+  0x33, 0x00,
+  0x33, 0x00,
+  0x16, 0x00,
+  0x1E, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x18, 0x00,
+  0x7C, 0x00,
+  /* 'z' */
+  0xFE,
+  0x86,
+  0x0C,
+  0x38,
+  0x60,
+  0xC2,
+  0xFE,
+  /* '{' */
+  0x30,
+  0x60,
+  0x60,
+  0x60,
+  0x60,
+  0x60,
+  0xC0,
+  0x60,
+  0x60,
+  0x60,
+  0x60,
+  0x30,
+  /* '|' */
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  /* '}' */
+  0xC0,
+  0x60,
+  0x60,
+  0x60,
+  0x60,
+  0x60,
+  0x30,
+  0x60,
+  0x60,
+  0x60,
+  0x60,
+  0xC0,
+  /* '~' */
+  0x60,
+  0x92,
+  0x0C,
+};
 
-	// @3008 '~' (11 pixels wide)
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x18, 0x00, //    ##      
-	0x24, 0x80, //   #  #  #  
-	0x03, 0x00, //       ##   
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
-	0x00, 0x00, //            
+static const sGLYPH Font16_Glyphs[] =
+{
+  /* Offset, XOffset, YOffset, Width, Height */
+  {     0,  0,  0,  0,  0 }, /* ' ' */
+  {     0,  4,  1,  2, 10 }, /* '!' */
+  {    10,  3,  2,  7,  5 }, /* '"' */
+  {    15,  2,  1,  8, 11 }, /* '#' */
+  {    26,  2,  0,  7, 13 }, /* '$' */
+  {    39,  2,  1,  8, 10 }, /* '%' */
+  {    49,  2,  2,  7,  9 }, /* '&' */
+  {    58,  5,  2,  3,  5 }, /* ''' */
+  {    63,  4,  1,  4, 12 }, /* '(' */
+  {    75,  3,  1,  4, 12 }, /* ')' */
+  {    87,  2,  1,  8,  7 }, /* '*' */
+  {    94,  2,  3,  7,  7 }, /* '+' */
+  {   101,  4,  9,  3,  5 }, /* ',' */
+  {   106,  2,  6,  7,  1 }, /* '-' */
+  {   107,  4,  9,  2,  2 }, /* '.' */
+  {   109,  2,  0,  8, 13 }, /* '/' */
+  {   122,  2,  1,  7, 10 }, /* '0' */
+  {   132,  2,  1,  8, 10 }, /* '1' */
+  {   142,  2,  1,  7, 10 }, /* '2' */
+  {   152,  1,  1,  8, 10 }, /* '3' */
+  {   162,  2,  1,  7, 10 }, /* '4' */
+  {   172,  2,  1,  7, 10 }, /* '5' */
+  {   182,  2,  1,  7, 10 }, /* '6' */
+  {   192,  1,  1,  7, 10 }, /* '7' */
+  {   202,  2,  1,  7, 10 }, /* '8' */
+  {   212,  2,  1,  7, 10 }, /* '9' */
+  {   222,  4,  4,  2,  7 }, /* ':' */
+  {   229,  4,  4,  4,  9 }, /* ';' */
+  {   238,  1,  2,  9,  9 }, /* '<' */
+  {   256,  1,  5,  9,  3 }, /* '=' */
+  {   262,  1,  2,  9,  9 }, /* '>' */
+  {   280,  2,  2,  7,  9 }, /* '?' */
+  {   289,  2,  1,  6, 11 }, /* '@' */
+  {   300,  1,  2, 10,  9 }, /* 'A' */
+  {   318,  1,  2,  8,  9 }, /* 'B' */
+  {   327,  1,  2,  9,  9 }, /* 'C' */
+  {   345,  1,  2,  9,  9 }, /* 'D' */
+  {   363,  1,  2,  8,  9 }, /* 'E' */
+  {   372,  1,  2,  9,  9 }, /* 'F' */
+  {   390,  1,  2,  9,  9 }, /* 'G' */
+  {   408,  1,  2,  9,  9 }, /* 'H' */
+  {   426,  2,  2,  8,  9 }, /* 'I' */
+  {   435,  1,  2,  9,  9 }, /* 'J' */
+  {   453,  1,  2,  9,  9 }, /* 'K' */
+  {   471,  1,  2,  9,  9 }, /* 'L' */
+  {   489,  0,  2, 11,  9 }, /* 'M' */
+  {   507,  1,  2,  9,  9 }, /* 'N' */
+  {   525,  1,  2,  9,  9 }, /* 'O' */
+  {   543,  1,  2,  8,  9 }, /* 'P' */
+  {   552,  1,  2,  9, 11 }, /* 'Q' */
+  {   574,  1,  2, 10,  9 }, /* 'R' */
+  {   592,  2,  2,  7,  9 }, /* 'S' */
+  {   601,  1,  2,  8,  9 }, /* 'T' */
+  {   610,  1,  2,  9,  9 }, /* 'U' */
+  {   628,  1,  2,  9,  9 }, /* 'V' */
+  {   646,  0,  2, 11,  9 }, /* 'W' */
+  {   664,  1,  2,  9,  9 }, /* 'X' */
+  {   682,  1,  2, 10,  9 }, /* 'Y' */
+  {   700,  2,  2,  7,  9 }, /* 'Z' */
+  {   709,  5,  1,  4, 12 }, /* '[' */
+  {   721,  2,  0,  8, 13 }, /* '\\' */
+  {   734,  3,  1,  4, 12 }, /* ']' */
+  {   746,  2,  0,  7,  6 }, /* '^' */
+  {   752,  0, 15, 11,  1 }, /* '_' */
+  {   754,  4,  0,  3,  3 }, /* '`' */
+  {   757,  2,  4,  8,  7 }, /* 'a' */
+  {   764,  1,  1,  9, 10 }, /* 'b' */
+  {   784,  1,  4,  8,  7 }, /* 'c' */
+  {   791,  1,  1,  9, 10 }, /* 'd' */
+  {   811,  1,  4,  9,  7 }, /* 'e' */
+  {   825,  2,  1,  9, 10 }, /* 'f' */
+  {   845,  1,  4,  9, 10 }, /* 'g' */
+  {   865,  1,  1,  9, 10 }, /* 'h' */
+  {   885,  2,  1,  8, 10 }, /* 'i' */
+  {   895,  2,  1,  6, 13 }, /* 'j' */
+  {   908,  1,  1,  9, 10 }, /* 'k' */
+  {   928,  2,  1,  8, 10 }, /* 'l' */
+  {   938,  1,  4, 10,  7 }, /* 'm' */
+  {   952,  1,  4,  9,  7 }, /* 'n' */
+  {   966,  1,  4,  9,  7 }, /* 'o' */
+  {   980,  1,  4,  9, 10 }, /* 'p' */
+  {  1000,  1,  4,  9, 10 }, /* 'q' */
+  {  1020,  1,  4,  9,  7 }, /* 'r' */
+  {  1034,  2,  4,  7,  7 }, /* 's' */
+  {  1041,  1,  1,  8, 10 }, /* 't' */
+  {  1051,  1,  4,  9,  7 }, /* 'u' */
+  {  1065,  1,  4,  9,  7 }, /* 'v' */
+  {  1079,  0,  4, 11,  7 }, /* 'w' */
+  {  1093,  1,  4,  9,  7 }, /* 'x' */
+  {  1107,  1,  4, 10, 10 }, /* 'y' */
+  {  1127,  2,  4,  7,  7 }, /* 'z' */
+  {  1134,  3,  1,  4, 12 }, /* '{' */
+  {  1146,  5,  1,  2, 12 }, /* '|' */
+  {  1158,  4,  1,  4, 12 }, /* '}' */
+  {  1170,  2,  5,  7,  3 }, /* '~' */
 };
 
 sFONT Font16 = {
-  Font16_Table,
+  Font16_Bitmap,
+  Font16_Glyphs,
   11, /* Width */
   16, /* Height */
+  32, /* FirstChar */
+  95, /* GlyphCount */
+  1, /* Bpp */
 };
-
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Function_Prototypes
-  * @{
-  */ 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Functions
-  * @{
-  */
-    
-/**
-  * @}
-  */
-  
-/**
-  * @}
-  */ 
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */  
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -1,10 +1,9 @@
 /**
   ******************************************************************************
   * @file    font20.c
-  * @author  MCD Application Team
-  * @version V1.0.0
-  * @date    18-February-2014
-  * @brief   This file provides text font20 for STM32xx-EVAL's LCD driver. 
+  * @brief   Font20 glyphs, 14x20 cells, 1 bpp, 1806 bytes of bitmap.
+  *          Generated by tools/fontgen from the STMicroelectronics
+  *          tables, do not edit.
   ******************************************************************************
   * @attention
   *
@@ -35,2189 +34,1290 @@
   ******************************************************************************
   */
 
-/* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
-/** @addtogroup Utilities
-  * @{
-  */
-  
-/** @addtogroup STM32_EVAL
-  * @{
-  */ 
-
-/** @addtogroup Common
-  * @{
-  */
-
-/** @addtogroup FONTS
-  * @brief      This file provides text font20 for STM32xx-EVAL's LCD driver.
-  * @{
-  */  
-
-/** @defgroup FONTS_Private_Types
-  * @{
-  */ 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Defines
-  * @{
-  */
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Macros
-  * @{
-  */
-/**
-  * @}
-  */ 
-  
-
-/** @defgroup FONTS_Private_Variables
-  * @{
-  */
-
-// Character bitmaps for Courier New 15pt
-const uint8_t Font20_Table[] = 
+static const uint8_t Font20_Bitmap[] =
 {
-	// @0 ' ' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @40 '!' (14 pixels wide)
-	0x00, 0x00, //               
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x02, 0x00, //       #       
-	0x02, 0x00, //       #       
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @80 '"' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1C, 0xE0, //    ###  ###   
-	0x1C, 0xE0, //    ###  ###   
-	0x1C, 0xE0, //    ###  ###   
-	0x08, 0x40, //     #    #    
-	0x08, 0x40, //     #    #    
-	0x08, 0x40, //     #    #    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @120 '#' (14 pixels wide)
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @160 '$' (14 pixels wide)
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x07, 0xE0, //      ######   
-	0x0F, 0xE0, //     #######   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x00, //    ##         
-	0x1F, 0x00, //    #####      
-	0x0F, 0xC0, //     ######    
-	0x00, 0xE0, //         ###   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xC0, //    #######    
-	0x1F, 0x80, //    ######     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @200 '%' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1C, 0x00, //    ###        
-	0x22, 0x00, //   #   #       
-	0x22, 0x00, //   #   #       
-	0x22, 0x00, //   #   #       
-	0x1C, 0x60, //    ###   ##   
-	0x01, 0xE0, //        ####   
-	0x0F, 0x80, //     #####     
-	0x3C, 0x00, //   ####        
-	0x31, 0xC0, //   ##   ###    
-	0x02, 0x20, //       #   #   
-	0x02, 0x20, //       #   #   
-	0x02, 0x20, //       #   #   
-	0x01, 0xC0, //        ###    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @240 '&' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0xE0, //       #####   
-	0x0F, 0xE0, //     #######   
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x06, 0x00, //      ##       
-	0x0F, 0x30, //     ####  ##  
-	0x1F, 0xF0, //    #########  
-	0x19, 0xE0, //    ##  ####   
-	0x18, 0xC0, //    ##   ##    
-	0x1F, 0xF0, //    #########  
-	0x07, 0xB0, //      #### ##  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @280 ''' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x01, 0x00, //        #      
-	0x01, 0x00, //        #      
-	0x01, 0x00, //        #      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @320 '(' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @360 ')' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @400 '*' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1B, 0x60, //    ## ## ##   
-	0x1F, 0xE0, //    ########   
-	0x07, 0x80, //      ####     
-	0x07, 0x80, //      ####     
-	0x0F, 0xC0, //     ######    
-	0x0C, 0xC0, //     ##  ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @440 '+' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @480 ',' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x04, 0x00, //      #        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @520 '-' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @560 '.' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @600 '/' (14 pixels wide)
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @640 '0' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x1F, 0xC0, //    #######    
-	0x0F, 0x80, //     #####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @680 '1' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x1F, 0x00, //    #####      
-	0x1F, 0x00, //    #####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @720 '2' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x00, 0x60, //          ##   
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x18, 0x00, //    ##         
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @760 '3' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x3F, 0xC0, //   ########    
-	0x30, 0xE0, //   ##    ###   
-	0x00, 0x60, //          ##   
-	0x00, 0xE0, //         ###   
-	0x07, 0xC0, //      #####    
-	0x07, 0xC0, //      #####    
-	0x00, 0xE0, //         ###   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x60, 0xE0, //  ##     ###   
-	0x7F, 0xC0, //  #########    
-	0x3F, 0x80, //   #######     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @800 '4' (14 pixels wide)
-	0x00, 0x00, //               
-	0x01, 0xC0, //        ###    
-	0x03, 0xC0, //       ####    
-	0x03, 0xC0, //       ####    
-	0x06, 0xC0, //      ## ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0xC0, //   ##    ##    
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x00, 0xC0, //         ##    
-	0x03, 0xE0, //       #####   
-	0x03, 0xE0, //       #####   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @840 '5' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xC0, //    #######    
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x1F, 0x80, //    ######     
-	0x1F, 0xC0, //    #######    
-	0x18, 0xE0, //    ##   ###   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x30, 0xE0, //   ##    ###   
-	0x3F, 0xC0, //   ########    
-	0x1F, 0x80, //    ######     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @880 '6' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0xE0, //       #####   
-	0x0F, 0xE0, //     #######   
-	0x1E, 0x00, //    ####       
-	0x18, 0x00, //    ##         
-	0x38, 0x00, //   ###         
-	0x37, 0x80, //   ## ####     
-	0x3F, 0xC0, //   ########    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xE0, //    ##   ###   
-	0x1F, 0xC0, //    #######    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @920 '7' (14 pixels wide)
-	0x00, 0x00, //               
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x30, 0x60, //   ##     ##   
-	0x00, 0x60, //          ##   
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @960 '8' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x38, 0xE0, //   ###   ###   
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xC0, //    #######    
-	0x38, 0xE0, //   ###   ###   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x38, 0xE0, //   ###   ###   
-	0x1F, 0xC0, //    #######    
-	0x0F, 0x80, //     #####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1000 '9' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x00, //     ####      
-	0x1F, 0xC0, //    #######    
-	0x38, 0xC0, //   ###   ##    
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x38, 0xE0, //   ###   ###   
-	0x1F, 0xE0, //    ########   
-	0x0F, 0x60, //     #### ##   
-	0x00, 0xE0, //         ###   
-	0x00, 0xC0, //         ##    
-	0x03, 0xC0, //       ####    
-	0x3F, 0x80, //   #######     
-	0x3E, 0x00, //   #####       
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1040 ':' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x03, 0x80, //       ###     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1080 ';' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x01, 0xC0, //        ###    
-	0x01, 0xC0, //        ###    
-	0x01, 0xC0, //        ###    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x04, 0x00, //      #        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1120 '<' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x30, //           ##  
-	0x00, 0xF0, //         ####  
-	0x03, 0xC0, //       ####    
-	0x07, 0x00, //      ###      
-	0x1C, 0x00, //    ###        
-	0x78, 0x00, //  ####         
-	0x1C, 0x00, //    ###        
-	0x07, 0x00, //      ###      
-	0x03, 0xC0, //       ####    
-	0x00, 0xF0, //         ####  
-	0x00, 0x30, //           ##  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1160 '=' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7F, 0xF0, //  ###########  
-	0x7F, 0xF0, //  ###########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7F, 0xF0, //  ###########  
-	0x7F, 0xF0, //  ###########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1200 '>' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x30, 0x00, //   ##          
-	0x3C, 0x00, //   ####        
-	0x0F, 0x00, //     ####      
-	0x03, 0x80, //       ###     
-	0x00, 0xE0, //         ###   
-	0x00, 0x78, //          #### 
-	0x00, 0xE0, //         ###   
-	0x03, 0x80, //       ###     
-	0x0F, 0x00, //     ####      
-	0x3C, 0x00, //   ####        
-	0x30, 0x00, //   ##          
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1240 '?' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0F, 0x80, //     #####     
-	0x1F, 0xC0, //    #######    
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x00, 0x60, //          ##   
-	0x01, 0xC0, //        ###    
-	0x03, 0x80, //       ###     
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1280 '@' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x80, //       ###     
-	0x0C, 0x80, //     ##  #     
-	0x08, 0x40, //     #    #    
-	0x10, 0x40, //    #     #    
-	0x10, 0x40, //    #     #    
-	0x11, 0xC0, //    #   ###    
-	0x12, 0x40, //    #  #  #    
-	0x12, 0x40, //    #  #  #    
-	0x12, 0x40, //    #  #  #    
-	0x11, 0xC0, //    #   ###    
-	0x10, 0x00, //    #          
-	0x08, 0x00, //     #         
-	0x08, 0x40, //     #    #    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1320 'A' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0x80, //    ######     
-	0x1F, 0x80, //    ######     
-	0x03, 0x80, //       ###     
-	0x06, 0xC0, //      ## ##    
-	0x06, 0xC0, //      ## ##    
-	0x0C, 0xC0, //     ##  ##    
-	0x0C, 0x60, //     ##   ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x30, 0x30, //   ##      ##  
-	0x78, 0x78, //  ####    #### 
-	0x78, 0x78, //  ####    #### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1360 'B' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0x80, //   #######     
-	0x3F, 0xC0, //   ########    
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0xE0, //    ##   ###   
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xE0, //    ########   
-	0x18, 0x70, //    ##    ###  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xE0, //   #########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1400 'C' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB0, //      #### ##  
-	0x0F, 0xF0, //     ########  
-	0x1C, 0x70, //    ###   ###  
-	0x38, 0x30, //   ###     ##  
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x38, 0x30, //   ###     ##  
-	0x1C, 0x70, //    ###   ###  
-	0x0F, 0xE0, //     #######   
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1440 'D' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7F, 0x80, //  ########     
-	0x7F, 0xC0, //  #########    
-	0x30, 0xE0, //   ##    ###   
-	0x30, 0x70, //   ##     ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x70, //   ##     ###  
-	0x30, 0xE0, //   ##    ###   
-	0x7F, 0xC0, //  #########    
-	0x7F, 0x80, //  ########     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1480 'E' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x19, 0x80, //    ##  ##     
-	0x1F, 0x80, //    ######     
-	0x1F, 0x80, //    ######     
-	0x19, 0x80, //    ##  ##     
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1520 'F' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x19, 0x80, //    ##  ##     
-	0x1F, 0x80, //    ######     
-	0x1F, 0x80, //    ######     
-	0x19, 0x80, //    ##  ##     
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x3F, 0x00, //   ######      
-	0x3F, 0x00, //   ######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1560 'G' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB0, //      #### ##  
-	0x1F, 0xF0, //    #########  
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x31, 0xF8, //   ##   ###### 
-	0x31, 0xF8, //   ##   ###### 
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x30, //    ##     ##  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1600 'H' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1640 'I' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1680 'J' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x03, 0xF8, //       ####### 
-	0x03, 0xF8, //       ####### 
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x30, 0xE0, //   ##    ###   
-	0x3F, 0xC0, //   ########    
-	0x0F, 0x80, //     #####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1720 'K' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3E, 0xF8, //   ##### ##### 
-	0x3E, 0xF8, //   ##### ##### 
-	0x18, 0xE0, //    ##   ###   
-	0x19, 0x80, //    ##  ##     
-	0x1B, 0x00, //    ## ##      
-	0x1F, 0x00, //    #####      
-	0x1D, 0x80, //    ### ##     
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0x60, //    ##    ##   
-	0x3E, 0x78, //   #####  #### 
-	0x3E, 0x38, //   #####   ### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1760 'L' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0x00, //   ######      
-	0x3F, 0x00, //   ######      
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x30, //     ##    ##  
-	0x0C, 0x30, //     ##    ##  
-	0x0C, 0x30, //     ##    ##  
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1800 'M' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0x78, //  ####    #### 
-	0x78, 0x78, //  ####    #### 
-	0x38, 0x70, //   ###    ###  
-	0x3C, 0xF0, //   ####  ####  
-	0x34, 0xB0, //   ## #  # ##  
-	0x37, 0xB0, //   ## #### ##  
-	0x37, 0xB0, //   ## #### ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x30, 0x30, //   ##      ##  
-	0x7C, 0xF8, //  #####  ##### 
-	0x7C, 0xF8, //  #####  ##### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1840 'N' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x39, 0xF0, //   ###  #####  
-	0x3D, 0xF0, //   #### #####  
-	0x1C, 0x60, //    ###   ##   
-	0x1E, 0x60, //    ####  ##   
-	0x1E, 0x60, //    ####  ##   
-	0x1B, 0x60, //    ## ## ##   
-	0x1B, 0x60, //    ## ## ##   
-	0x19, 0xE0, //    ##  ####   
-	0x19, 0xE0, //    ##  ####   
-	0x18, 0xE0, //    ##   ###   
-	0x3E, 0xE0, //   ##### ###   
-	0x3E, 0x60, //   #####  ##   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1880 'O' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x0F, 0xC0, //     ######    
-	0x1C, 0xE0, //    ###  ###   
-	0x38, 0x70, //   ###    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x1C, 0xE0, //    ###  ###   
-	0x0F, 0xC0, //     ######    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1920 'P' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xC0, //   ########    
-	0x3F, 0xE0, //   #########   
-	0x18, 0x70, //    ##    ###  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xC0, //    #######    
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x3F, 0x00, //   ######      
-	0x3F, 0x00, //   ######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @1960 'Q' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x0F, 0xC0, //     ######    
-	0x1C, 0xE0, //    ###  ###   
-	0x38, 0x70, //   ###    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x1C, 0xE0, //    ###  ###   
-	0x0F, 0xC0, //     ######    
-	0x07, 0x80, //      ####     
-	0x07, 0xB0, //      #### ##  
-	0x0F, 0xF0, //     ########  
-	0x0C, 0xE0, //     ##  ###   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2000 'R' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xC0, //   ########    
-	0x3F, 0xE0, //   #########   
-	0x18, 0x70, //    ##    ###  
-	0x18, 0x30, //    ##     ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xC0, //    #######    
-	0x18, 0xE0, //    ##   ###   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x70, //    ##    ###  
-	0x3E, 0x38, //   #####   ### 
-	0x3E, 0x18, //   #####    ## 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2040 'S' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0F, 0xB0, //     ##### ##  
-	0x1F, 0xF0, //    #########  
-	0x38, 0x70, //   ###    ###  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x00, //   ###         
-	0x1F, 0x80, //    ######     
-	0x07, 0xE0, //      ######   
-	0x00, 0x70, //          ###  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x3F, 0xE0, //   #########   
-	0x37, 0xC0, //   ## #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2080 'T' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x0F, 0xC0, //     ######    
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2120 'U' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x1C, 0xE0, //    ###  ###   
-	0x0F, 0xC0, //     ######    
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2160 'V' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x0D, 0x80, //     ## ##     
-	0x0D, 0x80, //     ## ##     
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2200 'W' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7C, 0x7C, //  #####   #####
-	0x7C, 0x7C, //  #####   #####
-	0x30, 0x18, //   ##       ## 
-	0x33, 0x98, //   ##  ###  ## 
-	0x33, 0x98, //   ##  ###  ## 
-	0x33, 0x98, //   ##  ###  ## 
-	0x36, 0xD8, //   ## ## ## ## 
-	0x16, 0xD0, //    # ## ## #  
-	0x1C, 0x70, //    ###   ###  
-	0x1C, 0x70, //    ###   ###  
-	0x1C, 0x70, //    ###   ###  
-	0x18, 0x30, //    ##     ##  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2240 'X' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x0D, 0x80, //     ## ##     
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0x60, //   ##     ##   
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2280 'Y' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x18, 0x60, //    ##    ##   
-	0x0C, 0xC0, //     ##  ##    
-	0x07, 0x80, //      ####     
-	0x07, 0x80, //      ####     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x0F, 0xC0, //     ######    
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2320 'Z' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0xC0, //    ##   ##    
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x0C, 0x60, //     ##   ##   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2360 '[' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0xC0, //       ####    
-	0x03, 0xC0, //       ####    
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0xC0, //       ####    
-	0x03, 0xC0, //       ####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2400 '\' (14 pixels wide)
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x01, 0x80, //        ##     
-	0x01, 0x80, //        ##     
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0x60, //          ##   
-	0x00, 0x60, //          ##   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2440 ']' (14 pixels wide)
-	0x00, 0x00, //               
-	0x0F, 0x00, //     ####      
-	0x0F, 0x00, //     ####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x0F, 0x00, //     ####      
-	0x0F, 0x00, //     ####      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2480 '^' (14 pixels wide)
-	0x00, 0x00, //               
-	0x02, 0x00, //       #       
-	0x07, 0x00, //      ###      
-	0x0D, 0x80, //     ## ##     
-	0x18, 0xC0, //    ##   ##    
-	0x30, 0x60, //   ##     ##   
-	0x20, 0x20, //   #       #   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2520 '_' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0xFF, 0xFC, // ##############
-	0xFF, 0xFC, // ##############
-
-	// @2560 '`' (14 pixels wide)
-	0x00, 0x00, //               
-	0x04, 0x00, //      #        
-	0x03, 0x00, //       ##      
-	0x00, 0x80, //         #     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2600 'a' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0F, 0xC0, //     ######    
-	0x1F, 0xE0, //    ########   
-	0x00, 0x60, //          ##   
-	0x0F, 0xE0, //     #######   
-	0x1F, 0xE0, //    ########   
-	0x38, 0x60, //   ###    ##   
-	0x30, 0xE0, //   ##    ###   
-	0x3F, 0xF0, //   ##########  
-	0x1F, 0x70, //    ##### ###  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2640 'b' (14 pixels wide)
-	0x00, 0x00, //               
-	0x70, 0x00, //  ###          
-	0x70, 0x00, //  ###          
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x37, 0x80, //   ## ####     
-	0x3F, 0xE0, //   #########   
-	0x38, 0x60, //   ###    ##   
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x60, //   ###    ##   
-	0x7F, 0xE0, //  ##########   
-	0x77, 0x80, //  ### ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2680 'c' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB0, //      #### ##  
-	0x1F, 0xF0, //    #########  
-	0x18, 0x30, //    ##     ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x38, 0x30, //   ###     ##  
-	0x1F, 0xF0, //    #########  
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2720 'd' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x70, //          ###  
-	0x00, 0x70, //          ###  
-	0x00, 0x30, //           ##  
-	0x00, 0x30, //           ##  
-	0x07, 0xB0, //      #### ##  
-	0x1F, 0xF0, //    #########  
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x70, //   ###    ###  
-	0x1F, 0xF8, //    ########## 
-	0x07, 0xB8, //      #### ### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2760 'e' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x3F, 0xF0, //   ##########  
-	0x3F, 0xF0, //   ##########  
-	0x30, 0x00, //   ##          
-	0x18, 0x30, //    ##     ##  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2800 'f' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0xF0, //       ######  
-	0x07, 0xF0, //      #######  
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2840 'g' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB8, //      #### ### 
-	0x1F, 0xF8, //    ########## 
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xB0, //      #### ##  
-	0x00, 0x30, //           ##  
-	0x00, 0x70, //          ###  
-	0x0F, 0xE0, //     #######   
-	0x0F, 0xC0, //     ######    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2880 'h' (14 pixels wide)
-	0x00, 0x00, //               
-	0x38, 0x00, //   ###         
-	0x38, 0x00, //   ###         
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x1B, 0xC0, //    ## ####    
-	0x1F, 0xE0, //    ########   
-	0x1C, 0x60, //    ###   ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2920 'i' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0x00, //    #####      
-	0x1F, 0x00, //    #####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @2960 'j' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xC0, //    #######    
-	0x1F, 0xC0, //    #######    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x00, 0xC0, //         ##    
-	0x01, 0xC0, //        ###    
-	0x3F, 0x80, //   #######     
-	0x3F, 0x00, //   ######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3000 'k' (14 pixels wide)
-	0x00, 0x00, //               
-	0x38, 0x00, //   ###         
-	0x38, 0x00, //   ###         
-	0x18, 0x00, //    ##         
-	0x18, 0x00, //    ##         
-	0x1B, 0xE0, //    ## #####   
-	0x1B, 0xE0, //    ## #####   
-	0x1B, 0x00, //    ## ##      
-	0x1E, 0x00, //    ####       
-	0x1E, 0x00, //    ####       
-	0x1B, 0x00, //    ## ##      
-	0x19, 0x80, //    ##  ##     
-	0x39, 0xF0, //   ###  #####  
-	0x39, 0xF0, //   ###  #####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3040 'l' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1F, 0x00, //    #####      
-	0x1F, 0x00, //    #####      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3080 'm' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x7E, 0xE0, //  ###### ###   
-	0x7F, 0xF0, //  ###########  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x33, 0x30, //   ##  ##  ##  
-	0x7B, 0xB8, //  #### ### ### 
-	0x7B, 0xB8, //  #### ### ### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3120 'n' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3B, 0xC0, //   ### ####    
-	0x3F, 0xE0, //   #########   
-	0x1C, 0x60, //    ###   ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3160 'o' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0x80, //      ####     
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x07, 0x80, //      ####     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3200 'p' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x77, 0x80, //  ### ####     
-	0x7F, 0xE0, //  ##########   
-	0x38, 0x60, //   ###    ##   
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x38, 0x60, //   ###    ##   
-	0x3F, 0xE0, //   #########   
-	0x37, 0x80, //   ## ####     
-	0x30, 0x00, //   ##          
-	0x30, 0x00, //   ##          
-	0x7C, 0x00, //  #####        
-	0x7C, 0x00, //  #####        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3240 'q' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xB8, //      #### ### 
-	0x1F, 0xF8, //    ########## 
-	0x18, 0x70, //    ##    ###  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x30, 0x30, //   ##      ##  
-	0x18, 0x70, //    ##    ###  
-	0x1F, 0xF0, //    #########  
-	0x07, 0xB0, //      #### ##  
-	0x00, 0x30, //           ##  
-	0x00, 0x30, //           ##  
-	0x00, 0xF8, //         ##### 
-	0x00, 0xF8, //         ##### 
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3280 'r' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xE0, //   ####  ###   
-	0x3D, 0xF0, //   #### #####  
-	0x0F, 0x30, //     ####  ##  
-	0x0E, 0x00, //     ###       
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x3F, 0xC0, //   ########    
-	0x3F, 0xC0, //   ########    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3320 's' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x07, 0xE0, //      ######   
-	0x1F, 0xE0, //    ########   
-	0x18, 0x60, //    ##    ##   
-	0x1E, 0x00, //    ####       
-	0x0F, 0xC0, //     ######    
-	0x01, 0xE0, //        ####   
-	0x18, 0x60, //    ##    ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0x80, //    ######     
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3360 't' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x3F, 0xE0, //   #########   
-	0x3F, 0xE0, //   #########   
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x00, //     ##        
-	0x0C, 0x30, //     ##    ##  
-	0x0F, 0xF0, //     ########  
-	0x07, 0xC0, //      #####    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3400 'u' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x38, 0xE0, //   ###   ###   
-	0x38, 0xE0, //   ###   ###   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0x60, //    ##    ##   
-	0x18, 0xE0, //    ##   ###   
-	0x1F, 0xF0, //    #########  
-	0x0F, 0x70, //     #### ###  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3440 'v' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x0D, 0x80, //     ## ##     
-	0x07, 0x00, //      ###      
-	0x07, 0x00, //      ###      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3480 'w' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x32, 0x60, //   ##  #  ##   
-	0x32, 0x60, //   ##  #  ##   
-	0x37, 0xE0, //   ## ######   
-	0x1D, 0xC0, //    ### ###    
-	0x1D, 0xC0, //    ### ###    
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3520 'x' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x0C, 0xC0, //     ##  ##    
-	0x07, 0x80, //      ####     
-	0x03, 0x00, //       ##      
-	0x07, 0x80, //      ####     
-	0x0C, 0xC0, //     ##  ##    
-	0x3C, 0xF0, //   ####  ####  
-	0x3C, 0xF0, //   ####  ####  
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3560 'y' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x78, 0xF0, //  ####   ####  
-	0x78, 0xF0, //  ####   ####  
-	0x30, 0x60, //   ##     ##   
-	0x18, 0xC0, //    ##   ##    
-	0x18, 0xC0, //    ##   ##    
-	0x0D, 0x80, //     ## ##     
-	0x0F, 0x80, //     #####     
-	0x07, 0x00, //      ###      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x0C, 0x00, //     ##        
-	0x7F, 0x00, //  #######      
-	0x7F, 0x00, //  #######      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3600 'z' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x18, 0xC0, //    ##   ##    
-	0x01, 0x80, //        ##     
-	0x03, 0x00, //       ##      
-	0x06, 0x00, //      ##       
-	0x0C, 0x60, //     ##   ##   
-	0x1F, 0xE0, //    ########   
-	0x1F, 0xE0, //    ########   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3640 '{' (14 pixels wide)
-	0x00, 0x00, //               
-	0x01, 0xC0, //        ###    
-	0x03, 0xC0, //       ####    
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x07, 0x00, //      ###      
-	0x0E, 0x00, //     ###       
-	0x07, 0x00, //      ###      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0xC0, //       ####    
-	0x01, 0xC0, //        ###    
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3680 '|' (14 pixels wide)
-	0x00, 0x00, //               
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x03, 0x00, //       ##      
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3720 '}' (14 pixels wide)
-	0x00, 0x00, //               
-	0x1C, 0x00, //    ###        
-	0x1E, 0x00, //    ####       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x07, 0x00, //      ###      
-	0x03, 0x80, //       ###     
-	0x07, 0x00, //      ###      
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x06, 0x00, //      ##       
-	0x1E, 0x00, //    ####       
-	0x1C, 0x00, //    ###        
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-
-	// @3760 '~' (14 pixels wide)
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x0E, 0x00, //     ###       
-	0x3F, 0x30, //   ######  ##  
-	0x33, 0xF0, //   ##  ######  
-	0x01, 0xE0, //        ####   
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
-	0x00, 0x00, //               
+  /* '!' */
+  0xE0,
+  0xE0,
+  0xE0,
+  0xE0,
+  0xE0,
+  0xE0,
+  0xE0,
+  0x40,
+  0x40,
+  0x00,
+  0x00,
+  0xE0,
+  0xE0,
+  /* '"' */
+  0xE7,
+  0xE7,
+  0xE7,
+  0x42,
+  0x42,
+  0x42,
+  /* '#' */
+  0x33, 0x00,
+  0x33, 0x00,
+  0x33, 0x00,
+  0x33, 0x00,
+  0x33, 0x00,
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  0x33, 0x00,
+  0x33, 0x00,
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  0x33, 0x00,
+  0x33, 0x00,
+  0x33, 0x00,
+  0x33, 0x00,
+  0x33, 0x00,
+  /* '$' */
+  0x18,
+  0x18,
+  0x3F,
+  0x7F,
+  0xC3,
+  0xC0,
+  0xF8,
+  0x7E,
+  0x07,
+  0xC3,
+  0xC3,
+  0xFE,
+  0xFC,
+  0x18,
+  0x18,
+  0x18,
+  /* '%' */
+  0x70, 0x00,
+  0x88, 0x00,
+  0x88, 0x00,
+  0x88, 0x00,
+  0x71, 0x80,
+  0x07, 0x80,
+  0x3E, 0x00,
+  0xF0, 0x00,
+  0xC7, 0x00,
+  0x08, 0x80,
+  0x08, 0x80,
+  0x08, 0x80,
+  0x07, 0x00,
+  /* '&' */
+  0x1F, 0x00,
+  0x7F, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0x30, 0x00,
+  0x79, 0x80,
+  0xFF, 0x80,
+  0xCF, 0x00,
+  0xC6, 0x00,
+  0xFF, 0x80,
+  0x3D, 0x80,
+  /* ''' */
+  0xE0,
+  0xE0,
+  0xE0,
+  0x40,
+  0x40,
+  0x40,
+  /* '(' */
+  0x30,
+  0x30,
+  0x60,
+  0x60,
+  0x60,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0x60,
+  0x60,
+  0x60,
+  0x30,
+  0x30,
+  /* ')' */
+  0xC0,
+  0xC0,
+  0x60,
+  0x60,
+  0x60,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x60,
+  0x60,
+  0x60,
+  0xC0,
+  0xC0,
+  /* '*' */
+  0x18,
+  0x18,
+  0x18,
+  0xDB,
+  0xFF,
+  0x3C,
+  0x3C,
+  0x7E,
+  0x66,
+  /* '+' */
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  /* ',' */
+  0x70,
+  0x60,
+  0x60,
+  0xC0,
+  0xC0,
+  0x80,
+  /* '-' */
+  0xFF, 0x80,
+  0xFF, 0x80,
+  /* '.' */
+  0xE0,
+  0xE0,
+  0xE0,
+  /* '/' */
+  0x03,
+  0x03,
+  0x06,
+  0x06,
+  0x06,
+  0x0C,
+  0x0C,
+  0x18,
+  0x18,
+  0x30,
+  0x30,
+  0x60,
+  0x60,
+  0x60,
+  0xC0,
+  0xC0,
+  /* '0' */
+  0x3E, 0x00,
+  0x7F, 0x00,
+  0x63, 0x00,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0x63, 0x00,
+  0x7F, 0x00,
+  0x3E, 0x00,
+  /* '1' */
+  0x18,
+  0xF8,
+  0xF8,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0xFF,
+  0xFF,
+  /* '2' */
+  0x3E, 0x00,
+  0x7F, 0x00,
+  0xE3, 0x80,
+  0xC1, 0x80,
+  0x01, 0x80,
+  0x03, 0x00,
+  0x06, 0x00,
+  0x0C, 0x00,
+  0x18, 0x00,
+  0x30, 0x00,
+  0x60, 0x00,
+  0xFF, 0x80,
+  0xFF, 0x80,
+  /* '3' */
+  0x1F, 0x00,
+  0x7F, 0x80,
+  0x61, 0xC0,
+  0x00, 0xC0,
+  0x01, 0xC0,
+  0x0F, 0x80,
+  0x0F, 0x80,
+  0x01, 0xC0,
+  0x00, 0xC0,
+  0x00, 0xC0,
+  0xC1, 0xC0,
+  0xFF, 0x80,
+  0x7F, 0x00,
+  /* '4' */
+  0x07, 0x00,
+  0x0F, 0x00,
+  0x0F, 0x00,
+  0x1B, 0x00,
+  0x33, 0x00,
+  0x33, 0x00,
+  0x63, 0x00,
+  0xC3, 0x00,
+  0xFF, 0x80,
+  0xFF, 0x80,
+  0x03, 0x00,
+  0x0F, 0x80,
+  0x0F, 0x80,
+  /* '5' */
+  0x7F, 0x00,
+  0x7F, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0x7E, 0x00,
+  0x7F, 0x00,
+  0x63, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0xC3, 0x80,
+  0xFF, 0x00,
+  0x7E, 0x00,
+  /* '6' */
+  0x0F, 0x80,
+  0x3F, 0x80,
+  0x78, 0x00,
+  0x60, 0x00,
+  0xE0, 0x00,
+  0xDE, 0x00,
+  0xFF, 0x00,
+  0xE3, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0x63, 0x80,
+  0x7F, 0x00,
+  0x1E, 0x00,
+  /* '7' */
+  0xFF, 0x80,
+  0xFF, 0x80,
+  0xC1, 0x80,
+  0x01, 0x80,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  /* '8' */
+  0x3E, 0x00,
+  0x7F, 0x00,
+  0xE3, 0x80,
+  0xC1, 0x80,
+  0xE3, 0x80,
+  0x7F, 0x00,
+  0x7F, 0x00,
+  0xE3, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xE3, 0x80,
+  0x7F, 0x00,
+  0x3E, 0x00,
+  /* '9' */
+  0x3C, 0x00,
+  0x7F, 0x00,
+  0xE3, 0x00,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xE3, 0x80,
+  0x7F, 0x80,
+  0x3D, 0x80,
+  0x03, 0x80,
+  0x03, 0x00,
+  0x0F, 0x00,
+  0xFE, 0x00,
+  0xF8, 0x00,
+  /* ':' */
+  0xE0,
+  0xE0,
+  0xE0,
+  0x00,
+  0x00,
+  0x00,
+  0xE0,
+  0xE0,
+  0xE0,
+  /* ';' */
+  0x38,
+  0x38,
+  0x38,
+  0x00,
+  0x00,
+  0x00,
+  0x70,
+  0x60,
+  0xC0,
+  0xC0,
+  0x80,
+  /* '<' */
+  0x00, 0x60,
+  0x01, 0xE0,
+  0x07, 0x80,
+  0x0E, 0x00,
+  0x38, 0x00,
+  0xF0, 0x00,
+  0x38, 0x00,
+  0x0E, 0x00,
+  0x07, 0x80,
+  0x01, 0xE0,
+  0x00, 0x60,
+  /* '=' */
+  0xFF, 0xE0,
+  0xFF, 0xE0,
+  0x00, 0x00,
+  0x00, 0x00,
+  0xFF, 0xE0,
+  0xFF, 0xE0,
+  /* '>' */
+  0xC0, 0x00,
+  0xF0, 0x00,
+  0x3C, 0x00,
+  0x0E, 0x00,
+  0x03, 0x80,
+  0x01, 0xE0,
+  0x03, 0x80,
+  0x0E, 0x00,
+  0x3C, 0x00,
+  0xF0, 0x00,
+  0xC0, 0x00,
+  /* '?' */
+  0x7C,
+  0xFE,
+  0xC3,
+  0xC3,
+  0x03,
+  0x0E,
+  0x1C,
+  0x18,
+  0x00,
+  0x00,
+  0x38,
+  0x38,
+  /* '@' */
+  0x1C,
+  0x64,
+  0x42,
+  0x82,
+  0x82,
+  0x8E,
+  0x92,
+  0x92,
+  0x92,
+  0x8E,
+  0x80,
+  0x40,
+  0x42,
+  0x3C,
+  /* 'A' */
+  0x3F, 0x00,
+  0x3F, 0x00,
+  0x07, 0x00,
+  0x0D, 0x80,
+  0x0D, 0x80,
+  0x19, 0x80,
+  0x18, 0xC0,
+  0x3F, 0xC0,
+  0x3F, 0xC0,
+  0x60, 0x60,
+  0xF0, 0xF0,
+  0xF0, 0xF0,
+  /* 'B' */
+  0xFE, 0x00,
+  0xFF, 0x00,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x63, 0x80,
+  0x7F, 0x00,
+  0x7F, 0x80,
+  0x61, 0xC0,
+  0x60, 0xC0,
+  0x60, 0xC0,
+  0xFF, 0xC0,
+  0xFF, 0x80,
+  /* 'C' */
+  0x1E, 0xC0,
+  0x3F, 0xC0,
+  0x71, 0xC0,
+  0xE0, 0xC0,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0xE0, 0xC0,
+  0x71, 0xC0,
+  0x3F, 0x80,
+  0x1F, 0x00,
+  /* 'D' */
+  0xFF, 0x00,
+  0xFF, 0x80,
+  0x61, 0xC0,
+  0x60, 0xE0,
+  0x60, 0x60,
+  0x60, 0x60,
+  0x60, 0x60,
+  0x60, 0x60,
+  0x60, 0xE0,
+  0x61, 0xC0,
+  0xFF, 0x80,
+  0xFF, 0x00,
+  /* 'E' */
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  0x60, 0xC0,
+  0x60, 0xC0,
+  0x66, 0x00,
+  0x7E, 0x00,
+  0x7E, 0x00,
+  0x66, 0x00,
+  0x60, 0xC0,
+  0x60, 0xC0,
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  /* 'F' */
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  0x60, 0xC0,
+  0x60, 0xC0,
+  0x66, 0x00,
+  0x7E, 0x00,
+  0x7E, 0x00,
+  0x66, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0xFC, 0x00,
+  0xFC, 0x00,
+  /* 'G' */
+  0x1E, 0xC0,
+  0x7F, 0xC0,
+  0x61, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0xC7, 0xE0,
+  0xC7, 0xE0,
+  0xC0, 0xC0,
+  0x60, 0xC0,
+  0x7F, 0xC0,
+  0x1F, 0x00,
+  /* 'H' */
+  0xF3, 0xC0,
+  0xF3, 0xC0,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x7F, 0x80,
+  0x7F, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0xF3, 0xC0,
+  0xF3, 0xC0,
+  /* 'I' */
+  0xFF,
+  0xFF,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0xFF,
+  0xFF,
+  /* 'J' */
+  0x0F, 0xE0,
+  0x0F, 0xE0,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0xC3, 0x80,
+  0xFF, 0x00,
+  0x3E, 0x00,
+  /* 'K' */
+  0xFB, 0xE0,
+  0xFB, 0xE0,
+  0x63, 0x80,
+  0x66, 0x00,
+  0x6C, 0x00,
+  0x7C, 0x00,
+  0x76, 0x00,
+  0x63, 0x00,
+  0x63, 0x00,
+  0x61, 0x80,
+  0xF9, 0xE0,
+  0xF8, 0xE0,
+  /* 'L' */
+  0xFC, 0x00,
+  0xFC, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0xC0,
+  0x30, 0xC0,
+  0x30, 0xC0,
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  /* 'M' */
+  0xF0, 0xF0,
+  0xF0, 0xF0,
+  0x70, 0xE0,
+  0x79, 0xE0,
+  0x69, 0x60,
+  0x6F, 0x60,
+  0x6F, 0x60,
+  0x66, 0x60,
+  0x66, 0x60,
+  0x60, 0x60,
+  0xF9, 0xF0,
+  0xF9, 0xF0,
+  /* 'N' */
+  0xE7, 0xC0,
+  0xF7, 0xC0,
+  0x71, 0x80,
+  0x79, 0x80,
+  0x79, 0x80,
+  0x6D, 0x80,
+  0x6D, 0x80,
+  0x67, 0x80,
+  0x67, 0x80,
+  0x63, 0x80,
+  0xFB, 0x80,
+  0xF9, 0x80,
+  /* 'O' */
+  0x1E, 0x00,
+  0x3F, 0x00,
+  0x73, 0x80,
+  0xE1, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xE1, 0xC0,
+  0x73, 0x80,
+  0x3F, 0x00,
+  0x1E, 0x00,
+  /* 'P' */
+  0xFF, 0x00,
+  0xFF, 0x80,
+  0x61, 0xC0,
+  0x60, 0xC0,
+  0x60, 0xC0,
+  0x61, 0xC0,
+  0x7F, 0x80,
+  0x7F, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0xFC, 0x00,
+  0xFC, 0x00,
+  /* 'Q' */
+  0x1E, 0x00,
+  0x3F, 0x00,
+  0x73, 0x80,
+  0xE1, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xE1, 0xC0,
+  0x73, 0x80,
+  0x3F, 0x00,
+  0x1E, 0x00,
+  0x1E, 0xC0,
+  0x3F, 0xC0,
+  0x33, 0x80,
+  /* 'R' */
+  0xFF, 0x00,
+  0xFF, 0x80,
+  0x61, 0xC0,
+  0x60, 0xC0,
+  0x61, 0xC0,
+  0x7F, 0x80,
+  0x7F, 0x00,
+  0x63, 0x80,
+  0x61, 0x80,
+  0x61, 0xC0,
+  0xF8, 0xE0,
+  0xF8, 0x60,
+  /* 'S' */
+  0x3E, 0xC0,
+  0x7F, 0xC0,
+  0xE1, 0xC0,
+  0xC0, 0xC0,
+  0xE0, 0x00,
+  0x7E, 0x00,
+  0x1F, 0x80,
+  0x01, 0xC0,
+  0xC0, 0xC0,
+  0xE1, 0xC0,
+  0xFF, 0x80,
+  0xDF, 0x00,
+  /* 'T' */
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  0xCC, 0xC0,
+  0xCC, 0xC0,
+  0xCC, 0xC0,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x3F, 0x00,
+  0x3F, 0x00,
+  /* 'U' */
+  0xF3, 0xC0,
+  0xF3, 0xC0,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x73, 0x80,
+  0x3F, 0x00,
+  0x1E, 0x00,
+  /* 'V' */
+  0xF1, 0xE0,
+  0xF1, 0xE0,
+  0x60, 0xC0,
+  0x60, 0xC0,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x1B, 0x00,
+  0x1B, 0x00,
+  0x1B, 0x00,
+  0x0E, 0x00,
+  0x0E, 0x00,
+  0x0E, 0x00,
+  /* 'W' */
+  0xF8, 0xF8,
+  0xF8, 0xF8,
+  0x60, 0x30,
+  0x67, 0x30,
+  0x67, 0x30,
+  0x67, 0x30,
+  0x6D, 0xB0,
+  0x2D, 0xA0,
+  0x38, 0xE0,
+  0x38, 0xE0,
+  0x38, 0xE0,
+  0x30, 0x60,
+  /* 'X' */
+  0xF1, 0xE0,
+  0xF1, 0xE0,
+  0x60, 0xC0,
+  0x31, 0x80,
+  0x1B, 0x00,
+  0x0E, 0x00,
+  0x0E, 0x00,
+  0x1B, 0x00,
+  0x31, 0x80,
+  0x60, 0xC0,
+  0xF1, 0xE0,
+  0xF1, 0xE0,
+  /* 'Y' */
+  0xF3, 0xC0,
+  0xF3, 0xC0,
+  0x61, 0x80,
+  0x33, 0x00,
+  0x1E, 0x00,
+  0x1E, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x3F, 0x00,
+  0x3F, 0x00,
+  /* 'Z' */
+  0xFF,
+  0xFF,
+  0xC3,
+  0xC6,
+  0x0C,
+  0x18,
+  0x18,
+  0x30,
+  0x63,
+  0xC3,
+  0xFF,
+  0xFF,
+  /* '[' */
+  0xF0,
+  0xF0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xF0,
+  0xF0,
+  /* '\\' */
+  0xC0,
+  0xC0,
+  0x60,
+  0x60,
+  0x60,
+  0x30,
+  0x30,
+  0x18,
+  0x18,
+  0x0C,
+  0x0C,
+  0x06,
+  0x06,
+  0x06,
+  0x03,
+  0x03,
+  /* ']' */
+  0xF0,
+  0xF0,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0xF0,
+  0xF0,
+  /* '^' */
+  0x08, 0x00,
+  0x1C, 0x00,
+  0x36, 0x00,
+  0x63, 0x00,
+  0xC1, 0x80,
+  0x80, 0x80,
+  /* '_' */
+  0xFF, 0xFC,
+  0xFF, 0xFC,
+  /* '`' */
+  0x80,
+  0x60,
+  0x10,
+  /* 'a' */
+  0x3F, 0x00,
+  0x7F, 0x80,
+  0x01, 0x80,
+  0x3F, 0x80,
+  0x7F, 0x80,
+  0xE1, 0x80,
+  0xC3, 0x80,
+  0xFF, 0xC0,
+  0x7D, 0xC0,
+  /* 'b' */
+  0xE0, 0x00,
+  0xE0, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0x6F, 0x00,
+  0x7F, 0xC0,
+  0x70, 0xC0,
+  0x60, 0x60,
+  0x60, 0x60,
+  0x60, 0x60,
+  0x70, 0xC0,
+  0xFF, 0xC0,
+  0xEF, 0x00,
+  /* 'c' */
+  0x1E, 0xC0,
+  0x7F, 0xC0,
+  0x60, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0xE0, 0xC0,
+  0x7F, 0xC0,
+  0x3F, 0x00,
+  /* 'd' */
+  0x01, 0xC0,
+  0x01, 0xC0,
+  0x00, 0xC0,
+  0x00, 0xC0,
+  0x1E, 0xC0,
+  0x7F, 0xC0,
+  0x61, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xE1, 0xC0,
+  0x7F, 0xE0,
+  0x1E, 0xE0,
+  /* 'e' */
+  0x1E, 0x00,
+  0x7F, 0x80,
+  0x61, 0x80,
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  0xC0, 0x00,
+  0x60, 0xC0,
+  0x7F, 0xC0,
+  0x1F, 0x00,
+  /* 'f' */
+  0x1F, 0x80,
+  0x3F, 0x80,
+  0x30, 0x00,
+  0x30, 0x00,
+  0xFF, 0x00,
+  0xFF, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0xFF, 0x00,
+  0xFF, 0x00,
+  /* 'g' */
+  0x1E, 0xE0,
+  0x7F, 0xE0,
+  0x61, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0x61, 0xC0,
+  0x7F, 0xC0,
+  0x1E, 0xC0,
+  0x00, 0xC0,
+  0x01, 0xC0,
+  0x3F, 0x80,
+  0x3F, 0x00,
+  /* 'h' */
+  0xE0, 0x00,
+  0xE0, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0x6F, 0x00,
+  0x7F, 0x80,
+  0x71, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0xF3, 0xC0,
+  0xF3, 0xC0,
+  /* 'i' */
+  0x18,
+  0x18,
+  0x00,
+  0x00,
+  0xF8,
+  0xF8,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0xFF,
+  0xFF,
+  /* 'j' */
+  0x0C,
+  0x0C,
+  0x00,
+  0x00,
+  0x7F,
+  0x7F,
+  0x03,
+  0x03,
+  0x03,
+  0x03,
+  0x03,
+  0x03,
+  0x03,
+  0x03,
+  0x07,
+  0xFE,
+  0xFC,
+  /* 'k' */
+  0xE0, 0x00,
+  0xE0, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0x6F, 0x80,
+  0x6F, 0x80,
+  0x6C, 0x00,
+  0x78, 0x00,
+  0x78, 0x00,
+  0x6C, 0x00,
+  0x66, 0x00,
+  0xE7, 0xC0,
+  0xE7, 0xC0,
+  /* 'l' */
+  0xF8,
+  0xF8,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0xFF,
+  0xFF,
+  /* 'm' */
+  0xFD, 0xC0,
+  0xFF, 0xE0,
+  0x66, 0x60,
+  0x66, 0x60,
+  0x66, 0x60,
+  0x66, 0x60,
+  0x66, 0x60,
+  0xF7, 0x70,
+  0xF7, 0x70,
+  /* 'n' */
+  0xEF, 0x00,
+  0xFF, 0x80,
+  0x71, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0xF3, 0xC0,
+  0xF3, 0xC0,
+  /* 'o' */
+  0x1E, 0x00,
+  0x7F, 0x80,
+  0x61, 0x80,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0x61, 0x80,
+  0x7F, 0x80,
+  0x1E, 0x00,
+  /* 'p' */
+  0xEF, 0x00,
+  0xFF, 0xC0,
+  0x70, 0xC0,
+  0x60, 0x60,
+  0x60, 0x60,
+  0x60, 0x60,
+  0x70, 0xC0,
+  0x7F, 0xC0,
+  0x6F, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0xF8, 0x00,
+  0xF8, 0x00,
+  /* 'q' */
+  0x1E, 0xE0,
+  0x7F, 0xE0,
+  0x61, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0x61, 0xC0,
+  0x7F, 0xC0,
+  0x1E, 0xC0,
+  0x00, 0xC0,
+  0x00, 0xC0,
+  0x03, 0xE0,
+  0x03, 0xE0,
+  /* 'r' */
+  0xF3, 0x80,
+  0xF7, 0xC0,
+  0x3C, 0xC0,
+  0x38, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0xFF, 0x00,
+  0xFF, 0x00,
+  /* 's' */
+  0x3F,
+  0xFF,
+  0xC3,
+  0xF0,
+  0x7E,
+  0x0F,
+  0xC3,
+  0xFF,
+  0xFC,
+  /* 't' */
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0xFF, 0x80,
+  0xFF, 0x80,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0xC0,
+  0x3F, 0xC0,
+  0x1F, 0x00,
+  /* 'u' */
+  0xE3, 0x80,
+  0xE3, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x63, 0x80,
+  0x7F, 0xC0,
+  0x3D, 0xC0,
+  /* 'v' */
+  0xF1, 0xE0,
+  0xF1, 0xE0,
+  0x60, 0xC0,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x1B, 0x00,
+  0x1B, 0x00,
+  0x0E, 0x00,
+  0x0E, 0x00,
+  /* 'w' */
+  0xF1, 0xE0,
+  0xF1, 0xE0,
+  0x64, 0xC0,
+  0x64, 0xC0,
+  0x6F, 0xC0,
+  0x3B, 0x80,
+  0x3B, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  /* 'x' */
+  0xF3, 0xC0,
+  0xF3, 0xC0,
+  0x33, 0x00,
+  0x1E, 0x00,
+  0x0C, 0x00,
+  0x1E, 0x00,
+  0x33, 0x00,
+  0xF3, 0xC0,
+  0xF3, 0xC0,
+  /* 'y' */
+  0xF1, 0xE0,
+  0xF1, 0xE0,
+  0x60, 0xC0,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x1B, 0x00,
+  0x1F, 0x00,
+  0x0E, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x18, 0x00,
+  0xFE, 0x00,
+  0xFE, 0x00,
+  /* 'z' */
+  0xFF,
+  0xFF,
+  0xC6,
+  0x0C,
+  0x18,
+  0x30,
+  0x63,
+  0xFF,
+  0xFF,
+  /* '{' */
+  0x1C,
+  0x3C,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x70,
+  0xE0,
+  0x70,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x3C,
+  0x1C,
+  /* '|' */
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  /* '}' */
+  0xE0,
+  0xF0,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x38,
+  0x1C,
+  0x38,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0xF0,
+  0xE0,
+  /* '~' */
+  0x38, 0x00,
+  0xFC, 0xC0,
+  0xCF, 0xC0,
+  0x07, 0x80,
 };
 
+static const sGLYPH Font20_Glyphs[] =
+{
+  /* Offset, XOffset, YOffset, Width, Height */
+  {     0,  0,  0,  0,  0 }, /* ' ' */
+  {     0,  5,  1,  3, 13 }, /* '!' */
+  {    13,  3,  2,  8,  6 }, /* '"' */
+  {    19,  2,  0, 10, 16 }, /* '#' */
+  {    51,  3,  0,  8, 16 }, /* '$' */
+  {    67,  2,  1,  9, 13 }, /* '%' */
+  {    93,  3,  3,  9, 11 }, /* '&' */
+  {   115,  6,  2,  3,  6 }, /* ''' */
+  {   121,  6,  1,  4, 16 }, /* '(' */
+  {   137,  4,  1,  4, 16 }, /* ')' */
+  {   153,  3,  1,  8,  9 }, /* '*' */
+  {   162,  2,  3, 10, 10 }, /* '+' */
+  {   182,  5, 11,  4,  6 }, /* ',' */
+  {   188,  2,  7,  9,  2 }, /* '-' */
+  {   192,  6, 11,  3,  3 }, /* '.' */
+  {   195,  3,  0,  8, 16 }, /* '/' */
+  {   211,  2,  1,  9, 13 }, /* '0' */
+  {   237,  3,  1,  8, 13 }, /* '1' */
+  {   250,  2,  1,  9, 13 }, /* '2' */
+  {   276,  1,  1, 10, 13 }, /* '3' */
+  {   302,  2,  1,  9, 13 }, /* '4' */
+  {   328,  2,  1,  9, 13 }, /* '5' */
+  {   354,  2,  1,  9, 13 }, /* '6' */
+  {   380,  2,  1,  9, 13 }, /* '7' */
+  {   406,  2,  1,  9, 13 }, /* '8' */
+  {   432,  2,  1,  9, 13 }, /* '9' */
+  {   458,  6,  5,  3,  9 }, /* ':' */
+  {   467,  5,  5,  5, 11 }, /* ';' */
+  {   478,  1,  3, 11, 11 }, /* '<' */
+  {   500,  1,  5, 11,  6 }, /* '=' */
+  {   512,  2,  3, 11, 11 }, /* '>' */
+  {   534,  3,  2,  8, 12 }, /* '?' */
+  {   546,  3,  1,  7, 14 }, /* '@' */
+  {   560,  1,  2, 12, 12 }, /* 'A' */
+  {   584,  2,  2, 10, 12 }, /* 'B' */
+  {   608,  2,  2, 10, 12 }, /* 'C' */
+  {   632,  1,  2, 11, 12 }, /* 'D' */
+  {   656,  2,  2, 10, 12 }, /* 'E' */
+  {   680,  2,  2, 10, 12 }, /* 'F' */
+  {   704,  2,  2, 11, 12 }, /* 'G' */
+  {   728,  2,  2, 10, 12 }, /* 'H' */
+  {   752,  3,  2,  8, 12 }, /* 'I' */
+  {   764,  2,  2, 11, 12 }, /* 'J' */
+  {   788,  2,  2, 11, 12 }, /* 'K' */
+  {   812,  2,  2, 10, 12 }, /* 'L' */
+  {   836,  1,  2, 12, 12 }, /* 'M' */
+  {   860,  2,  2, 10, 12 }, /* 'N' */
+  {   884,  2,  2, 10, 12 }, /* 'O' */
+  {   908,  2,  2, 10, 12 }, /* 'P' */
+  {   932,  2,  2, 10, 15 }, /* 'Q' */
+  {   962,  2,  2, 11, 12 }, /* 'R' */
+  {   986,  2,  2, 10, 12 }, /* 'S' */
+  {  1010,  2,  2, 10, 12 }, /* 'T' */
+  {  1034,  2,  2, 10, 12 }, /* 'U' */
+  {  1058,  1,  2, 11, 12 }, /* 'V' */
+  {  1082,  1,  2, 13, 12 }, /* 'W' */
+  {  1106,  1,  2, 11, 12 }, /* 'X' */
+  {  1130,  2,  2, 10, 12 }, /* 'Y' */
+  {  1154,  3,  2,  8, 12 }, /* 'Z' */
+  {  1166,  6,  1,  4, 16 }, /* '[' */
+  {  1182,  3,  0,  8, 16 }, /* '\\' */
+  {  1198,  4,  1,  4, 16 }, /* ']' */
+  {  1214,  2,  1,  9,  6 }, /* '^' */
+  {  1226,  0, 18, 14,  2 }, /* '_' */
+  {  1230,  5,  1,  4,  3 }, /* '`' */
+  {  1233,  2,  5, 10,  9 }, /* 'a' */
+  {  1251,  1,  1, 11, 13 }, /* 'b' */
+  {  1277,  2,  5, 10,  9 }, /* 'c' */
+  {  1295,  2,  1, 11, 13 }, /* 'd' */
+  {  1321,  2,  5, 10,  9 }, /* 'e' */
+  {  1339,  3,  1,  9, 13 }, /* 'f' */
+  {  1365,  2,  5, 11, 13 }, /* 'g' */
+  {  1391,  2,  1, 10, 13 }, /* 'h' */
+  {  1417,  3,  1,  8, 13 }, /* 'i' */
+  {  1430,  2,  1,  8, 17 }, /* 'j' */
+  {  1447,  2,  1, 10, 13 }, /* 'k' */
+  {  1473,  3,  1,  8, 13 }, /* 'l' */
+  {  1486,  1,  5, 12,  9 }, /* 'm' */
+  {  1504,  2,  5, 10,  9 }, /* 'n' */
+  {  1522,  2,  5, 10,  9 }, /* 'o' */
+  {  1540,  1,  5, 11, 13 }, /* 'p' */
+  {  1566,  2,  5, 11, 13 }, /* 'q' */
+  {  1592,  2,  5, 10,  9 }, /* 'r' */
+  {  1610,  3,  5,  8,  9 }, /* 's' */
+  {  1619,  2,  2, 10, 12 }, /* 't' */
+  {  1643,  2,  5, 10,  9 }, /* 'u' */
+  {  1661,  1,  5, 11,  9 }, /* 'v' */
+  {  1679,  1,  5, 11,  9 }, /* 'w' */
+  {  1697,  2,  5, 10,  9 }, /* 'x' */
+  {  1715,  1,  5, 11, 13 }, /* 'y' */
+  {  1741,  3,  5,  8,  9 }, /* 'z' */
+  {  1750,  4,  1,  6, 16 }, /* '{' */
+  {  1766,  6,  1,  2, 16 }, /* '|' */
+  {  1782,  3,  1,  6, 16 }, /* '}' */
+  {  1798,  2,  6, 10,  4 }, /* '~' */
+};
 
 sFONT Font20 = {
-  Font20_Table,
+  Font20_Bitmap,
+  Font20_Glyphs,
   14, /* Width */
   20, /* Height */
+  32, /* FirstChar */
+  95, /* GlyphCount */
+  1, /* Bpp */
 };
-
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Function_Prototypes
-  * @{
-  */ 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Functions
-  * @{
-  */
-    
-/**
-  * @}
-  */
-  
-/**
-  * @}
-  */ 
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */  
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
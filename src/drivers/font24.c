@@ -1,10 +1,9 @@
 /**
   ******************************************************************************
   * @file    font24.c
-  * @author  MCD Application Team
-  * @version V1.0.0
-  * @date    18-February-2014
-  * @brief   This file provides text font24 for STM32xx-EVAL's LCD driver. 
+  * @brief   Font24 glyphs, 17x24 cells, 1 bpp, 2345 bytes of bitmap.
+  *          Generated by tools/fontgen from the STMicroelectronics
+  *          tables, do not edit.
   ******************************************************************************
   * @attention
   *
@@ -35,2566 +34,1474 @@
   ******************************************************************************
   */
 
-/* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
-/** @addtogroup Utilities
-  * @{
-  */
-  
-/** @addtogroup STM32_EVAL
-  * @{
-  */ 
-
-/** @addtogroup Common
-  * @{
-  */
-
-/** @addtogroup FONTS
-  * @brief      This file provides text font24 for STM32xx-EVAL's LCD driver.
-  * @{
-  */  
-
-/** @defgroup FONTS_Private_Types
-  * @{
-  */ 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Defines
-  * @{
-  */
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Macros
-  * @{
-  */
-/**
-  * @}
-  */ 
-  
-
-/** @defgroup FONTS_Private_Variables
-  * @{
-  */
-const uint8_t Font24_Table [] = 
+static const uint8_t Font24_Bitmap[] =
 {
-	// @0 ' ' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @72 '!' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x01, 0x00, 0x00, //        #         
-	0x01, 0x00, 0x00, //        #         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @144 '"' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x0E, 0x70, 0x00, //     ###  ###     
-	0x0E, 0x70, 0x00, //     ###  ###     
-	0x0E, 0x70, 0x00, //     ###  ###     
-	0x04, 0x20, 0x00, //      #    #      
-	0x04, 0x20, 0x00, //      #    #      
-	0x04, 0x20, 0x00, //      #    #      
-	0x04, 0x20, 0x00, //      #    #      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @216 '#' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @288 '$' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x07, 0xB0, 0x00, //      #### ##     
-	0x0F, 0xF0, 0x00, //     ########     
-	0x18, 0x70, 0x00, //    ##    ###     
-	0x18, 0x70, 0x00, //    ##    ###     
-	0x1C, 0x00, 0x00, //    ###           
-	0x0F, 0x80, 0x00, //     #####        
-	0x07, 0xE0, 0x00, //      ######      
-	0x00, 0xF0, 0x00, //         ####     
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x1C, 0x30, 0x00, //    ###    ##     
-	0x1C, 0x70, 0x00, //    ###   ###     
-	0x1F, 0xE0, 0x00, //    ########      
-	0x1B, 0xC0, 0x00, //    ## ####       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @360 '%' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0x80, 0x00, //      ####        
-	0x0F, 0xC0, 0x00, //     ######       
-	0x1C, 0xE0, 0x00, //    ###  ###      
-	0x18, 0x60, 0x00, //    ##    ##      
-	0x18, 0x60, 0x00, //    ##    ##      
-	0x1C, 0xE0, 0x00, //    ###  ###      
-	0x0F, 0xF8, 0x00, //     #########    
-	0x07, 0xE0, 0x00, //      ######      
-	0x1F, 0xF0, 0x00, //    #########     
-	0x07, 0x38, 0x00, //      ###  ###    
-	0x06, 0x18, 0x00, //      ##    ##    
-	0x06, 0x18, 0x00, //      ##    ##    
-	0x07, 0x38, 0x00, //      ###  ###    
-	0x03, 0xF0, 0x00, //       ######     
-	0x01, 0xE0, 0x00, //        ####      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @432 '&' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xF0, 0x00, //       ######     
-	0x07, 0xF0, 0x00, //      #######     
-	0x0C, 0x60, 0x00, //     ##   ##      
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x06, 0x00, 0x00, //      ##          
-	0x07, 0x00, 0x00, //      ###         
-	0x0F, 0x9C, 0x00, //     #####  ###   
-	0x1D, 0xFC, 0x00, //    ### #######   
-	0x18, 0xF0, 0x00, //    ##   ####     
-	0x18, 0x70, 0x00, //    ##    ###     
-	0x0F, 0xFC, 0x00, //     ##########   
-	0x07, 0xDC, 0x00, //      ##### ###   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @504 ''' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x01, 0x00, 0x00, //        #         
-	0x01, 0x00, 0x00, //        #         
-	0x01, 0x00, 0x00, //        #         
-	0x01, 0x00, 0x00, //        #         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @576 '(' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x38, 0x00, //           ###    
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0xF0, 0x00, //         ####     
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0xE0, 0x00, //         ###      
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0xC0, 0x00, //        ###       
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0x38, 0x00, //           ###    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @648 ')' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x18, 0x00, 0x00, //    ##            
-	0x1C, 0x00, 0x00, //    ###           
-	0x0E, 0x00, 0x00, //     ###          
-	0x0E, 0x00, 0x00, //     ###          
-	0x07, 0x00, 0x00, //      ###         
-	0x07, 0x00, 0x00, //      ###         
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x80, 0x00, //       ###        
-	0x07, 0x00, 0x00, //      ###         
-	0x07, 0x00, 0x00, //      ###         
-	0x0F, 0x00, 0x00, //     ####         
-	0x0E, 0x00, 0x00, //     ###          
-	0x1C, 0x00, 0x00, //    ###           
-	0x18, 0x00, 0x00, //    ##            
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @720 '*' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x1D, 0xB8, 0x00, //    ### ## ###    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x07, 0xE0, 0x00, //      ######      
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @792 '+' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x3F, 0xFC, 0x00, //   ############   
-	0x3F, 0xFC, 0x00, //   ############   
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @864 ',' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0xC0, 0x00, //         ##       
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0x00, 0x00, //       ##         
-	0x03, 0x00, 0x00, //       ##         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @936 '-' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1008 '.' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1080 '/' (17 pixels wide)
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x38, 0x00, //           ###    
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0x60, 0x00, //          ##      
-	0x00, 0x60, 0x00, //          ##      
-	0x00, 0xC0, 0x00, //         ##       
-	0x00, 0xC0, 0x00, //         ##       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0x00, 0x00, //       ##         
-	0x03, 0x00, 0x00, //       ##         
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x0E, 0x00, 0x00, //     ###          
-	0x0C, 0x00, 0x00, //     ##           
-	0x1C, 0x00, 0x00, //    ###           
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1152 '0' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x07, 0xE0, 0x00, //      ######      
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x07, 0xE0, 0x00, //      ######      
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1224 '1' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x80, 0x00, //         #        
-	0x07, 0x80, 0x00, //      ####        
-	0x1F, 0x80, 0x00, //    ######        
-	0x1D, 0x80, 0x00, //    ### ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1296 '2' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xC0, 0x00, //      #####       
-	0x1F, 0xF0, 0x00, //    #########     
-	0x38, 0x30, 0x00, //   ###     ##     
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x60, 0x00, //          ##      
-	0x01, 0xC0, 0x00, //        ###       
-	0x03, 0x80, 0x00, //       ###        
-	0x06, 0x00, 0x00, //      ##          
-	0x0C, 0x00, 0x00, //     ##           
-	0x18, 0x00, 0x00, //    ##            
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1368 '3' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x0F, 0xE0, 0x00, //     #######      
-	0x0C, 0x70, 0x00, //     ##   ###     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x60, 0x00, //          ##      
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xE0, 0x00, //       #####      
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x1F, 0xF0, 0x00, //    #########     
-	0x0F, 0xC0, 0x00, //     ######       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1440 '4' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0xE0, 0x00, //         ###      
-	0x01, 0xE0, 0x00, //        ####      
-	0x01, 0xE0, 0x00, //        ####      
-	0x03, 0x60, 0x00, //       ## ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x0C, 0x60, 0x00, //     ##   ##      
-	0x0C, 0x60, 0x00, //     ##   ##      
-	0x18, 0x60, 0x00, //    ##    ##      
-	0x30, 0x60, 0x00, //   ##     ##      
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x00, 0x60, 0x00, //          ##      
-	0x03, 0xF8, 0x00, //       #######    
-	0x03, 0xF8, 0x00, //       #######    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1512 '5' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1F, 0xF0, 0x00, //    #########     
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x1B, 0xC0, 0x00, //    ## ####       
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1C, 0x30, 0x00, //    ###    ##     
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x30, 0x30, 0x00, //   ##      ##     
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x0F, 0xC0, 0x00, //     ######       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1584 '6' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0xF8, 0x00, //         #####    
-	0x03, 0xF8, 0x00, //       #######    
-	0x07, 0x00, 0x00, //      ###         
-	0x0E, 0x00, 0x00, //     ###          
-	0x0C, 0x00, 0x00, //     ##           
-	0x18, 0x00, 0x00, //    ##            
-	0x1B, 0xC0, 0x00, //    ## ####       
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1C, 0x30, 0x00, //    ###    ##     
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x38, 0x00, //     ##    ###    
-	0x0F, 0xF0, 0x00, //     ########     
-	0x03, 0xE0, 0x00, //       #####      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1656 '7' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0x60, 0x00, //          ##      
-	0x00, 0x60, 0x00, //          ##      
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0xC0, 0x00, //         ##       
-	0x00, 0xC0, 0x00, //         ##       
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1728 '8' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xE0, 0x00, //      ######      
-	0x0F, 0xF0, 0x00, //     ########     
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x07, 0xE0, 0x00, //      ######      
-	0x07, 0xE0, 0x00, //      ######      
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x0F, 0xF0, 0x00, //     ########     
-	0x07, 0xE0, 0x00, //      ######      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1800 '9' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xC0, 0x00, //      #####       
-	0x0F, 0xF0, 0x00, //     ########     
-	0x1C, 0x30, 0x00, //    ###    ##     
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x38, 0x00, //     ##    ###    
-	0x0F, 0xF8, 0x00, //     #########    
-	0x03, 0xD8, 0x00, //       #### ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0xE0, 0x00, //         ###      
-	0x1F, 0xC0, 0x00, //    #######       
-	0x1F, 0x00, 0x00, //    #####         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1872 ':' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @1944 ';' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0xF0, 0x00, //         ####     
-	0x00, 0xF0, 0x00, //         ####     
-	0x00, 0xF0, 0x00, //         ####     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0xE0, 0x00, //         ###      
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0x00, 0x00, //       ##         
-	0x02, 0x00, 0x00, //       #          
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2016 '<' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x1C, 0x00, //            ###   
-	0x00, 0x3C, 0x00, //           ####   
-	0x00, 0xF0, 0x00, //         ####     
-	0x03, 0xC0, 0x00, //       ####       
-	0x0F, 0x00, 0x00, //     ####         
-	0x3C, 0x00, 0x00, //   ####           
-	0xF0, 0x00, 0x00, // ####             
-	0x3C, 0x00, 0x00, //   ####           
-	0x0F, 0x00, 0x00, //     ####         
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0xF0, 0x00, //         ####     
-	0x00, 0x3C, 0x00, //           ####   
-	0x00, 0x1C, 0x00, //            ###   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2088 '=' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0xFC, 0x00, //  #############   
-	0x7F, 0xFC, 0x00, //  #############   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0xFC, 0x00, //  #############   
-	0x7F, 0xFC, 0x00, //  #############   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2160 '>' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x70, 0x00, 0x00, //  ###             
-	0x78, 0x00, 0x00, //  ####            
-	0x1E, 0x00, 0x00, //    ####          
-	0x07, 0x80, 0x00, //      ####        
-	0x01, 0xE0, 0x00, //        ####      
-	0x00, 0x78, 0x00, //          ####    
-	0x00, 0x1E, 0x00, //            ####  
-	0x00, 0x78, 0x00, //          ####    
-	0x01, 0xE0, 0x00, //        ####      
-	0x07, 0x80, 0x00, //      ####        
-	0x1E, 0x00, 0x00, //    ####          
-	0x78, 0x00, 0x00, //  ####            
-	0x70, 0x00, 0x00, //  ###             
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2232 '?' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xC0, 0x00, //      #####       
-	0x0F, 0xE0, 0x00, //     #######      
-	0x18, 0x70, 0x00, //    ##    ###     
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0xE0, 0x00, //         ###      
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0x80, 0x00, //       ###        
-	0x03, 0x00, 0x00, //       ##         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0x00, 0x00, //      ###         
-	0x07, 0x00, 0x00, //      ###         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2304 '@' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xE0, 0x00, //       #####      
-	0x07, 0xF0, 0x00, //      #######     
-	0x0E, 0x38, 0x00, //     ###   ###    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x18, 0x78, 0x00, //    ##    ####    
-	0x18, 0xF8, 0x00, //    ##   #####    
-	0x19, 0xD8, 0x00, //    ##  ### ##    
-	0x19, 0x98, 0x00, //    ##  ##  ##    
-	0x19, 0x98, 0x00, //    ##  ##  ##    
-	0x19, 0x98, 0x00, //    ##  ##  ##    
-	0x18, 0xF8, 0x00, //    ##   #####    
-	0x18, 0x78, 0x00, //    ##    ####    
-	0x18, 0x00, 0x00, //    ##            
-	0x0C, 0x00, 0x00, //     ##           
-	0x0E, 0x18, 0x00, //     ###    ##    
-	0x07, 0xF8, 0x00, //      ########    
-	0x03, 0xE0, 0x00, //       #####      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2376 'A' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0x80, 0x00, //    ######        
-	0x1F, 0xC0, 0x00, //    #######       
-	0x01, 0xC0, 0x00, //        ###       
-	0x03, 0x60, 0x00, //       ## ##      
-	0x03, 0x60, 0x00, //       ## ##      
-	0x06, 0x30, 0x00, //      ##   ##     
-	0x06, 0x30, 0x00, //      ##   ##     
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x0F, 0xF8, 0x00, //     #########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0xFC, 0x7F, 0x00, // ######   ####### 
-	0xFC, 0x7F, 0x00, // ######   ####### 
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2448 'B' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0xE0, 0x00, //  ##########      
-	0x7F, 0xF0, 0x00, //  ###########     
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x1C, 0x00, //    ##      ###   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x7F, 0xF8, 0x00, //  ############    
-	0x7F, 0xF0, 0x00, //  ###########     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2520 'C' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xEC, 0x00, //       ##### ##   
-	0x0F, 0xFC, 0x00, //     ##########   
-	0x1C, 0x1C, 0x00, //    ###     ###   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0x00, 0x00, //   ##             
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x1C, 0x1C, 0x00, //    ###     ###   
-	0x0F, 0xF8, 0x00, //     #########    
-	0x03, 0xF0, 0x00, //       ######     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2592 'D' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0xC0, 0x00, //  #########       
-	0x7F, 0xF0, 0x00, //  ###########     
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x7F, 0xF0, 0x00, //  ###########     
-	0x7F, 0xE0, 0x00, //  ##########      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2664 'E' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0xF8, 0x00, //  ############    
-	0x7F, 0xF8, 0x00, //  ############    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x19, 0x98, 0x00, //    ##  ##  ##    
-	0x19, 0x80, 0x00, //    ##  ##        
-	0x1F, 0x80, 0x00, //    ######        
-	0x1F, 0x80, 0x00, //    ######        
-	0x19, 0x80, 0x00, //    ##  ##        
-	0x19, 0x98, 0x00, //    ##  ##  ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x7F, 0xF8, 0x00, //  ############    
-	0x7F, 0xF8, 0x00, //  ############    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2736 'F' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x3F, 0xFC, 0x00, //   ############   
-	0x3F, 0xFC, 0x00, //   ############   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0xCC, 0x00, //     ##  ##  ##   
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0F, 0xC0, 0x00, //     ######       
-	0x0F, 0xC0, 0x00, //     ######       
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x3F, 0xC0, 0x00, //   ########       
-	0x3F, 0xC0, 0x00, //   ########       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2808 'G' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xEC, 0x00, //       ##### ##   
-	0x0F, 0xFC, 0x00, //     ##########   
-	0x1C, 0x1C, 0x00, //    ###     ###   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0xFE, 0x00, //   ##    #######  
-	0x30, 0xFE, 0x00, //   ##    #######  
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x38, 0x0C, 0x00, //   ###       ##   
-	0x1C, 0x1C, 0x00, //    ###     ###   
-	0x0F, 0xFC, 0x00, //     ##########   
-	0x03, 0xF0, 0x00, //       ######     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2880 'H' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @2952 'I' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3024 'J' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xFE, 0x00, //      ##########  
-	0x07, 0xFE, 0x00, //      ##########  
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x30, 0x30, 0x00, //   ##      ##     
-	0x30, 0x30, 0x00, //   ##      ##     
-	0x30, 0x30, 0x00, //   ##      ##     
-	0x30, 0x30, 0x00, //   ##      ##     
-	0x30, 0x60, 0x00, //   ##     ##      
-	0x3F, 0xE0, 0x00, //   #########      
-	0x0F, 0x80, 0x00, //     #####        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3096 'K' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0x3E, 0x00, //  #######  #####  
-	0x7F, 0x3E, 0x00, //  #######  #####  
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x18, 0x60, 0x00, //    ##    ##      
-	0x18, 0xC0, 0x00, //    ##   ##       
-	0x19, 0x80, 0x00, //    ##  ##        
-	0x1B, 0x80, 0x00, //    ## ###        
-	0x1F, 0xC0, 0x00, //    #######       
-	0x1C, 0xE0, 0x00, //    ###  ###      
-	0x18, 0x70, 0x00, //    ##    ###     
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x7F, 0x1F, 0x00, //  #######   ##### 
-	0x7F, 0x1F, 0x00, //  #######   ##### 
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3168 'L' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0x80, 0x00, //  ########        
-	0x7F, 0x80, 0x00, //  ########        
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x7F, 0xFC, 0x00, //  #############   
-	0x7F, 0xFC, 0x00, //  #############   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3240 'M' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0xF0, 0x0F, 0x00, // ####        #### 
-	0xF8, 0x1F, 0x00, // #####      ##### 
-	0x38, 0x1C, 0x00, //   ###      ###   
-	0x3C, 0x3C, 0x00, //   ####    ####   
-	0x3C, 0x3C, 0x00, //   ####    ####   
-	0x36, 0x6C, 0x00, //   ## ##  ## ##   
-	0x36, 0x6C, 0x00, //   ## ##  ## ##   
-	0x33, 0xCC, 0x00, //   ##  ####  ##   
-	0x33, 0xCC, 0x00, //   ##  ####  ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0xFE, 0x7F, 0x00, // #######  ####### 
-	0xFE, 0x7F, 0x00, // #######  ####### 
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3312 'N' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x78, 0xFE, 0x00, //  ####   #######  
-	0x78, 0xFE, 0x00, //  ####   #######  
-	0x1C, 0x18, 0x00, //    ###     ##    
-	0x1E, 0x18, 0x00, //    ####    ##    
-	0x1F, 0x18, 0x00, //    #####   ##    
-	0x1B, 0x18, 0x00, //    ## ##   ##    
-	0x1B, 0x98, 0x00, //    ## ###  ##    
-	0x19, 0xD8, 0x00, //    ##  ### ##    
-	0x18, 0xD8, 0x00, //    ##   ## ##    
-	0x18, 0xF8, 0x00, //    ##   #####    
-	0x18, 0x78, 0x00, //    ##    ####    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x7F, 0x18, 0x00, //  #######   ##    
-	0x7F, 0x18, 0x00, //  #######   ##    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3384 'O' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x0F, 0xF0, 0x00, //     ########     
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x38, 0x1C, 0x00, //   ###      ###   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x38, 0x1C, 0x00, //   ###      ###   
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x0F, 0xF0, 0x00, //     ########     
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3456 'P' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x0C, 0x1C, 0x00, //     ##     ###   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0x0C, 0x00, //     ##      ##   
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x0F, 0xF8, 0x00, //     #########    
-	0x0F, 0xE0, 0x00, //     #######      
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x3F, 0xC0, 0x00, //   ########       
-	0x3F, 0xC0, 0x00, //   ########       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3528 'Q' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x0F, 0xF0, 0x00, //     ########     
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x38, 0x1C, 0x00, //   ###      ###   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x38, 0x1C, 0x00, //   ###      ###   
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x0F, 0xF0, 0x00, //     ########     
-	0x07, 0xC0, 0x00, //      #####       
-	0x07, 0xCC, 0x00, //      #####  ##   
-	0x0F, 0xFC, 0x00, //     ##########   
-	0x0C, 0x38, 0x00, //     ##    ###    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3600 'R' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0xE0, 0x00, //  ##########      
-	0x7F, 0xF0, 0x00, //  ###########     
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1F, 0xC0, 0x00, //    #######       
-	0x18, 0xE0, 0x00, //    ##   ###      
-	0x18, 0x70, 0x00, //    ##    ###     
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x7F, 0x1E, 0x00, //  #######   ####  
-	0x7F, 0x0E, 0x00, //  #######    ###  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3672 'S' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xD8, 0x00, //      ##### ##    
-	0x0F, 0xF8, 0x00, //     #########    
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x1E, 0x00, 0x00, //    ####          
-	0x0F, 0xC0, 0x00, //     ######       
-	0x03, 0xF0, 0x00, //       ######     
-	0x00, 0x78, 0x00, //          ####    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1B, 0xE0, 0x00, //    ## #####      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3744 'T' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x3F, 0xFC, 0x00, //   ############   
-	0x3F, 0xFC, 0x00, //   ############   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x0F, 0xF0, 0x00, //     ########     
-	0x0F, 0xF0, 0x00, //     ########     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3816 'U' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x0F, 0xF0, 0x00, //     ########     
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3888 'V' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7F, 0x7F, 0x00, //  ####### ####### 
-	0x7F, 0x7F, 0x00, //  ####### ####### 
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x06, 0x30, 0x00, //      ##   ##     
-	0x06, 0x30, 0x00, //      ##   ##     
-	0x03, 0x60, 0x00, //       ## ##      
-	0x03, 0x60, 0x00, //       ## ##      
-	0x03, 0x60, 0x00, //       ## ##      
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0xC0, 0x00, //        ###       
-	0x00, 0x80, 0x00, //         #        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @3960 'W' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0xFE, 0x3F, 0x80, // #######   #######
-	0xFE, 0x3F, 0x80, // #######   #######
-	0x30, 0x06, 0x00, //   ##         ##  
-	0x30, 0x06, 0x00, //   ##         ##  
-	0x30, 0x86, 0x00, //   ##    #    ##  
-	0x19, 0xCC, 0x00, //    ##  ###  ##   
-	0x19, 0xCC, 0x00, //    ##  ###  ##   
-	0x1B, 0x6C, 0x00, //    ## ## ## ##   
-	0x1B, 0x6C, 0x00, //    ## ## ## ##   
-	0x1E, 0x7C, 0x00, //    ####  #####   
-	0x0E, 0x38, 0x00, //     ###   ###    
-	0x0E, 0x38, 0x00, //     ###   ###    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4032 'X' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x03, 0xC0, 0x00, //       ####       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0xC0, 0x00, //       ####       
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4104 'Y' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7C, 0x7E, 0x00, //  #####   ######  
-	0x7C, 0x7E, 0x00, //  #####   ######  
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x03, 0xC0, 0x00, //       ####       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x0F, 0xF0, 0x00, //     ########     
-	0x0F, 0xF0, 0x00, //     ########     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4176 'Z' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x18, 0x60, 0x00, //    ##    ##      
-	0x18, 0xC0, 0x00, //    ##   ##       
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0x00, 0x00, //       ##         
-	0x06, 0x18, 0x00, //      ##    ##    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4248 '[' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x01, 0xF0, 0x00, //        #####     
-	0x01, 0xF0, 0x00, //        #####     
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0xF0, 0x00, //        #####     
-	0x01, 0xF0, 0x00, //        #####     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4320 '\' (17 pixels wide)
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x1C, 0x00, 0x00, //    ###           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0E, 0x00, 0x00, //     ###          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x03, 0x00, 0x00, //       ##         
-	0x03, 0x00, 0x00, //       ##         
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x00, 0xC0, 0x00, //         ##       
-	0x00, 0xC0, 0x00, //         ##       
-	0x00, 0x60, 0x00, //          ##      
-	0x00, 0x60, 0x00, //          ##      
-	0x00, 0x70, 0x00, //          ###     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x38, 0x00, //           ###    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4392 ']' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x0F, 0x80, 0x00, //     #####        
-	0x0F, 0x80, 0x00, //     #####        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x0F, 0x80, 0x00, //     #####        
-	0x0F, 0x80, 0x00, //     #####        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4464 '^' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x80, 0x00, //         #        
-	0x01, 0xC0, 0x00, //        ###       
-	0x03, 0xE0, 0x00, //       #####      
-	0x07, 0x70, 0x00, //      ### ###     
-	0x06, 0x30, 0x00, //      ##   ##     
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x10, 0x04, 0x00, //    #         #   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4536 '_' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0xFF, 0xFF, 0x00, // ################ 
-	0xFF, 0xFF, 0x00, // ################ 
-
-	// @4608 '`' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x03, 0x00, 0x00, //       ##         
-	0x03, 0x80, 0x00, //       ###        
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0x60, 0x00, //          ##      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4680 'a' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x0F, 0xC0, 0x00, //     ######       
-	0x1F, 0xE0, 0x00, //    ########      
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x07, 0xF0, 0x00, //      #######     
-	0x1F, 0xF0, 0x00, //    #########     
-	0x38, 0x30, 0x00, //   ###     ##     
-	0x30, 0x30, 0x00, //   ##      ##     
-	0x30, 0x70, 0x00, //   ##     ###     
-	0x1F, 0xFC, 0x00, //    ###########   
-	0x0F, 0xBC, 0x00, //     ##### ####   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4752 'b' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x78, 0x00, 0x00, //  ####            
-	0x78, 0x00, 0x00, //  ####            
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x1B, 0xE0, 0x00, //    ## #####      
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1C, 0x18, 0x00, //    ###     ##    
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x1C, 0x18, 0x00, //    ###     ##    
-	0x7F, 0xF8, 0x00, //  ############    
-	0x7B, 0xE0, 0x00, //  #### #####      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4824 'c' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xEC, 0x00, //       ##### ##   
-	0x0F, 0xFC, 0x00, //     ##########   
-	0x1C, 0x1C, 0x00, //    ###     ###   
-	0x38, 0x0C, 0x00, //   ###       ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0x00, 0x00, //   ##             
-	0x38, 0x0C, 0x00, //   ###       ##   
-	0x1C, 0x1C, 0x00, //    ###     ###   
-	0x0F, 0xF8, 0x00, //     #########    
-	0x03, 0xF0, 0x00, //       ######     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4896 'd' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x78, 0x00, //          ####    
-	0x00, 0x78, 0x00, //          ####    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x07, 0xD8, 0x00, //      ##### ##    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x1F, 0xFE, 0x00, //    ############  
-	0x07, 0xDE, 0x00, //      ##### ####  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @4968 'e' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xE0, 0x00, //      ######      
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x3F, 0xFC, 0x00, //   ############   
-	0x3F, 0xFC, 0x00, //   ############   
-	0x30, 0x00, 0x00, //   ##             
-	0x30, 0x00, 0x00, //   ##             
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x1F, 0xFC, 0x00, //    ###########   
-	0x07, 0xF0, 0x00, //      #######     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5040 'f' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x01, 0xFC, 0x00, //        #######   
-	0x03, 0xFC, 0x00, //       ########   
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x3F, 0xF8, 0x00, //   ###########    
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5112 'g' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xDE, 0x00, //      ##### ####  
-	0x1F, 0xFE, 0x00, //    ############  
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x07, 0xD8, 0x00, //      ##### ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x38, 0x00, //           ###    
-	0x0F, 0xF0, 0x00, //     ########     
-	0x0F, 0xC0, 0x00, //     ######       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5184 'h' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x78, 0x00, 0x00, //  ####            
-	0x78, 0x00, 0x00, //  ####            
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x1B, 0xE0, 0x00, //    ## #####      
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5256 'i' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0x80, 0x00, //    ######        
-	0x1F, 0x80, 0x00, //    ######        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x3F, 0xFC, 0x00, //   ############   
-	0x3F, 0xFC, 0x00, //   ############   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5328 'j' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0xC0, 0x00, //         ##       
-	0x00, 0xC0, 0x00, //         ##       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1F, 0xF0, 0x00, //    #########     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x30, 0x00, //           ##     
-	0x00, 0x70, 0x00, //          ###     
-	0x1F, 0xE0, 0x00, //    ########      
-	0x1F, 0x80, 0x00, //    ######        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5400 'k' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x3C, 0x00, 0x00, //   ####           
-	0x3C, 0x00, 0x00, //   ####           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0xF8, 0x00, //     ##  #####    
-	0x0C, 0xF8, 0x00, //     ##  #####    
-	0x0C, 0xC0, 0x00, //     ##  ##       
-	0x0D, 0x80, 0x00, //     ## ##        
-	0x0F, 0x80, 0x00, //     #####        
-	0x0F, 0x00, 0x00, //     ####         
-	0x0F, 0x80, 0x00, //     #####        
-	0x0D, 0xC0, 0x00, //     ## ###       
-	0x0C, 0xE0, 0x00, //     ##  ###      
-	0x3C, 0x7C, 0x00, //   ####   #####   
-	0x3C, 0x7C, 0x00, //   ####   #####   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5472 'l' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0x80, 0x00, //    ######        
-	0x1F, 0x80, 0x00, //    ######        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x3F, 0xFC, 0x00, //   ############   
-	0x3F, 0xFC, 0x00, //   ############   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5544 'm' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0xF7, 0x78, 0x00, // #### ### ####    
-	0xFF, 0xFC, 0x00, // ##############   
-	0x39, 0xCC, 0x00, //   ###  ###  ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0x31, 0x8C, 0x00, //   ##   ##   ##   
-	0xFD, 0xEF, 0x00, // ###### #### #### 
-	0xFD, 0xEF, 0x00, // ###### #### #### 
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5616 'n' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7B, 0xE0, 0x00, //  #### #####      
-	0x7F, 0xF0, 0x00, //  ###########     
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x7E, 0x7E, 0x00, //  ######  ######  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5688 'o' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x03, 0xC0, 0x00, //       ####       
-	0x0F, 0xF0, 0x00, //     ########     
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x38, 0x1C, 0x00, //   ###      ###   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x30, 0x0C, 0x00, //   ##        ##   
-	0x38, 0x1C, 0x00, //   ###      ###   
-	0x1C, 0x38, 0x00, //    ###    ###    
-	0x0F, 0xF0, 0x00, //     ########     
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5760 'p' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7B, 0xE0, 0x00, //  #### #####      
-	0x7F, 0xF8, 0x00, //  ############    
-	0x1C, 0x18, 0x00, //    ###     ##    
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x1C, 0x18, 0x00, //    ###     ##    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1B, 0xE0, 0x00, //    ## #####      
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x18, 0x00, 0x00, //    ##            
-	0x7F, 0x00, 0x00, //  #######         
-	0x7F, 0x00, 0x00, //  #######         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5832 'q' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xDE, 0x00, //      ##### ####  
-	0x1F, 0xFE, 0x00, //    ############  
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x30, 0x18, 0x00, //   ##       ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x07, 0xD8, 0x00, //      ##### ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0x18, 0x00, //            ##    
-	0x00, 0xFE, 0x00, //         #######  
-	0x00, 0xFE, 0x00, //         #######  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5904 'r' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x3E, 0x78, 0x00, //   #####  ####    
-	0x3E, 0xFC, 0x00, //   ##### ######   
-	0x07, 0xCC, 0x00, //      #####  ##   
-	0x07, 0x00, 0x00, //      ###         
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x06, 0x00, 0x00, //      ##          
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @5976 's' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0xF8, 0x00, //      ########    
-	0x0F, 0xF8, 0x00, //     #########    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x1F, 0x80, 0x00, //    ######        
-	0x0F, 0xF0, 0x00, //     ########     
-	0x00, 0xF8, 0x00, //         #####    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x1F, 0xF0, 0x00, //    #########     
-	0x1F, 0xE0, 0x00, //    ########      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6048 't' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x3F, 0xF0, 0x00, //   ##########     
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x00, 0x00, //     ##           
-	0x0C, 0x1C, 0x00, //     ##     ###   
-	0x07, 0xFC, 0x00, //      #########   
-	0x03, 0xF0, 0x00, //       ######     
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6120 'u' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x78, 0x78, 0x00, //  ####    ####    
-	0x78, 0x78, 0x00, //  ####    ####    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x38, 0x00, //    ##     ###    
-	0x0F, 0xFE, 0x00, //     ###########  
-	0x07, 0xDE, 0x00, //      ##### ####  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6192 'v' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7C, 0x3E, 0x00, //  #####    #####  
-	0x7C, 0x3E, 0x00, //  #####    #####  
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x18, 0x18, 0x00, //    ##      ##    
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x07, 0xE0, 0x00, //      ######      
-	0x03, 0xC0, 0x00, //       ####       
-	0x03, 0xC0, 0x00, //       ####       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6264 'w' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x78, 0x3C, 0x00, //  ####     ####   
-	0x78, 0x3C, 0x00, //  ####     ####   
-	0x31, 0x18, 0x00, //   ##   #   ##    
-	0x33, 0x98, 0x00, //   ##  ###  ##    
-	0x33, 0x98, 0x00, //   ##  ###  ##    
-	0x1A, 0xB0, 0x00, //    ## # # ##     
-	0x1E, 0xF0, 0x00, //    #### ####     
-	0x1E, 0xF0, 0x00, //    #### ####     
-	0x1C, 0x60, 0x00, //    ###   ##      
-	0x0C, 0x60, 0x00, //     ##   ##      
-	0x0C, 0x60, 0x00, //     ##   ##      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6336 'x' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x3E, 0x7C, 0x00, //   #####  #####   
-	0x3E, 0x7C, 0x00, //   #####  #####   
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x03, 0xC0, 0x00, //       ####       
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0xC0, 0x00, //       ####       
-	0x06, 0x60, 0x00, //      ##  ##      
-	0x0C, 0x30, 0x00, //     ##    ##     
-	0x3E, 0x7C, 0x00, //   #####  #####   
-	0x3E, 0x7C, 0x00, //   #####  #####   
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6408 'y' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x7E, 0x1F, 0x00, //  ######    ##### 
-	0x7E, 0x1F, 0x00, //  ######    ##### 
-	0x18, 0x0C, 0x00, //    ##       ##   
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x06, 0x30, 0x00, //      ##   ##     
-	0x06, 0x30, 0x00, //      ##   ##     
-	0x03, 0x60, 0x00, //       ## ##      
-	0x03, 0xE0, 0x00, //       #####      
-	0x01, 0xC0, 0x00, //        ###       
-	0x00, 0xC0, 0x00, //         ##       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0x00, 0x00, //       ##         
-	0x3F, 0xC0, 0x00, //   ########       
-	0x3F, 0xC0, 0x00, //   ########       
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6480 'z' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x18, 0x30, 0x00, //    ##     ##     
-	0x18, 0x60, 0x00, //    ##    ##      
-	0x00, 0xC0, 0x00, //         ##       
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0x00, 0x00, //       ##         
-	0x06, 0x18, 0x00, //      ##    ##    
-	0x0C, 0x18, 0x00, //     ##     ##    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x1F, 0xF8, 0x00, //    ##########    
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6552 '{' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0xE0, 0x00, //         ###      
-	0x01, 0xE0, 0x00, //        ####      
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x03, 0x80, 0x00, //       ###        
-	0x07, 0x00, 0x00, //      ###         
-	0x03, 0x80, 0x00, //       ###        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0xE0, 0x00, //        ####      
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6624 '|' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-
-	// @6696 '}' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x07, 0x00, 0x00, //      ###         
-	0x07, 0x80, 0x00, //      ####        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0xC0, 0x00, //        ###       
-	0x00, 0xE0, 0x00, //         ###      
-	0x01, 0xC0, 0x00, //        ###       
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x01, 0x80, 0x00, //        ##        
-	0x07, 0x80, 0x00, //      ####        
-	0x07, 0x00, 0x00, //      ###         
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
+  /* '!' */
+  0xE0,
+  0xE0,
+  0xE0,
+  0xE0,
+  0xE0,
+  0xE0,
+  0xE0,
+  0xE0,
+  0xE0,
+  0x40,
+  0x40,
+  0x00,
+  0x00,
+  0xE0,
+  0xE0,
+  /* '"' */
+  0xE7,
+  0xE7,
+  0xE7,
+  0x42,
+  0x42,
+  0x42,
+  0x42,
+  /* '#' */
+  0x19, 0x80,
+  0x19, 0x80,
+  0x19, 0x80,
+  0x19, 0x80,
+  0x19, 0x80,
+  0xFF, 0xE0,
+  0xFF, 0xE0,
+  0x19, 0x80,
+  0x33, 0x00,
+  0xFF, 0xE0,
+  0xFF, 0xE0,
+  0x33, 0x00,
+  0x33, 0x00,
+  0x33, 0x00,
+  0x33, 0x00,
+  0x33, 0x00,
+  /* '$' */
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x3D, 0x80,
+  0x7F, 0x80,
+  0xC3, 0x80,
+  0xC3, 0x80,
+  0xE0, 0x00,
+  0x7C, 0x00,
+  0x3F, 0x00,
+  0x07, 0x80,
+  0xC1, 0x80,
+  0xE1, 0x80,
+  0xE3, 0x80,
+  0xFF, 0x00,
+  0xDE, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  /* '%' */
+  0x3C, 0x00,
+  0x7E, 0x00,
+  0xE7, 0x00,
+  0xC3, 0x00,
+  0xC3, 0x00,
+  0xE7, 0x00,
+  0x7F, 0xC0,
+  0x3F, 0x00,
+  0xFF, 0x80,
+  0x39, 0xC0,
+  0x30, 0xC0,
+  0x30, 0xC0,
+  0x39, 0xC0,
+  0x1F, 0x80,
+  0x0F, 0x00,
+  /* '&' */
+  0x1F, 0x80,
+  0x3F, 0x80,
+  0x63, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0x30, 0x00,
+  0x38, 0x00,
+  0x7C, 0xE0,
+  0xEF, 0xE0,
+  0xC7, 0x80,
+  0xC3, 0x80,
+  0x7F, 0xE0,
+  0x3E, 0xE0,
+  /* ''' */
+  0xE0,
+  0xE0,
+  0xE0,
+  0x40,
+  0x40,
+  0x40,
+  0x40,
+  /* '(' */
+  0x0C,
+  0x1C,
+  0x38,
+  0x78,
+  0x70,
+  0x70,
+  0xE0,
+  0xE0,
+  0xE0,
+  0xE0,
+  0xE0,
+  0xE0,
+  0x70,
+  0x70,
+  0x38,
+  0x38,
+  0x1C,
+  0x0C,
+  /* ')' */
+  0xC0,
+  0xE0,
+  0x70,
+  0x70,
+  0x38,
+  0x38,
+  0x1C,
+  0x1C,
+  0x1C,
+  0x1C,
+  0x1C,
+  0x1C,
+  0x38,
+  0x38,
+  0x78,
+  0x70,
+  0xE0,
+  0xC0,
+  /* '*' */
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0xED, 0xC0,
+  0xFF, 0xC0,
+  0x3F, 0x00,
+  0x1E, 0x00,
+  0x1E, 0x00,
+  0x33, 0x00,
+  0x33, 0x00,
+  /* '+' */
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0xFF, 0xF0,
+  0xFF, 0xF0,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  /* ',' */
+  0x38,
+  0x30,
+  0x70,
+  0x60,
+  0x60,
+  0xC0,
+  0xC0,
+  /* '-' */
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  /* '.' */
+  0xF0,
+  0xF0,
+  0xF0,
+  /* '/' */
+  0x00, 0xC0,
+  0x00, 0xC0,
+  0x01, 0xC0,
+  0x01, 0x80,
+  0x03, 0x80,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x70, 0x00,
+  0x60, 0x00,
+  0xE0, 0x00,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  /* '0' */
+  0x1E, 0x00,
+  0x3F, 0x00,
+  0x61, 0x80,
+  0x61, 0x80,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0x61, 0x80,
+  0x61, 0x80,
+  0x3F, 0x00,
+  0x1E, 0x00,
+  /* '1' */
+  0x04, 0x00,
+  0x3C, 0x00,
+  0xFC, 0x00,
+  0xEC, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  /* '2' */
+  0x1F, 0x00,
+  0x7F, 0xC0,
+  0xE0, 0xC0,
+  0xC0, 0x60,
+  0xC0, 0x60,
+  0x00, 0x60,
+  0x00, 0xC0,
+  0x01, 0x80,
+  0x07, 0x00,
+  0x0E, 0x00,
+  0x18, 0x00,
+  0x30, 0x00,
+  0x60, 0x00,
+  0xFF, 0xE0,
+  0xFF, 0xE0,
+  /* '3' */
+  0x1E, 0x00,
+  0x7F, 0x00,
+  0x63, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x03, 0x00,
+  0x1E, 0x00,
+  0x1F, 0x00,
+  0x03, 0x80,
+  0x00, 0xC0,
+  0x00, 0xC0,
+  0x00, 0xC0,
+  0xC1, 0xC0,
+  0xFF, 0x80,
+  0x7E, 0x00,
+  /* '4' */
+  0x03, 0x80,
+  0x07, 0x80,
+  0x07, 0x80,
+  0x0D, 0x80,
+  0x19, 0x80,
+  0x19, 0x80,
+  0x31, 0x80,
+  0x31, 0x80,
+  0x61, 0x80,
+  0xC1, 0x80,
+  0xFF, 0xE0,
+  0xFF, 0xE0,
+  0x01, 0x80,
+  0x0F, 0xE0,
+  0x0F, 0xE0,
+  /* '5' */
+  0x7F, 0xC0,
+  0x7F, 0xC0,
+  0x60, 0x00,
+  0x60, 0x00,
+  0x60, 0x00,
+  0x6F, 0x00,
+  0x7F, 0xC0,
+  0x70, 0xC0,
+  0x00, 0x60,
+  0x00, 0x60,
+  0x00, 0x60,
+  0x00, 0x60,
+  0xC0, 0xC0,
+  0xFF, 0xC0,
+  0x3F, 0x00,
+  /* '6' */
+  0x07, 0xC0,
+  0x1F, 0xC0,
+  0x38, 0x00,
+  0x70, 0x00,
+  0x60, 0x00,
+  0xC0, 0x00,
+  0xDE, 0x00,
+  0xFF, 0x80,
+  0xE1, 0x80,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0x61, 0xC0,
+  0x7F, 0x80,
+  0x1F, 0x00,
+  /* '7' */
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  0xC0, 0xC0,
+  0xC1, 0xC0,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x03, 0x80,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x07, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x0E, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  /* '8' */
+  0x3F, 0x00,
+  0x7F, 0x80,
+  0xE1, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0x61, 0x80,
+  0x3F, 0x00,
+  0x3F, 0x00,
+  0x61, 0x80,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xE1, 0xC0,
+  0x7F, 0x80,
+  0x3F, 0x00,
+  /* '9' */
+  0x3E, 0x00,
+  0x7F, 0x80,
+  0xE1, 0x80,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0x61, 0xC0,
+  0x7F, 0xC0,
+  0x1E, 0xC0,
+  0x00, 0xC0,
+  0x01, 0x80,
+  0x03, 0x80,
+  0x07, 0x00,
+  0xFE, 0x00,
+  0xF8, 0x00,
+  /* ':' */
+  0xF0,
+  0xF0,
+  0xF0,
+  0x00,
+  0x00,
+  0x00,
+  0x00,
+  0x00,
+  0xF0,
+  0xF0,
+  0xF0,
+  /* ';' */
+  0x3C,
+  0x3C,
+  0x3C,
+  0x00,
+  0x00,
+  0x00,
+  0x00,
+  0x38,
+  0x70,
+  0x60,
+  0x60,
+  0xC0,
+  0x80,
+  /* '<' */
+  0x00, 0x1C,
+  0x00, 0x3C,
+  0x00, 0xF0,
+  0x03, 0xC0,
+  0x0F, 0x00,
+  0x3C, 0x00,
+  0xF0, 0x00,
+  0x3C, 0x00,
+  0x0F, 0x00,
+  0x03, 0xC0,
+  0x00, 0xF0,
+  0x00, 0x3C,
+  0x00, 0x1C,
+  /* '=' */
+  0xFF, 0xF8,
+  0xFF, 0xF8,
+  0x00, 0x00,
+  0x00, 0x00,
+  0xFF, 0xF8,
+  0xFF, 0xF8,
+  /* '>' */
+  0xE0, 0x00,
+  0xF0, 0x00,
+  0x3C, 0x00,
+  0x0F, 0x00,
+  0x03, 0xC0,
+  0x00, 0xF0,
+  0x00, 0x3C,
+  0x00, 0xF0,
+  0x03, 0xC0,
+  0x0F, 0x00,
+  0x3C, 0x00,
+  0xF0, 0x00,
+  0xE0, 0x00,
+  /* '?' */
+  0x3E, 0x00,
+  0x7F, 0x00,
+  0xC3, 0x80,
+  0xC1, 0x80,
+  0xC1, 0x80,
+  0x03, 0x80,
+  0x07, 0x00,
+  0x1E, 0x00,
+  0x1C, 0x00,
+  0x18, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x38, 0x00,
+  0x38, 0x00,
+  /* '@' */
+  0x1F, 0x00,
+  0x3F, 0x80,
+  0x71, 0xC0,
+  0x60, 0xC0,
+  0xC3, 0xC0,
+  0xC7, 0xC0,
+  0xCE, 0xC0,
+  0xCC, 0xC0,
+  0xCC, 0xC0,
+  0xCC, 0xC0,
+  0xC7, 0xC0,
+  0xC3, 0xC0,
+  0xC0, 0x00,
+  0x60, 0x00,
+  0x70, 0xC0,
+  0x3F, 0xC0,
+  0x1F, 0x00,
+  /* 'A' */
+  0x1F, 0x80,
+  0x1F, 0xC0,
+  0x01, 0xC0,
+  0x03, 0x60,
+  0x03, 0x60,
+  0x06, 0x30,
+  0x06, 0x30,
+  0x0C, 0x30,
+  0x0F, 0xF8,
+  0x1F, 0xF8,
+  0x18, 0x0C,
+  0x30, 0x0C,
+  0xFC, 0x7F,
+  0xFC, 0x7F,
+  /* 'B' */
+  0xFF, 0xC0,
+  0xFF, 0xE0,
+  0x30, 0x70,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x70,
+  0x3F, 0xE0,
+  0x3F, 0xF0,
+  0x30, 0x38,
+  0x30, 0x18,
+  0x30, 0x18,
+  0x30, 0x18,
+  0xFF, 0xF0,
+  0xFF, 0xE0,
+  /* 'C' */
+  0x0F, 0xB0,
+  0x3F, 0xF0,
+  0x70, 0x70,
+  0x60, 0x30,
+  0xC0, 0x30,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0x60, 0x30,
+  0x70, 0x70,
+  0x3F, 0xE0,
+  0x0F, 0xC0,
+  /* 'D' */
+  0xFF, 0x80,
+  0xFF, 0xE0,
+  0x30, 0x70,
+  0x30, 0x30,
+  0x30, 0x18,
+  0x30, 0x18,
+  0x30, 0x18,
+  0x30, 0x18,
+  0x30, 0x18,
+  0x30, 0x18,
+  0x30, 0x30,
+  0x30, 0x70,
+  0xFF, 0xE0,
+  0xFF, 0xC0,
+  /* 'E' */
+  0xFF, 0xF0,
+  0xFF, 0xF0,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x33, 0x30,
+  0x33, 0x00,
+  0x3F, 0x00,
+  0x3F, 0x00,
+  0x33, 0x00,
+  0x33, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0xFF, 0xF0,
+  0xFF, 0xF0,
+  /* 'F' */
+  0xFF, 0xF0,
+  0xFF, 0xF0,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x33, 0x30,
+  0x33, 0x00,
+  0x3F, 0x00,
+  0x3F, 0x00,
+  0x33, 0x00,
+  0x33, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0xFF, 0x00,
+  0xFF, 0x00,
+  /* 'G' */
+  0x0F, 0xB0,
+  0x3F, 0xF0,
+  0x70, 0x70,
+  0x60, 0x30,
+  0xC0, 0x30,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0xC3, 0xF8,
+  0xC3, 0xF8,
+  0xC0, 0x30,
+  0xE0, 0x30,
+  0x70, 0x70,
+  0x3F, 0xF0,
+  0x0F, 0xC0,
+  /* 'H' */
+  0xFC, 0xFC,
+  0xFC, 0xFC,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x3F, 0xF0,
+  0x3F, 0xF0,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0xFC, 0xFC,
+  0xFC, 0xFC,
+  /* 'I' */
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  /* 'J' */
+  0x1F, 0xF8,
+  0x1F, 0xF8,
+  0x00, 0xC0,
+  0x00, 0xC0,
+  0x00, 0xC0,
+  0x00, 0xC0,
+  0x00, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xC1, 0x80,
+  0xFF, 0x80,
+  0x3E, 0x00,
+  /* 'K' */
+  0xFE, 0x7C,
+  0xFE, 0x7C,
+  0x30, 0x60,
+  0x30, 0xC0,
+  0x31, 0x80,
+  0x33, 0x00,
+  0x37, 0x00,
+  0x3F, 0x80,
+  0x39, 0xC0,
+  0x30, 0xE0,
+  0x30, 0x60,
+  0x30, 0x70,
+  0xFE, 0x3E,
+  0xFE, 0x3E,
+  /* 'L' */
+  0xFF, 0x00,
+  0xFF, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x18,
+  0x18, 0x18,
+  0x18, 0x18,
+  0x18, 0x18,
+  0xFF, 0xF8,
+  0xFF, 0xF8,
+  /* 'M' */
+  0xF0, 0x0F,
+  0xF8, 0x1F,
+  0x38, 0x1C,
+  0x3C, 0x3C,
+  0x3C, 0x3C,
+  0x36, 0x6C,
+  0x36, 0x6C,
+  0x33, 0xCC,
+  0x33, 0xCC,
+  0x31, 0x8C,
+  0x30, 0x0C,
+  0x30, 0x0C,
+  0xFE, 0x7F,
+  0xFE, 0x7F,
+  /* 'N' */
+  0xF1, 0xFC,
+  0xF1, 0xFC,
+  0x38, 0x30,
+  0x3C, 0x30,
+  0x3E, 0x30,
+  0x36, 0x30,
+  0x37, 0x30,
+  0x33, 0xB0,
+  0x31, 0xB0,
+  0x31, 0xF0,
+  0x30, 0xF0,
+  0x30, 0x70,
+  0xFE, 0x30,
+  0xFE, 0x30,
+  /* 'O' */
+  0x0F, 0x00,
+  0x3F, 0xC0,
+  0x70, 0xE0,
+  0x60, 0x60,
+  0xE0, 0x70,
+  0xC0, 0x30,
+  0xC0, 0x30,
+  0xC0, 0x30,
+  0xC0, 0x30,
+  0xE0, 0x70,
+  0x60, 0x60,
+  0x70, 0xE0,
+  0x3F, 0xC0,
+  0x0F, 0x00,
+  /* 'P' */
+  0xFF, 0xC0,
+  0xFF, 0xE0,
+  0x30, 0x70,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x60,
+  0x3F, 0xE0,
+  0x3F, 0x80,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0xFF, 0x00,
+  0xFF, 0x00,
+  /* 'Q' */
+  0x0F, 0x00,
+  0x3F, 0xC0,
+  0x70, 0xE0,
+  0x60, 0x60,
+  0xE0, 0x70,
+  0xC0, 0x30,
+  0xC0, 0x30,
+  0xC0, 0x30,
+  0xC0, 0x30,
+  0xE0, 0x70,
+  0x60, 0x60,
+  0x70, 0xE0,
+  0x3F, 0xC0,
+  0x1F, 0x00,
+  0x1F, 0x30,
+  0x3F, 0xF0,
+  0x30, 0xE0,
+  /* 'R' */
+  0xFF, 0xC0,
+  0xFF, 0xE0,
+  0x30, 0x70,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x70,
+  0x3F, 0xE0,
+  0x3F, 0x80,
+  0x31, 0xC0,
+  0x30, 0xE0,
+  0x30, 0x60,
+  0x30, 0x70,
+  0xFE, 0x3C,
+  0xFE, 0x1C,
+  /* 'S' */
+  0x3E, 0xC0,
+  0x7F, 0xC0,
+  0xE1, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xF0, 0x00,
+  0x7E, 0x00,
+  0x1F, 0x80,
+  0x03, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xE1, 0xC0,
+  0xFF, 0x80,
+  0xDF, 0x00,
+  /* 'T' */
+  0xFF, 0xF0,
+  0xFF, 0xF0,
+  0xC6, 0x30,
+  0xC6, 0x30,
+  0xC6, 0x30,
+  0xC6, 0x30,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x3F, 0xC0,
+  0x3F, 0xC0,
+  /* 'U' */
+  0xFC, 0xFC,
+  0xFC, 0xFC,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x18, 0x60,
+  0x1F, 0xE0,
+  0x07, 0x80,
+  /* 'V' */
+  0xFE, 0xFE,
+  0xFE, 0xFE,
+  0x30, 0x18,
+  0x18, 0x30,
+  0x18, 0x30,
+  0x18, 0x30,
+  0x0C, 0x60,
+  0x0C, 0x60,
+  0x06, 0xC0,
+  0x06, 0xC0,
+  0x06, 0xC0,
+  0x03, 0x80,
+  0x03, 0x80,
+  0x01, 0x00,
+  /* 'W' */
+  0xFE, 0x3F, 0x80,
+  0xFE, 0x3F, 0x80,
+  0x30, 0x06, 0x00,
+  0x30, 0x06, 0x00,
+  0x30, 0x86, 0x00,
+  0x19, 0xCC, 0x00,
+  0x19, 0xCC, 0x00,
+  0x1B, 0x6C, 0x00,
+  0x1B, 0x6C, 0x00,
+  0x1E, 0x7C, 0x00,
+  0x0E, 0x38, 0x00,
+  0x0E, 0x38, 0x00,
+  0x0C, 0x18, 0x00,
+  0x0C, 0x18, 0x00,
+  /* 'X' */
+  0xFC, 0xFC,
+  0xFC, 0xFC,
+  0x30, 0x30,
+  0x18, 0x60,
+  0x0C, 0xC0,
+  0x07, 0x80,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x07, 0x80,
+  0x0C, 0xC0,
+  0x18, 0x60,
+  0x30, 0x30,
+  0xFC, 0xFC,
+  0xFC, 0xFC,
+  /* 'Y' */
+  0xF8, 0xFC,
+  0xF8, 0xFC,
+  0x30, 0x30,
+  0x18, 0x60,
+  0x0C, 0xC0,
+  0x0C, 0xC0,
+  0x07, 0x80,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x1F, 0xE0,
+  0x1F, 0xE0,
+  /* 'Z' */
+  0x7F, 0xE0,
+  0x7F, 0xE0,
+  0x60, 0x60,
+  0x60, 0xC0,
+  0x61, 0x80,
+  0x63, 0x00,
+  0x06, 0x00,
+  0x0C, 0x00,
+  0x18, 0x60,
+  0x30, 0x60,
+  0x60, 0x60,
+  0xC0, 0x60,
+  0xFF, 0xE0,
+  0xFF, 0xE0,
+  /* '[' */
+  0xF8,
+  0xF8,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xF8,
+  0xF8,
+  /* '\\' */
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0xE0, 0x00,
+  0x60, 0x00,
+  0x70, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x0C, 0x00,
+  0x0C, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x03, 0x80,
+  0x01, 0x80,
+  0x01, 0xC0,
+  0x00, 0xC0,
+  0x00, 0xC0,
+  /* ']' */
+  0xF8,
+  0xF8,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0x18,
+  0xF8,
+  0xF8,
+  /* '^' */
+  0x04, 0x00,
+  0x0E, 0x00,
+  0x1F, 0x00,
+  0x3B, 0x80,
+  0x31, 0x80,
+  0x60, 0xC0,
+  0xC0, 0x60,
+  0x80, 0x20,
+  /* '_' */
+  0xFF, 0xFF,
+  0xFF, 0xFF,
+  /* '`' */
+  0xC0,
+  0xE0,
+  0x38,
+  0x18,
+  /* 'a' */
+  0x3F, 0x00,
+  0x7F, 0x80,
+  0x00, 0xC0,
+  0x00, 0xC0,
+  0x1F, 0xC0,
+  0x7F, 0xC0,
+  0xE0, 0xC0,
+  0xC0, 0xC0,
+  0xC1, 0xC0,
+  0x7F, 0xF0,
+  0x3E, 0xF0,
+  /* 'b' */
+  0xF0, 0x00,
+  0xF0, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x37, 0xC0,
+  0x3F, 0xF0,
+  0x38, 0x30,
+  0x30, 0x18,
+  0x30, 0x18,
+  0x30, 0x18,
+  0x30, 0x18,
+  0x30, 0x18,
+  0x38, 0x30,
+  0xFF, 0xF0,
+  0xF7, 0xC0,
+  /* 'c' */
+  0x0F, 0xB0,
+  0x3F, 0xF0,
+  0x70, 0x70,
+  0xE0, 0x30,
+  0xC0, 0x30,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0xE0, 0x30,
+  0x70, 0x70,
+  0x3F, 0xE0,
+  0x0F, 0xC0,
+  /* 'd' */
+  0x01, 0xE0,
+  0x01, 0xE0,
+  0x00, 0x60,
+  0x00, 0x60,
+  0x1F, 0x60,
+  0x7F, 0xE0,
+  0x60, 0xE0,
+  0xC0, 0x60,
+  0xC0, 0x60,
+  0xC0, 0x60,
+  0xC0, 0x60,
+  0xC0, 0x60,
+  0x60, 0xE0,
+  0x7F, 0xF8,
+  0x1F, 0x78,
+  /* 'e' */
+  0x1F, 0x80,
+  0x7F, 0xE0,
+  0x60, 0x60,
+  0xC0, 0x30,
+  0xFF, 0xF0,
+  0xFF, 0xF0,
+  0xC0, 0x00,
+  0xC0, 0x00,
+  0x60, 0x30,
+  0x7F, 0xF0,
+  0x1F, 0xC0,
+  /* 'f' */
+  0x07, 0xF0,
+  0x0F, 0xF0,
+  0x18, 0x00,
+  0x18, 0x00,
+  0xFF, 0xE0,
+  0xFF, 0xE0,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  /* 'g' */
+  0x1F, 0x78,
+  0x7F, 0xF8,
+  0x60, 0xE0,
+  0xC0, 0x60,
+  0xC0, 0x60,
+  0xC0, 0x60,
+  0xC0, 0x60,
+  0xC0, 0x60,
+  0x60, 0xE0,
+  0x7F, 0xE0,
+  0x1F, 0x60,
+  0x00, 0x60,
+  0x00, 0x60,
+  0x00, 0xE0,
+  0x3F, 0xC0,
+  0x3F, 0x00,
+  /* 'h' */
+  0xF0, 0x00,
+  0xF0, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x37, 0xC0,
+  0x3F, 0xE0,
+  0x38, 0x70,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0xFC, 0xFC,
+  0xFC, 0xFC,
+  /* 'i' */
+  0x06, 0x00,
+  0x06, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0x7E, 0x00,
+  0x7E, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0xFF, 0xF0,
+  0xFF, 0xF0,
+  /* 'j' */
+  0x06, 0x00,
+  0x06, 0x00,
+  0x00, 0x00,
+  0x00, 0x00,
+  0xFF, 0x80,
+  0xFF, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x01, 0x80,
+  0x03, 0x80,
+  0xFF, 0x00,
+  0xFC, 0x00,
+  /* 'k' */
+  0xF0, 0x00,
+  0xF0, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x33, 0xE0,
+  0x33, 0xE0,
+  0x33, 0x00,
+  0x36, 0x00,
+  0x3E, 0x00,
+  0x3C, 0x00,
+  0x3E, 0x00,
+  0x37, 0x00,
+  0x33, 0x80,
+  0xF1, 0xF0,
+  0xF1, 0xF0,
+  /* 'l' */
+  0x7E, 0x00,
+  0x7E, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0x06, 0x00,
+  0xFF, 0xF0,
+  0xFF, 0xF0,
+  /* 'm' */
+  0xF7, 0x78,
+  0xFF, 0xFC,
+  0x39, 0xCC,
+  0x31, 0x8C,
+  0x31, 0x8C,
+  0x31, 0x8C,
+  0x31, 0x8C,
+  0x31, 0x8C,
+  0x31, 0x8C,
+  0xFD, 0xEF,
+  0xFD, 0xEF,
+  /* 'n' */
+  0xF7, 0xC0,
+  0xFF, 0xE0,
+  0x38, 0x70,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0xFC, 0xFC,
+  0xFC, 0xFC,
+  /* 'o' */
+  0x0F, 0x00,
+  0x3F, 0xC0,
+  0x70, 0xE0,
+  0xE0, 0x70,
+  0xC0, 0x30,
+  0xC0, 0x30,
+  0xC0, 0x30,
+  0xE0, 0x70,
+  0x70, 0xE0,
+  0x3F, 0xC0,
+  0x0F, 0x00,
+  /* 'p' */
+  0xF7, 0xC0,
+  0xFF, 0xF0,
+  0x38, 0x30,
+  0x30, 0x18,
+  0x30, 0x18,
+  0x30, 0x18,
+  0x30, 0x18,
+  0x30, 0x18,
+  0x38, 0x30,
+  0x3F, 0xF0,
+  0x37, 0xC0,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0xFE, 0x00,
+  0xFE, 0x00,
+  /* 'q' */
+  0x1F, 0x78,
+  0x7F, 0xF8,
+  0x60, 0xE0,
+  0xC0, 0x60,
+  0xC0, 0x60,
+  0xC0, 0x60,
+  0xC0, 0x60,
+  0xC0, 0x60,
+  0x60, 0xE0,
+  0x7F, 0xE0,
+  0x1F, 0x60,
+  0x00, 0x60,
+  0x00, 0x60,
+  0x00, 0x60,
+  0x03, 0xF8,
+  0x03, 0xF8,
+  /* 'r' */
+  0xF9, 0xE0,
+  0xFB, 0xF0,
+  0x1F, 0x30,
+  0x1C, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0x18, 0x00,
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  /* 's' */
+  0x3F, 0xC0,
+  0x7F, 0xC0,
+  0xC0, 0xC0,
+  0xC0, 0xC0,
+  0xFC, 0x00,
+  0x7F, 0x80,
+  0x07, 0xC0,
+  0xC0, 0xC0,
+  0xC1, 0xC0,
+  0xFF, 0x80,
+  0xFF, 0x00,
+  /* 't' */
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x00,
+  0x30, 0x70,
+  0x1F, 0xF0,
+  0x0F, 0xC0,
+  /* 'u' */
+  0xF0, 0xF0,
+  0xF0, 0xF0,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x30, 0x70,
+  0x1F, 0xFC,
+  0x0F, 0xBC,
+  /* 'v' */
+  0xF8, 0x7C,
+  0xF8, 0x7C,
+  0x30, 0x30,
+  0x30, 0x30,
+  0x18, 0x60,
+  0x18, 0x60,
+  0x0C, 0xC0,
+  0x0C, 0xC0,
+  0x0F, 0xC0,
+  0x07, 0x80,
+  0x07, 0x80,
+  /* 'w' */
+  0xF0, 0x78,
+  0xF0, 0x78,
+  0x62, 0x30,
+  0x67, 0x30,
+  0x67, 0x30,
+  0x35, 0x60,
+  0x3D, 0xE0,
+  0x3D, 0xE0,
+  0x38, 0xC0,
+  0x18, 0xC0,
+  0x18, 0xC0,
+  /* 'x' */
+  0xF9, 0xF0,
+  0xF9, 0xF0,
+  0x30, 0xC0,
+  0x19, 0x80,
+  0x0F, 0x00,
+  0x06, 0x00,
+  0x0F, 0x00,
+  0x19, 0x80,
+  0x30, 0xC0,
+  0xF9, 0xF0,
+  0xF9, 0xF0,
+  /* 'y' */
+  0xFC, 0x3E,
+  0xFC, 0x3E,
+  0x30, 0x18,
+  0x18, 0x30,
+  0x18, 0x30,
+  0x0C, 0x60,
+  0x0C, 0x60,
+  0x06, 0xC0,
+  0x07, 0xC0,
+  0x03, 0x80,
+  0x01, 0x80,
+  0x03, 0x00,
+  0x03, 0x00,
+  0x06, 0x00,
+  0x7F, 0x80,
+  0x7F, 0x80,
+  /* 'z' */
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  0xC1, 0x80,
+  0xC3, 0x00,
+  0x06, 0x00,
+  0x0C, 0x00,
+  0x18, 0x00,
+  0x30, 0xC0,
+  0x60, 0xC0,
+  0xFF, 0xC0,
+  0xFF, 0xC0,
+  /* '{' */
+  0x1C,
+  0x3C,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x70,
+  0xE0,
+  0x70,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x3C,
+  0x1C,
+  /* '|' */
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  0xC0,
+  /* '}' */
+  0xE0,
+  0xF0,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x38,
+  0x1C,
+  0x38,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0x30,
+  0xF0,
+  0xE0,
+  /* '~' */
+  0x38, 0x00,
+  0x7C, 0x60,
+  0xEE, 0xE0,
+  0xC7, 0xC0,
+  0x03, 0x80,
+};
 
-	// @6768 '~' (17 pixels wide)
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x0E, 0x00, 0x00, //     ###          
-	0x1F, 0x18, 0x00, //    #####   ##    
-	0x3B, 0xB8, 0x00, //   ### ### ###    
-	0x31, 0xF0, 0x00, //   ##   #####     
-	0x00, 0xE0, 0x00, //         ###      
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
-	0x00, 0x00, 0x00, //                  
+static const sGLYPH Font24_Glyphs[] =
+{
+  /* Offset, XOffset, YOffset, Width, Height */
+  {     0,  0,  0,  0,  0 }, /* ' ' */
+  {     0,  6,  2,  3, 15 }, /* '!' */
+  {    15,  4,  3,  8,  7 }, /* '"' */
+  {    22,  2,  2, 11, 16 }, /* '#' */
+  {    54,  3,  1,  9, 19 }, /* '$' */
+  {    92,  3,  2, 10, 15 }, /* '%' */
+  {   122,  3,  4, 11, 13 }, /* '&' */
+  {   148,  6,  3,  3,  7 }, /* ''' */
+  {   155,  7,  2,  6, 18 }, /* '(' */
+  {   173,  3,  2,  6, 18 }, /* ')' */
+  {   191,  3,  2, 10, 10 }, /* '*' */
+  {   211,  2,  4, 12, 12 }, /* '+' */
+  {   235,  6, 14,  5,  7 }, /* ',' */
+  {   242,  3,  9, 10,  2 }, /* '-' */
+  {   246,  6, 14,  4,  3 }, /* '.' */
+  {   249,  3,  0, 10, 20 }, /* '/' */
+  {   289,  3,  2, 10, 15 }, /* '0' */
+  {   319,  3,  2, 10, 15 }, /* '1' */
+  {   349,  2,  2, 11, 15 }, /* '2' */
+  {   379,  3,  2, 10, 15 }, /* '3' */
+  {   409,  2,  2, 11, 15 }, /* '4' */
+  {   439,  2,  2, 11, 15 }, /* '5' */
+  {   469,  3,  2, 10, 15 }, /* '6' */
+  {   499,  3,  2, 10, 15 }, /* '7' */
+  {   529,  3,  2, 10, 15 }, /* '8' */
+  {   559,  3,  2, 10, 15 }, /* '9' */
+  {   589,  6,  6,  4, 11 }, /* ':' */
+  {   600,  6,  6,  6, 13 }, /* ';' */
+  {   613,  0,  4, 14, 13 }, /* '<' */
+  {   639,  1,  7, 13,  6 }, /* '=' */
+  {   651,  1,  4, 14, 13 }, /* '>' */
+  {   677,  3,  3,  9, 14 }, /* '?' */
+  {   705,  3,  2, 10, 17 }, /* '@' */
+  {   739,  0,  3, 16, 14 }, /* 'A' */
+  {   767,  1,  3, 13, 14 }, /* 'B' */
+  {   795,  2,  3, 12, 14 }, /* 'C' */
+  {   823,  1,  3, 13, 14 }, /* 'D' */
+  {   851,  1,  3, 12, 14 }, /* 'E' */
+  {   879,  2,  3, 12, 14 }, /* 'F' */
+  {   907,  2,  3, 13, 14 }, /* 'G' */
+  {   935,  1,  3, 14, 14 }, /* 'H' */
+  {   963,  3,  3, 10, 14 }, /* 'I' */
+  {   991,  2,  3, 13, 14 }, /* 'J' */
+  {  1019,  1,  3, 15, 14 }, /* 'K' */
+  {  1047,  1,  3, 13, 14 }, /* 'L' */
+  {  1075,  0,  3, 16, 14 }, /* 'M' */
+  {  1103,  1,  3, 14, 14 }, /* 'N' */
+  {  1131,  2,  3, 12, 14 }, /* 'O' */
+  {  1159,  2,  3, 12, 14 }, /* 'P' */
+  {  1187,  2,  3, 12, 17 }, /* 'Q' */
+  {  1221,  1,  3, 14, 14 }, /* 'R' */
+  {  1249,  3,  3, 10, 14 }, /* 'S' */
+  {  1277,  2,  3, 12, 14 }, /* 'T' */
+  {  1305,  1,  3, 14, 14 }, /* 'U' */
+  {  1333,  1,  3, 15, 14 }, /* 'V' */
+  {  1361,  0,  3, 17, 14 }, /* 'W' */
+  {  1403,  1,  3, 14, 14 }, /* 'X' */
+  {  1431,  1,  3, 14, 14 }, /* 'Y' */
+  {  1459,  2,  3, 11, 14 }, /* 'Z' */
+  {  1487,  7,  2,  5, 18 }, /* '[' */
+  {  1505,  3,  0, 10, 20 }, /* '\\' */
+  {  1545,  4,  2,  5, 18 }, /* ']' */
+  {  1563,  3,  1, 11,  8 }, /* '^' */
+  {  1579,  0, 22, 16,  2 }, /* '_' */
+  {  1583,  6,  1,  5,  4 }, /* '`' */
+  {  1587,  2,  6, 12, 11 }, /* 'a' */
+  {  1609,  1,  2, 13, 15 }, /* 'b' */
+  {  1639,  2,  6, 12, 11 }, /* 'c' */
+  {  1661,  2,  2, 13, 15 }, /* 'd' */
+  {  1691,  2,  6, 12, 11 }, /* 'e' */
+  {  1713,  2,  2, 12, 15 }, /* 'f' */
+  {  1743,  2,  6, 13, 16 }, /* 'g' */
+  {  1775,  1,  2, 14, 15 }, /* 'h' */
+  {  1805,  2,  2, 12, 15 }, /* 'i' */
+  {  1835,  3,  2,  9, 20 }, /* 'j' */
+  {  1875,  2,  2, 12, 15 }, /* 'k' */
+  {  1905,  2,  2, 12, 15 }, /* 'l' */
+  {  1935,  0,  6, 16, 11 }, /* 'm' */
+  {  1957,  1,  6, 14, 11 }, /* 'n' */
+  {  1979,  2,  6, 12, 11 }, /* 'o' */
+  {  2001,  1,  6, 13, 16 }, /* 'p' */
+  {  2033,  2,  6, 13, 16 }, /* 'q' */
+  {  2065,  2,  6, 12, 11 }, /* 'r' */
+  {  2087,  3,  6, 10, 11 }, /* 's' */
+  {  2109,  2,  2, 12, 15 }, /* 't' */
+  {  2139,  1,  6, 14, 11 }, /* 'u' */
+  {  2161,  1,  6, 14, 11 }, /* 'v' */
+  {  2183,  1,  6, 13, 11 }, /* 'w' */
+  {  2205,  2,  6, 12, 11 }, /* 'x' */
+  {  2227,  1,  6, 15, 16 }, /* 'y' */
+  {  2259,  3,  6, 10, 11 }, /* 'z' */
+  {  2281,  5,  2,  6, 18 }, /* '{' */
+  {  2299,  7,  2,  2, 18 }, /* '|' */
+  {  2317,  5,  2,  6, 18 }, /* '}' */
+  {  2335,  2,  8, 11,  5 }, /* '~' */
 };
 
 sFONT Font24 = {
-  Font24_Table,
+  Font24_Bitmap,
+  Font24_Glyphs,
   17, /* Width */
   24, /* Height */
+  32, /* FirstChar */
+  95, /* GlyphCount */
+  1, /* Bpp */
 };
-
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Function_Prototypes
-  * @{
-  */ 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Functions
-  * @{
-  */
-    
-/**
-  * @}
-  */
-  
-/**
-  * @}
-  */ 
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */  
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -1,10 +1,9 @@
 /**
   ******************************************************************************
-  * @file    Font8.c
-  * @author  MCD Application Team
-  * @version V1.0.0
-  * @date    18-February-2014
-  * @brief   This file provides text Font8 for STM32xx-EVAL's LCD driver. 
+  * @file    font8.c
+  * @brief   Font8 glyphs, 5x8 cells, 1 bpp, 503 bytes of bitmap.
+  *          Generated by tools/fontgen from the STMicroelectronics
+  *          tables, do not edit.
   ******************************************************************************
   * @attention
   *
@@ -35,1050 +34,715 @@
   ******************************************************************************
   */
 
-/* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
 
-/** @addtogroup Utilities
-  * @{
-  */
-  
-/** @addtogroup STM32_EVAL
-  * @{
-  */ 
-
-/** @addtogroup Common
-  * @{
-  */
-
-/** @addtogroup FONTS
-  * @brief      This file provides text Font8 for STM32xx-EVAL's LCD driver. 
-  * @{
-  */  
-
-/** @defgroup FONTS_Private_Types
-  * @{
-  */ 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Defines
-  * @{
-  */
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Macros
-  * @{
-  */
-/**
-  * @}
-  */ 
-  
-
-/** @defgroup FONTS_Private_Variables
-  * @{
-  */
-// 
-//  Font data for Courier New 12pt
-// 
-
-const uint8_t Font8_Table[] = 
+static const uint8_t Font8_Bitmap[] =
 {
-	// @0 ' ' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @8 '!' (5 pixels wide)
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @16 '"' (5 pixels wide)
-	0x50, //  # # 
-	0x50, //  # # 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @24 '#' (5 pixels wide)
-	0x28, //   # #
-	0x50, //  # # 
-	0xF8, // #####
-	0x50, //  # # 
-	0xF8, // #####
-	0x50, //  # # 
-	0xA0, // # #  
-	0x00, //      
-
-	// @32 '$' (5 pixels wide)
-	0x20, //   #  
-	0x30, //   ## 
-	0x60, //  ##  
-	0x30, //   ## 
-	0x10, //    # 
-	0x60, //  ##  
-	0x20, //   #  
-	0x00, //      
-
-	// @40 '%' (5 pixels wide)
-	0x20, //   #  
-	0x20, //   #  
-	0x18, //    ##
-	0x60, //  ##  
-	0x10, //    # 
-	0x10, //    # 
-	0x00, //      
-	0x00, //      
-
-	// @48 '&' (5 pixels wide)
-	0x00, //      
-	0x38, //   ###
-	0x20, //   #  
-	0x60, //  ##  
-	0x50, //  # # 
-	0x78, //  ####
-	0x00, //      
-	0x00, //      
-
-	// @56 ''' (5 pixels wide)
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @64 '(' (5 pixels wide)
-	0x10, //    # 
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x10, //    # 
-	0x00, //      
-
-	// @72 ')' (5 pixels wide)
-	0x40, //  #   
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x40, //  #   
-	0x00, //      
-
-	// @80 '*' (5 pixels wide)
-	0x20, //   #  
-	0x70, //  ### 
-	0x20, //   #  
-	0x50, //  # # 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @88 '+' (5 pixels wide)
-	0x00, //      
-	0x20, //   #  
-	0x20, //   #  
-	0xF8, // #####
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @96 ',' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x10, //    # 
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
-
-	// @104 '-' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @112 '.' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @120 '/' (5 pixels wide)
-	0x10, //    # 
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x40, //  #   
-	0x40, //  #   
-	0x80, // #    
-	0x00, //      
-
-	// @128 '0' (5 pixels wide)
-	0x20, //   #  
-	0x50, //  # # 
-	0x50, //  # # 
-	0x50, //  # # 
-	0x50, //  # # 
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @136 '1' (5 pixels wide)
-	0x60, //  ##  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-
-	// @144 '2' (5 pixels wide)
-	0x20, //   #  
-	0x50, //  # # 
-	0x20, //   #  
-	0x20, //   #  
-	0x40, //  #   
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @152 '3' (5 pixels wide)
-	0x20, //   #  
-	0x50, //  # # 
-	0x10, //    # 
-	0x20, //   #  
-	0x10, //    # 
-	0x60, //  ##  
-	0x00, //      
-	0x00, //      
-
-	// @160 '4' (5 pixels wide)
-	0x10, //    # 
-	0x30, //   ## 
-	0x50, //  # # 
-	0x78, //  ####
-	0x10, //    # 
-	0x38, //   ###
-	0x00, //      
-	0x00, //      
-
-	// @168 '5' (5 pixels wide)
-	0x70, //  ### 
-	0x40, //  #   
-	0x60, //  ##  
-	0x10, //    # 
-	0x50, //  # # 
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @176 '6' (5 pixels wide)
-	0x30, //   ## 
-	0x40, //  #   
-	0x60, //  ##  
-	0x50, //  # # 
-	0x50, //  # # 
-	0x60, //  ##  
-	0x00, //      
-	0x00, //      
-
-	// @184 '7' (5 pixels wide)
-	0x70, //  ### 
-	0x50, //  # # 
-	0x10, //    # 
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @192 '8' (5 pixels wide)
-	0x20, //   #  
-	0x50, //  # # 
-	0x20, //   #  
-	0x50, //  # # 
-	0x50, //  # # 
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @200 '9' (5 pixels wide)
-	0x30, //   ## 
-	0x50, //  # # 
-	0x50, //  # # 
-	0x30, //   ## 
-	0x10, //    # 
-	0x60, //  ##  
-	0x00, //      
-	0x00, //      
-
-	// @208 ':' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @216 ';' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x10, //    # 
-	0x00, //      
-	0x10, //    # 
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @224 '<' (5 pixels wide)
-	0x00, //      
-	0x10, //    # 
-	0x20, //   #  
-	0xC0, // ##   
-	0x20, //   #  
-	0x10, //    # 
-	0x00, //      
-	0x00, //      
-
-	// @232 '=' (5 pixels wide)
-	0x00, //      
-	0x70, //  ### 
-	0x00, //      
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @240 '>' (5 pixels wide)
-	0x00, //      
-	0x40, //  #   
-	0x20, //   #  
-	0x18, //    ##
-	0x20, //   #  
-	0x40, //  #   
-	0x00, //      
-	0x00, //      
-
-	// @248 '?' (5 pixels wide)
-	0x20, //   #  
-	0x50, //  # # 
-	0x10, //    # 
-	0x20, //   #  
-	0x00, //      
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @256 '@' (5 pixels wide)
-	0x30, //   ## 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x58, //  # ##
-	0x48, //  #  #
-	0x40, //  #   
-	0x38, //   ###
-	0x00, //      
-
-	// @264 'A' (5 pixels wide)
-	0x60, //  ##  
-	0x20, //   #  
-	0x50, //  # # 
-	0x70, //  ### 
-	0x88, // #   #
-	0xD8, // ## ##
-	0x00, //      
-	0x00, //      
-
-	// @272 'B' (5 pixels wide)
-	0xF0, // #### 
-	0x48, //  #  #
-	0x70, //  ### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0xF0, // #### 
-	0x00, //      
-	0x00, //      
-
-	// @280 'C' (5 pixels wide)
-	0x70, //  ### 
-	0x50, //  # # 
-	0x40, //  #   
-	0x40, //  #   
-	0x40, //  #   
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @288 'D' (5 pixels wide)
-	0xF0, // #### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0xF0, // #### 
-	0x00, //      
-	0x00, //      
-
-	// @296 'E' (5 pixels wide)
-	0xF8, // #####
-	0x48, //  #  #
-	0x60, //  ##  
-	0x40, //  #   
-	0x48, //  #  #
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-
-	// @304 'F' (5 pixels wide)
-	0xF8, // #####
-	0x48, //  #  #
-	0x60, //  ##  
-	0x40, //  #   
-	0x40, //  #   
-	0xE0, // ###  
-	0x00, //      
-	0x00, //      
-
-	// @312 'G' (5 pixels wide)
-	0x70, //  ### 
-	0x40, //  #   
-	0x40, //  #   
-	0x58, //  # ##
-	0x50, //  # # 
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @320 'H' (5 pixels wide)
-	0xE8, // ### #
-	0x48, //  #  #
-	0x78, //  ####
-	0x48, //  #  #
-	0x48, //  #  #
-	0xE8, // ### #
-	0x00, //      
-	0x00, //      
-
-	// @328 'I' (5 pixels wide)
-	0x70, //  ### 
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @336 'J' (5 pixels wide)
-	0x38, //   ###
-	0x10, //    # 
-	0x10, //    # 
-	0x50, //  # # 
-	0x50, //  # # 
-	0x20, //   #  
-	0x00, //      
-	0x00, //      
-
-	// @344 'K' (5 pixels wide)
-	0xD8, // ## ##
-	0x50, //  # # 
-	0x60, //  ##  
-	0x70, //  ### 
-	0x50, //  # # 
-	0xD8, // ## ##
-	0x00, //      
-	0x00, //      
-
-	// @352 'L' (5 pixels wide)
-	0xE0, // ###  
-	0x40, //  #   
-	0x40, //  #   
-	0x40, //  #   
-	0x48, //  #  #
-	0xF8, // #####
-	0x00, //      
-	0x00, //      
-
-	// @360 'M' (5 pixels wide)
-	0xD8, // ## ##
-	0xD8, // ## ##
-	0xD8, // ## ##
-	0xA8, // # # #
-	0x88, // #   #
-	0xD8, // ## ##
-	0x00, //      
-	0x00, //      
-
-	// @368 'N' (5 pixels wide)
-	0xD8, // ## ##
-	0x68, //  ## #
-	0x68, //  ## #
-	0x58, //  # ##
-	0x58, //  # ##
-	0xE8, // ### #
-	0x00, //      
-	0x00, //      
-
-	// @376 'O' (5 pixels wide)
-	0x30, //   ## 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @384 'P' (5 pixels wide)
-	0xF0, // #### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x70, //  ### 
-	0x40, //  #   
-	0xE0, // ###  
-	0x00, //      
-	0x00, //      
-
-	// @392 'Q' (5 pixels wide)
-	0x30, //   ## 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0x30, //   ## 
-	0x18, //    ##
-	0x00, //      
-
-	// @400 'R' (5 pixels wide)
-	0xF0, // #### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x70, //  ### 
-	0x48, //  #  #
-	0xE8, // ### #
-	0x00, //      
-	0x00, //      
-
-	// @408 'S' (5 pixels wide)
-	0x70, //  ### 
-	0x50, //  # # 
-	0x20, //   #  
-	0x10, //    # 
-	0x50, //  # # 
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @416 'T' (5 pixels wide)
-	0xF8, // #####
-	0xA8, // # # #
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @424 'U' (5 pixels wide)
-	0xD8, // ## ##
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0x48, //  #  #
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @432 'V' (5 pixels wide)
-	0xD8, // ## ##
-	0x88, // #   #
-	0x48, //  #  #
-	0x50, //  # # 
-	0x50, //  # # 
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @440 'W' (5 pixels wide)
-	0xD8, // ## ##
-	0x88, // #   #
-	0xA8, // # # #
-	0xA8, // # # #
-	0xA8, // # # #
-	0x50, //  # # 
-	0x00, //      
-	0x00, //      
-
-	// @448 'X' (5 pixels wide)
-	0xD8, // ## ##
-	0x50, //  # # 
-	0x20, //   #  
-	0x20, //   #  
-	0x50, //  # # 
-	0xD8, // ## ##
-	0x00, //      
-	0x00, //      
-
-	// @456 'Y' (5 pixels wide)
-	0xD8, // ## ##
-	0x88, // #   #
-	0x50, //  # # 
-	0x20, //   #  
-	0x20, //   #  
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @464 'Z' (5 pixels wide)
-	0x78, //  ####
-	0x48, //  #  #
-	0x10, //    # 
-	0x20, //   #  
-	0x48, //  #  #
-	0x78, //  ####
-	0x00, //      
-	0x00, //      
-
-	// @472 '[' (5 pixels wide)
-	0x30, //   ## 
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x30, //   ## 
-	0x00, //      
-
-	// @480 '\' (5 pixels wide)
-	0x80, // #    
-	0x40, //  #   
-	0x40, //  #   
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x10, //    # 
-	0x00, //      
-
-	// @488 ']' (5 pixels wide)
-	0x60, //  ##  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x60, //  ##  
-	0x00, //      
-
-	// @496 '^' (5 pixels wide)
-	0x20, //   #  
-	0x20, //   #  
-	0x50, //  # # 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @504 '_' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0xF8, // #####
-
-	// @512 '`' (5 pixels wide)
-	0x20, //   #  
-	0x10, //    # 
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x00, //      
-
-	// @520 'a' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x30, //   ## 
-	0x10, //    # 
-	0x70, //  ### 
-	0x78, //  ####
-	0x00, //      
-	0x00, //      
-
-	// @528 'b' (5 pixels wide)
-	0xC0, // ##   
-	0x40, //  #   
-	0x70, //  ### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0xF0, // #### 
-	0x00, //      
-	0x00, //      
-
-	// @536 'c' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x70, //  ### 
-	0x40, //  #   
-	0x40, //  #   
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @544 'd' (5 pixels wide)
-	0x18, //    ##
-	0x08, //     #
-	0x38, //   ###
-	0x48, //  #  #
-	0x48, //  #  #
-	0x38, //   ###
-	0x00, //      
-	0x00, //      
-
-	// @552 'e' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x70, //  ### 
-	0x70, //  ### 
-	0x40, //  #   
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @560 'f' (5 pixels wide)
-	0x10, //    # 
-	0x20, //   #  
-	0x70, //  ### 
-	0x20, //   #  
-	0x20, //   #  
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @568 'g' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x38, //   ###
-	0x48, //  #  #
-	0x48, //  #  #
-	0x38, //   ###
-	0x08, //     #
-	0x30, //   ## 
-
-	// @576 'h' (5 pixels wide)
-	0xC0, // ##   
-	0x40, //  #   
-	0x70, //  ### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0xE8, // ### #
-	0x00, //      
-	0x00, //      
-
-	// @584 'i' (5 pixels wide)
-	0x20, //   #  
-	0x00, //      
-	0x60, //  ##  
-	0x20, //   #  
-	0x20, //   #  
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @592 'j' (5 pixels wide)
-	0x20, //   #  
-	0x00, //      
-	0x70, //  ### 
-	0x10, //    # 
-	0x10, //    # 
-	0x10, //    # 
-	0x10, //    # 
-	0x70, //  ### 
-
-	// @600 'k' (5 pixels wide)
-	0xC0, // ##   
-	0x40, //  #   
-	0x58, //  # ##
-	0x70, //  ### 
-	0x50, //  # # 
-	0xD8, // ## ##
-	0x00, //      
-	0x00, //      
-
-	// @608 'l' (5 pixels wide)
-	0x60, //  ##  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @616 'm' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xD0, // ## # 
-	0xA8, // # # #
-	0xA8, // # # #
-	0xA8, // # # #
-	0x00, //      
-	0x00, //      
-
-	// @624 'n' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xF0, // #### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0xC8, // ##  #
-	0x00, //      
-	0x00, //      
-
-	// @632 'o' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x30, //   ## 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @640 'p' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xF0, // #### 
-	0x48, //  #  #
-	0x48, //  #  #
-	0x70, //  ### 
-	0x40, //  #   
-	0xE0, // ###  
-
-	// @648 'q' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x38, //   ###
-	0x48, //  #  #
-	0x48, //  #  #
-	0x38, //   ###
-	0x08, //     #
-	0x18, //    ##
-
-	// @656 'r' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x78, //  ####
-	0x20, //   #  
-	0x20, //   #  
-	0x70, //  ### 
-	0x00, //      
-	0x00, //      
-
-	// @664 's' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x30, //   ## 
-	0x20, //   #  
-	0x10, //    # 
-	0x60, //  ##  
-	0x00, //      
-	0x00, //      
-
-	// @672 't' (5 pixels wide)
-	0x00, //      
-	0x40, //  #   
-	0xF0, // #### 
-	0x40, //  #   
-	0x48, //  #  #
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @680 'u' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xD8, // ## ##
-	0x48, //  #  #
-	0x48, //  #  #
-	0x38, //   ###
-	0x00, //      
-	0x00, //      
-
-	// @688 'v' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xC8, // ##  #
-	0x48, //  #  #
-	0x30, //   ## 
-	0x30, //   ## 
-	0x00, //      
-	0x00, //      
-
-	// @696 'w' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xD8, // ## ##
-	0xA8, // # # #
-	0xA8, // # # #
-	0x50, //  # # 
-	0x00, //      
-	0x00, //      
-
-	// @704 'x' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x48, //  #  #
-	0x30, //   ## 
-	0x30, //   ## 
-	0x48, //  #  #
-	0x00, //      
-	0x00, //      
-
-	// @712 'y' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0xD8, // ## ##
-	0x50, //  # # 
-	0x50, //  # # 
-	0x20, //   #  
-	0x20, //   #  
-	0x60, //  ##  
-
-	// @720 'z' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x78, //  ####
-	0x50, //  # # 
-	0x28, //   # #
-	0x78, //  ####
-	0x00, //      
-	0x00, //      
-
-	// @728 '{' (5 pixels wide)
-	0x10, //    # 
-	0x20, //   #  
-	0x20, //   #  
-	0x60, //  ##  
-	0x20, //   #  
-	0x20, //   #  
-	0x10, //    # 
-	0x00, //      
-
-	// @736 '|' (5 pixels wide)
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x20, //   #  
-	0x00, //      
-
-	// @744 '}' (5 pixels wide)
-	0x40, //  #   
-	0x20, //   #  
-	0x20, //   #  
-	0x30, //   ## 
-	0x20, //   #  
-	0x20, //   #  
-	0x40, //  #   
-	0x00, //      
+  /* '!' */
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x00,
+  0x80,
+  /* '"' */
+  0xA0,
+  0xA0,
+  /* '#' */
+  0x28,
+  0x50,
+  0xF8,
+  0x50,
+  0xF8,
+  0x50,
+  0xA0,
+  /* '$' */
+  0x40,
+  0x60,
+  0xC0,
+  0x60,
+  0x20,
+  0xC0,
+  0x40,
+  /* '%' */
+  0x40,
+  0x40,
+  0x30,
+  0xC0,
+  0x20,
+  0x20,
+  /* '&' */
+  0x70,
+  0x40,
+  0xC0,
+  0xA0,
+  0xF0,
+  /* ''' */
+  0x80,
+  0x80,
+  0x80,
+  /* '(' */
+  0x40,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x40,
+  /* ')' */
+  0x80,
+  0x40,
+  0x40,
+  0x40,
+  0x40,
+  0x40,
+  0x80,
+  /* '*' */
+  0x40,
+  0xE0,
+  0x40,
+  0xA0,
+  /* '+' */
+  0x20,
+  0x20,
+  0xF8,
+  0x20,
+  0x20,
+  /* ',' */
+  0x40,
+  0x80,
+  0x80,
+  /* '-' */
+  0xE0,
+  /* '.' */
+  0x80,
+  /* '/' */
+  0x10,
+  0x20,
+  0x20,
+  0x20,
+  0x40,
+  0x40,
+  0x80,
+  /* '0' */
+  0x40,
+  0xA0,
+  0xA0,
+  0xA0,
+  0xA0,
+  0x40,
+  /* '1' */
+  0x60,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0xF8,
+  /* '2' */
+  0x40,
+  0xA0,
+  0x40,
+  0x40,
+  0x80,
+  0xE0,
+  /* '3' */
+  0x40,
+  0xA0,
+  0x20,
+  0x40,
+  0x20,
+  0xC0,
+  /* '4' */
+  0x20,
+  0x60,
+  0xA0,
+  0xF0,
+  0x20,
+  0x70,
+  /* '5' */
+  0xE0,
+  0x80,
+  0xC0,
+  0x20,
+  0xA0,
+  0x40,
+  /* '6' */
+  0x60,
+  0x80,
+  0xC0,
+  0xA0,
+  0xA0,
+  0xC0,
+  /* '7' */
+  0xE0,
+  0xA0,
+  0x20,
+  0x40,
+  0x40,
+  0x40,
+  /* '8' */
+  0x40,
+  0xA0,
+  0x40,
+  0xA0,
+  0xA0,
+  0x40,
+  /* '9' */
+  0x60,
+  0xA0,
+  0xA0,
+  0x60,
+  0x20,
+  0xC0,
+  /* ':' */
+  0x80,
+  0x00,
+  0x00,
+  0x80,
+  /* ';' */
+  0x40,
+  0x00,
+  0x40,
+  0x80,
+  /* '<' */
+  0x10,
+  0x20,
+  0xC0,
+  0x20,
+  0x10,
+  /* '=' */
+  0xE0,
+  0x00,
+  0xE0,
+  /* '>' */
+  0x80,
+  0x40,
+  0x30,
+  0x40,
+  0x80,
+  /* '?' */
+  0x40,
+  0xA0,
+  0x20,
+  0x40,
+  0x00,
+  0x40,
+  /* '@' */
+  0x60,
+  0x90,
+  0x90,
+  0xB0,
+  0x90,
+  0x80,
+  0x70,
+  /* 'A' */
+  0x60,
+  0x20,
+  0x50,
+  0x70,
+  0x88,
+  0xD8,
+  /* 'B' */
+  0xF0,
+  0x48,
+  0x70,
+  0x48,
+  0x48,
+  0xF0,
+  /* 'C' */
+  0xE0,
+  0xA0,
+  0x80,
+  0x80,
+  0x80,
+  0x60,
+  /* 'D' */
+  0xF0,
+  0x48,
+  0x48,
+  0x48,
+  0x48,
+  0xF0,
+  /* 'E' */
+  0xF8,
+  0x48,
+  0x60,
+  0x40,
+  0x48,
+  0xF8,
+  /* 'F' */
+  0xF8,
+  0x48,
+  0x60,
+  0x40,
+  0x40,
+  0xE0,
+  /* 'G' */
+  0xE0,
+  0x80,
+  0x80,
+  0xB0,
+  0xA0,
+  0x60,
+  /* 'H' */
+  0xE8,
+  0x48,
+  0x78,
+  0x48,
+  0x48,
+  0xE8,
+  /* 'I' */
+  0xE0,
+  0x40,
+  0x40,
+  0x40,
+  0x40,
+  0xE0,
+  /* 'J' */
+  0x70,
+  0x20,
+  0x20,
+  0xA0,
+  0xA0,
+  0x40,
+  /* 'K' */
+  0xD8,
+  0x50,
+  0x60,
+  0x70,
+  0x50,
+  0xD8,
+  /* 'L' */
+  0xE0,
+  0x40,
+  0x40,
+  0x40,
+  0x48,
+  0xF8,
+  /* 'M' */
+  0xD8,
+  0xD8,
+  0xD8,
+  0xA8,
+  0x88,
+  0xD8,
+  /* 'N' */
+  0xD8,
+  0x68,
+  0x68,
+  0x58,
+  0x58,
+  0xE8,
+  /* 'O' */
+  0x60,
+  0x90,
+  0x90,
+  0x90,
+  0x90,
+  0x60,
+  /* 'P' */
+  0xF0,
+  0x48,
+  0x48,
+  0x70,
+  0x40,
+  0xE0,
+  /* 'Q' */
+  0x60,
+  0x90,
+  0x90,
+  0x90,
+  0x90,
+  0x60,
+  0x30,
+  /* 'R' */
+  0xF0,
+  0x48,
+  0x48,
+  0x70,
+  0x48,
+  0xE8,
+  /* 'S' */
+  0xE0,
+  0xA0,
+  0x40,
+  0x20,
+  0xA0,
+  0xE0,
+  /* 'T' */
+  0xF8,
+  0xA8,
+  0x20,
+  0x20,
+  0x20,
+  0x70,
+  /* 'U' */
+  0xD8,
+  0x48,
+  0x48,
+  0x48,
+  0x48,
+  0x30,
+  /* 'V' */
+  0xD8,
+  0x88,
+  0x48,
+  0x50,
+  0x50,
+  0x30,
+  /* 'W' */
+  0xD8,
+  0x88,
+  0xA8,
+  0xA8,
+  0xA8,
+  0x50,
+  /* 'X' */
+  0xD8,
+  0x50,
+  0x20,
+  0x20,
+  0x50,
+  0xD8,
+  /* 'Y' */
+  0xD8,
+  0x88,
+  0x50,
+  0x20,
+  0x20,
+  0x70,
+  /* 'Z' */
+  0xF0,
+  0x90,
+  0x20,
+  0x40,
+  0x90,
+  0xF0,
+  /* '[' */
+  0xC0,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0xC0,
+  /* '\\' */
+  0x80,
+  0x40,
+  0x40,
+  0x20,
+  0x20,
+  0x20,
+  0x10,
+  /* ']' */
+  0xC0,
+  0x40,
+  0x40,
+  0x40,
+  0x40,
+  0x40,
+  0xC0,
+  /* '^' */
+  0x40,
+  0x40,
+  0xA0,
+  /* '_' */
+  0xF8,
+  /* '`' */
+  0x80,
+  0x40,
+  /* 'a' */
+  0x60,
+  0x20,
+  0xE0,
+  0xF0,
+  /* 'b' */
+  0xC0,
+  0x40,
+  0x70,
+  0x48,
+  0x48,
+  0xF0,
+  /* 'c' */
+  0xE0,
+  0x80,
+  0x80,
+  0xE0,
+  /* 'd' */
+  0x30,
+  0x10,
+  0x70,
+  0x90,
+  0x90,
+  0x70,
+  /* 'e' */
+  0xE0,
+  0xE0,
+  0x80,
+  0x60,
+  /* 'f' */
+  0x20,
+  0x40,
+  0xE0,
+  0x40,
+  0x40,
+  0xE0,
+  /* 'g' */
+  0x70,
+  0x90,
+  0x90,
+  0x70,
+  0x10,
+  0x60,
+  /* 'h' */
+  0xC0,
+  0x40,
+  0x70,
+  0x48,
+  0x48,
+  0xE8,
+  /* 'i' */
+  0x40,
+  0x00,
+  0xC0,
+  0x40,
+  0x40,
+  0xE0,
+  /* 'j' */
+  0x40,
+  0x00,
+  0xE0,
+  0x20,
+  0x20,
+  0x20,
+  0x20,
+  0xE0,
+  /* 'k' */
+  0xC0,
+  0x40,
+  0x58,
+  0x70,
+  0x50,
+  0xD8,
+  /* 'l' */
+  0xC0,
+  0x40,
+  0x40,
+  0x40,
+  0x40,
+  0xE0,
+  /* 'm' */
+  0xD0,
+  0xA8,
+  0xA8,
+  0xA8,
+  /* 'n' */
+  0xF0,
+  0x48,
+  0x48,
+  0xC8,
+  /* 'o' */
+  0x60,
+  0x90,
+  0x90,
+  0x60,
+  /* 'p' */
+  0xF0,
+  0x48,
+  0x48,
+  0x70,
+  0x40,
+  0xE0,
+  /* 'q' */
+  0x70,
+  0x90,
+  0x90,
+  0x70,
+  0x10,
+  0x30,
+  /* 'r' */
+  0xF0,
+  0x40,
+  0x40,
+  0xE0,
+  /* 's' */
+  0x60,
+  0x40,
+  0x20,
+  0xC0,
+  /* 't' */
+  0x40,
+  0xF0,
+  0x40,
+  0x48,
+  0x30,
+  /* 'u' */
+  0xD8,
+  0x48,
+  0x48,
+  0x38,
+  /* 'v' */
+  0xC8,
+  0x48,
+  0x30,
+  0x30,
+  /* 'w' */
+  0xD8,
+  0xA8,
+  0xA8,
+  0x50,
+  /* 'x' */
+  0x90,
+  0x60,
+  0x60,
+  0x90,
+  /* 'y' */
+  0xD8,
+  0x50,
+  0x50,
+  0x20,
+  0x20,
+  0x60,
+  /* 'z' */
+  0xF0,
+  0xA0,
+  0x50,
+  0xF0,
+  /* '{' */
+  0x20,
+  0x40,
+  0x40,
+  0xC0,
+  0x40,
+  0x40,
+  0x20,
+  /* '|' */
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  0x80,
+  /* '}' */
+  0x80,
+  0x40,
+  0x40,
+  0x60,
+  0x40,
+  0x40,
+  0x80,
+  /* '~' */
+  0x50,
+  0xA0,
+};
 
-	// @752 '~' (5 pixels wide)
-	0x00, //      
-	0x00, //      
-	0x00, //      
-	0x28, //   # #
-	0x50, //  # # 
-	0x00, //      
-	0x00, //      
-	0x00, //      
+static const sGLYPH Font8_Glyphs[] =
+{
+  /* Offset, XOffset, YOffset, Width, Height */
+  {     0,  0,  0,  0,  0 }, /* ' ' */
+  {     0,  2,  0,  1,  6 }, /* '!' */
+  {     6,  1,  0,  3,  2 }, /* '"' */
+  {     8,  0,  0,  5,  7 }, /* '#' */
+  {    15,  1,  0,  3,  7 }, /* '$' */
+  {    22,  1,  0,  4,  6 }, /* '%' */
+  {    28,  1,  1,  4,  5 }, /* '&' */
+  {    33,  2,  0,  1,  3 }, /* ''' */
+  {    36,  2,  0,  2,  7 }, /* '(' */
+  {    43,  1,  0,  2,  7 }, /* ')' */
+  {    50,  1,  0,  3,  4 }, /* '*' */
+  {    54,  0,  1,  5,  5 }, /* '+' */
+  {    59,  2,  4,  2,  3 }, /* ',' */
+  {    62,  1,  3,  3,  1 }, /* '-' */
+  {    63,  2,  5,  1,  1 }, /* '.' */
+  {    64,  0,  0,  4,  7 }, /* '/' */
+  {    71,  1,  0,  3,  6 }, /* '0' */
+  {    77,  0,  0,  5,  6 }, /* '1' */
+  {    83,  1,  0,  3,  6 }, /* '2' */
+  {    89,  1,  0,  3,  6 }, /* '3' */
+  {    95,  1,  0,  4,  6 }, /* '4' */
+  {   101,  1,  0,  3,  6 }, /* '5' */
+  {   107,  1,  0,  3,  6 }, /* '6' */
+  {   113,  1,  0,  3,  6 }, /* '7' */
+  {   119,  1,  0,  3,  6 }, /* '8' */
+  {   125,  1,  0,  3,  6 }, /* '9' */
+  {   131,  2,  2,  1,  4 }, /* ':' */
+  {   135,  2,  2,  2,  4 }, /* ';' */
+  {   139,  0,  1,  4,  5 }, /* '<' */
+  {   144,  1,  1,  3,  3 }, /* '=' */
+  {   147,  1,  1,  4,  5 }, /* '>' */
+  {   152,  1,  0,  3,  6 }, /* '?' */
+  {   158,  1,  0,  4,  7 }, /* '@' */
+  {   165,  0,  0,  5,  6 }, /* 'A' */
+  {   171,  0,  0,  5,  6 }, /* 'B' */
+  {   177,  1,  0,  3,  6 }, /* 'C' */
+  {   183,  0,  0,  5,  6 }, /* 'D' */
+  {   189,  0,  0,  5,  6 }, /* 'E' */
+  {   195,  0,  0,  5,  6 }, /* 'F' */
+  {   201,  1,  0,  4,  6 }, /* 'G' */
+  {   207,  0,  0,  5,  6 }, /* 'H' */
+  {   213,  1,  0,  3,  6 }, /* 'I' */
+  {   219,  1,  0,  4,  6 }, /* 'J' */
+  {   225,  0,  0,  5,  6 }, /* 'K' */
+  {   231,  0,  0,  5,  6 }, /* 'L' */
+  {   237,  0,  0,  5,  6 }, /* 'M' */
+  {   243,  0,  0,  5,  6 }, /* 'N' */
+  {   249,  1,  0,  4,  6 }, /* 'O' */
+  {   255,  0,  0,  5,  6 }, /* 'P' */
+  {   261,  1,  0,  4,  7 }, /* 'Q' */
+  {   268,  0,  0,  5,  6 }, /* 'R' */
+  {   274,  1,  0,  3,  6 }, /* 'S' */
+  {   280,  0,  0,  5,  6 }, /* 'T' */
+  {   286,  0,  0,  5,  6 }, /* 'U' */
+  {   292,  0,  0,  5,  6 }, /* 'V' */
+  {   298,  0,  0,  5,  6 }, /* 'W' */
+  {   304,  0,  0,  5,  6 }, /* 'X' */
+  {   310,  0,  0,  5,  6 }, /* 'Y' */
+  {   316,  1,  0,  4,  6 }, /* 'Z' */
+  {   322,  2,  0,  2,  7 }, /* '[' */
+  {   329,  0,  0,  4,  7 }, /* '\\' */
+  {   336,  1,  0,  2,  7 }, /* ']' */
+  {   343,  1,  0,  3,  3 }, /* '^' */
+  {   346,  0,  7,  5,  1 }, /* '_' */
+  {   347,  2,  0,  2,  2 }, /* '`' */
+  {   349,  1,  2,  4,  4 }, /* 'a' */
+  {   353,  0,  0,  5,  6 }, /* 'b' */
+  {   359,  1,  2,  3,  4 }, /* 'c' */
+  {   363,  1,  0,  4,  6 }, /* 'd' */
+  {   369,  1,  2,  3,  4 }, /* 'e' */
+  {   373,  1,  0,  3,  6 }, /* 'f' */
+  {   379,  1,  2,  4,  6 }, /* 'g' */
+  {   385,  0,  0,  5,  6 }, /* 'h' */
+  {   391,  1,  0,  3,  6 }, /* 'i' */
+  {   397,  1,  0,  3,  8 }, /* 'j' */
+  {   405,  0,  0,  5,  6 }, /* 'k' */
+  {   411,  1,  0,  3,  6 }, /* 'l' */
+  {   417,  0,  2,  5,  4 }, /* 'm' */
+  {   421,  0,  2,  5,  4 }, /* 'n' */
+  {   425,  1,  2,  4,  4 }, /* 'o' */
+  {   429,  0,  2,  5,  6 }, /* 'p' */
+  {   435,  1,  2,  4,  6 }, /* 'q' */
+  {   441,  1,  2,  4,  4 }, /* 'r' */
+  {   445,  1,  2,  3,  4 }, /* 's' */
+  {   449,  0,  1,  5,  5 }, /* 't' */
+  {   454,  0,  2,  5,  4 }, /* 'u' */
+  {   458,  0,  2,  5,  4 }, /* 'v' */
+  {   462,  0,  2,  5,  4 }, /* 'w' */
+  {   466,  1,  2,  4,  4 }, /* 'x' */
+  {   470,  0,  2,  5,  6 }, /* 'y' */
+  {   476,  1,  2,  4,  4 }, /* 'z' */
+  {   480,  1,  0,  3,  7 }, /* '{' */
+  {   487,  2,  0,  1,  7 }, /* '|' */
+  {   494,  1,  0,  3,  7 }, /* '}' */
+  {   501,  1,  3,  4,  2 }, /* '~' */
 };
 
 sFONT Font8 = {
-  Font8_Table,
+  Font8_Bitmap,
+  Font8_Glyphs,
   5, /* Width */
   8, /* Height */
+  32, /* FirstChar */
+  95, /* GlyphCount */
+  1, /* Bpp */
 };
-
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Function_Prototypes
-  * @{
-  */ 
-/**
-  * @}
-  */ 
-
-
-/** @defgroup FONTS_Private_Functions
-  * @{
-  */
-    
-/**
-  * @}
-  */
-  
-/**
-  * @}
-  */ 
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */
-
-/**
-  * @}
-  */  
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
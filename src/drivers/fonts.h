@@ -65,12 +65,30 @@
 /** @defgroup FONTS_Exported_Types
   * @{
   */ 
+/**
+  * @brief  Glyph box in the character cell, see tools/fontgen
+  */
+typedef struct
+{
+  uint16_t Offset;         /*!< First byte of the box in the font bitmap          */
+  uint8_t  XOffset;        /*!< Box position in the cell                          */
+  uint8_t  YOffset;
+  uint8_t  Width;          /*!< Box size, 0 for a blank glyph. Even at 4 bpp, the
+                                box may then end one pixel after the cell         */
+  uint8_t  Height;
+} sGLYPH;
+
 typedef struct _tFont
 {    
-  const uint8_t *table;
-  uint16_t Width;
+  const uint8_t *Bitmap;   /*!< Glyph boxes, each row starts on a byte. 1 bpp rows
+                                hold the first pixel in the MSB, 4 bpp rows in the
+                                low nibble as the DMA2D A4 format                 */
+  const sGLYPH  *Glyphs;   /*!< One glyph per character from FirstChar            */
+  uint16_t Width;          /*!< Cell size                                         */
   uint16_t Height;
-  
+  uint8_t  FirstChar;
+  uint8_t  GlyphCount;
+  uint8_t  Bpp;            /*!< 1, or 4 for an alpha font drawn by the DMA2D      */
 } sFONT;
 
 extern sFONT Font24;
@@ -87,6 +105,10 @@ extern sFONT Font8;
   */ 
 #define LINE(x) ((x) * (((sFONT *)BSP_LCD_GetFont())->Height))
 
+/* Glyph of a character, characters out of the font get the first glyph */
+#define FONT_GLYPH(pFont, Ascii)  (&(pFont)->Glyphs[((uint8_t)((Ascii) - (pFont)->FirstChar) < (pFont)->GlyphCount) ? \
+                                                    (uint8_t)((Ascii) - (pFont)->FirstChar) : 0])
+
 /**
   * @}
   */ 
@@ -36,6 +36,8 @@
   
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f429i_discovery.h"
+#include "stm32f429i_discovery_spi.h"
+#include "stm32f429i_discovery_i2c.h"
 #include "cmsis_nvic.h" // // Added for mbed
 
 // Added for mbed. This function replaces HAL_Delay()
@@ -103,11 +105,21 @@ GPIO_TypeDef* BUTTON_PORT[BUTTONn] = {KEY_BUTTON_GPIO_PORT};
 const uint16_t BUTTON_PIN[BUTTONn] = {KEY_BUTTON_PIN}; 
 const uint8_t BUTTON_IRQn[BUTTONn] = {KEY_BUTTON_EXTI_IRQn};
 
-uint32_t I2cxTimeout = I2Cx_TIMEOUT_MAX; /*<! Value of Timeout when I2C communication fails */  
-uint32_t SpixTimeout = SPIx_TIMEOUT_MAX; /*<! Value of Timeout when SPI communication fails */  
-
 I2C_HandleTypeDef EEP_I2cHandle;
 static SPI_HandleTypeDef SpiHandle;
+
+/* SPI5 devices. 5.625 MHz for both: ILI9341 reads are limited to 6.66 MHz and
+   the L3GD20 to 10 MHz. Sensor reads go first, LCD transfers can be split */
+static const SPI_BUS_DeviceTypeDef LcdSpiDevice =
+{
+  LCD_NCS_GPIO_PORT, LCD_NCS_PIN, LCD_WRX_GPIO_PORT, LCD_WRX_PIN,
+  SPI_BAUDRATEPRESCALER_16, SPI_POLARITY_LOW, SPI_PHASE_1EDGE, SPI_BUS_PRIORITY_LOW, 16
+};
+static const SPI_BUS_DeviceTypeDef GyroSpiDevice =
+{
+  GYRO_CS_GPIO_PORT, GYRO_CS_PIN, NULL, 0,
+  SPI_BAUDRATEPRESCALER_16, SPI_POLARITY_LOW, SPI_PHASE_1EDGE, SPI_BUS_PRIORITY_HIGH, 0
+};
 static uint8_t Is_LCD_IO_Initialized = 0;
 
 /**
@@ -120,26 +132,12 @@ static uint8_t Is_LCD_IO_Initialized = 0;
 /* I2Cx bus function */
 static void               I2Cx_Init(void);
 static void               I2Cx_ITConfig(void);
-static void               I2Cx_WriteData(uint8_t Addr, uint8_t Reg, uint8_t Value);
-static void               I2Cx_WriteBuffer(uint8_t Addr, uint8_t Reg,  uint8_t *pBuffer, uint16_t Length);
-static uint8_t            I2Cx_ReadData(uint8_t Addr, uint8_t Reg);
-static uint8_t            I2Cx_ReadBuffer(uint8_t Addr, uint8_t Reg, uint8_t *pBuffer, uint16_t Length);
-static void               I2Cx_Error(void);
 static void               I2Cx_MspInit(I2C_HandleTypeDef *hi2c);  
-#ifdef EE_M24LR64
-static HAL_StatusTypeDef  I2Cx_WriteBufferDMA(uint8_t Addr, uint16_t Reg,  uint8_t *pBuffer, uint16_t Length);
-static HAL_StatusTypeDef  I2Cx_ReadBufferDMA(uint8_t Addr, uint16_t Reg, uint8_t *pBuffer, uint16_t Length);
-static HAL_StatusTypeDef  I2Cx_IsDeviceReady(uint16_t DevAddress, uint32_t Trials);
 static void EEPROM_I2C_DMA_TX_IRQHandler(void);
 static void EEPROM_I2C_DMA_RX_IRQHandler(void);
-#endif /* EE_M24LR64 */
 
 /* SPIx bus function */
 static void               SPIx_Init(void);
-static void               SPIx_Write(uint16_t Value);
-static uint32_t           SPIx_Read(uint8_t ReadSize);
-static uint8_t            SPIx_WriteRead(uint8_t Byte);
-static void               SPIx_Error(void);
 static void               SPIx_MspInit(SPI_HandleTypeDef *hspi);
 
 /* Link function for LCD peripheral */
@@ -157,6 +155,7 @@ void                      IOE_Write(uint8_t Addr, uint8_t Reg, uint8_t Value);
 uint8_t                   IOE_Read(uint8_t Addr, uint8_t Reg);
 uint16_t                  IOE_ReadMultiple(uint8_t Addr, uint8_t Reg, uint8_t *pBuffer, uint16_t Length);
 void                      IOE_WriteMultiple(uint8_t Addr, uint8_t Reg, uint8_t *pBuffer, uint16_t Length);
+void                      IOE_Submit(I2C_BUS_TransactionTypeDef *pTransaction);
 
 /* Link function for GYRO peripheral */
 void                      GYRO_IO_Init(void);
@@ -169,6 +168,7 @@ void                      EEPROM_IO_Init(void);
 HAL_StatusTypeDef         EEPROM_IO_WriteData(uint16_t DevAddress, uint16_t MemAddress, uint8_t* pBuffer, uint32_t BufferSize);
 HAL_StatusTypeDef         EEPROM_IO_ReadData(uint16_t DevAddress, uint16_t MemAddress, uint8_t* pBuffer, uint32_t BufferSize);
 HAL_StatusTypeDef         EEPROM_IO_IsDeviceReady(uint16_t DevAddress, uint32_t Trials);
+void                      EEPROM_IO_Submit(I2C_BUS_TransactionTypeDef *pTransaction);
 #endif /* EE_M24LR64 */
 
 /**
@@ -314,13 +314,11 @@ uint32_t BSP_PB_GetState(Button_TypeDef Button)
 static void I2Cx_MspInit(I2C_HandleTypeDef *hi2c)
 {
   GPIO_InitTypeDef  GPIO_InitStruct;  
-#ifdef EE_M24LR64
   static DMA_HandleTypeDef hdma_tx;
   static DMA_HandleTypeDef hdma_rx;
   
   I2C_HandleTypeDef* pI2cHandle;
   pI2cHandle = &EEP_I2cHandle;
-#endif /* EE_M24LR64 */
 
   if (hi2c->Instance == DISCOVERY_I2Cx)
   {
@@ -360,8 +358,7 @@ static void I2Cx_MspInit(I2C_HandleTypeDef *hi2c)
     HAL_NVIC_SetPriority(DISCOVERY_I2Cx_ER_IRQn, 0x0F, 0);
     HAL_NVIC_EnableIRQ(DISCOVERY_I2Cx_ER_IRQn);  
 
-#ifdef EE_M24LR64
-    /* I2C DMA TX and RX channels configuration */
+    /* I2C DMA TX and RX channels configuration, used by the bus scheduler */
     /* Enable the DMA clock */
     EEPROM_I2C_DMA_CLK_ENABLE();
     
@@ -434,8 +431,6 @@ static void I2Cx_MspInit(I2C_HandleTypeDef *hi2c)
     NVIC_SetPriority(irqn, EEPROM_I2C_DMA_PREPRIO);
     NVIC_SetVector(irqn, (uint32_t)EEPROM_I2C_DMA_RX_IRQHandler);
     NVIC_EnableIRQ(irqn);
-
-#endif /* EE_M24LR64 */
   }
 }
 
@@ -459,6 +454,9 @@ static void I2Cx_Init(void)
     /* Init the I2C */
     I2Cx_MspInit(&EEP_I2cHandle);
     HAL_I2C_Init(&EEP_I2cHandle);
+
+    /* All the transfers go through the bus scheduler from now on */
+    BSP_I2C_BUS_Init(&EEP_I2cHandle);
   }
 }
 
@@ -483,172 +481,6 @@ static void I2Cx_ITConfig(void)
   HAL_NVIC_EnableIRQ((IRQn_Type)(STMPE811_INT_EXTI));
 }
 
-/**
-  * @brief  Writes a value in a register of the device through BUS.
-  * @param  Addr: Device address on BUS Bus.  
-  * @param  Reg: The target register address to write
-  * @param  Value: The target register value to be written 
-  */
-static void I2Cx_WriteData(uint8_t Addr, uint8_t Reg, uint8_t Value)
-  {
-  HAL_StatusTypeDef status = HAL_OK;
-  
-  status = HAL_I2C_Mem_Write(&EEP_I2cHandle, Addr, (uint16_t)Reg, I2C_MEMADD_SIZE_8BIT, &Value, 1, I2cxTimeout); 
-  
-  /* Check the communication status */
-  if(status != HAL_OK)
-  {
-    /* Re-Initialize the BUS */
-    I2Cx_Error();
-  }        
-}
-
-/**
-  * @brief  Writes a value in a register of the device through BUS.
-  * @param  Addr: Device address on BUS Bus.  
-  * @param  Reg: The target register address to write
-  * @param  pBuffer: The target register value to be written 
-  * @param  Length: buffer size to be written
-  */
-static void I2Cx_WriteBuffer(uint8_t Addr, uint8_t Reg,  uint8_t *pBuffer, uint16_t Length)
-  {
-  HAL_StatusTypeDef status = HAL_OK;
-  
-  status = HAL_I2C_Mem_Write(&EEP_I2cHandle, Addr, (uint16_t)Reg, I2C_MEMADD_SIZE_8BIT, pBuffer, Length, I2cxTimeout); 
-
-  /* Check the communication status */
-  if(status != HAL_OK)
-  {
-    /* Re-Initialize the BUS */
-    I2Cx_Error();
-  }        
-}
-
-/**
-  * @brief  Reads a register of the device through BUS.
-  * @param  Addr: Device address on BUS Bus.  
-  * @param  Reg: The target register address to write
-  * @retval Data read at register address
-  */
-static uint8_t I2Cx_ReadData(uint8_t Addr, uint8_t Reg)
-{
-  HAL_StatusTypeDef status = HAL_OK;
-  uint8_t value = 0;
-  
-  status = HAL_I2C_Mem_Read(&EEP_I2cHandle, Addr, Reg, I2C_MEMADD_SIZE_8BIT, &value, 1, I2cxTimeout);
- 
-  /* Check the communication status */
-  if(status != HAL_OK)
-  {
-    /* Re-Initialize the BUS */
-    I2Cx_Error();
-  
-  }
-  return value;
-}
-
-/**
-  * @brief  Reads multiple data on the BUS.
-  * @param  Addr: I2C Address
-  * @param  Reg: Reg Address 
-  * @param  pBuffer: pointer to read data buffer
-  * @param  Length: length of the data
-  * @retval 0 if no problems to read multiple data
-  */
-static uint8_t I2Cx_ReadBuffer(uint8_t Addr, uint8_t Reg, uint8_t *pBuffer, uint16_t Length)
-{
-  HAL_StatusTypeDef status = HAL_OK;
-
-  status = HAL_I2C_Mem_Read(&EEP_I2cHandle, Addr, (uint16_t)Reg, I2C_MEMADD_SIZE_8BIT, pBuffer, Length, I2cxTimeout);
-  
-  /* Check the communication status */
-  if(status == HAL_OK)
-  {
-    return 0;
-  }
-  else
-  {
-    /* Re-Initialize the BUS */
-    I2Cx_Error();
-
-    return 1;
-  }
-}
-
-#ifdef EE_M24LR64
-/**
-  * @brief  Writes a value in a register of the device through BUS in using DMA mode.
-  * @param  Addr: Device address on BUS Bus.  
-  * @param  Reg: The target register address to write
-  * @param  pBuffer: The target register value to be written 
-  * @param  Length: buffer size to be written
-  * @retval HAL status
-  */
-static HAL_StatusTypeDef I2Cx_WriteBufferDMA(uint8_t Addr, uint16_t Reg,  uint8_t *pBuffer, uint16_t Length)
-  {
-  HAL_StatusTypeDef status = HAL_OK;
-  
-  status = HAL_I2C_Mem_Write_DMA(&EEP_I2cHandle, Addr, Reg, I2C_MEMADD_SIZE_16BIT, pBuffer, Length);
-
-  /* Check the communication status */
-  if(status != HAL_OK)
-  {
-    /* Re-Initialize the BUS */
-    I2Cx_Error();
-  }
-
-  return status;
-}
-
-/**
-  * @brief  Reads multiple data on the BUS in using DMA mode.
-  * @param  Addr: I2C Address
-  * @param  Reg: Reg Address 
-  * @param  pBuffer: pointer to read data buffer
-  * @param  Length: length of the data
-  * @retval HAL status
-  */
-static HAL_StatusTypeDef I2Cx_ReadBufferDMA(uint8_t Addr, uint16_t Reg, uint8_t *pBuffer, uint16_t Length)
-{
-  HAL_StatusTypeDef status = HAL_OK;
-
-  status = HAL_I2C_Mem_Read_DMA(&EEP_I2cHandle, Addr, Reg, I2C_MEMADD_SIZE_16BIT, pBuffer, Length);
-  
-  /* Check the communication status */
-  if(status != HAL_OK)
-  {
-    /* Re-Initialize the BUS */
-    I2Cx_Error();
-  }
-  
-  return status;
-}
-
-/**
-* @brief  Checks if target device is ready for communication. 
-* @note   This function is used with Memory devices
-* @param  DevAddress: Target device address
-* @param  Trials: Number of trials
-* @retval HAL status
-*/
-static HAL_StatusTypeDef I2Cx_IsDeviceReady(uint16_t DevAddress, uint32_t Trials)
-{ 
-  return (HAL_I2C_IsDeviceReady(&EEP_I2cHandle, DevAddress, Trials, I2cxTimeout));
-}
-#endif /* EE_M24LR64 */
-
-/**
-  * @brief  I2Cx error treatment function
-  */
-static void I2Cx_Error(void)
-{
-  /* De-initialize the I2C communication BUS */
-  HAL_I2C_DeInit(&EEP_I2cHandle);
-  
-  /* Re-Initialize the I2C communication BUS */
-  I2Cx_Init();
-}
-
 /******************************* SPI Routines *********************************/
 
 /**
@@ -684,79 +516,10 @@ static void SPIx_Init(void)
   
     SPIx_MspInit(&SpiHandle);
     HAL_SPI_Init(&SpiHandle);
-  } 
-}
-
-/**
-  * @brief  Reads 4 bytes from device.
-  * @param  ReadSize: Number of bytes to read (max 4 bytes)
-  * @retval Value read on the SPI
-  */
-static uint32_t SPIx_Read(uint8_t ReadSize)
-{
-  HAL_StatusTypeDef status = HAL_OK;
-  uint32_t readvalue;
-  
-  status = HAL_SPI_Receive(&SpiHandle, (uint8_t*) &readvalue, ReadSize, SpixTimeout);
-  
-  /* Check the communication status */
-  if(status != HAL_OK)
-  {
-    /* Re-Initialize the BUS */
-    SPIx_Error();
-  }
-  
-  return readvalue;
-}
 
-/**
-  * @brief  Writes a byte to device.
-  * @param  Value: value to be written
-  */
-static void SPIx_Write(uint16_t Value)
-{
-  HAL_StatusTypeDef status = HAL_OK;
-  
-  status = HAL_SPI_Transmit(&SpiHandle, (uint8_t*) &Value, 1, SpixTimeout);
-  
-  /* Check the communication status */
-  if(status != HAL_OK)
-  {
-    /* Re-Initialize the BUS */
-    SPIx_Error();
-  }
-}
-
-/**
-  * @brief  Sends a Byte through the SPI interface and return the Byte received 
-  *         from the SPI bus.
-  * @param  Byte: Byte send.
-  * @retval The received byte value
-  */
-static uint8_t SPIx_WriteRead(uint8_t Byte)
-{
-  uint8_t receivedbyte = 0;
-  
-  /* Send a Byte through the SPI peripheral */
-  /* Read byte from the SPI bus */
-  if(HAL_SPI_TransmitReceive(&SpiHandle, (uint8_t*) &Byte, (uint8_t*) &receivedbyte, 1, SpixTimeout) != HAL_OK)
-  {
-    SPIx_Error();
-  }
-  
-  return receivedbyte;
-}
-
-/**
-  * @brief  SPIx error treatment function.
-  */
-static void SPIx_Error(void)
-{
-  /* De-initialize the SPI communication BUS */
-  HAL_SPI_DeInit(&SpiHandle);
-  
-  /* Re- Initialize the SPI communication BUS */
-  SPIx_Init();
+    /* All the transfers go through the bus arbiter from now on */
+    BSP_SPI_BUS_Init(&SpiHandle);
+  } 
 }
 
 /**
@@ -833,15 +596,10 @@ void LCD_IO_Init(void)
   */
 void LCD_IO_WriteData(uint16_t RegValue) 
 {
-  /* Set WRX to send data */
-  LCD_WRX_HIGH();
-  
-  /* Reset LCD control line(/CS) and Send data */  
-  LCD_CS_LOW();
-  SPIx_Write(RegValue);
-  
-  /* Deselect: Chip Select high */
-  LCD_CS_HIGH();
+  uint8_t data = (uint8_t)RegValue;
+
+  /* WRX high to send data */
+  BSP_SPI_BUS_Transfer(&LcdSpiDevice, 1, &data, NULL, 1);
 }
 
 /**
@@ -849,15 +607,8 @@ void LCD_IO_WriteData(uint16_t RegValue)
   */
 void LCD_IO_WriteReg(uint8_t Reg) 
 {
-  /* Reset WRX to send command */
-  LCD_WRX_LOW();
-  
-  /* Reset LCD control line(/CS) and Send command */
-  LCD_CS_LOW();
-  SPIx_Write(Reg);
-  
-  /* Deselect: Chip Select high */
-  LCD_CS_HIGH();
+  /* WRX low to send a command */
+  BSP_SPI_BUS_Transfer(&LcdSpiDevice, 0, &Reg, NULL, 1);
 }
 
 /**
@@ -868,24 +619,23 @@ void LCD_IO_WriteReg(uint8_t Reg)
   */
 uint32_t LCD_IO_ReadData(uint16_t RegValue, uint8_t ReadSize) 
 {
+  uint8_t tx[5] = {0}, rx[5] = {0};
   uint32_t readvalue = 0;
+  uint32_t i;
 
-  /* Select: Chip Select low */
-  LCD_CS_LOW();
-
-  /* Reset WRX to send command */
-  LCD_WRX_LOW();
-  
-  SPIx_Write(RegValue);
-  
-  readvalue = SPIx_Read(ReadSize);
+  if(ReadSize > 4)
+  {
+    ReadSize = 4;
+  }
 
-  /* Set WRX to send data */
-  LCD_WRX_HIGH();
+  /* Command and answer in the same chip select frame, WRX low */
+  tx[0] = (uint8_t)RegValue;
+  BSP_SPI_BUS_Transfer(&LcdSpiDevice, 0, tx, rx, 1 + ReadSize);
+  for(i = 0; i < ReadSize; i++)
+  {
+    readvalue |= (uint32_t)rx[1 + i] << (8 * i);
+  }
 
-  /* Deselect: Chip Select high */
-  LCD_CS_HIGH();
-  
   return readvalue;
 }
 
@@ -929,7 +679,7 @@ void IOE_ITConfig(void)
   */
 void IOE_Write(uint8_t Addr, uint8_t Reg, uint8_t Value)
 {
-  I2Cx_WriteData(Addr, Reg, Value);
+  BSP_I2C_BUS_Write(I2C_BUS_PRIORITY_HIGH, Addr, Reg, I2C_MEMADD_SIZE_8BIT, &Value, 1);
 }
 
 /**
@@ -940,7 +690,10 @@ void IOE_Write(uint8_t Addr, uint8_t Reg, uint8_t Value)
   */
 uint8_t IOE_Read(uint8_t Addr, uint8_t Reg)
 {
-  return I2Cx_ReadData(Addr, Reg);
+  uint8_t value = 0;
+
+  BSP_I2C_BUS_Read(I2C_BUS_PRIORITY_HIGH, Addr, Reg, I2C_MEMADD_SIZE_8BIT, &value, 1);
+  return value;
 }
 
 /**
@@ -952,7 +705,7 @@ uint8_t IOE_Read(uint8_t Addr, uint8_t Reg)
   */
 void IOE_WriteMultiple(uint8_t Addr, uint8_t Reg, uint8_t *pBuffer, uint16_t Length)
 {
-  I2Cx_WriteBuffer(Addr, Reg, pBuffer, Length);
+  BSP_I2C_BUS_Write(I2C_BUS_PRIORITY_HIGH, Addr, Reg, I2C_MEMADD_SIZE_8BIT, pBuffer, Length);
 }
 
 /**
@@ -965,7 +718,20 @@ void IOE_WriteMultiple(uint8_t Addr, uint8_t Reg, uint8_t *pBuffer, uint16_t Len
   */
 uint16_t IOE_ReadMultiple(uint8_t Addr, uint8_t Reg, uint8_t *pBuffer, uint16_t Length)
 {
- return I2Cx_ReadBuffer(Addr, Reg, pBuffer, Length);
+  return (BSP_I2C_BUS_Read(I2C_BUS_PRIORITY_HIGH, Addr, Reg, I2C_MEMADD_SIZE_8BIT, pBuffer, Length) == I2C_BUS_DONE) ? 0 : 1;
+}
+
+/**
+  * @brief  Queues an IO expander transaction without waiting for it, ahead
+  *         of the pending EEPROM transfers. May be called from an interrupt.
+  * @param  pTransaction: Type, DevAddress, MemAddress, pData, Length and
+  *         callback filled by the caller
+  */
+void IOE_Submit(I2C_BUS_TransactionTypeDef *pTransaction)
+{
+  pTransaction->Priority   = I2C_BUS_PRIORITY_HIGH;
+  pTransaction->MemAddSize = I2C_MEMADD_SIZE_8BIT;
+  BSP_I2C_BUS_Submit(pTransaction);
 }
 
 /**
@@ -1014,10 +780,18 @@ void GYRO_IO_Init(void)
   * @brief  Writes one byte to the Gyroscope.
   * @param  pBuffer: Pointer to the buffer containing the data to be written to the Gyroscope.
   * @param  WriteAddr: Gyroscope's internal address to write to.
-  * @param  NumByteToWrite: Number of bytes to write.
+  * @param  NumByteToWrite: Number of bytes to write, GYRO_IO_MAX_SIZE at most.
   */
 void GYRO_IO_Write(uint8_t* pBuffer, uint8_t WriteAddr, uint16_t NumByteToWrite)
 {
+  uint8_t frame[1 + GYRO_IO_MAX_SIZE];
+  uint16_t i;
+
+  if(NumByteToWrite > GYRO_IO_MAX_SIZE)
+  {
+    NumByteToWrite = GYRO_IO_MAX_SIZE;
+  }
+
   /* Configure the MS bit: 
        - When 0, the address will remain unchanged in multiple read/write commands.
        - When 1, the address will be auto incremented in multiple read/write commands.
@@ -1026,32 +800,33 @@ void GYRO_IO_Write(uint8_t* pBuffer, uint8_t WriteAddr, uint16_t NumByteToWrite)
   {
     WriteAddr |= (uint8_t)MULTIPLEBYTE_CMD;
   }
-  /* Set chip select Low at the start of the transmission */
-  GYRO_CS_LOW();
-  
-  /* Send the Address of the indexed register */
-  SPIx_WriteRead(WriteAddr);
-  
-  /* Send the data that will be written into the device (MSB First) */
-  while(NumByteToWrite >= 0x01)
+
+  /* Address of the indexed register, then the data, in one chip select frame */
+  frame[0] = WriteAddr;
+  for(i = 0; i < NumByteToWrite; i++)
   {
-    SPIx_WriteRead(*pBuffer);
-    NumByteToWrite--;
-    pBuffer++;
+    frame[1 + i] = pBuffer[i];
   }
-  
-  /* Set chip select High at the end of the transmission */ 
-  GYRO_CS_HIGH();
+  BSP_SPI_BUS_Transfer(&GyroSpiDevice, 0, frame, NULL, 1 + NumByteToWrite);
 }
 
 /**
   * @brief  Reads a block of data from the Gyroscope.
   * @param  pBuffer: Pointer to the buffer that receives the data read from the Gyroscope.
   * @param  ReadAddr: Gyroscope's internal address to read from.
-  * @param  NumByteToRead: Number of bytes to read from the Gyroscope.
+  * @param  NumByteToRead: Number of bytes to read from the Gyroscope, GYRO_IO_MAX_SIZE at most.
   */
 void GYRO_IO_Read(uint8_t* pBuffer, uint8_t ReadAddr, uint16_t NumByteToRead)
 {  
+  uint8_t tx[1 + GYRO_IO_MAX_SIZE];
+  uint8_t rx[1 + GYRO_IO_MAX_SIZE];
+  uint16_t i;
+
+  if(NumByteToRead > GYRO_IO_MAX_SIZE)
+  {
+    NumByteToRead = GYRO_IO_MAX_SIZE;
+  }
+
   if(NumByteToRead > 0x01)
   {
     ReadAddr |= (uint8_t)(READWRITE_CMD | MULTIPLEBYTE_CMD);
@@ -1060,25 +835,20 @@ void GYRO_IO_Read(uint8_t* pBuffer, uint8_t ReadAddr, uint16_t NumByteToRead)
   {
     ReadAddr |= (uint8_t)READWRITE_CMD;
   }
-  /* Set chip select Low at the start of the transmission */
-  GYRO_CS_LOW();
-  
-  /* Send the Address of the indexed register */
-  SPIx_WriteRead(ReadAddr);
-  
-  /* Receive the data that will be read from the device (MSB First) */
-  while(NumByteToRead > 0x00)
+
+  /* Address of the indexed register, then dummy bytes to clock the data out */
+  tx[0] = ReadAddr;
+  for(i = 0; i < NumByteToRead; i++)
   {
-    /* Send dummy byte (0x00) to generate the SPI clock to Gyroscope (Slave device) */
-    *pBuffer = SPIx_WriteRead(DUMMY_BYTE);
-    NumByteToRead--;
-    pBuffer++;
+    tx[1 + i] = DUMMY_BYTE;
   }
-  
-  /* Set chip select High at the end of the transmission */ 
-  GYRO_CS_HIGH();
-}  
+  BSP_SPI_BUS_Transfer(&GyroSpiDevice, 0, tx, rx, 1 + NumByteToRead);
 
+  for(i = 0; i < NumByteToRead; i++)
+  {
+    pBuffer[i] = rx[1 + i];
+  }
+}
 
 #ifdef EE_M24LR64
 
@@ -1093,46 +863,88 @@ void EEPROM_IO_Init(void)
 }
 
 /**
-  * @brief  Writes data to I2C EEPROM driver in using DMA channel.
+  * @brief  Writes data to I2C EEPROM driver in using DMA channel, after the
+  *         pending IO expander transfers.
   * @param  DevAddress: Target device address
   * @param  MemAddress: Internal memory address
   * @param  pBuffer: Pointer to data buffer
   * @param  BufferSize: Amount of data to be sent
-  * @retval HAL status
+  * @retval HAL status, once the data is sent
   */
 HAL_StatusTypeDef EEPROM_IO_WriteData(uint16_t DevAddress, uint16_t MemAddress, uint8_t* pBuffer, uint32_t BufferSize)
 {
-  return (I2Cx_WriteBufferDMA(DevAddress, MemAddress,  pBuffer, BufferSize));
+  if(BSP_I2C_BUS_Write(I2C_BUS_PRIORITY_LOW, DevAddress, MemAddress, I2C_MEMADD_SIZE_16BIT, pBuffer, BufferSize) != I2C_BUS_DONE)
+  {
+    return HAL_ERROR;
+  }
+  return HAL_OK;
 }
 
 /**
-  * @brief  Reads data from I2C EEPROM driver in using DMA channel.
+  * @brief  Reads data from I2C EEPROM driver in using DMA channel, after the
+  *         pending IO expander transfers. Read in transfers of
+  *         EEPROM_READ_CHUNK bytes, the IO expander transfers queued during
+  *         one go before the next.
   * @param  DevAddress: Target device address
   * @param  MemAddress: Internal memory address
   * @param  pBuffer: Pointer to data buffer
   * @param  BufferSize: Amount of data to be read
-  * @retval HAL status
+  * @retval HAL status, once the data is received
   */
 HAL_StatusTypeDef EEPROM_IO_ReadData(uint16_t DevAddress, uint16_t MemAddress, uint8_t* pBuffer, uint32_t BufferSize)
 {
-  return (I2Cx_ReadBufferDMA(DevAddress, MemAddress, pBuffer, BufferSize));
+  uint32_t length;
+
+  while(BufferSize > 0)
+  {
+    length = (BufferSize > EEPROM_READ_CHUNK) ? EEPROM_READ_CHUNK : BufferSize;
+    if(BSP_I2C_BUS_Read(I2C_BUS_PRIORITY_LOW, DevAddress, MemAddress, I2C_MEMADD_SIZE_16BIT, pBuffer, length) != I2C_BUS_DONE)
+    {
+      return HAL_ERROR;
+    }
+    MemAddress += length;
+    pBuffer    += length;
+    BufferSize -= length;
+  }
+  return HAL_OK;
 }
 
 /**
 * @brief  Checks if target device is ready for communication. 
-* @note   This function is used with Memory devices
+* @note   This function is used with Memory devices. The acknowledge polling
+*         runs in the background of the bus scheduler: the IO expander
+*         transfers go between two trials.
 * @param  DevAddress: Target device address
 * @param  Trials: Number of trials
 * @retval HAL status
 */
 HAL_StatusTypeDef EEPROM_IO_IsDeviceReady(uint16_t DevAddress, uint32_t Trials)
 { 
-  return (I2Cx_IsDeviceReady(DevAddress, Trials));
+  if(BSP_I2C_BUS_Poll(I2C_BUS_PRIORITY_LOW, DevAddress, Trials) != I2C_BUS_DONE)
+  {
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queues an EEPROM transaction without waiting for it, after the
+  *         pending IO expander transfers.
+  * @param  pTransaction: Type, DevAddress, MemAddress, pData, Length, Trials
+  *         and callback filled by the caller
+  */
+void EEPROM_IO_Submit(I2C_BUS_TransactionTypeDef *pTransaction)
+{
+  pTransaction->Priority   = I2C_BUS_PRIORITY_LOW;
+  pTransaction->MemAddSize = I2C_MEMADD_SIZE_16BIT;
+  BSP_I2C_BUS_Submit(pTransaction);
 }
 
+#endif /* EE_M24LR64 */
+
 // Added for mbed
 /**
-  * @brief  This function handles sEE DMA TX interrupt request.
+  * @brief  This function handles I2C DMA TX interrupt request.
   * @param  None
   * @retval None
   */
@@ -1142,7 +954,7 @@ static void EEPROM_I2C_DMA_TX_IRQHandler(void)
 }
 
 /**
-  * @brief  This function handles sEE DMA RX interrupt request.
+  * @brief  This function handles I2C DMA RX interrupt request.
   * @param  None
   * @retval None
   */
@@ -1151,8 +963,6 @@ static void EEPROM_I2C_DMA_RX_IRQHandler(void)
   HAL_DMA_IRQHandler(EEP_I2cHandle.hdmarx);
 }
 
-#endif /* EE_M24LR64 */
-
 /**
   * @}
   */ 
@@ -151,6 +151,12 @@ typedef enum
 #ifdef EE_M24LR64
 #define EEPROM_I2C_ADDRESS_A01              0xA0
 #define EEPROM_I2C_ADDRESS_A02              0xA6
+
+/* Longest EEPROM read transfer: about 3 ms of the bus at 100 kHz, the IO
+   expander transfers queued meanwhile go before the next one */
+#ifndef EEPROM_READ_CHUNK
+ #define EEPROM_READ_CHUNK                  32
+#endif /* EEPROM_READ_CHUNK */
 #endif /* EE_M24LR64 */ 
 
 /*############################### I2Cx #######################################*/
@@ -258,6 +264,8 @@ typedef enum
 #define MULTIPLEBYTE_CMD           ((uint8_t)0x40)
 /* Dummy Byte Send by the SPI Master device in order to generate the Clock to the Slave device */
 #define DUMMY_BYTE                 ((uint8_t)0x00)
+/* Largest GYRO_IO_Read()/GYRO_IO_Write() transfer: the whole FIFO, 32 samples */
+#define GYRO_IO_MAX_SIZE           192
 
 /* Chip Select macro definition */
 #define GYRO_CS_LOW()       HAL_GPIO_WritePin(GYRO_CS_GPIO_PORT, GYRO_CS_PIN, GPIO_PIN_RESET)
@@ -282,7 +290,6 @@ typedef enum
   * @}
   */ 
 
-#ifdef EE_M24LR64
 /** @defgroup STM32F429I_DISCOVERY_LOW_LEVEL_I2C_EEPROM STM32F429I DISCOVERY LOW LEVEL I2C EEPROM
   * @{
   */
@@ -304,8 +311,6 @@ typedef enum
   * @}
   */ 
 
-#endif /* EE_M24LR64 */
-
 /** @defgroup STM32F429I_DISCOVERY_LOW_LEVEL_Exported_Macros STM32F429I DISCOVERY LOW LEVEL Exported Macros
   * @{
   */  
@@ -0,0 +1,593 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_dma2d.c
+  * @brief   This file provides a queued, interrupt driven interface to the
+  *          DMA2D (Chrom-ART) graphics accelerator.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this driver:
+--------------------------
+   - BSP_DMA2D_Init() is called by BSP_LCD_Init(), it enables the DMA2D clock
+     and its interrupt.
+   - BSP_DMA2D_Fill(), BSP_DMA2D_Copy(), BSP_DMA2D_Convert() and BSP_DMA2D_Blend()
+     encode the transfer and put it in a queue. They return a fence at once,
+     the transfers are chained from the DMA2D interrupt.
+   - BSP_DMA2D_Wait() blocks until a fence is reached, BSP_DMA2D_WaitIdle()
+     until the queue is empty. The CPU must wait before it reads or writes
+     pixels that a queued transfer may still touch.
+
+2. Driver description:
+---------------------
+   - The registers of each transfer are computed at submission time, the
+     interrupt handler only copies them into the DMA2D: no HAL_DMA2D_Init()
+     is done per transfer.
+   - CLUTs of indexed inputs (L8, AL44, AL88, L4) are loaded with the CLUT
+     transfer complete interrupt and kept: a CLUT is reloaded only when its
+     address or layout differ from the one already in the DMA2D. A CLUT that
+     is modified in place must be followed by BSP_DMA2D_InvalidateCLUT().
+   - A transfer ending on an error is dropped and counted.
+   - The functions are not meant to be called from interrupt context.
+
+------------------------------------------------------------------------------*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery_dma2d.h"
+#include "cmsis_nvic.h" // Added for mbed
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_DMA2D STM32F429I DISCOVERY DMA2D
+  * @brief This file includes the DMA2D command queue
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_DMA2D_Private_TypesDefinitions STM32F429I DISCOVERY DMA2D Private TypesDefinitions
+  * @{
+  */
+typedef struct
+{
+  uint32_t CR;
+  uint32_t OPFCCR;
+  uint32_t OCOLR;
+  uint32_t OMAR;
+  uint32_t OOR;
+  uint32_t NLR;
+  uint32_t FGMAR;
+  uint32_t FGOR;
+  uint32_t FGPFCCR;
+  uint32_t FGCOLR;
+  uint32_t FGCMAR;
+  uint32_t BGMAR;
+  uint32_t BGOR;
+  uint32_t BGPFCCR;
+  uint32_t BGCOLR;
+  uint32_t BGCMAR;
+}DMA2D_CommandTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_DMA2D_Private_Defines STM32F429I DISCOVERY DMA2D Private Defines
+  * @{
+  */
+#define DMA2D_STATE_IDLE               0
+#define DMA2D_STATE_FG_CLUT            1
+#define DMA2D_STATE_BG_CLUT            2
+#define DMA2D_STATE_TRANSFER           3
+
+/* PFCCR fields that describe the CLUT layout, same positions in FG and BG */
+#define DMA2D_PFCCR_CLUT_MASK          (DMA2D_FGPFCCR_CCM | DMA2D_FGPFCCR_CS)
+
+#define DMA2D_CR_IT_ERRORS             (DMA2D_CR_TEIE | DMA2D_CR_CEIE | DMA2D_CR_CAEIE)
+#define DMA2D_ISR_ERRORS               (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF | DMA2D_ISR_CAEIF)
+#define DMA2D_ISR_ALL                  (DMA2D_ISR_ERRORS | DMA2D_ISR_TCIF | DMA2D_ISR_CTCIF | DMA2D_ISR_TWIF)
+
+#define DMA2D_NLR_PL_SHIFT             16
+#define DMA2D_PFCCR_AM_SHIFT           16
+#define DMA2D_PFCCR_CCM_SHIFT          4
+#define DMA2D_PFCCR_CS_SHIFT           8
+
+/* The fences are free running: the ring index stays right when they wrap */
+#if (DMA2D_QUEUE_DEPTH == 0) || ((DMA2D_QUEUE_DEPTH & (DMA2D_QUEUE_DEPTH - 1)) != 0)
+ #error "DMA2D_QUEUE_DEPTH must be a power of 2"
+#endif
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_DMA2D_Private_Variables STM32F429I DISCOVERY DMA2D Private Variables
+  * @{
+  */
+static DMA2D_CommandTypeDef Dma2dQueue[DMA2D_QUEUE_DEPTH];
+
+static __IO uint32_t Dma2dHead = 0;     /* Fence of the last queued command    */
+static __IO uint32_t Dma2dTail = 0;     /* Fence of the last retired command   */
+static __IO uint32_t Dma2dState = DMA2D_STATE_IDLE;
+static __IO uint32_t Dma2dErrors = 0;
+
+/* CLUT currently held in the DMA2D CLUT memories (address 0: none) */
+static uint32_t FgClutAddress = 0, FgClutLayout = 0;
+static uint32_t BgClutAddress = 0, BgClutLayout = 0;
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_DMA2D_Private_FunctionPrototypes STM32F429I DISCOVERY DMA2D Private FunctionPrototypes
+  * @{
+  */
+static DMA2D_FenceTypeDef DMA2D_Submit(const DMA2D_CommandTypeDef *pCmd);
+static void               DMA2D_StartNext(void);
+static void               DMA2D_EncodeLayer(const DMA2D_LayerTypeDef *pLayer, uint32_t *pMAR, uint32_t *pOR, uint32_t *pPFCCR, uint32_t *pCOLR, uint32_t *pCMAR);
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_DMA2D_Private_Functions STM32F429I DISCOVERY DMA2D Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Initializes the DMA2D and its command queue.
+  */
+void BSP_DMA2D_Init(void)
+{
+  IRQn_Type irqn = DMA2D_IRQn;
+
+  /* Do not drop transfers queued before a re-initialization */
+  BSP_DMA2D_WaitIdle();
+
+  /* Enable the DMA2D Clock */
+  __HAL_RCC_DMA2D_CLK_ENABLE();
+
+  DMA2D->CR = 0;
+  DMA2D->IFCR = DMA2D_ISR_ALL;
+  BSP_DMA2D_InvalidateCLUT();
+
+  // Added for mbed
+  NVIC_ClearPendingIRQ(irqn);
+  NVIC_DisableIRQ(irqn);
+  NVIC_SetPriority(irqn, DMA2D_IRQ_PREPRIO);
+  NVIC_SetVector(irqn, (uint32_t)BSP_DMA2D_IRQHandler);
+  NVIC_EnableIRQ(irqn);
+}
+
+/**
+  * @brief  Queues a register to memory fill.
+  * @param  DstAddress: address of the first pixel
+  * @param  DstOffset: pixels skipped at the end of each line
+  * @param  DstColorMode: output color mode, DMA2D_ARGB8888 ... DMA2D_ARGB4444
+  * @param  Width: rectangle width
+  * @param  Height: rectangle height
+  * @param  Color: fill color code ARGB(8-8-8-8)
+  * @retval Fence of the transfer
+  */
+DMA2D_FenceTypeDef BSP_DMA2D_Fill(uint32_t DstAddress, uint32_t DstOffset, uint32_t DstColorMode, uint32_t Width, uint32_t Height, uint32_t Color)
+{
+  DMA2D_CommandTypeDef cmd;
+
+  if((Width == 0) || (Height == 0))
+  {
+    return Dma2dHead;
+  }
+
+  cmd.CR     = DMA2D_R2M;
+  cmd.OPFCCR = DstColorMode;
+  cmd.OCOLR  = BSP_DMA2D_EncodeColor(Color, DstColorMode);
+  cmd.OMAR   = DstAddress;
+  cmd.OOR    = DstOffset;
+  cmd.NLR    = (Width << DMA2D_NLR_PL_SHIFT) | Height;
+  cmd.FGCMAR = 0;
+  cmd.BGCMAR = 0;
+
+  return DMA2D_Submit(&cmd);
+}
+
+/**
+  * @brief  Queues a memory to memory copy without pixel format conversion.
+  * @param  SrcAddress: address of the first source pixel
+  * @param  SrcOffset: pixels skipped at the end of each source line
+  * @param  DstAddress: address of the first destination pixel
+  * @param  DstOffset: pixels skipped at the end of each destination line
+  * @param  ColorMode: color mode of both images, DMA2D_ARGB8888 ... DMA2D_ARGB4444
+  * @param  Width: rectangle width
+  * @param  Height: rectangle height
+  * @retval Fence of the transfer
+  */
+DMA2D_FenceTypeDef BSP_DMA2D_Copy(uint32_t SrcAddress, uint32_t SrcOffset, uint32_t DstAddress, uint32_t DstOffset, uint32_t ColorMode, uint32_t Width, uint32_t Height)
+{
+  DMA2D_CommandTypeDef cmd;
+
+  if((Width == 0) || (Height == 0))
+  {
+    return Dma2dHead;
+  }
+
+  cmd.CR      = DMA2D_M2M;
+  cmd.OPFCCR  = ColorMode;
+  cmd.OMAR    = DstAddress;
+  cmd.OOR     = DstOffset;
+  cmd.NLR     = (Width << DMA2D_NLR_PL_SHIFT) | Height;
+  cmd.FGMAR   = SrcAddress;
+  cmd.FGOR    = SrcOffset;
+  cmd.FGPFCCR = ColorMode;
+  cmd.FGCOLR  = 0;
+  cmd.FGCMAR  = 0;
+  cmd.BGCMAR  = 0;
+
+  return DMA2D_Submit(&cmd);
+}
+
+/**
+  * @brief  Queues a memory to memory transfer with pixel format conversion.
+  * @param  pFg: source image
+  * @param  DstAddress: address of the first destination pixel
+  * @param  DstOffset: pixels skipped at the end of each destination line
+  * @param  DstColorMode: output color mode, DMA2D_ARGB8888 ... DMA2D_ARGB4444
+  * @param  Width: rectangle width
+  * @param  Height: rectangle height
+  * @retval Fence of the transfer
+  */
+DMA2D_FenceTypeDef BSP_DMA2D_Convert(const DMA2D_LayerTypeDef *pFg, uint32_t DstAddress, uint32_t DstOffset, uint32_t DstColorMode, uint32_t Width, uint32_t Height)
+{
+  DMA2D_CommandTypeDef cmd;
+
+  if((Width == 0) || (Height == 0))
+  {
+    return Dma2dHead;
+  }
+
+  cmd.CR     = DMA2D_M2M_PFC;
+  cmd.OPFCCR = DstColorMode;
+  cmd.OMAR   = DstAddress;
+  cmd.OOR    = DstOffset;
+  cmd.NLR    = (Width << DMA2D_NLR_PL_SHIFT) | Height;
+  DMA2D_EncodeLayer(pFg, &cmd.FGMAR, &cmd.FGOR, &cmd.FGPFCCR, &cmd.FGCOLR, &cmd.FGCMAR);
+  cmd.BGCMAR = 0;
+
+  return DMA2D_Submit(&cmd);
+}
+
+/**
+  * @brief  Queues the blending of a foreground over a background image.
+  * @param  pFg: foreground image
+  * @param  pBg: background image, may be the destination itself
+  * @param  DstAddress: address of the first destination pixel
+  * @param  DstOffset: pixels skipped at the end of each destination line
+  * @param  DstColorMode: output color mode, DMA2D_ARGB8888 ... DMA2D_ARGB4444
+  * @param  Width: rectangle width
+  * @param  Height: rectangle height
+  * @retval Fence of the transfer
+  */
+DMA2D_FenceTypeDef BSP_DMA2D_Blend(const DMA2D_LayerTypeDef *pFg, const DMA2D_LayerTypeDef *pBg, uint32_t DstAddress, uint32_t DstOffset, uint32_t DstColorMode, uint32_t Width, uint32_t Height)
+{
+  DMA2D_CommandTypeDef cmd;
+
+  if((Width == 0) || (Height == 0))
+  {
+    return Dma2dHead;
+  }
+
+  cmd.CR     = DMA2D_M2M_BLEND;
+  cmd.OPFCCR = DstColorMode;
+  cmd.OMAR   = DstAddress;
+  cmd.OOR    = DstOffset;
+  cmd.NLR    = (Width << DMA2D_NLR_PL_SHIFT) | Height;
+  DMA2D_EncodeLayer(pFg, &cmd.FGMAR, &cmd.FGOR, &cmd.FGPFCCR, &cmd.FGCOLR, &cmd.FGCMAR);
+  DMA2D_EncodeLayer(pBg, &cmd.BGMAR, &cmd.BGOR, &cmd.BGPFCCR, &cmd.BGCOLR, &cmd.BGCMAR);
+
+  return DMA2D_Submit(&cmd);
+}
+
+/**
+  * @brief  Gets the fence of the last queued transfer.
+  * @retval Fence
+  */
+DMA2D_FenceTypeDef BSP_DMA2D_GetLastFence(void)
+{
+  return Dma2dHead;
+}
+
+/**
+  * @brief  Checks if a fence has been reached.
+  * @param  Fence: fence returned by a submission function
+  * @retval 1 if the transfer and all the transfers queued before are done
+  */
+uint8_t BSP_DMA2D_IsComplete(DMA2D_FenceTypeDef Fence)
+{
+  return ((int32_t)(Dma2dTail - Fence) >= 0) ? 1 : 0;
+}
+
+/**
+  * @brief  Waits until a fence has been reached.
+  * @note   The CPU sleeps until the next interrupt between checks.
+  * @param  Fence: fence returned by a submission function
+  */
+void BSP_DMA2D_Wait(DMA2D_FenceTypeDef Fence)
+{
+  uint32_t primask;
+
+  for(;;)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if(BSP_DMA2D_IsComplete(Fence))
+    {
+      __set_PRIMASK(primask);
+      break;
+    }
+    /* A pending interrupt wakes the core up even while masked */
+    __WFI();
+    __set_PRIMASK(primask);
+  }
+}
+
+/**
+  * @brief  Checks if all the queued transfers are done.
+  * @retval 1 if the queue is empty
+  */
+uint8_t BSP_DMA2D_IsIdle(void)
+{
+  return (Dma2dTail == Dma2dHead) ? 1 : 0;
+}
+
+/**
+  * @brief  Waits until all the queued transfers are done.
+  */
+void BSP_DMA2D_WaitIdle(void)
+{
+  if(!BSP_DMA2D_IsIdle())
+  {
+    BSP_DMA2D_Wait(Dma2dHead);
+  }
+}
+
+/**
+  * @brief  Gets the number of transfers dropped on a DMA2D error.
+  * @retval Error count
+  */
+uint32_t BSP_DMA2D_GetErrorCount(void)
+{
+  return Dma2dErrors;
+}
+
+/**
+  * @brief  Forces the next indexed transfers to reload their CLUT.
+  */
+void BSP_DMA2D_InvalidateCLUT(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  FgClutAddress = 0;
+  BgClutAddress = 0;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Converts an ARGB8888 color to a pixel of the output color mode,
+  *         as expected by the OCOLR register in register to memory mode.
+  * @param  Color: color code ARGB(8-8-8-8)
+  * @param  ColorMode: output color mode
+  * @retval Encoded color
+  */
+uint32_t BSP_DMA2D_EncodeColor(uint32_t Color, uint32_t ColorMode)
+{
+  uint32_t alpha = (Color >> 24) & 0xFF;
+  uint32_t red   = (Color >> 16) & 0xFF;
+  uint32_t green = (Color >> 8) & 0xFF;
+  uint32_t blue  = Color & 0xFF;
+
+  switch(ColorMode)
+  {
+  case DMA2D_RGB888:
+    return Color & 0x00FFFFFF;
+
+  case DMA2D_RGB565:
+    return ((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3);
+
+  case DMA2D_ARGB1555:
+    return ((alpha >> 7) << 15) | ((red >> 3) << 10) | ((green >> 3) << 5) | (blue >> 3);
+
+  case DMA2D_ARGB4444:
+    return ((alpha >> 4) << 12) | ((red >> 4) << 8) | ((green >> 4) << 4) | (blue >> 4);
+
+  case DMA2D_ARGB8888:
+  default:
+    return Color;
+  }
+}
+
+/**
+  * @brief  Handles DMA2D interrupt request: retires the finished transfer
+  *         and starts the next one.
+  */
+void BSP_DMA2D_IRQHandler(void)
+{
+  uint32_t isr = DMA2D->ISR;
+
+  /* Clear flags: IFCR bits have the same positions as ISR bits */
+  DMA2D->IFCR = isr & DMA2D_ISR_ALL;
+
+  if(isr & DMA2D_ISR_ERRORS)
+  {
+    /* The CLUT memories content is unknown after an error */
+    FgClutAddress = 0;
+    BgClutAddress = 0;
+    Dma2dErrors++;
+    Dma2dTail++;
+    DMA2D_StartNext();
+  }
+  else if(isr & DMA2D_ISR_CTCIF)
+  {
+    /* CLUT loaded, go on with the same command */
+    DMA2D_StartNext();
+  }
+  else if(isr & DMA2D_ISR_TCIF)
+  {
+    Dma2dTail++;
+    DMA2D_StartNext();
+  }
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+/**
+  * @brief  Puts a command in the queue and starts it if the DMA2D is idle.
+  * @param  pCmd: encoded command
+  * @retval Fence of the command
+  */
+static DMA2D_FenceTypeDef DMA2D_Submit(const DMA2D_CommandTypeDef *pCmd)
+{
+  uint32_t primask;
+  DMA2D_FenceTypeDef fence;
+
+  /* Wait for a free slot */
+  for(;;)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if((Dma2dHead - Dma2dTail) < DMA2D_QUEUE_DEPTH)
+    {
+      break;
+    }
+    __WFI();
+    __set_PRIMASK(primask);
+  }
+
+  /* Frame buffer stores of the CPU must land before the DMA2D touches it */
+  __DSB();
+
+  fence = Dma2dHead + 1;
+  Dma2dQueue[fence % DMA2D_QUEUE_DEPTH] = *pCmd;
+  Dma2dHead = fence;
+
+  if(Dma2dState == DMA2D_STATE_IDLE)
+  {
+    DMA2D_StartNext();
+  }
+  __set_PRIMASK(primask);
+
+  return fence;
+}
+
+/**
+  * @brief  Programs the DMA2D with the oldest pending command.
+  * @note   Called with interrupts masked or from the DMA2D interrupt.
+  */
+static void DMA2D_StartNext(void)
+{
+  DMA2D_CommandTypeDef *cmd;
+  uint32_t mode;
+
+  if(Dma2dTail == Dma2dHead)
+  {
+    Dma2dState = DMA2D_STATE_IDLE;
+    return;
+  }
+
+  cmd  = &Dma2dQueue[(Dma2dTail + 1) % DMA2D_QUEUE_DEPTH];
+  mode = cmd->CR & DMA2D_CR_MODE;
+
+  /* Load the foreground CLUT if it is not the one already in the DMA2D */
+  if((cmd->FGCMAR != 0) && ((cmd->FGCMAR != FgClutAddress) || ((cmd->FGPFCCR & DMA2D_PFCCR_CLUT_MASK) != FgClutLayout)))
+  {
+    FgClutAddress = cmd->FGCMAR;
+    FgClutLayout  = cmd->FGPFCCR & DMA2D_PFCCR_CLUT_MASK;
+    DMA2D->CR      = DMA2D_CR_CTCIE | DMA2D_CR_IT_ERRORS;
+    DMA2D->FGCMAR  = cmd->FGCMAR;
+    DMA2D->FGPFCCR = cmd->FGPFCCR | DMA2D_FGPFCCR_START;
+    Dma2dState = DMA2D_STATE_FG_CLUT;
+    return;
+  }
+
+  /* Same for the background CLUT */
+  if((cmd->BGCMAR != 0) && ((cmd->BGCMAR != BgClutAddress) || ((cmd->BGPFCCR & DMA2D_PFCCR_CLUT_MASK) != BgClutLayout)))
+  {
+    BgClutAddress = cmd->BGCMAR;
+    BgClutLayout  = cmd->BGPFCCR & DMA2D_PFCCR_CLUT_MASK;
+    DMA2D->CR      = DMA2D_CR_CTCIE | DMA2D_CR_IT_ERRORS;
+    DMA2D->BGCMAR  = cmd->BGCMAR;
+    DMA2D->BGPFCCR = cmd->BGPFCCR | DMA2D_BGPFCCR_START;
+    Dma2dState = DMA2D_STATE_BG_CLUT;
+    return;
+  }
+
+  DMA2D->OPFCCR = cmd->OPFCCR;
+  DMA2D->OMAR   = cmd->OMAR;
+  DMA2D->OOR    = cmd->OOR;
+  DMA2D->NLR    = cmd->NLR;
+
+  if(mode == DMA2D_R2M)
+  {
+    DMA2D->OCOLR = cmd->OCOLR;
+  }
+  else
+  {
+    DMA2D->FGMAR   = cmd->FGMAR;
+    DMA2D->FGOR    = cmd->FGOR;
+    DMA2D->FGPFCCR = cmd->FGPFCCR;
+    DMA2D->FGCOLR  = cmd->FGCOLR;
+
+    if(mode == DMA2D_M2M_BLEND)
+    {
+      DMA2D->BGMAR   = cmd->BGMAR;
+      DMA2D->BGOR    = cmd->BGOR;
+      DMA2D->BGPFCCR = cmd->BGPFCCR;
+      DMA2D->BGCOLR  = cmd->BGCOLR;
+    }
+  }
+
+  Dma2dState = DMA2D_STATE_TRANSFER;
+  DMA2D->CR  = cmd->CR | DMA2D_CR_TCIE | DMA2D_CR_IT_ERRORS | DMA2D_CR_START;
+}
+
+/**
+  * @brief  Encodes a source image into the DMA2D layer registers values.
+  * @param  pLayer: source image
+  * @param  pMAR: memory address register value
+  * @param  pOR: offset register value
+  * @param  pPFCCR: PFC control register value
+  * @param  pCOLR: color register value
+  * @param  pCMAR: CLUT address, 0 when the input is not indexed
+  */
+static void DMA2D_EncodeLayer(const DMA2D_LayerTypeDef *pLayer, uint32_t *pMAR, uint32_t *pOR, uint32_t *pPFCCR, uint32_t *pCOLR, uint32_t *pCMAR)
+{
+  *pMAR   = pLayer->Address;
+  *pOR    = pLayer->Offset;
+  *pPFCCR = pLayer->ColorMode | (pLayer->AlphaMode << DMA2D_PFCCR_AM_SHIFT) | (pLayer->Color & 0xFF000000);
+  *pCOLR  = pLayer->Color & 0x00FFFFFF;
+  *pCMAR  = 0;
+
+  if((pLayer->CLUTAddress != 0) && (pLayer->CLUTSize != 0))
+  {
+    *pPFCCR |= (pLayer->CLUTColorMode << DMA2D_PFCCR_CCM_SHIFT) | ((pLayer->CLUTSize - 1) << DMA2D_PFCCR_CS_SHIFT);
+    *pCMAR   = pLayer->CLUTAddress;
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_dma2d.h
+  * @brief   This file contains all the functions prototypes for the
+  *          stm32f429i_discovery_dma2d.c driver.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F429I_DISCOVERY_DMA2D_H
+#define __STM32F429I_DISCOVERY_DMA2D_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY_DMA2D
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_DMA2D_Exported_Types STM32F429I DISCOVERY DMA2D Exported Types
+  * @{
+  */
+
+/**
+  * @brief  Sequence number of a queued DMA2D command. A fence is reached once
+  *         the command and every command queued before it has completed.
+  */
+typedef uint32_t DMA2D_FenceTypeDef;
+
+/**
+  * @brief  Source (foreground or background) image description
+  */
+typedef struct
+{
+  uint32_t Address;        /*!< Address of the first pixel                              */
+  uint32_t Offset;         /*!< Pixels skipped at the end of each line                  */
+  uint32_t ColorMode;      /*!< Input color mode, CM_ARGB8888 ... CM_A4                 */
+  uint32_t AlphaMode;      /*!< DMA2D_NO_MODIF_ALPHA, DMA2D_REPLACE_ALPHA or
+                                DMA2D_COMBINE_ALPHA                                     */
+  uint32_t Color;          /*!< ARGB8888 constant alpha, and RGB used by A8/A4 inputs   */
+  uint32_t CLUTAddress;    /*!< CLUT address for L8/AL44/AL88/L4 inputs, 0 otherwise    */
+  uint32_t CLUTColorMode;  /*!< CLUT format: 0 for ARGB8888, 1 for RGB888               */
+  uint32_t CLUTSize;       /*!< Number of CLUT entries (1 to 256)                       */
+}DMA2D_LayerTypeDef;
+
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_DMA2D_Exported_Constants STM32F429I DISCOVERY DMA2D Exported Constants
+  * @{
+  */
+
+/**
+  * @brief  Number of commands that can be pending at the same time. A submit
+  *         on a full queue waits for the oldest command to complete.
+  *         Must be a power of 2.
+  */
+#ifndef DMA2D_QUEUE_DEPTH
+ #define DMA2D_QUEUE_DEPTH                 16
+#endif /* DMA2D_QUEUE_DEPTH */
+
+#define DMA2D_IRQ_PREPRIO                  0x0E
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_DMA2D_Exported_Functions STM32F429I DISCOVERY DMA2D Exported Functions
+  * @{
+  */
+void               BSP_DMA2D_Init(void);
+
+/* Command submission: all functions return without waiting for the transfer */
+DMA2D_FenceTypeDef BSP_DMA2D_Fill(uint32_t DstAddress, uint32_t DstOffset, uint32_t DstColorMode, uint32_t Width, uint32_t Height, uint32_t Color);
+DMA2D_FenceTypeDef BSP_DMA2D_Copy(uint32_t SrcAddress, uint32_t SrcOffset, uint32_t DstAddress, uint32_t DstOffset, uint32_t ColorMode, uint32_t Width, uint32_t Height);
+DMA2D_FenceTypeDef BSP_DMA2D_Convert(const DMA2D_LayerTypeDef *pFg, uint32_t DstAddress, uint32_t DstOffset, uint32_t DstColorMode, uint32_t Width, uint32_t Height);
+DMA2D_FenceTypeDef BSP_DMA2D_Blend(const DMA2D_LayerTypeDef *pFg, const DMA2D_LayerTypeDef *pBg, uint32_t DstAddress, uint32_t DstOffset, uint32_t DstColorMode, uint32_t Width, uint32_t Height);
+
+/* Synchronisation */
+DMA2D_FenceTypeDef BSP_DMA2D_GetLastFence(void);
+uint8_t            BSP_DMA2D_IsComplete(DMA2D_FenceTypeDef Fence);
+void               BSP_DMA2D_Wait(DMA2D_FenceTypeDef Fence);
+uint8_t            BSP_DMA2D_IsIdle(void);
+void               BSP_DMA2D_WaitIdle(void);
+uint32_t           BSP_DMA2D_GetErrorCount(void);
+void               BSP_DMA2D_InvalidateCLUT(void);
+uint32_t           BSP_DMA2D_EncodeColor(uint32_t Color, uint32_t ColorMode);
+
+void               BSP_DMA2D_IRQHandler(void);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F429I_DISCOVERY_DMA2D_H */
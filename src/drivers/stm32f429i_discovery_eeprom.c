@@ -26,17 +26,21 @@
   *          by just adapting the defines for hardware resources and 
   *          EEPROM_IO_Init() function. 
   *        
-  *          @note In this driver, basic read and write functions (BSP_EEPROM_ReadBuffer() 
-  *                and BSP_EEPROM_WritePage()) use DMA mode to perform the data 
-  *                transfer to/from EEPROM memory.
+  *          @note In this driver, reads and writes are requests queued with
+  *                BSP_EEPROM_Submit(). They run from the I2C interrupts, one
+  *                after the other: a read is split in DMA transfers of
+  *                EEPROM_READ_CHUNK bytes, a write is split in page writes,
+  *                each followed by the acknowledge polling of the write
+  *                cycle. Each transfer is queued on the bus after the IO
+  *                expander transfers waiting, which never wait for more than
+  *                one of them. A page is filled from the
+  *                following queued writes when they start where the previous
+  *                one ends, so that small contiguous writes share write cycles.
+  *                The caller learns the end of a request from its callback.
   *
-  *         @note   Regarding BSP_EEPROM_WritePage(), it is a optimized function to perform
-  *                small write (less than 1 page) BUT The number of bytes (combined to write start address) must not 
-  *                cross the EEPROM page boundary. This function can only write into
-  *                the boundaries of an EEPROM page.
-  *                This function doesn't check on boundaries condition (in this driver 
-  *                the function BSP_EEPROM_WriteBuffer() which calls BSP_EEPROM_WritePage() is 
-  *                responsible of checking on Page boundaries).
+  *         @note   BSP_EEPROM_ReadBuffer(), BSP_EEPROM_WritePage() and
+  *                BSP_EEPROM_WriteBuffer() submit a request and spin until it
+  *                completes; threads should rather sleep until the callback.
   * 
   *             
   *     +-----------------------------------------------------------------+
@@ -126,9 +130,12 @@
   * @{
   */
 __IO uint16_t  EEPROMAddress = 0;
-__IO uint32_t  EEPROMTimeout = EEPROM_READ_TIMEOUT;
-__IO uint16_t  EEPROMDataRead;
-__IO uint8_t   EEPROMDataWrite;
+
+static EEPROM_RequestTypeDef      *EepromHead;   /* Running request */
+static EEPROM_RequestTypeDef      *EepromTail;
+static uint8_t                     EepromBusy;
+static I2C_BUS_TransactionTypeDef  EepromTransaction;
+static uint8_t                     EepromPage[EEPROM_PAGESIZE];
 
 /**
   * @}
@@ -137,6 +144,11 @@ __IO uint8_t   EEPROMDataWrite;
 /** @defgroup STM32F429I_DISCOVERY_EEPROM_Private_Function_Prototypes STM32F429I DISCOVERY EEPROM Private Function Prototypes
   * @{
   */ 
+static void EEPROM_Start(void);
+static void EEPROM_FillPage(void);
+static void EEPROM_Commit(uint16_t Length);
+static void EEPROM_Complete(uint8_t State);
+static void EEPROM_TransactionCallback(I2C_BUS_TransactionTypeDef *pTransaction);
 /**
   * @}
   */ 
@@ -181,37 +193,29 @@ uint32_t BSP_EEPROM_Init(void)
   *         be read from the EEPROM.
   * 
   *        @note The variable pointed by NumByteToRead is reset to 0 when all the 
-  *              data are read from the EEPROM. Application should monitor this 
-  *              variable in order know when the transfer is complete.
+  *              data are read from the EEPROM, which is when this function
+  *              returns EEPROM_OK.
   * 
   * @retval EEPROM_OK (0) if operation is correctly performed, else return value 
-  *         different from EEPROM_OK (0) or the timeout user callback.
+  *         different from EEPROM_OK (0).
   */
 uint32_t BSP_EEPROM_ReadBuffer(uint8_t *pBuffer, uint16_t ReadAddr, uint16_t *NumByteToRead)
 {  
-  uint32_t buffersize = *NumByteToRead;
-  
-  /* Set the pointer to the Number of data to be read. This pointer will be used 
-  by the DMA Transfer Completer interrupt Handler in order to reset the 
-  variable to 0. User should check on this variable in order to know if the 
-  DMA transfer has been complete or not. */
-  EEPROMDataRead = *NumByteToRead;
-  
-  if (EEPROM_IO_ReadData(EEPROMAddress, ReadAddr, pBuffer, buffersize) != HAL_OK)
-  {
-    return EEPROM_FAIL;
-  }
+  EEPROM_RequestTypeDef request;
 
-  /* Wait transfer through DMA to be complete */
-  EEPROMTimeout = HAL_GetTick() + EEPROM_READ_TIMEOUT;
-  while (EEPROMDataRead > 0)
+  request.Type      = EEPROM_REQUEST_READ;
+  request.Address   = ReadAddr;
+  request.pBuffer   = pBuffer;
+  request.Length    = *NumByteToRead;
+  request.pCallback = NULL;
+  request.pContext  = NULL;
+  BSP_EEPROM_Submit(&request);
+
+  if (BSP_EEPROM_Wait(&request) != EEPROM_OK)
   {
-    if(HAL_GetTick() > EEPROMTimeout)
-    {
-      BSP_EEPROM_TIMEOUT_UserCallback();
-      return EEPROM_TIMEOUT;
-    }
+    return EEPROM_FAIL;
   }
+  *NumByteToRead = 0;
   
   /* If all operations OK, return EEPROM_OK (0) */
   return EEPROM_OK;
@@ -220,12 +224,9 @@ uint32_t BSP_EEPROM_ReadBuffer(uint8_t *pBuffer, uint16_t ReadAddr, uint16_t *Nu
 /**
   * @brief  Writes more than one byte to the EEPROM with a single WRITE cycle.
   *
-  * @note   The number of bytes (combined to write start address) must not 
-  *         cross the EEPROM page boundary. This function can only write into
-  *         the boundaries of an EEPROM page.
-  *         This function doesn't check on boundaries condition (in this driver 
-  *         the function BSP_EEPROM_WriteBuffer() which calls BSP_EEPROM_WritePage() is 
-  *         responsible of checking on Page boundaries).
+  * @note   The number of bytes (combined to write start address) should not 
+  *         cross the EEPROM page boundary. If they do, the request is split
+  *         in two write cycles like any other.
   * 
   * @param  pBuffer : pointer to the buffer containing the data to be written to 
   *         the EEPROM.
@@ -234,49 +235,24 @@ uint32_t BSP_EEPROM_ReadBuffer(uint8_t *pBuffer, uint16_t ReadAddr, uint16_t *Nu
   *         be written into the EEPROM. 
   * 
   *        @note The variable pointed by NumByteToWrite is reset to 0 when all the 
-  *              data are written to the EEPROM. Application should monitor this 
-  *              variable in order know when the transfer is complete.
-  * 
-  * @note This function just configure the communication and enable the DMA 
-  *       channel to transfer data. Meanwhile, the user application may perform 
-  *       other tasks in parallel.
+  *              data are written to the EEPROM, which is when this function
+  *              returns EEPROM_OK.
   * 
   * @retval EEPROM_OK (0) if operation is correctly performed, else return value 
   *         different from EEPROM_OK (0) or the timeout user callback.
   */
 uint32_t BSP_EEPROM_WritePage(uint8_t *pBuffer, uint16_t WriteAddr, uint8_t *NumByteToWrite)
 { 
-  uint32_t buffersize = *NumByteToWrite;
-  uint32_t status = EEPROM_OK;
-  /* Set the pointer to the Number of data to be written. This pointer will be used 
-      by the DMA Transfer Completer interrupt Handler in order to reset the 
-      variable to 0. User should check on this variable in order to know if the 
-      DMA transfer has been complete or not. */
-  EEPROMDataWrite = *NumByteToWrite;  
-  
-  if (EEPROM_IO_WriteData(EEPROMAddress, WriteAddr, pBuffer, buffersize) != HAL_OK)
-  {
-    status = EEPROM_FAIL;
-  }
+  uint16_t buffersize = *NumByteToWrite;
   
-  /* Wait transfer through DMA to be complete */
-  EEPROMTimeout = HAL_GetTick() + EEPROM_WRITE_TIMEOUT;
-  while (EEPROMDataWrite > 0)
-  {
-    if(HAL_GetTick() > EEPROMTimeout)
-    {
-      BSP_EEPROM_TIMEOUT_UserCallback();
-      return EEPROM_TIMEOUT;
-    }
-  }
-  
-  if (BSP_EEPROM_WaitEepromStandbyState() != EEPROM_OK) 
+  if (BSP_EEPROM_WriteBuffer(pBuffer, WriteAddr, buffersize) != EEPROM_OK)
   {
     return EEPROM_FAIL;
   }
+  *NumByteToWrite = 0;
   
   /* If all operations OK, return EEPROM_OK (0) */
-  return status;
+  return EEPROM_OK;
 }
 
 /**
@@ -290,146 +266,66 @@ uint32_t BSP_EEPROM_WritePage(uint8_t *pBuffer, uint16_t WriteAddr, uint8_t *Num
   */
 uint32_t BSP_EEPROM_WriteBuffer(uint8_t *pBuffer, uint16_t WriteAddr, uint16_t NumByteToWrite)
 {
-  uint16_t numofpage = 0, numofsingle = 0, count = 0;
-  uint16_t addr = 0;
-  uint8_t  dataindex = 0;
-  uint32_t status = EEPROM_OK;
-
-  addr = WriteAddr % EEPROM_PAGESIZE;
-  count = EEPROM_PAGESIZE - addr;
-  numofpage =  NumByteToWrite / EEPROM_PAGESIZE;
-  numofsingle = NumByteToWrite % EEPROM_PAGESIZE;
- 
-  /* If WriteAddr is EEPROM_PAGESIZE aligned  */
-  if(addr == 0) 
+  EEPROM_RequestTypeDef request;
+
+  /* The page boundaries are handled by the request queue */
+  request.Type      = EEPROM_REQUEST_WRITE;
+  request.Address   = WriteAddr;
+  request.pBuffer   = pBuffer;
+  request.Length    = NumByteToWrite;
+  request.pCallback = NULL;
+  request.pContext  = NULL;
+  BSP_EEPROM_Submit(&request);
+
+  return BSP_EEPROM_Wait(&request);
+}
+
+/**
+  * @brief  Queues a read or write request, started at once if the EEPROM is
+  *         idle. Returns without waiting.
+  * @note   May be called from interrupt context, including from a request
+  *         callback. BSP_EEPROM_Init() must have found the EEPROM.
+  * @param  pRequest : request, with its buffer, must stay valid until it
+  *         completes
+  */
+void BSP_EEPROM_Submit(EEPROM_RequestTypeDef *pRequest)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  pRequest->State = EEPROM_REQUEST_QUEUED;
+  pRequest->Done  = 0;
+  pRequest->pNext = NULL;
+
+  __disable_irq();
+  if(EepromTail == NULL)
   {
-    /* If NumByteToWrite < EEPROM_PAGESIZE */
-    if(numofpage == 0) 
-    {
-      /* Store the number of data to be written */
-      dataindex = numofsingle;
-      /* Start writing data */
-      status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-      if (status != EEPROM_OK)
-      {
-        return status;
-      }
-    }
-    /* If NumByteToWrite > EEPROM_PAGESIZE */
-    else  
-    {
-      while(numofpage--)
-      {
-        /* Store the number of data to be written */
-        dataindex = EEPROM_PAGESIZE;        
-        status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-        if (status != EEPROM_OK)
-        {
-          return status;
-        }
-        
-        WriteAddr +=  EEPROM_PAGESIZE;
-        pBuffer += EEPROM_PAGESIZE;
-      }
-      
-      if(numofsingle!=0)
-      {
-        /* Store the number of data to be written */
-        dataindex = numofsingle;          
-        status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-        if (status != EEPROM_OK)
-        {
-          return status;
-        }
-      }
-    }
+    EepromHead = pRequest;
   }
-  /* If WriteAddr is not EEPROM_PAGESIZE aligned */
-  else 
+  else
   {
-    /* If NumByteToWrite < EEPROM_PAGESIZE */
-    if(numofpage== 0) 
-    {
-      /* If the number of data to be written is more than the remaining space 
-      in the current page: */
-      if (NumByteToWrite > count)
-      {
-        /* Store the number of data to be written */
-        dataindex = count;        
-        /* Write the data contained in same page */
-        status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-        if (status != EEPROM_OK)
-        {
-          return status;
-        }
-        
-        /* Store the number of data to be written */
-        dataindex = (NumByteToWrite - count);          
-        /* Write the remaining data in the following page */
-        status = BSP_EEPROM_WritePage((uint8_t*)(pBuffer + count), (WriteAddr + count), (uint8_t*)(&dataindex));
-        if (status != EEPROM_OK)
-        {
-          return status;
-        }
-      }      
-      else      
-      {
-        /* Store the number of data to be written */
-        dataindex = numofsingle;         
-        status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-        if (status != EEPROM_OK)
-        {
-          return status;
-        }
-      }     
-    }
-    /* If NumByteToWrite > EEPROM_PAGESIZE */
-    else
-    {
-      NumByteToWrite -= count;
-      numofpage =  NumByteToWrite / EEPROM_PAGESIZE;
-      numofsingle = NumByteToWrite % EEPROM_PAGESIZE;
-      
-      if(count != 0)
-      {  
-        /* Store the number of data to be written */
-        dataindex = count;         
-        status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-        if (status != EEPROM_OK)
-        {
-          return status;
-        }
-        WriteAddr += count;
-        pBuffer += count;
-      } 
-      
-      while(numofpage--)
-      {
-        /* Store the number of data to be written */
-        dataindex = EEPROM_PAGESIZE;          
-        status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-        if (status != EEPROM_OK)
-        {
-          return status;
-        }
-        WriteAddr +=  EEPROM_PAGESIZE;
-        pBuffer += EEPROM_PAGESIZE;  
-      }
-      if(numofsingle != 0)
-      {
-        /* Store the number of data to be written */
-        dataindex = numofsingle;           
-        status = BSP_EEPROM_WritePage(pBuffer, WriteAddr, (uint8_t*)(&dataindex));
-        if (status != EEPROM_OK)
-        {
-          return status;
-        }
-      }
-    }
-  }  
-                                   
-  /* If all operations OK, return EEPROM_OK (0) */
-  return EEPROM_OK;
+    EepromTail->pNext = pRequest;
+  }
+  EepromTail = pRequest;
+
+  if(!EepromBusy)
+  {
+    EepromBusy = 1;
+    EEPROM_Start();
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Spins until a request completes.
+  * @param  pRequest : submitted request
+  * @retval EEPROM_OK (0) if the request is done, else EEPROM_FAIL
+  */
+uint32_t BSP_EEPROM_Wait(EEPROM_RequestTypeDef *pRequest)
+{
+  while(pRequest->State < EEPROM_REQUEST_DONE)
+  {
+  }
+  return (pRequest->State == EEPROM_REQUEST_DONE) ? EEPROM_OK : EEPROM_FAIL;
 }
 
 /**
@@ -458,28 +354,168 @@ uint32_t BSP_EEPROM_WaitEepromStandbyState(void)
 }
 
 /**
-  * @brief  Memory Tx Transfer completed callbacks.
-  * @param  hi2c: I2C handle
+  * @brief  Basic management of the timeout situation.
   */
-void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+__weak void BSP_EEPROM_TIMEOUT_UserCallback(void)
 {
-  EEPROMDataWrite = 0;  
 }
 
 /**
-  * @brief  Memory Rx Transfer completed callbacks.
-  * @param  hi2c: I2C handle
+  * @brief  Starts the transfer of the oldest request, interrupts disabled.
   */
-void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+static void EEPROM_Start(void)
 {
-  EEPROMDataRead = 0;
+  EEPROM_RequestTypeDef *request;
+
+  while(1)
+  {
+    request = EepromHead;
+    if(request == NULL)
+    {
+      EepromBusy = 0;
+      return;
+    }
+    if(request->Done < request->Length)
+    {
+      break;
+    }
+    EEPROM_Complete(EEPROM_REQUEST_DONE);
+  }
+
+  request->State = EEPROM_REQUEST_RUNNING;
+  EepromTransaction.DevAddress = EEPROMAddress;
+  EepromTransaction.Trials     = 0;
+  EepromTransaction.pCallback  = EEPROM_TransactionCallback;
+  EepromTransaction.pContext   = NULL;
+
+  if(request->Type == EEPROM_REQUEST_READ)
+  {
+    /* The rest is queued again once this part is read */
+    EepromTransaction.Type       = I2C_BUS_READ;
+    EepromTransaction.MemAddress = request->Address + request->Done;
+    EepromTransaction.pData      = request->pBuffer + request->Done;
+    EepromTransaction.Length     = request->Length - request->Done;
+    if(EepromTransaction.Length > EEPROM_READ_CHUNK)
+    {
+      EepromTransaction.Length = EEPROM_READ_CHUNK;
+    }
+  }
+  else
+  {
+    EEPROM_FillPage();
+  }
+  EEPROM_IO_Submit(&EepromTransaction);
 }
 
 /**
-  * @brief  Basic management of the timeout situation.
+  * @brief  Prepares the write of the rest of the page at the current write
+  *         address, from the current request then from the queued writes
+  *         that follow on in the EEPROM.
   */
-__weak void BSP_EEPROM_TIMEOUT_UserCallback(void)
+static void EEPROM_FillPage(void)
+{
+  EEPROM_RequestTypeDef *request = EepromHead;
+  uint16_t address = request->Address + request->Done;
+  uint16_t room = EEPROM_PAGESIZE - (address % EEPROM_PAGESIZE);
+  uint16_t offset = request->Done, length = 0;
+
+  while(length < room)
+  {
+    if(offset == request->Length)
+    {
+      request = request->pNext;
+      if((request == NULL) || (request->Type != EEPROM_REQUEST_WRITE) || (request->Address != (uint16_t)(address + length)))
+      {
+        break;
+      }
+      offset = 0;
+      continue;
+    }
+    EepromPage[length++] = request->pBuffer[offset++];
+  }
+
+  EepromTransaction.Type       = I2C_BUS_WRITE;
+  EepromTransaction.MemAddress = address;
+  EepromTransaction.pData      = EepromPage;
+  EepromTransaction.Length     = length;
+}
+
+/**
+  * @brief  Accounts the bytes of a transfer to the requests they came from.
+  */
+static void EEPROM_Commit(uint16_t Length)
 {
+  EEPROM_RequestTypeDef *request;
+  uint16_t count;
+
+  while(Length > 0)
+  {
+    request = EepromHead;
+    count = request->Length - request->Done;
+    if(count > Length)
+    {
+      count = Length;
+    }
+    request->Done += count;
+    Length -= count;
+    if(request->Done == request->Length)
+    {
+      EEPROM_Complete(EEPROM_REQUEST_DONE);
+    }
+  }
+}
+
+/**
+  * @brief  Ends the oldest request.
+  */
+static void EEPROM_Complete(uint8_t State)
+{
+  EEPROM_RequestTypeDef *request = EepromHead;
+
+  EepromHead = request->pNext;
+  if(EepromHead == NULL)
+  {
+    EepromTail = NULL;
+  }
+  /* Removed first, the callback may submit it again */
+  request->State = State;
+  if(request->pCallback != NULL)
+  {
+    request->pCallback(request);
+  }
+}
+
+/**
+  * @brief  I2C transaction completed: after a page write, polls for the end
+  *         of the write cycle; after a read or a poll, moves on.
+  */
+static void EEPROM_TransactionCallback(I2C_BUS_TransactionTypeDef *pTransaction)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if(pTransaction->State != I2C_BUS_DONE)
+  {
+    if(pTransaction->Type == I2C_BUS_POLL)
+    {
+      BSP_EEPROM_TIMEOUT_UserCallback();
+    }
+    EEPROM_Complete(EEPROM_REQUEST_ERROR);
+    EEPROM_Start();
+  }
+  else if(pTransaction->Type == I2C_BUS_WRITE)
+  {
+    /* Same page length, the bus does not look at it when polling */
+    pTransaction->Type   = I2C_BUS_POLL;
+    pTransaction->Trials = EEPROM_MAX_TRIALS;
+    EEPROM_IO_Submit(pTransaction);
+  }
+  else
+  {
+    EEPROM_Commit(pTransaction->Length);
+    EEPROM_Start();
+  }
+  __set_PRIMASK(primask);
 }
 
 #endif /* EE_M24LR64 */
@@ -44,6 +44,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f429i_discovery.h"
+#include "stm32f429i_discovery_i2c.h"
 
 /** @addtogroup BSP
   * @{
@@ -60,6 +61,26 @@
 /** @defgroup STM32F429I_DISCOVERY_EEPROM_Exported_Types STM32F429I DISCOVERY EEPROM Exported Types
   * @{
   */ 
+/**
+  * @brief  One read or write of any length and address. Owned by the driver
+  *         from BSP_EEPROM_Submit() until its State is EEPROM_REQUEST_DONE or
+  *         EEPROM_REQUEST_ERROR.
+  */
+typedef struct EEPROM_Request
+{
+  uint8_t          Type;            /*!< EEPROM_REQUEST_READ or EEPROM_REQUEST_WRITE           */
+  uint16_t         Address;         /*!< First EEPROM address                                  */
+  uint8_t         *pBuffer;
+  uint16_t         Length;
+  void           (*pCallback)(struct EEPROM_Request *pRequest); /*!< From the interrupt, at
+                                         completion, may be NULL                               */
+  void            *pContext;        /*!< Free for the callback                                 */
+
+  /* Driver state */
+  volatile uint8_t State;
+  uint16_t         Done;            /*!< Bytes read, or written and programmed                 */
+  struct EEPROM_Request *pNext;
+}EEPROM_RequestTypeDef;
 /**
   * @}
   */
@@ -86,6 +107,14 @@ This timeout is based on systick set to 1ms*/
 #define EEPROM_OK                   0
 #define EEPROM_FAIL                 1
 #define EEPROM_TIMEOUT              2
+
+#define EEPROM_REQUEST_READ         0
+#define EEPROM_REQUEST_WRITE        1
+
+#define EEPROM_REQUEST_QUEUED       0
+#define EEPROM_REQUEST_RUNNING      1
+#define EEPROM_REQUEST_DONE         2
+#define EEPROM_REQUEST_ERROR        3
 /**
   * @}
   */ 
@@ -105,6 +134,8 @@ uint32_t BSP_EEPROM_ReadBuffer(uint8_t *pBuffer, uint16_t ReadAddr, uint16_t *Nu
 uint32_t BSP_EEPROM_WritePage(uint8_t *pBuffer, uint16_t WriteAddr, uint8_t *NumByteToWrite);
 uint32_t BSP_EEPROM_WriteBuffer(uint8_t *pBuffer, uint16_t WriteAddr, uint16_t NumByteToWrite);
 uint32_t BSP_EEPROM_WaitEepromStandbyState(void);
+void     BSP_EEPROM_Submit(EEPROM_RequestTypeDef *pRequest);
+uint32_t BSP_EEPROM_Wait(EEPROM_RequestTypeDef *pRequest);
 
 /* USER Callbacks: This function is declared as __weak in EEPROM driver and 
    should be implemented into user application.  
@@ -119,6 +150,7 @@ void              EEPROM_IO_Init(void);
 HAL_StatusTypeDef EEPROM_IO_WriteData(uint16_t DevAddress, uint16_t MemAddress, uint8_t *pBuffer, uint32_t BufferSize);
 HAL_StatusTypeDef EEPROM_IO_ReadData(uint16_t DevAddress, uint16_t MemAddress, uint8_t *pBuffer, uint32_t BufferSize);
 HAL_StatusTypeDef EEPROM_IO_IsDeviceReady(uint16_t DevAddress, uint32_t Trials);
+void              EEPROM_IO_Submit(I2C_BUS_TransactionTypeDef *pTransaction);
 
 #ifdef __cplusplus
 }
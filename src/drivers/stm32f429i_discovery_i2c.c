@@ -0,0 +1,420 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_i2c.c
+  * @brief   This file provides the transaction scheduler of the I2C3 bus
+  *          shared by the STMPE811 IO expander and the M24LR64 EEPROM.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this driver:
+--------------------------
+   - I2Cx_Init() calls BSP_I2C_BUS_Init() once the I2C is configured. Nothing
+     else may start I2C3 transfers afterwards.
+   - Fill a transaction and BSP_I2C_BUS_Submit() it, then BSP_I2C_BUS_Wait()
+     for it or let its callback run. BSP_I2C_BUS_Read(), BSP_I2C_BUS_Write()
+     and BSP_I2C_BUS_Poll() do both.
+
+2. Driver description:
+---------------------
+   - Transactions wait in one FIFO list per priority. The next one is always
+     taken from the highest priority list and runs from the interrupts:
+     transfers of I2C_BUS_DMA_MIN_LENGTH bytes or more use the DMA streams
+     linked to the I2C handle, shorter ones the I2C interrupts.
+   - An I2C_BUS_POLL transaction addresses the device until it acknowledges,
+     as the EEPROM does once its write cycle is over. A not acknowledged
+     attempt goes back to the head of its list: the higher priority
+     transactions queued in the meantime run first, the lower and equal ones
+     wait for the polling to end. No attempt blocks the CPU.
+   - A running transfer is never cut: the longest low priority transfer
+     bounds the wait of a high priority one, hence the EEPROM reads of
+     EEPROM_READ_CHUNK bytes at most.
+   - A bus error resets the I2C peripheral and fails the transaction.
+   - BSP_I2C_BUS_Submit() may be called from interrupt context, including
+     from a completion callback. BSP_I2C_BUS_Wait() may not.
+   - The HAL I2C completion and error callbacks are defined here, the mbed
+     asynchronous I2C API must be removed from the target (mbed_app.json).
+
+------------------------------------------------------------------------------*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery_i2c.h"
+#include "stm32f429i_discovery.h"
+#include "cmsis_nvic.h" // Added for mbed
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_I2C STM32F429I DISCOVERY I2C
+  * @brief This file includes the I2C bus scheduler
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_I2C_Private_Variables STM32F429I DISCOVERY I2C Private Variables
+  * @{
+  */
+static I2C_HandleTypeDef           *I2cBusHandle;
+static I2C_BUS_TransactionTypeDef  *I2cBusHead[I2C_BUS_PRIORITIES];
+static I2C_BUS_TransactionTypeDef  *I2cBusTail[I2C_BUS_PRIORITIES];
+static I2C_BUS_TransactionTypeDef  *I2cBusCurrent;
+static volatile uint32_t            I2cBusErrors;
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_I2C_Private_FunctionPrototypes STM32F429I DISCOVERY I2C Private FunctionPrototypes
+  * @{
+  */
+static void    I2C_BUS_StartNext(void);
+static void    I2C_BUS_Run(I2C_BUS_TransactionTypeDef *pTransaction);
+static void    I2C_BUS_Complete(uint8_t State);
+static uint8_t I2C_BUS_Transfer(uint8_t Type, uint8_t Priority, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Length, uint16_t Trials);
+static void    I2C_BUS_EventIRQHandler(void);
+static void    I2C_BUS_ErrorIRQHandler(void);
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_I2C_Private_Functions STM32F429I DISCOVERY I2C Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Takes the bus over: I2C event and error interrupts.
+  * @param  hi2c: I2C handle, initialized, DMA streams linked
+  */
+void BSP_I2C_BUS_Init(I2C_HandleTypeDef *hi2c)
+{
+  I2cBusHandle = hi2c;
+
+  NVIC_SetVector(DISCOVERY_I2Cx_EV_IRQn, (uint32_t)I2C_BUS_EventIRQHandler);
+  NVIC_SetPriority(DISCOVERY_I2Cx_EV_IRQn, I2C_BUS_IRQ_PREPRIO);
+  NVIC_EnableIRQ(DISCOVERY_I2Cx_EV_IRQn);
+  NVIC_SetVector(DISCOVERY_I2Cx_ER_IRQn, (uint32_t)I2C_BUS_ErrorIRQHandler);
+  NVIC_SetPriority(DISCOVERY_I2Cx_ER_IRQn, I2C_BUS_IRQ_PREPRIO);
+  NVIC_EnableIRQ(DISCOVERY_I2Cx_ER_IRQn);
+}
+
+/**
+  * @brief  Queues a transaction, started at once if the bus is free.
+  * @param  pTransaction: transaction, must stay valid until it completes
+  */
+void BSP_I2C_BUS_Submit(I2C_BUS_TransactionTypeDef *pTransaction)
+{
+  uint8_t priority = pTransaction->Priority;
+  uint32_t primask = __get_PRIMASK();
+
+  pTransaction->State    = I2C_BUS_QUEUED;
+  pTransaction->Attempts = 0;
+  pTransaction->pNext    = NULL;
+
+  __disable_irq();
+  if(I2cBusTail[priority] == NULL)
+  {
+    I2cBusHead[priority] = pTransaction;
+  }
+  else
+  {
+    I2cBusTail[priority]->pNext = pTransaction;
+  }
+  I2cBusTail[priority] = pTransaction;
+
+  if(I2cBusCurrent == NULL)
+  {
+    I2C_BUS_StartNext();
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Waits for a transaction to complete.
+  * @param  pTransaction: submitted transaction
+  * @retval I2C_BUS_DONE or I2C_BUS_ERROR
+  */
+uint8_t BSP_I2C_BUS_Wait(I2C_BUS_TransactionTypeDef *pTransaction)
+{
+  while(pTransaction->State < I2C_BUS_DONE)
+  {
+  }
+  return pTransaction->State;
+}
+
+/**
+  * @brief  Reads registers or memory of a device and waits for the data.
+  * @param  Priority: I2C_BUS_PRIORITY_HIGH or I2C_BUS_PRIORITY_LOW
+  * @param  DevAddress: 8 bit device address
+  * @param  MemAddress: first register or memory address
+  * @param  MemAddSize: I2C_MEMADD_SIZE_8BIT or I2C_MEMADD_SIZE_16BIT
+  * @param  pData: bytes read
+  * @param  Length: number of bytes
+  * @retval I2C_BUS_DONE or I2C_BUS_ERROR
+  */
+uint8_t BSP_I2C_BUS_Read(uint8_t Priority, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Length)
+{
+  return I2C_BUS_Transfer(I2C_BUS_READ, Priority, DevAddress, MemAddress, MemAddSize, pData, Length, 0);
+}
+
+/**
+  * @brief  Writes registers or memory of a device and waits for the end of
+  *         the transfer.
+  * @param  Priority: I2C_BUS_PRIORITY_HIGH or I2C_BUS_PRIORITY_LOW
+  * @param  DevAddress: 8 bit device address
+  * @param  MemAddress: first register or memory address
+  * @param  MemAddSize: I2C_MEMADD_SIZE_8BIT or I2C_MEMADD_SIZE_16BIT
+  * @param  pData: bytes written
+  * @param  Length: number of bytes
+  * @retval I2C_BUS_DONE or I2C_BUS_ERROR
+  */
+uint8_t BSP_I2C_BUS_Write(uint8_t Priority, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Length)
+{
+  return I2C_BUS_Transfer(I2C_BUS_WRITE, Priority, DevAddress, MemAddress, MemAddSize, pData, Length, 0);
+}
+
+/**
+  * @brief  Addresses a device until it acknowledges.
+  * @param  Priority: I2C_BUS_PRIORITY_HIGH or I2C_BUS_PRIORITY_LOW
+  * @param  DevAddress: 8 bit device address
+  * @param  Trials: addressings before giving up
+  * @retval I2C_BUS_DONE if the device answered, else I2C_BUS_ERROR
+  */
+uint8_t BSP_I2C_BUS_Poll(uint8_t Priority, uint16_t DevAddress, uint16_t Trials)
+{
+  return I2C_BUS_Transfer(I2C_BUS_POLL, Priority, DevAddress, 0, I2C_MEMADD_SIZE_8BIT, NULL, 0, Trials);
+}
+
+/**
+  * @brief  Gets the number of failed transactions since the start.
+  */
+uint32_t BSP_I2C_BUS_GetErrors(void)
+{
+  return I2cBusErrors;
+}
+
+/**
+  * @brief  Memory write completed callback.
+  * @param  hi2c: I2C handle
+  */
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  I2C_BUS_Complete(I2C_BUS_DONE);
+}
+
+/**
+  * @brief  Memory read completed callback.
+  * @param  hi2c: I2C handle
+  */
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  I2C_BUS_Complete(I2C_BUS_DONE);
+}
+
+/**
+  * @brief  Polling acknowledged: the addressing without data is complete.
+  * @param  hi2c: I2C handle
+  */
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  I2C_BUS_Complete(I2C_BUS_DONE);
+}
+
+/**
+  * @brief  Not acknowledged or bus error. The HAL has already sent the stop
+  *         condition and released the handle.
+  * @param  hi2c: I2C handle
+  */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+  I2C_BUS_TransactionTypeDef *transaction = I2cBusCurrent;
+  uint32_t error = HAL_I2C_GetError(hi2c);
+  uint8_t priority;
+
+  if(transaction == NULL)
+  {
+    return;
+  }
+
+  /* Device still busy: try again after the higher priorities */
+  if((transaction->Type == I2C_BUS_POLL) && (error == HAL_I2C_ERROR_AF) && (++transaction->Attempts < transaction->Trials))
+  {
+    priority = transaction->Priority;
+    transaction->State = I2C_BUS_QUEUED;
+    transaction->pNext = I2cBusHead[priority];
+    I2cBusHead[priority] = transaction;
+    if(I2cBusTail[priority] == NULL)
+    {
+      I2cBusTail[priority] = transaction;
+    }
+    I2C_BUS_StartNext();
+    return;
+  }
+
+  if((error & ~HAL_I2C_ERROR_AF) != 0)
+  {
+    /* Re-Initialize the BUS */
+    HAL_I2C_DeInit(hi2c);
+    HAL_I2C_Init(hi2c);
+  }
+  I2cBusErrors++;
+  I2C_BUS_Complete(I2C_BUS_ERROR);
+}
+
+/**
+  * @brief  Queues a transaction and waits for it.
+  */
+static uint8_t I2C_BUS_Transfer(uint8_t Type, uint8_t Priority, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Length, uint16_t Trials)
+{
+  I2C_BUS_TransactionTypeDef transaction;
+
+  transaction.Type       = Type;
+  transaction.Priority   = Priority;
+  transaction.DevAddress = DevAddress;
+  transaction.MemAddress = MemAddress;
+  transaction.MemAddSize = MemAddSize;
+  transaction.pData      = pData;
+  transaction.Length     = Length;
+  transaction.Trials     = Trials;
+  transaction.pCallback  = NULL;
+  transaction.pContext   = NULL;
+  BSP_I2C_BUS_Submit(&transaction);
+
+  return BSP_I2C_BUS_Wait(&transaction);
+}
+
+/**
+  * @brief  Starts the oldest transaction of the highest priority, interrupts
+  *         disabled or from the I2C interrupts.
+  */
+static void I2C_BUS_StartNext(void)
+{
+  I2C_BUS_TransactionTypeDef *next;
+  uint32_t i;
+
+  I2cBusCurrent = NULL;
+  for(i = 0; i < I2C_BUS_PRIORITIES; i++)
+  {
+    next = I2cBusHead[i];
+    if(next != NULL)
+    {
+      I2cBusHead[i] = next->pNext;
+      if(I2cBusHead[i] == NULL)
+      {
+        I2cBusTail[i] = NULL;
+      }
+      I2C_BUS_Run(next);
+      return;
+    }
+  }
+}
+
+/**
+  * @brief  Starts the transfer of a transaction.
+  */
+static void I2C_BUS_Run(I2C_BUS_TransactionTypeDef *pTransaction)
+{
+  HAL_StatusTypeDef status;
+  uint8_t dma = (pTransaction->Length >= I2C_BUS_DMA_MIN_LENGTH);
+
+  I2cBusCurrent = pTransaction;
+  pTransaction->State = I2C_BUS_RUNNING;
+
+  switch(pTransaction->Type)
+  {
+  case I2C_BUS_READ:
+    if(dma)
+    {
+      status = HAL_I2C_Mem_Read_DMA(I2cBusHandle, pTransaction->DevAddress, pTransaction->MemAddress,
+                                    pTransaction->MemAddSize, pTransaction->pData, pTransaction->Length);
+    }
+    else
+    {
+      status = HAL_I2C_Mem_Read_IT(I2cBusHandle, pTransaction->DevAddress, pTransaction->MemAddress,
+                                   pTransaction->MemAddSize, pTransaction->pData, pTransaction->Length);
+    }
+    break;
+
+  case I2C_BUS_WRITE:
+    if(dma)
+    {
+      status = HAL_I2C_Mem_Write_DMA(I2cBusHandle, pTransaction->DevAddress, pTransaction->MemAddress,
+                                     pTransaction->MemAddSize, pTransaction->pData, pTransaction->Length);
+    }
+    else
+    {
+      status = HAL_I2C_Mem_Write_IT(I2cBusHandle, pTransaction->DevAddress, pTransaction->MemAddress,
+                                    pTransaction->MemAddSize, pTransaction->pData, pTransaction->Length);
+    }
+    break;
+
+  default:
+    /* Address only, the HAL sends the stop condition at once */
+    status = HAL_I2C_Master_Transmit_IT(I2cBusHandle, pTransaction->DevAddress, NULL, 0);
+    break;
+  }
+
+  if(status != HAL_OK)
+  {
+    I2cBusErrors++;
+    I2C_BUS_Complete(I2C_BUS_ERROR);
+  }
+}
+
+/**
+  * @brief  Ends the current transaction and starts the next one.
+  */
+static void I2C_BUS_Complete(uint8_t State)
+{
+  I2C_BUS_TransactionTypeDef *transaction = I2cBusCurrent;
+  void (*callback)(I2C_BUS_TransactionTypeDef *);
+
+  if(transaction == NULL)
+  {
+    return;
+  }
+  callback = transaction->pCallback;
+
+  /* The next transaction starts before the callback, which may submit */
+  I2C_BUS_StartNext();
+  transaction->State = State;
+  if(callback != NULL)
+  {
+    callback(transaction);
+  }
+}
+
+/**
+  * @brief  I2C event interrupt.
+  */
+static void I2C_BUS_EventIRQHandler(void)
+{
+  HAL_I2C_EV_IRQHandler(I2cBusHandle);
+}
+
+/**
+  * @brief  I2C error interrupt.
+  */
+static void I2C_BUS_ErrorIRQHandler(void)
+{
+  HAL_I2C_ER_IRQHandler(I2cBusHandle);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
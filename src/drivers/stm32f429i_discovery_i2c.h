@@ -0,0 +1,120 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_i2c.h
+  * @brief   This file contains the common defines and functions prototypes for
+  *          the stm32f429i_discovery_i2c.c driver.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F429I_DISCOVERY_I2C_H
+#define __STM32F429I_DISCOVERY_I2C_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY_I2C
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_I2C_Exported_Types STM32F429I DISCOVERY I2C Exported Types
+  * @{
+  */
+
+/**
+  * @brief  One bus transaction: a register or memory read or write, or the
+  *         acknowledge polling of a device. Owned by the driver from
+  *         BSP_I2C_BUS_Submit() until its State is I2C_BUS_DONE or
+  *         I2C_BUS_ERROR.
+  */
+typedef struct I2C_BUS_Transaction
+{
+  uint8_t          Type;            /*!< I2C_BUS_READ, I2C_BUS_WRITE or I2C_BUS_POLL          */
+  uint8_t          Priority;        /*!< I2C_BUS_PRIORITY_HIGH or I2C_BUS_PRIORITY_LOW         */
+  uint16_t         DevAddress;      /*!< 8 bit device address                                  */
+  uint16_t         MemAddress;
+  uint16_t         MemAddSize;      /*!< I2C_MEMADD_SIZE_8BIT or I2C_MEMADD_SIZE_16BIT         */
+  uint8_t         *pData;
+  uint16_t         Length;
+  uint16_t         Trials;          /*!< I2C_BUS_POLL: addressings before giving up            */
+  void           (*pCallback)(struct I2C_BUS_Transaction *pTransaction); /*!< From the interrupt,
+                                         at completion, may be NULL                            */
+  void            *pContext;        /*!< Free for the callback                                 */
+
+  /* Driver state */
+  volatile uint8_t State;
+  uint16_t         Attempts;
+  struct I2C_BUS_Transaction *pNext;
+}I2C_BUS_TransactionTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_I2C_Exported_Constants STM32F429I DISCOVERY I2C Exported Constants
+  * @{
+  */
+#define I2C_BUS_READ                    0
+#define I2C_BUS_WRITE                   1
+#define I2C_BUS_POLL                    2
+
+#define I2C_BUS_PRIORITY_HIGH           0
+#define I2C_BUS_PRIORITY_LOW            1
+#define I2C_BUS_PRIORITIES              2
+
+#define I2C_BUS_QUEUED                  0
+#define I2C_BUS_RUNNING                 1
+#define I2C_BUS_DONE                    2
+#define I2C_BUS_ERROR                   3
+
+/* Shorter transfers are sent with interrupts, the DMA cannot receive one byte */
+#define I2C_BUS_DMA_MIN_LENGTH          2
+
+#define I2C_BUS_IRQ_PREPRIO             0x0F
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_I2C_Exported_Functions STM32F429I DISCOVERY I2C Exported Functions
+  * @{
+  */
+void    BSP_I2C_BUS_Init(I2C_HandleTypeDef *hi2c);
+void    BSP_I2C_BUS_Submit(I2C_BUS_TransactionTypeDef *pTransaction);
+uint8_t BSP_I2C_BUS_Wait(I2C_BUS_TransactionTypeDef *pTransaction);
+uint8_t BSP_I2C_BUS_Read(uint8_t Priority, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Length);
+uint8_t BSP_I2C_BUS_Write(uint8_t Priority, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Length);
+uint8_t BSP_I2C_BUS_Poll(uint8_t Priority, uint16_t DevAddress, uint16_t Trials);
+uint32_t BSP_I2C_BUS_GetErrors(void);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F429I_DISCOVERY_I2C_H */
@@ -73,6 +73,8 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f429i_discovery_lcd.h"
+#include "stm32f429i_discovery_dma2d.h"
+#include "stm32f429i_discovery_raster.h"
 #include "fonts.h"
 //#include "font24.c"
 //#include "font20.c"
@@ -103,8 +105,6 @@
 /** @defgroup STM32F429I_DISCOVERY_LCD_Private_Defines STM32F429I DISCOVERY LCD Private Defines
   * @{
   */
-#define POLY_X(Z)              ((int32_t)((Points + Z)->X))
-#define POLY_Y(Z)              ((int32_t)((Points + Z)->Y))
 /**
   * @}
   */ 
@@ -112,7 +112,6 @@
 /** @defgroup STM32F429I_DISCOVERY_LCD_Private_Macros STM32F429I DISCOVERY LCD Private Macros
   * @{
   */
-#define ABS(X)  ((X) > 0 ? (X) : -(X))
 /**
   * @}
   */ 
@@ -121,13 +120,15 @@
   * @{
   */ 
 LTDC_HandleTypeDef  LtdcHandler;
-static DMA2D_HandleTypeDef Dma2dHandler;
 static RCC_PeriphCLKInitTypeDef  PeriphClkInitStruct;
 
 /* Default LCD configuration with LCD Layer 1 */
 static uint32_t ActiveLayer = 0;
 static LCD_DrawPropTypeDef DrawProp[MAX_LAYER_NUMBER];
 LCD_DrvTypeDef  *LcdDrv;
+
+/* Last DMA2D command waited for by BSP_LCD_DrawPixel() */
+static DMA2D_FenceTypeDef PixelFence = 0;
 /**
   * @}
   */ 
@@ -135,9 +136,7 @@ LCD_DrvTypeDef  *LcdDrv;
 /** @defgroup STM32F429I_DISCOVERY_LCD_Private_FunctionPrototypes STM32F429I DISCOVERY LCD Private FunctionPrototypes
   * @{
   */ 
-static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c);
-static void FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex);
-static void ConvertLineToARGB8888(void *pSrc, void *pDst, uint32_t xSize, uint32_t ColorMode);
+static void FillBuffer(void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex);
 /**
   * @}
   */ 
@@ -223,6 +222,9 @@ uint8_t BSP_LCD_Init(void)
     /* Initialize the SDRAM */
     BSP_SDRAM_Init();
 
+    /* Initialize the DMA2D command queue */
+    BSP_DMA2D_Init();
+
     /* Initialize the font */
     BSP_LCD_SetFont(&LCD_DEFAULT_FONT);
 
@@ -534,6 +536,9 @@ uint32_t BSP_LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos)
 {
   uint32_t ret = 0;
   
+  /* Let the queued DMA2D transfers reach the frame buffer first */
+  BSP_DMA2D_WaitIdle();
+
   if(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_ARGB8888)
   {
     /* Read data value from SDRAM memory */
@@ -567,7 +572,7 @@ uint32_t BSP_LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos)
 void BSP_LCD_Clear(uint32_t Color)
 { 
   /* Clear the LCD */ 
-  FillBuffer(ActiveLayer, (uint32_t *)(LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress), BSP_LCD_GetXSize(), BSP_LCD_GetYSize(), 0, Color);
+  FillBuffer((uint32_t *)(LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress), BSP_LCD_GetXSize(), BSP_LCD_GetYSize(), 0, Color);
 }
 
 /**
@@ -594,8 +599,11 @@ void BSP_LCD_ClearStringLine(uint32_t Line)
   */
 void BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii)
 {
-  DrawChar(Xpos, Ypos, &DrawProp[ActiveLayer].pFont->table[(Ascii-' ') *\
-              DrawProp[ActiveLayer].pFont->Height * ((DrawProp[ActiveLayer].pFont->Width + 7) / 8)]);
+  RASTER_SurfaceTypeDef surface;
+
+  BSP_RASTER_GetLayerSurface(ActiveLayer, &surface);
+  BSP_RASTER_DrawChar(&surface, Xpos, Ypos, DrawProp[ActiveLayer].pFont, Ascii,
+                      DrawProp[ActiveLayer].TextColor, DrawProp[ActiveLayer].BackColor);
 }
 
 /**
@@ -676,13 +684,11 @@ void BSP_LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr)
   */
 void BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
 {
-  uint32_t xaddress = 0;
-  
-  /* Get the line address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
+  RASTER_SurfaceTypeDef surface;
 
-  /* Write line */
-  FillBuffer(ActiveLayer, (uint32_t *)xaddress, Length, 1, 0, DrawProp[ActiveLayer].TextColor);
+  /* Write clipped line */
+  BSP_RASTER_GetLayerSurface(ActiveLayer, &surface);
+  BSP_RASTER_FillRect(&surface, Xpos, Ypos, Length, 1, DrawProp[ActiveLayer].TextColor);
 }
 
 /**
@@ -693,13 +699,11 @@ void BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
   */
 void BSP_LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
 {
-  uint32_t xaddress = 0;
-  
-  /* Get the line address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
-  
-  /* Write line */
-  FillBuffer(ActiveLayer, (uint32_t *)xaddress, 1, Length, (BSP_LCD_GetXSize() - 1), DrawProp[ActiveLayer].TextColor);
+  RASTER_SurfaceTypeDef surface;
+
+  /* Write clipped line */
+  BSP_RASTER_GetLayerSurface(ActiveLayer, &surface);
+  BSP_RASTER_FillRect(&surface, Xpos, Ypos, 1, Length, DrawProp[ActiveLayer].TextColor);
 }
 
 /**
@@ -711,69 +715,10 @@ void BSP_LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
   */
 void BSP_LCD_DrawLine(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
 {
-  int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
-  yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0, 
-  curpixel = 0;
-  
-  deltax = ABS(X2 - X1);        /* The difference between the x's */
-  deltay = ABS(Y2 - Y1);        /* The difference between the y's */
-  x = X1;                       /* Start x off at the first pixel */
-  y = Y1;                       /* Start y off at the first pixel */
-  
-  if (X2 >= X1)                 /* The x-values are increasing */
-  {
-    xinc1 = 1;
-    xinc2 = 1;
-  }
-  else                          /* The x-values are decreasing */
-  {
-    xinc1 = -1;
-    xinc2 = -1;
-  }
-  
-  if (Y2 >= Y1)                 /* The y-values are increasing */
-  {
-    yinc1 = 1;
-    yinc2 = 1;
-  }
-  else                          /* The y-values are decreasing */
-  {
-    yinc1 = -1;
-    yinc2 = -1;
-  }
-  
-  if (deltax >= deltay)         /* There is at least one x-value for every y-value */
-  {
-    xinc1 = 0;                  /* Don't change the x when numerator >= denominator */
-    yinc2 = 0;                  /* Don't change the y for every iteration */
-    den = deltax;
-    num = deltax / 2;
-    numadd = deltay;
-    numpixels = deltax;         /* There are more x-values than y-values */
-  }
-  else                          /* There is at least one y-value for every x-value */
-  {
-    xinc2 = 0;                  /* Don't change the x for every iteration */
-    yinc1 = 0;                  /* Don't change the y when numerator >= denominator */
-    den = deltay;
-    num = deltay / 2;
-    numadd = deltax;
-    numpixels = deltay;         /* There are more y-values than x-values */
-  }
-  
-  for (curpixel = 0; curpixel <= numpixels; curpixel++)
-  {
-    BSP_LCD_DrawPixel(x, y, DrawProp[ActiveLayer].TextColor);   /* Draw the current pixel */
-    num += numadd;                            /* Increase the numerator by the top of the fraction */
-    if (num >= den)                           /* Check if numerator >= denominator */
-    {
-      num -= den;                             /* Calculate the new numerator value */
-      x += xinc1;                             /* Change the x as appropriate */
-      y += yinc1;                             /* Change the y as appropriate */
-    }
-    x += xinc2;                               /* Change the x as appropriate */
-    y += yinc2;                               /* Change the y as appropriate */
-  }
+  RASTER_SurfaceTypeDef surface;
+
+  BSP_RASTER_GetLayerSurface(ActiveLayer, &surface);
+  BSP_RASTER_DrawLine(&surface, X1, Y1, X2, Y2, DrawProp[ActiveLayer].TextColor);
 }
 
 /**
@@ -802,36 +747,10 @@ void BSP_LCD_DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Hei
   */
 void BSP_LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
 {
-  int32_t  d;/* Decision Variable */ 
-  uint32_t  curx;/* Current X Value */
-  uint32_t  cury;/* Current Y Value */ 
-  
-  d = 3 - (Radius << 1);
-  curx = 0;
-  cury = Radius;
-  
-  while (curx <= cury)
-  {
-    BSP_LCD_DrawPixel((Xpos + curx), (Ypos - cury), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos - curx), (Ypos - cury), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos + cury), (Ypos - curx), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos - cury), (Ypos - curx), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos + curx), (Ypos + cury), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos - curx), (Ypos + cury), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos + cury), (Ypos + curx), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos - cury), (Ypos + curx), DrawProp[ActiveLayer].TextColor);   
-
-    if (d < 0)
-    { 
-      d += (curx << 2) + 6;
-    }
-    else
-    {
-      d += ((curx - cury) << 2) + 10;
-      cury--;
-    }
-    curx++;
-  } 
+  RASTER_SurfaceTypeDef surface;
+
+  BSP_RASTER_GetLayerSurface(ActiveLayer, &surface);
+  BSP_RASTER_DrawEllipse(&surface, Xpos, Ypos, Radius, Radius, DrawProp[ActiveLayer].TextColor);
 }
 
 /**
@@ -868,83 +787,28 @@ void BSP_LCD_DrawPolygon(pPoint Points, uint16_t PointCount)
   */
 void BSP_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
 {
-  int x = 0, y = -YRadius, err = 2-2*XRadius, e2;
-  float k = 0, rad1 = 0, rad2 = 0;
-  
-  rad1 = XRadius;
-  rad2 = YRadius;
-  
-  k = (float)(rad2/rad1);
-  
-  do { 
-    BSP_LCD_DrawPixel((Xpos-(uint16_t)(x/k)), (Ypos+y), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos+(uint16_t)(x/k)), (Ypos+y), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos+(uint16_t)(x/k)), (Ypos-y), DrawProp[ActiveLayer].TextColor);
-    BSP_LCD_DrawPixel((Xpos-(uint16_t)(x/k)), (Ypos-y), DrawProp[ActiveLayer].TextColor);      
-    
-    e2 = err;
-    if (e2 <= x) {
-      err += ++x*2+1;
-      if (-y == x && e2 <= y) e2 = 0;
-    }
-    if (e2 > y) err += ++y*2+1;
-  }
-  while (y <= 0);
+  RASTER_SurfaceTypeDef surface;
+
+  BSP_RASTER_GetLayerSurface(ActiveLayer, &surface);
+  BSP_RASTER_DrawEllipse(&surface, Xpos, Ypos, XRadius, YRadius, DrawProp[ActiveLayer].TextColor);
 }
 
 /**
-  * @brief  Displays a bitmap picture loaded in the internal Flash (32 bpp).
+  * @brief  Displays a bitmap picture loaded in the internal Flash (16, 24 or 32 bpp).
+  * @note   The picture is converted and clipped by the DMA2D in the background.
   * @param  X: the bmp x position in the LCD
   * @param  Y: the bmp Y position in the LCD
   * @param  pBmp: Bmp picture address in the internal Flash
   */
 void BSP_LCD_DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp)
 {
-  uint32_t index = 0, width = 0, height = 0, bitpixel = 0;
-  uint32_t address;
-  uint32_t inputcolormode = 0;
-  
-  /* Get bitmap data address offset */
-  index = pBmp[10] + (pBmp[11] << 8) + (pBmp[12] << 16)  + (pBmp[13] << 24);
-
-  /* Read bitmap width */
-  width = pBmp[18] + (pBmp[19] << 8) + (pBmp[20] << 16)  + (pBmp[21] << 24);
-
-  /* Read bitmap height */
-  height = pBmp[22] + (pBmp[23] << 8) + (pBmp[24] << 16)  + (pBmp[25] << 24);
-
-  /* Read bit/pixel */
-  bitpixel = pBmp[28] + (pBmp[29] << 8);   
- 
-  /* Set Address */
-  address = LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (((BSP_LCD_GetXSize()*Y) + X)*(4));
-
-  /* Get the Layer pixel format */    
-  if ((bitpixel/8) == 4)
-  {
-    inputcolormode = CM_ARGB8888;
-  }
-  else if ((bitpixel/8) == 2)
-  {
-    inputcolormode = CM_RGB565;
-  }
-  else
-  {
-    inputcolormode = CM_RGB888;
-  }
- 
-  /* bypass the bitmap header */
-  pBmp += (index + (width * (height - 1) * (bitpixel/8)));
+  RASTER_SurfaceTypeDef surface;
+  RASTER_ImageTypeDef image;
 
-  /* Convert picture to ARGB8888 pixel format */
-  for(index=0; index < height; index++)
+  if(BSP_RASTER_ImageFromBmp(&image, pBmp) == RASTER_OK)
   {
-  /* Pixel format conversion */
-  ConvertLineToARGB8888((uint32_t *)pBmp, (uint32_t *)address, width, inputcolormode);
-
-  /* Increment the source and destination buffers */
-  address+=  ((BSP_LCD_GetXSize() - width + width)*4);
-  pBmp -= width*(bitpixel/8);
+    BSP_RASTER_GetLayerSurface(ActiveLayer, &surface);
+    BSP_RASTER_DrawImage(&surface, X, Y, &image);
   }
 }
 
@@ -957,16 +821,11 @@ void BSP_LCD_DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp)
   */
 void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
 {
-  uint32_t xaddress = 0;
-
-  /* Set the text color */
-  BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
-
-  /* Get the rectangle start address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
+  RASTER_SurfaceTypeDef surface;
 
-  /* Fill the rectangle */
-  FillBuffer(ActiveLayer, (uint32_t *)xaddress, Width, Height, (BSP_LCD_GetXSize() - Width), DrawProp[ActiveLayer].TextColor);
+  /* Fill the clipped rectangle */
+  BSP_RASTER_GetLayerSurface(ActiveLayer, &surface);
+  BSP_RASTER_FillRect(&surface, Xpos, Ypos, Width, Height, DrawProp[ActiveLayer].TextColor);
 }
 
 /**
@@ -977,44 +836,10 @@ void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Hei
   */
 void BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
 {
-  int32_t  d;    /* Decision Variable */ 
-  uint32_t  curx;/* Current X Value */
-  uint32_t  cury;/* Current Y Value */ 
-  
-  d = 3 - (Radius << 1);
-
-  curx = 0;
-  cury = Radius;
-  
-  BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
-
-  while (curx <= cury)
-  {
-    if(cury > 0) 
-    {
-      BSP_LCD_DrawHLine(Xpos - cury, Ypos + curx, 2*cury);
-      BSP_LCD_DrawHLine(Xpos - cury, Ypos - curx, 2*cury);
-    }
+  RASTER_SurfaceTypeDef surface;
 
-    if(curx > 0) 
-    {
-      BSP_LCD_DrawHLine(Xpos - curx, Ypos - cury, 2*curx);
-      BSP_LCD_DrawHLine(Xpos - curx, Ypos + cury, 2*curx);
-    }
-    if (d < 0)
-    { 
-      d += (curx << 2) + 6;
-    }
-    else
-    {
-      d += ((curx - cury) << 2) + 10;
-      cury--;
-    }
-    curx++;
-  }
-
-  BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
-  BSP_LCD_DrawCircle(Xpos, Ypos, Radius);
+  BSP_RASTER_GetLayerSurface(ActiveLayer, &surface);
+  BSP_RASTER_FillEllipse(&surface, Xpos, Ypos, Radius, Radius, DrawProp[ActiveLayer].TextColor);
 }
 
 /**
@@ -1028,70 +853,10 @@ void BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
   */
 void BSP_LCD_FillTriangle(uint16_t X1, uint16_t X2, uint16_t X3, uint16_t Y1, uint16_t Y2, uint16_t Y3)
 { 
-  int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
-  yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0, 
-  curpixel = 0;
-  
-  deltax = ABS(X2 - X1);        /* The difference between the x's */
-  deltay = ABS(Y2 - Y1);        /* The difference between the y's */
-  x = X1;                       /* Start x off at the first pixel */
-  y = Y1;                       /* Start y off at the first pixel */
-  
-  if (X2 >= X1)                 /* The x-values are increasing */
-  {
-    xinc1 = 1;
-    xinc2 = 1;
-  }
-  else                          /* The x-values are decreasing */
-  {
-    xinc1 = -1;
-    xinc2 = -1;
-  }
-  
-  if (Y2 >= Y1)                 /* The y-values are increasing */
-  {
-    yinc1 = 1;
-    yinc2 = 1;
-  }
-  else                          /* The y-values are decreasing */
-  {
-    yinc1 = -1;
-    yinc2 = -1;
-  }
-  
-  if (deltax >= deltay)         /* There is at least one x-value for every y-value */
-  {
-    xinc1 = 0;                  /* Don't change the x when numerator >= denominator */
-    yinc2 = 0;                  /* Don't change the y for every iteration */
-    den = deltax;
-    num = deltax / 2;
-    numadd = deltay;
-    numpixels = deltax;         /* There are more x-values than y-values */
-  }
-  else                          /* There is at least one y-value for every x-value */
-  {
-    xinc2 = 0;                  /* Don't change the x for every iteration */
-    yinc1 = 0;                  /* Don't change the y when numerator >= denominator */
-    den = deltay;
-    num = deltay / 2;
-    numadd = deltax;
-    numpixels = deltay;         /* There are more y-values than x-values */
-  }
-  
-  for (curpixel = 0; curpixel <= numpixels; curpixel++)
-  {
-    BSP_LCD_DrawLine(x, y, X3, Y3);
-    
-    num += numadd;              /* Increase the numerator by the top of the fraction */
-    if (num >= den)             /* Check if numerator >= denominator */
-    {
-      num -= den;               /* Calculate the new numerator value */
-      x += xinc1;               /* Change the x as appropriate */
-      y += yinc1;               /* Change the y as appropriate */
-    }
-    x += xinc2;                 /* Change the x as appropriate */
-    y += yinc2;                 /* Change the y as appropriate */
-  } 
+  RASTER_SurfaceTypeDef surface;
+
+  BSP_RASTER_GetLayerSurface(ActiveLayer, &surface);
+  BSP_RASTER_FillTriangle(&surface, X1, Y1, X2, Y2, X3, Y3, DrawProp[ActiveLayer].TextColor);
 }
 
 /**
@@ -1101,63 +866,10 @@ void BSP_LCD_FillTriangle(uint16_t X1, uint16_t X2, uint16_t X3, uint16_t Y1, ui
   */
 void BSP_LCD_FillPolygon(pPoint Points, uint16_t PointCount)
 {
-  
-  int16_t x = 0, y = 0, x2 = 0, y2 = 0, xcenter = 0, ycenter = 0, xfirst = 0, yfirst = 0, pixelx = 0, pixely = 0, counter = 0;
-  uint16_t  imageleft = 0, imageright = 0, imagetop = 0, imagebottom = 0;  
-
-  imageleft = imageright = Points->X;
-  imagetop= imagebottom = Points->Y;
-
-  for(counter = 1; counter < PointCount; counter++)
-  {
-    pixelx = POLY_X(counter);
-    if(pixelx < imageleft)
-    {
-      imageleft = pixelx;
-    }
-    if(pixelx > imageright)
-    {
-      imageright = pixelx;
-    }
-
-    pixely = POLY_Y(counter);
-    if(pixely < imagetop)
-    { 
-      imagetop = pixely;
-    }
-    if(pixely > imagebottom)
-    {
-      imagebottom = pixely;
-    }
-  }  
+  RASTER_SurfaceTypeDef surface;
 
-  if(PointCount < 2)
-  {
-    return;
-  }
-
-  xcenter = (imageleft + imageright)/2;
-  ycenter = (imagebottom + imagetop)/2;
- 
-  xfirst = Points->X;
-  yfirst = Points->Y;
-
-  while(--PointCount)
-  {
-    x = Points->X;
-    y = Points->Y;
-    Points++;
-    x2 = Points->X;
-    y2 = Points->Y;    
-  
-    BSP_LCD_FillTriangle(x, x2, xcenter, y, y2, ycenter);
-    BSP_LCD_FillTriangle(x, xcenter, x2, y, ycenter, y2);
-    BSP_LCD_FillTriangle(xcenter, x2, x, ycenter, y2, y);   
-  }
-  
-  BSP_LCD_FillTriangle(xfirst, x2, xcenter, yfirst, y2, ycenter);
-  BSP_LCD_FillTriangle(xfirst, xcenter, x2, yfirst, ycenter, y2);
-  BSP_LCD_FillTriangle(xcenter, x2, xfirst, ycenter, y2, yfirst);   
+  BSP_RASTER_GetLayerSurface(ActiveLayer, &surface);
+  BSP_RASTER_FillPolygon(&surface, Points, PointCount, RASTER_FILL_NONZERO, DrawProp[ActiveLayer].TextColor);
 }
 
 /**
@@ -1169,27 +881,10 @@ void BSP_LCD_FillPolygon(pPoint Points, uint16_t PointCount)
   */
 void BSP_LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
 {
-  int x = 0, y = -YRadius, err = 2-2*XRadius, e2;
-  float K = 0, rad1 = 0, rad2 = 0;
-  
-  rad1 = XRadius;
-  rad2 = YRadius;
-  K = (float)(rad2/rad1);
-  
-  do 
-  { 
-    BSP_LCD_DrawHLine((Xpos-(uint16_t)(x/K)), (Ypos+y), (2*(uint16_t)(x/K) + 1));
-    BSP_LCD_DrawHLine((Xpos-(uint16_t)(x/K)), (Ypos-y), (2*(uint16_t)(x/K) + 1));
-    
-    e2 = err;
-    if (e2 <= x) 
-    {
-      err += ++x*2+1;
-      if (-y == x && e2 <= y) e2 = 0;
-    }
-    if (e2 > y) err += ++y*2+1;
-  }
-  while (y <= 0);
+  RASTER_SurfaceTypeDef surface;
+
+  BSP_RASTER_GetLayerSurface(ActiveLayer, &surface);
+  BSP_RASTER_FillEllipse(&surface, Xpos, Ypos, XRadius, YRadius, DrawProp[ActiveLayer].TextColor);
 }
 
 /**
@@ -1307,131 +1002,30 @@ __weak void BSP_LCD_MspInit(void)
   */
 void BSP_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code)
 {
-  /* Write data value to all SDRAM memory */
-  *(__IO uint32_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (4*(Ypos*BSP_LCD_GetXSize() + Xpos))) = RGB_Code;
-}
-
-/**
-  * @brief  Draws a character on LCD.
-  * @param  Xpos: the Line where to display the character shape
-  * @param  Ypos: start column address
-  * @param  c: pointer to the character data
-  */
-static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
-{
-  uint32_t i = 0, j = 0;
-  uint16_t height, width;
-  uint8_t offset;
-  uint8_t *pchar;
-  uint32_t line=0;
-
-  height = DrawProp[ActiveLayer].pFont->Height;
-  width  = DrawProp[ActiveLayer].pFont->Width;
-
-  offset = 8 *((width + 7)/8) -  width ;
-
-  for(i = 0; i < height; i++)
+  /* A queued DMA2D transfer could overwrite the pixel afterwards: wait once
+     per run of pixels, not again while nothing new was queued */
+  if(BSP_DMA2D_GetLastFence() != PixelFence)
   {
-    pchar = ((uint8_t *)c + (width + 7)/8 * i);
-
-    switch(((width + 7)/8))
-    {
-    case 1:
-      line =  pchar[0];      
-      break;
-      
-    case 2:
-      line =  (pchar[0]<< 8) | pchar[1];
-      break;
-
-    case 3:
-    default:
-      line =  (pchar[0]<< 16) | (pchar[1]<< 8) | pchar[2];      
-      break;
-    }
-
-    for (j = 0; j < width; j++)
-    {
-      if(line & (1 << (width- j + offset- 1))) 
-      {
-        BSP_LCD_DrawPixel((Xpos + j), Ypos, DrawProp[ActiveLayer].TextColor);
-      }
-      else
-      {
-        BSP_LCD_DrawPixel((Xpos + j), Ypos, DrawProp[ActiveLayer].BackColor);
-      } 
-    }
-    Ypos++;
+    BSP_DMA2D_WaitIdle();
+    PixelFence = BSP_DMA2D_GetLastFence();
   }
+
+  /* Write data value to all SDRAM memory */
+  *(__IO uint32_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (4*(Ypos*BSP_LCD_GetXSize() + Xpos))) = RGB_Code;
 }
 
 /**
   * @brief  Fills buffer.
-  * @param  LayerIndex: layer index
   * @param  pDst: output color
   * @param  xSize: buffer width
   * @param  ySize: buffer height
   * @param  OffLine: offset
   * @param  ColorIndex: color Index  
   */
-static void FillBuffer(uint32_t LayerIndex, void * pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex) 
+static void FillBuffer(void * pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex) 
 {
-  
-  /* Register to memory mode with ARGB8888 as color Mode */ 
-  Dma2dHandler.Init.Mode         = DMA2D_R2M;
-  Dma2dHandler.Init.ColorMode    = DMA2D_ARGB8888;
-  Dma2dHandler.Init.OutputOffset = OffLine;      
-  
-  Dma2dHandler.Instance = DMA2D; 
-  
-  /* DMA2D Initialization */
-  if(HAL_DMA2D_Init(&Dma2dHandler) == HAL_OK) 
-  {
-    if(HAL_DMA2D_ConfigLayer(&Dma2dHandler, LayerIndex) == HAL_OK) 
-    {
-      if (HAL_DMA2D_Start(&Dma2dHandler, ColorIndex, (uint32_t)pDst, xSize, ySize) == HAL_OK)
-      {
-        /* Polling For DMA transfer */  
-        HAL_DMA2D_PollForTransfer(&Dma2dHandler, 10);
-      }
-    }
-  } 
-}
-
-/**
-  * @brief  Converts Line to ARGB8888 pixel format.
-  * @param  pSrc: pointer to source buffer
-  * @param  pDst: output color
-  * @param  xSize: buffer width
-  * @param  ColorMode: input color mode   
-  */
-static void ConvertLineToARGB8888(void * pSrc, void * pDst, uint32_t xSize, uint32_t ColorMode)
-{    
-  /* Configure the DMA2D Mode, Color Mode and output offset */
-  Dma2dHandler.Init.Mode         = DMA2D_M2M_PFC;
-  Dma2dHandler.Init.ColorMode    = DMA2D_ARGB8888;
-  Dma2dHandler.Init.OutputOffset = 0;     
-  
-  /* Foreground Configuration */
-  Dma2dHandler.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
-  Dma2dHandler.LayerCfg[1].InputAlpha = 0xFF;
-  Dma2dHandler.LayerCfg[1].InputColorMode = ColorMode;
-  Dma2dHandler.LayerCfg[1].InputOffset = 0;
-  
-  Dma2dHandler.Instance = DMA2D; 
-  
-  /* DMA2D Initialization */
-  if(HAL_DMA2D_Init(&Dma2dHandler) == HAL_OK) 
-  {
-    if(HAL_DMA2D_ConfigLayer(&Dma2dHandler, 1) == HAL_OK) 
-    {
-      if (HAL_DMA2D_Start(&Dma2dHandler, (uint32_t)pSrc, (uint32_t)pDst, xSize, 1) == HAL_OK)
-      {
-        /* Polling For DMA transfer */  
-        HAL_DMA2D_PollForTransfer(&Dma2dHandler, 10);
-      }
-    }
-  } 
+  /* Register to memory mode with ARGB8888 as color Mode, queued without waiting */
+  BSP_DMA2D_Fill((uint32_t)pDst, OffLine, DMA2D_ARGB8888, xSize, ySize, ColorIndex);
 }
 
 /**
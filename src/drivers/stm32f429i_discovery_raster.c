@@ -0,0 +1,1288 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_raster.c
+  * @brief   This file provides clipped, span based drawing of lines, triangles,
+  *          polygons and ellipses into a pixel buffer.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this driver:
+--------------------------
+   - Get the surface of a LCD layer with BSP_RASTER_GetLayerSurface(), narrow
+     its clip rectangle with BSP_RASTER_IntersectClip() if needed, then draw
+     with the BSP_RASTER_Fill/Draw functions.
+   - Coordinates may be negative or out of the surface: everything is clipped.
+   - BSP_RASTER_FillPolygon() handles any polygon, BSP_RASTER_FillTriangle()
+     is faster for triangles.
+
+2. Driver description:
+---------------------
+   - Every primitive is converted into horizontal spans (a vertical line is a
+     single 1 pixel wide rectangle). The frame buffer address is computed once
+     per span.
+   - Spans of RASTER_DMA2D_MIN_SPAN pixels or more are queued as DMA2D register
+     to memory fills. Shorter spans are written by CPU word stores, but only
+     if the DMA2D queue was empty when the primitive started: a CPU store must
+     never be overwritten afterwards by an older queued transfer. Otherwise
+     the filled primitives queue all their spans, lines and outlines wait for
+     the queue to drain as they are made of very short spans.
+   - Characters use the trimmed glyphs of fonts.h. The cell is back color
+     around the glyph box. 4 bpp glyphs are DMA2D A4 images and are blended
+     by the DMA2D, 1 bpp glyphs are split into spans.
+
+------------------------------------------------------------------------------*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery_raster.h"
+#include <string.h>
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_RASTER STM32F429I DISCOVERY RASTER
+  * @brief This file includes the span rasterizer
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_RASTER_Private_TypesDefinitions STM32F429I DISCOVERY RASTER Private TypesDefinitions
+  * @{
+  */
+typedef struct
+{
+  const RASTER_SurfaceTypeDef *pSurface;
+  uint32_t Color;          /* ARGB8888 color, for the DMA2D                 */
+  uint32_t Pixel;          /* Same color in the surface color mode          */
+  uint32_t Bpp;            /* Bytes per pixel                               */
+  uint32_t UseCpu;         /* Short spans may be written by the CPU         */
+}RASTER_ContextTypeDef;
+
+typedef struct
+{
+  int64_t  X;              /* 16.16 X position on the current row, biased to
+                              round up on >> 16                             */
+  int64_t  Step;           /* 16.16 X increment per row                     */
+  int32_t  YTop;           /* First row crossed, clipped                    */
+  int32_t  YBottom;        /* Row after the last row crossed                */
+  int32_t  Winding;        /* +1 for a downward edge, -1 for an upward one  */
+}RASTER_EdgeTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_RASTER_Private_Defines STM32F429I DISCOVERY RASTER Private Defines
+  * @{
+  */
+#define RASTER_CLIP_LEFT       0x01
+#define RASTER_CLIP_RIGHT      0x02
+#define RASTER_CLIP_TOP        0x04
+#define RASTER_CLIP_BOTTOM     0x08
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_RASTER_Private_Macros STM32F429I DISCOVERY RASTER Private Macros
+  * @{
+  */
+#define RASTER_MIN(A, B)       ((A) < (B) ? (A) : (B))
+#define RASTER_MAX(A, B)       ((A) > (B) ? (A) : (B))
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_RASTER_Private_Variables STM32F429I DISCOVERY RASTER Private Variables
+  * @{
+  */
+extern LTDC_HandleTypeDef LtdcHandler;
+
+/* Polygon edge table, sorted by YTop, and indexes of the active edges */
+static RASTER_EdgeTypeDef RasterEdges[RASTER_MAX_EDGES];
+static uint16_t           RasterActive[RASTER_MAX_EDGES];
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_RASTER_Private_FunctionPrototypes STM32F429I DISCOVERY RASTER Private FunctionPrototypes
+  * @{
+  */
+static uint32_t RASTER_OutputBpp(uint32_t ColorMode);
+static uint32_t RASTER_InputBpp(uint32_t ColorMode);
+static uint8_t  RASTER_Begin(RASTER_ContextTypeDef *pCtx, const RASTER_SurfaceTypeDef *pSurface, uint32_t Color);
+static void     RASTER_Store(const RASTER_ContextTypeDef *pCtx, uint32_t Address, uint32_t Count);
+static void     RASTER_Span(const RASTER_ContextTypeDef *pCtx, int32_t X0, int32_t X1, int32_t Y);
+static void     RASTER_VSpan(const RASTER_ContextTypeDef *pCtx, int32_t X, int32_t Y0, int32_t Y1);
+static uint32_t RASTER_OutCode(const RASTER_SurfaceTypeDef *pSurface, int32_t X, int32_t Y);
+static uint8_t  RASTER_ClipLine(const RASTER_SurfaceTypeDef *pSurface, int32_t *pX0, int32_t *pY0, int32_t *pX1, int32_t *pY1);
+static void     RASTER_EdgeInit(int64_t *pX, int64_t *pStep, int32_t XA, int32_t YA, int32_t XB, int32_t YB, int32_t Y);
+static uint8_t  RASTER_EdgeSetup(RASTER_EdgeTypeDef *pEdge, int32_t XA, int32_t YA, int32_t XB, int32_t YB, const RASTER_SurfaceTypeDef *pSurface);
+static void     RASTER_Triangle(const RASTER_ContextTypeDef *pCtx, int32_t X0, int32_t Y0, int32_t X1, int32_t Y1, int32_t X2, int32_t Y2);
+static void     RASTER_EllipseRow(const RASTER_ContextTypeDef *pCtx, int32_t Xpos, int32_t Ypos, int32_t Y, int32_t XMin, int32_t XMax, uint8_t Fill);
+static void     RASTER_Ellipse(const RASTER_ContextTypeDef *pCtx, int32_t Xpos, int32_t Ypos, int32_t XRadius, int32_t YRadius, uint8_t Fill);
+static uint8_t  RASTER_AlphaGlyph(const RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, const sFONT *pFont, const sGLYPH *pGlyph, uint32_t TextColor, uint32_t BackColor);
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_RASTER_Private_Functions STM32F429I DISCOVERY RASTER Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Gets the surface of a LCD layer, clipped to the layer image.
+  * @note   Layers in a color mode the DMA2D cannot write (L8, AL44, AL88)
+  *         get an empty clip rectangle.
+  * @param  LayerIndex: the layer foreground or background
+  * @param  pSurface: surface to fill in
+  */
+void BSP_RASTER_GetLayerSurface(uint32_t LayerIndex, RASTER_SurfaceTypeDef *pSurface)
+{
+  LTDC_LayerCfgTypeDef *cfg = &LtdcHandler.LayerCfg[LayerIndex];
+
+  pSurface->Address = cfg->FBStartAdress;
+  pSurface->Pitch   = cfg->ImageWidth;
+  /* LTDC and DMA2D output share the codes of ARGB8888 ... ARGB4444 */
+  pSurface->ColorMode = cfg->PixelFormat;
+  pSurface->ClipX0 = 0;
+  pSurface->ClipY0 = 0;
+  pSurface->ClipX1 = cfg->ImageWidth - 1;
+  pSurface->ClipY1 = cfg->ImageHeight - 1;
+
+  if(cfg->PixelFormat > LTDC_PIXEL_FORMAT_ARGB4444)
+  {
+    pSurface->ClipX1 = -1;
+  }
+}
+
+/**
+  * @brief  Narrows the clip rectangle of a surface.
+  * @param  pSurface: the surface
+  * @param  Xpos: the X position
+  * @param  Ypos: the Y position
+  * @param  Width: rectangle width
+  * @param  Height: rectangle height
+  */
+void BSP_RASTER_IntersectClip(RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, int32_t Width, int32_t Height)
+{
+  pSurface->ClipX0 = RASTER_MAX(pSurface->ClipX0, Xpos);
+  pSurface->ClipY0 = RASTER_MAX(pSurface->ClipY0, Ypos);
+  pSurface->ClipX1 = RASTER_MIN(pSurface->ClipX1, Xpos + Width - 1);
+  pSurface->ClipY1 = RASTER_MIN(pSurface->ClipY1, Ypos + Height - 1);
+}
+
+/**
+  * @brief  Fills an horizontal span.
+  * @param  pSurface: the surface
+  * @param  X0: first X position
+  * @param  X1: last X position, included
+  * @param  Ypos: the Y position
+  * @param  Color: color code ARGB(8-8-8-8)
+  */
+void BSP_RASTER_FillSpan(const RASTER_SurfaceTypeDef *pSurface, int32_t X0, int32_t X1, int32_t Ypos, uint32_t Color)
+{
+  RASTER_ContextTypeDef ctx;
+
+  if(RASTER_Begin(&ctx, pSurface, Color))
+  {
+    RASTER_Span(&ctx, X0, X1, Ypos);
+  }
+}
+
+/**
+  * @brief  Fills a rectangle with a single DMA2D transfer.
+  * @param  pSurface: the surface
+  * @param  Xpos: the X position
+  * @param  Ypos: the Y position
+  * @param  Width: rectangle width
+  * @param  Height: rectangle height
+  * @param  Color: color code ARGB(8-8-8-8)
+  */
+void BSP_RASTER_FillRect(const RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, int32_t Width, int32_t Height, uint32_t Color)
+{
+  RASTER_ContextTypeDef ctx;
+  int32_t x0, y0, x1, y1;
+
+  if(!RASTER_Begin(&ctx, pSurface, Color))
+  {
+    return;
+  }
+
+  x0 = RASTER_MAX(Xpos, pSurface->ClipX0);
+  y0 = RASTER_MAX(Ypos, pSurface->ClipY0);
+  x1 = RASTER_MIN(Xpos + Width - 1, pSurface->ClipX1);
+  y1 = RASTER_MIN(Ypos + Height - 1, pSurface->ClipY1);
+
+  if((x0 <= x1) && (y0 <= y1))
+  {
+    BSP_DMA2D_Fill(pSurface->Address + (y0 * pSurface->Pitch + x0) * ctx.Bpp, pSurface->Pitch - (x1 - x0 + 1),
+                   pSurface->ColorMode, x1 - x0 + 1, y1 - y0 + 1, Color);
+  }
+}
+
+/**
+  * @brief  Draws an image, converted to the surface color mode.
+  * @note   The transfer is queued: the image must stay in place until the
+  *         DMA2D is done with it, see BSP_DMA2D_Wait().
+  * @note   Images whose lines follow each other in memory are drawn with a
+  *         single transfer. Bottom-up images, and images whose line padding is
+  *         not a whole number of pixels, take one transfer per line as the
+  *         DMA2D line offsets cannot be negative.
+  * @param  pSurface: the surface
+  * @param  Xpos: the image left X position
+  * @param  Ypos: the image top Y position
+  * @param  pImage: the image
+  */
+void BSP_RASTER_DrawImage(const RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, const RASTER_ImageTypeDef *pImage)
+{
+  DMA2D_LayerTypeDef fg;
+  uint32_t srcbpp = RASTER_InputBpp(pImage->ColorMode);
+  uint32_t dstbpp = RASTER_OutputBpp(pSurface->ColorMode);
+  uint32_t src, dst, width, height, line;
+  int32_t x0, y0, x1, y1;
+
+  x0 = RASTER_MAX(Xpos, pSurface->ClipX0);
+  y0 = RASTER_MAX(Ypos, pSurface->ClipY0);
+  x1 = RASTER_MIN(Xpos + pImage->Width - 1, pSurface->ClipX1);
+  y1 = RASTER_MIN(Ypos + pImage->Height - 1, pSurface->ClipY1);
+
+  if((srcbpp == 0) || (x0 > x1) || (y0 > y1))
+  {
+    return;
+  }
+
+  width  = x1 - x0 + 1;
+  height = y1 - y0 + 1;
+  src = pImage->Address + (y0 - Ypos) * pImage->Pitch + (x0 - Xpos) * srcbpp;
+  dst = pSurface->Address + (y0 * pSurface->Pitch + x0) * dstbpp;
+
+  fg.Address       = src;
+  fg.Offset        = 0;
+  fg.ColorMode     = pImage->ColorMode;
+  fg.AlphaMode     = DMA2D_NO_MODIF_ALPHA;
+  fg.Color         = 0xFF000000;
+  fg.CLUTAddress   = 0;
+  fg.CLUTColorMode = 0;
+  fg.CLUTSize      = 0;
+
+  if((pImage->Pitch > 0) && ((pImage->Pitch % srcbpp) == 0))
+  {
+    /* Input and output codes are the same for ARGB8888 ... ARGB4444 */
+    if(pImage->ColorMode == pSurface->ColorMode)
+    {
+      BSP_DMA2D_Copy(src, pImage->Pitch / srcbpp - width, dst, pSurface->Pitch - width, pSurface->ColorMode, width, height);
+    }
+    else
+    {
+      fg.Offset = pImage->Pitch / srcbpp - width;
+      BSP_DMA2D_Convert(&fg, dst, pSurface->Pitch - width, pSurface->ColorMode, width, height);
+    }
+    return;
+  }
+
+  /* One line per transfer */
+  for(line = 0; line < height; line++)
+  {
+    fg.Address = src + line * pImage->Pitch;
+    BSP_DMA2D_Convert(&fg, dst + line * pSurface->Pitch * dstbpp, 0, pSurface->ColorMode, width, 1);
+  }
+}
+
+/**
+  * @brief  Describes the pixels of a BMP file.
+  * @param  pImage: image to fill in
+  * @param  pBmp: BMP file, uncompressed 16 (RGB565), 24 or 32 bits per pixel
+  * @retval RASTER_ERROR if the BMP format is not supported
+  */
+uint8_t BSP_RASTER_ImageFromBmp(RASTER_ImageTypeDef *pImage, const uint8_t *pBmp)
+{
+  uint32_t index, width, bitpixel, compression, linebytes;
+  int32_t height;
+
+  if((pBmp[0] != 'B') || (pBmp[1] != 'M'))
+  {
+    return RASTER_ERROR;
+  }
+
+  /* Get bitmap data address offset */
+  index = pBmp[10] + (pBmp[11] << 8) + (pBmp[12] << 16) + (pBmp[13] << 24);
+
+  /* Read bitmap width and height, a negative height is a top-down bitmap */
+  width  = pBmp[18] + (pBmp[19] << 8) + (pBmp[20] << 16) + (pBmp[21] << 24);
+  height = (int32_t)(pBmp[22] + (pBmp[23] << 8) + (pBmp[24] << 16) + ((uint32_t)pBmp[25] << 24));
+
+  /* Read bit/pixel and compression: BI_RGB, or BI_BITFIELDS taken as RGB565/ARGB8888 */
+  bitpixel    = pBmp[28] + (pBmp[29] << 8);
+  compression = pBmp[30] + (pBmp[31] << 8) + (pBmp[32] << 16) + (pBmp[33] << 24);
+
+  if((compression != 0) && (compression != 3))
+  {
+    return RASTER_ERROR;
+  }
+
+  switch(bitpixel)
+  {
+  case 32:
+    pImage->ColorMode = CM_ARGB8888;
+    break;
+  case 24:
+    pImage->ColorMode = CM_RGB888;
+    break;
+  case 16:
+    pImage->ColorMode = CM_RGB565;
+    break;
+  default:
+    return RASTER_ERROR;
+  }
+
+  /* Lines are padded to 4 bytes */
+  linebytes = ((width * (bitpixel / 8)) + 3) & ~3UL;
+
+  pImage->Width = width;
+  if(height > 0)
+  {
+    pImage->Height  = height;
+    pImage->Address = (uint32_t)pBmp + index + (height - 1) * linebytes;
+    pImage->Pitch   = -(int32_t)linebytes;
+  }
+  else
+  {
+    pImage->Height  = -height;
+    pImage->Address = (uint32_t)pBmp + index;
+    pImage->Pitch   = linebytes;
+  }
+
+  return RASTER_OK;
+}
+
+/**
+  * @brief  Draws a line between two points, both included.
+  * @param  pSurface: the surface
+  * @param  X0: the point 0 X position
+  * @param  Y0: the point 0 Y position
+  * @param  X1: the point 1 X position
+  * @param  Y1: the point 1 Y position
+  * @param  Color: color code ARGB(8-8-8-8)
+  */
+void BSP_RASTER_DrawLine(const RASTER_SurfaceTypeDef *pSurface, int32_t X0, int32_t Y0, int32_t X1, int32_t Y1, uint32_t Color)
+{
+  RASTER_ContextTypeDef ctx;
+  int32_t dx, dy, sx, sy, err, start, i;
+  uint32_t address;
+  int32_t xstep, ystep;
+
+  if(!RASTER_Begin(&ctx, pSurface, Color) || !RASTER_ClipLine(pSurface, &X0, &Y0, &X1, &Y1))
+  {
+    return;
+  }
+
+  /* Axis aligned lines are a single transfer */
+  if(Y0 == Y1)
+  {
+    RASTER_Span(&ctx, X0, X1, Y0);
+    return;
+  }
+  if(X0 == X1)
+  {
+    RASTER_VSpan(&ctx, X0, Y0, Y1);
+    return;
+  }
+
+  if(!ctx.UseCpu)
+  {
+    BSP_DMA2D_WaitIdle();
+    ctx.UseCpu = 1;
+  }
+
+  dx = (X1 > X0) ? (X1 - X0) : (X0 - X1);
+  dy = (Y1 > Y0) ? (Y1 - Y0) : (Y0 - Y1);
+  sx = (X1 > X0) ? 1 : -1;
+  sy = (Y1 > Y0) ? 1 : -1;
+
+  if(dx >= dy)
+  {
+    /* X major: one span per row */
+    err = dx / 2;
+    start = X0;
+    for(i = 0; i < dx; i++)
+    {
+      err -= dy;
+      if(err < 0)
+      {
+        RASTER_Span(&ctx, start, X0, Y0);
+        Y0 += sy;
+        err += dx;
+        start = X0 + sx;
+      }
+      X0 += sx;
+    }
+    RASTER_Span(&ctx, start, X0, Y0);
+  }
+  else
+  {
+    /* Y major: one pixel per row, walk the frame buffer address */
+    address = pSurface->Address + (Y0 * pSurface->Pitch + X0) * ctx.Bpp;
+    xstep = sx * (int32_t)ctx.Bpp;
+    ystep = sy * (int32_t)(pSurface->Pitch * ctx.Bpp);
+    err = dy / 2;
+    for(i = 0; i <= dy; i++)
+    {
+      RASTER_Store(&ctx, address, 1);
+      err -= dx;
+      if(err < 0)
+      {
+        address += xstep;
+        err += dy;
+      }
+      address += ystep;
+    }
+  }
+}
+
+/**
+  * @brief  Fills a triangle.
+  * @param  pSurface: the surface
+  * @param  X0: the point 0 X position
+  * @param  Y0: the point 0 Y position
+  * @param  X1: the point 1 X position
+  * @param  Y1: the point 1 Y position
+  * @param  X2: the point 2 X position
+  * @param  Y2: the point 2 Y position
+  * @param  Color: color code ARGB(8-8-8-8)
+  */
+void BSP_RASTER_FillTriangle(const RASTER_SurfaceTypeDef *pSurface, int32_t X0, int32_t Y0, int32_t X1, int32_t Y1, int32_t X2, int32_t Y2, uint32_t Color)
+{
+  RASTER_ContextTypeDef ctx;
+
+  if(RASTER_Begin(&ctx, pSurface, Color))
+  {
+    RASTER_Triangle(&ctx, X0, Y0, X1, Y1, X2, Y2);
+  }
+}
+
+/**
+  * @brief  Fills a polygon with an active edge table scanline walk. Concave and
+  *         self intersecting polygons are supported.
+  * @note   A pixel is filled when its top left corner is inside the polygon,
+  *         so polygons sharing an edge do not overlap.
+  * @note   Not reentrant: the edge tables are static.
+  * @param  pSurface: the surface
+  * @param  pPoints: pointer to the points array, the polygon is closed
+  * @param  PointCount: number of points
+  * @param  Rule: RASTER_FILL_EVENODD or RASTER_FILL_NONZERO
+  * @param  Color: color code ARGB(8-8-8-8)
+  * @retval RASTER_ERROR if the polygon has more than RASTER_MAX_EDGES edges
+  */
+uint8_t BSP_RASTER_FillPolygon(const RASTER_SurfaceTypeDef *pSurface, const Point *pPoints, uint16_t PointCount, RASTER_FillRuleTypeDef Rule, uint32_t Color)
+{
+  RASTER_ContextTypeDef ctx;
+  RASTER_EdgeTypeDef *edge, newedge;
+  uint32_t edgecount = 0, activecount = 0, next = 0, i, j;
+  int32_t y, yend, winding, previous, start = 0;
+  uint16_t index;
+
+  if((PointCount < 3) || !RASTER_Begin(&ctx, pSurface, Color))
+  {
+    return RASTER_OK;
+  }
+
+  /* Build the edge table, sorted by first row */
+  yend = pSurface->ClipY0 - 1;
+  for(i = 0; i < PointCount; i++)
+  {
+    j = (i + 1 < PointCount) ? (i + 1) : 0;
+    if(pPoints[i].Y == pPoints[j].Y)
+    {
+      continue;
+    }
+    if(edgecount == RASTER_MAX_EDGES)
+    {
+      return RASTER_ERROR;
+    }
+    if(RASTER_EdgeSetup(&RasterEdges[edgecount], pPoints[i].X, pPoints[i].Y, pPoints[j].X, pPoints[j].Y, pSurface))
+    {
+      edge = &RasterEdges[edgecount];
+      yend = RASTER_MAX(yend, edge->YBottom - 1);
+      for(j = edgecount; (j > 0) && (RasterEdges[j - 1].YTop > edge->YTop); j--)
+      {
+      }
+      if(j != edgecount)
+      {
+        newedge = *edge;
+        memmove(&RasterEdges[j + 1], &RasterEdges[j], (edgecount - j) * sizeof(RASTER_EdgeTypeDef));
+        RasterEdges[j] = newedge;
+      }
+      edgecount++;
+    }
+  }
+
+  if(edgecount == 0)
+  {
+    return RASTER_OK;
+  }
+  yend = RASTER_MIN(yend, pSurface->ClipY1);
+
+  for(y = RasterEdges[0].YTop; y <= yend; y++)
+  {
+    /* Retire the edges ending above this row */
+    for(i = 0, j = 0; i < activecount; i++)
+    {
+      if(RasterEdges[RasterActive[i]].YBottom > y)
+      {
+        RasterActive[j++] = RasterActive[i];
+      }
+    }
+    activecount = j;
+
+    /* Activate the edges starting on this row */
+    while((next < edgecount) && (RasterEdges[next].YTop <= y))
+    {
+      RasterActive[activecount++] = next++;
+    }
+
+    if(activecount == 0)
+    {
+      /* Jump over a gap between disjoint parts */
+      if(next == edgecount)
+      {
+        break;
+      }
+      y = RasterEdges[next].YTop - 1;
+      continue;
+    }
+
+    /* Keep the active edges sorted by X, they are nearly sorted already */
+    for(i = 1; i < activecount; i++)
+    {
+      index = RasterActive[i];
+      for(j = i; (j > 0) && (RasterEdges[RasterActive[j - 1]].X > RasterEdges[index].X); j--)
+      {
+        RasterActive[j] = RasterActive[j - 1];
+      }
+      RasterActive[j] = index;
+    }
+
+    /* Emit the inside spans */
+    winding = 0;
+    for(i = 0; i < activecount; i++)
+    {
+      edge = &RasterEdges[RasterActive[i]];
+      previous = winding;
+      winding = (Rule == RASTER_FILL_EVENODD) ? (winding ^ 1) : (winding + edge->Winding);
+
+      if((previous == 0) && (winding != 0))
+      {
+        start = (int32_t)(edge->X >> 16);
+      }
+      else if((previous != 0) && (winding == 0) && ((int32_t)(edge->X >> 16) > start))
+      {
+        RASTER_Span(&ctx, start, (int32_t)(edge->X >> 16) - 1, y);
+      }
+      edge->X += edge->Step;
+    }
+  }
+
+  return RASTER_OK;
+}
+
+/**
+  * @brief  Draws an ellipse outline.
+  * @param  pSurface: the surface
+  * @param  Xpos: the center X position
+  * @param  Ypos: the center Y position
+  * @param  XRadius: the X radius
+  * @param  YRadius: the Y radius
+  * @param  Color: color code ARGB(8-8-8-8)
+  */
+void BSP_RASTER_DrawEllipse(const RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, int32_t XRadius, int32_t YRadius, uint32_t Color)
+{
+  RASTER_ContextTypeDef ctx;
+
+  if((XRadius < 0) || (YRadius < 0) || !RASTER_Begin(&ctx, pSurface, Color))
+  {
+    return;
+  }
+
+  if(!ctx.UseCpu)
+  {
+    BSP_DMA2D_WaitIdle();
+    ctx.UseCpu = 1;
+  }
+  RASTER_Ellipse(&ctx, Xpos, Ypos, XRadius, YRadius, 0);
+}
+
+/**
+  * @brief  Fills an ellipse.
+  * @param  pSurface: the surface
+  * @param  Xpos: the center X position
+  * @param  Ypos: the center Y position
+  * @param  XRadius: the X radius
+  * @param  YRadius: the Y radius
+  * @param  Color: color code ARGB(8-8-8-8)
+  */
+void BSP_RASTER_FillEllipse(const RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, int32_t XRadius, int32_t YRadius, uint32_t Color)
+{
+  RASTER_ContextTypeDef ctx;
+
+  if((XRadius >= 0) && (YRadius >= 0) && RASTER_Begin(&ctx, pSurface, Color))
+  {
+    RASTER_Ellipse(&ctx, Xpos, Ypos, XRadius, YRadius, 1);
+  }
+}
+
+/**
+  * @brief  Draws one character, background included.
+  * @note   4 bpp fonts are drawn by the DMA2D: a fill of the cell, then the
+  *         glyph box blended over it. 1 bpp fonts, and 4 bpp glyphs clipped
+  *         in the middle of a byte, are drawn by the CPU, one span per run of
+  *         text or background pixels.
+  * @param  pSurface: the surface
+  * @param  Xpos: the character left X position
+  * @param  Ypos: the character top Y position
+  * @param  pFont: the font
+  * @param  Ascii: character ascii code
+  * @param  TextColor: text color code ARGB(8-8-8-8)
+  * @param  BackColor: background color code ARGB(8-8-8-8)
+  */
+void BSP_RASTER_DrawChar(const RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, const sFONT *pFont, uint8_t Ascii, uint32_t TextColor, uint32_t BackColor)
+{
+  RASTER_ContextTypeDef ctx[2];
+  const sGLYPH *glyph = FONT_GLYPH(pFont, Ascii);
+  const uint8_t *prow;
+  uint32_t stride = (glyph->Width * pFont->Bpp + 7) / 8;
+  uint32_t bit, pixel;
+  int32_t y, x, gx, gy, start;
+
+  if((Ypos + pFont->Height <= pSurface->ClipY0) || (Ypos > pSurface->ClipY1) ||
+     (Xpos + pFont->Width <= pSurface->ClipX0) || (Xpos > pSurface->ClipX1) ||
+     !RASTER_Begin(&ctx[0], pSurface, BackColor) || !RASTER_Begin(&ctx[1], pSurface, TextColor))
+  {
+    return;
+  }
+
+  if((pFont->Bpp == 4) && RASTER_AlphaGlyph(pSurface, Xpos, Ypos, pFont, glyph, TextColor, BackColor))
+  {
+    return;
+  }
+
+  if(!ctx[0].UseCpu)
+  {
+    BSP_DMA2D_WaitIdle();
+    ctx[0].UseCpu = 1;
+    ctx[1].UseCpu = 1;
+  }
+
+  for(y = Ypos; y < Ypos + pFont->Height; y++)
+  {
+    gy = y - Ypos - glyph->YOffset;
+    if((gy < 0) || (gy >= glyph->Height))
+    {
+      RASTER_Span(&ctx[0], Xpos, Xpos + pFont->Width - 1, y);
+      continue;
+    }
+
+    /* Runs over the cell, the pixels out of the box are background */
+    prow = pFont->Bitmap + glyph->Offset + gy * stride;
+    start = Xpos;
+    bit = 0;
+    for(x = 0; x < pFont->Width; x++)
+    {
+      gx = x - glyph->XOffset;
+      pixel = 0;
+      if((gx >= 0) && (gx < glyph->Width))
+      {
+        pixel = (pFont->Bpp == 1) ? ((prow[gx >> 3] >> (7 - (gx & 7))) & 1) :
+                                    (((prow[gx >> 1] >> ((gx & 1) * 4)) & 0x0F) >= 8);
+      }
+      if(pixel != bit)
+      {
+        if(Xpos + x > start)
+        {
+          RASTER_Span(&ctx[bit], start, Xpos + x - 1, y);
+        }
+        start = Xpos + x;
+        bit = pixel;
+      }
+    }
+    RASTER_Span(&ctx[bit], start, Xpos + pFont->Width - 1, y);
+  }
+}
+
+/*******************************************************************************
+                            Static Functions
+*******************************************************************************/
+
+/**
+  * @brief  Prepares the drawing of a primitive.
+  * @param  pCtx: context to fill in
+  * @param  pSurface: the surface
+  * @param  Color: color code ARGB(8-8-8-8)
+  * @retval 0 if nothing can be drawn
+  */
+static uint8_t RASTER_Begin(RASTER_ContextTypeDef *pCtx, const RASTER_SurfaceTypeDef *pSurface, uint32_t Color)
+{
+  if((pSurface->ClipX0 > pSurface->ClipX1) || (pSurface->ClipY0 > pSurface->ClipY1))
+  {
+    return 0;
+  }
+
+  pCtx->pSurface = pSurface;
+  pCtx->Color    = Color;
+  pCtx->Pixel    = BSP_DMA2D_EncodeColor(Color, pSurface->ColorMode);
+  pCtx->UseCpu   = BSP_DMA2D_IsIdle();
+  pCtx->Bpp      = RASTER_OutputBpp(pSurface->ColorMode);
+
+  return 1;
+}
+
+/**
+  * @brief  Draws a 4 bpp character with the DMA2D.
+  * @param  pSurface: the surface
+  * @param  Xpos: the character left X position
+  * @param  Ypos: the character top Y position
+  * @param  pFont: the font
+  * @param  pGlyph: the character glyph
+  * @param  TextColor: text color code ARGB(8-8-8-8)
+  * @param  BackColor: background color code ARGB(8-8-8-8)
+  * @retval 0 if the visible part of the box does not start and end on a byte
+  */
+static uint8_t RASTER_AlphaGlyph(const RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, const sFONT *pFont, const sGLYPH *pGlyph, uint32_t TextColor, uint32_t BackColor)
+{
+  DMA2D_LayerTypeDef fg, bg;
+  int32_t bx = Xpos + pGlyph->XOffset;
+  int32_t by = Ypos + pGlyph->YOffset;
+  int32_t x0 = RASTER_MAX(bx, pSurface->ClipX0);
+  int32_t y0 = RASTER_MAX(by, pSurface->ClipY0);
+  int32_t x1 = RASTER_MIN(bx + pGlyph->Width - 1, pSurface->ClipX1);
+  int32_t y1 = RASTER_MIN(by + pGlyph->Height - 1, pSurface->ClipY1);
+  uint32_t dst;
+
+  if((pGlyph->Width == 0) || (x0 > x1) || (y0 > y1))
+  {
+    BSP_RASTER_FillRect(pSurface, Xpos, Ypos, pFont->Width, pFont->Height, BackColor);
+    return 1;
+  }
+  if(((x0 - bx) & 1) || ((x1 - x0 + 1) & 1))
+  {
+    return 0;
+  }
+
+  BSP_RASTER_FillRect(pSurface, Xpos, Ypos, pFont->Width, pFont->Height, BackColor);
+
+  /* The text color alpha scales the glyph alpha, the background is the cell */
+  dst = pSurface->Address + (y0 * pSurface->Pitch + x0) * RASTER_OutputBpp(pSurface->ColorMode);
+  memset(&fg, 0, sizeof(fg));
+  fg.Address   = (uint32_t)(uintptr_t)(pFont->Bitmap + pGlyph->Offset + (y0 - by) * (pGlyph->Width / 2) + (x0 - bx) / 2);
+  fg.Offset    = pGlyph->Width - (x1 - x0 + 1);
+  fg.ColorMode = CM_A4;
+  fg.AlphaMode = DMA2D_COMBINE_ALPHA;
+  fg.Color     = TextColor;
+  memset(&bg, 0, sizeof(bg));
+  bg.Address   = dst;
+  bg.Offset    = pSurface->Pitch - (x1 - x0 + 1);
+  /* DMA2D input and output share the codes of ARGB8888 ... ARGB4444 */
+  bg.ColorMode = pSurface->ColorMode;
+  bg.AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  BSP_DMA2D_Blend(&fg, &bg, dst, bg.Offset, pSurface->ColorMode, x1 - x0 + 1, y1 - y0 + 1);
+
+  return 1;
+}
+
+/**
+  * @brief  Gets the pixel size of a DMA2D output color mode.
+  * @param  ColorMode: DMA2D_ARGB8888 ... DMA2D_ARGB4444
+  * @retval Bytes per pixel
+  */
+static uint32_t RASTER_OutputBpp(uint32_t ColorMode)
+{
+  switch(ColorMode)
+  {
+  case DMA2D_ARGB8888:
+    return 4;
+  case DMA2D_RGB888:
+    return 3;
+  default:
+    return 2;
+  }
+}
+
+/**
+  * @brief  Gets the pixel size of a DMA2D input color mode.
+  * @param  ColorMode: CM_ARGB8888 ... CM_A4
+  * @retval Bytes per pixel, 0 for the indexed and sub-byte modes
+  */
+static uint32_t RASTER_InputBpp(uint32_t ColorMode)
+{
+  switch(ColorMode)
+  {
+  case CM_ARGB8888:
+    return 4;
+  case CM_RGB888:
+    return 3;
+  case CM_RGB565:
+  case CM_ARGB1555:
+  case CM_ARGB4444:
+    return 2;
+  default:
+    return 0;
+  }
+}
+
+/**
+  * @brief  Writes pixels with the CPU.
+  * @param  pCtx: drawing context
+  * @param  Address: address of the first pixel
+  * @param  Count: number of pixels
+  */
+static void RASTER_Store(const RASTER_ContextTypeDef *pCtx, uint32_t Address, uint32_t Count)
+{
+  uint32_t pixel = pCtx->Pixel;
+  uint32_t *pword;
+  uint8_t *pbyte;
+
+  if(pCtx->Bpp == 4)
+  {
+    pword = (uint32_t *)Address;
+    while(Count--)
+    {
+      *pword++ = pixel;
+    }
+  }
+  else if(pCtx->Bpp == 2)
+  {
+    /* Align on a word, then store two pixels at a time */
+    if((Address & 2) && Count)
+    {
+      *(uint16_t *)Address = (uint16_t)pixel;
+      Address += 2;
+      Count--;
+    }
+    pixel |= pixel << 16;
+    pword = (uint32_t *)Address;
+    for(; Count >= 2; Count -= 2)
+    {
+      *pword++ = pixel;
+    }
+    if(Count)
+    {
+      *(uint16_t *)pword = (uint16_t)pixel;
+    }
+  }
+  else
+  {
+    pbyte = (uint8_t *)Address;
+    while(Count--)
+    {
+      *pbyte++ = (uint8_t)pixel;
+      *pbyte++ = (uint8_t)(pixel >> 8);
+      *pbyte++ = (uint8_t)(pixel >> 16);
+    }
+  }
+}
+
+/**
+  * @brief  Fills a clipped horizontal span.
+  * @param  pCtx: drawing context
+  * @param  X0: first X position
+  * @param  X1: last X position, included
+  * @param  Y: the Y position
+  */
+static void RASTER_Span(const RASTER_ContextTypeDef *pCtx, int32_t X0, int32_t X1, int32_t Y)
+{
+  const RASTER_SurfaceTypeDef *s = pCtx->pSurface;
+  uint32_t address, count;
+  int32_t tmp;
+
+  if((Y < s->ClipY0) || (Y > s->ClipY1))
+  {
+    return;
+  }
+  if(X0 > X1)
+  {
+    tmp = X0; X0 = X1; X1 = tmp;
+  }
+  X0 = RASTER_MAX(X0, s->ClipX0);
+  X1 = RASTER_MIN(X1, s->ClipX1);
+  if(X0 > X1)
+  {
+    return;
+  }
+
+  count   = X1 - X0 + 1;
+  address = s->Address + (Y * s->Pitch + X0) * pCtx->Bpp;
+
+  if(!pCtx->UseCpu || (count >= RASTER_DMA2D_MIN_SPAN) || (pCtx->Bpp == 3))
+  {
+    BSP_DMA2D_Fill(address, 0, s->ColorMode, count, 1, pCtx->Color);
+  }
+  else
+  {
+    RASTER_Store(pCtx, address, count);
+  }
+}
+
+/**
+  * @brief  Fills a clipped vertical span.
+  * @param  pCtx: drawing context
+  * @param  X: the X position
+  * @param  Y0: first Y position
+  * @param  Y1: last Y position, included
+  */
+static void RASTER_VSpan(const RASTER_ContextTypeDef *pCtx, int32_t X, int32_t Y0, int32_t Y1)
+{
+  const RASTER_SurfaceTypeDef *s = pCtx->pSurface;
+  uint32_t address, count;
+  int32_t tmp;
+
+  if((X < s->ClipX0) || (X > s->ClipX1))
+  {
+    return;
+  }
+  if(Y0 > Y1)
+  {
+    tmp = Y0; Y0 = Y1; Y1 = tmp;
+  }
+  Y0 = RASTER_MAX(Y0, s->ClipY0);
+  Y1 = RASTER_MIN(Y1, s->ClipY1);
+  if(Y0 > Y1)
+  {
+    return;
+  }
+
+  count   = Y1 - Y0 + 1;
+  address = s->Address + (Y0 * s->Pitch + X) * pCtx->Bpp;
+
+  if(!pCtx->UseCpu || (count >= RASTER_DMA2D_MIN_SPAN))
+  {
+    BSP_DMA2D_Fill(address, s->Pitch - 1, s->ColorMode, 1, count, pCtx->Color);
+  }
+  else
+  {
+    while(count--)
+    {
+      RASTER_Store(pCtx, address, 1);
+      address += s->Pitch * pCtx->Bpp;
+    }
+  }
+}
+
+/**
+  * @brief  Computes the Cohen-Sutherland region code of a point.
+  * @param  pSurface: the surface
+  * @param  X: the X position
+  * @param  Y: the Y position
+  * @retval Region code
+  */
+static uint32_t RASTER_OutCode(const RASTER_SurfaceTypeDef *pSurface, int32_t X, int32_t Y)
+{
+  uint32_t code = 0;
+
+  if(X < pSurface->ClipX0)
+  {
+    code |= RASTER_CLIP_LEFT;
+  }
+  else if(X > pSurface->ClipX1)
+  {
+    code |= RASTER_CLIP_RIGHT;
+  }
+  if(Y < pSurface->ClipY0)
+  {
+    code |= RASTER_CLIP_TOP;
+  }
+  else if(Y > pSurface->ClipY1)
+  {
+    code |= RASTER_CLIP_BOTTOM;
+  }
+
+  return code;
+}
+
+/**
+  * @brief  Clips a line to the surface clip rectangle.
+  * @param  pSurface: the surface
+  * @param  pX0: the point 0 X position, updated
+  * @param  pY0: the point 0 Y position, updated
+  * @param  pX1: the point 1 X position, updated
+  * @param  pY1: the point 1 Y position, updated
+  * @retval 0 if the line is fully out of the clip rectangle
+  */
+static uint8_t RASTER_ClipLine(const RASTER_SurfaceTypeDef *pSurface, int32_t *pX0, int32_t *pY0, int32_t *pX1, int32_t *pY1)
+{
+  uint32_t code0 = RASTER_OutCode(pSurface, *pX0, *pY0);
+  uint32_t code1 = RASTER_OutCode(pSurface, *pX1, *pY1);
+  uint32_t code;
+  int32_t x = 0, y = 0;
+
+  for(;;)
+  {
+    if(!(code0 | code1))
+    {
+      return 1;
+    }
+    if(code0 & code1)
+    {
+      return 0;
+    }
+
+    code = code0 ? code0 : code1;
+
+    if(code & RASTER_CLIP_TOP)
+    {
+      y = pSurface->ClipY0;
+      x = *pX0 + (int32_t)((int64_t)(*pX1 - *pX0) * (y - *pY0) / (*pY1 - *pY0));
+    }
+    else if(code & RASTER_CLIP_BOTTOM)
+    {
+      y = pSurface->ClipY1;
+      x = *pX0 + (int32_t)((int64_t)(*pX1 - *pX0) * (y - *pY0) / (*pY1 - *pY0));
+    }
+    else if(code & RASTER_CLIP_LEFT)
+    {
+      x = pSurface->ClipX0;
+      y = *pY0 + (int32_t)((int64_t)(*pY1 - *pY0) * (x - *pX0) / (*pX1 - *pX0));
+    }
+    else
+    {
+      x = pSurface->ClipX1;
+      y = *pY0 + (int32_t)((int64_t)(*pY1 - *pY0) * (x - *pX0) / (*pX1 - *pX0));
+    }
+
+    if(code == code0)
+    {
+      *pX0 = x;
+      *pY0 = y;
+      code0 = RASTER_OutCode(pSurface, x, y);
+    }
+    else
+    {
+      *pX1 = x;
+      *pY1 = y;
+      code1 = RASTER_OutCode(pSurface, x, y);
+    }
+  }
+}
+
+/**
+  * @brief  Sets up a 16.16 fixed point edge walk, rounded to the nearest pixel.
+  * @param  pX: X position at row Y
+  * @param  pStep: X increment per row
+  * @param  XA: edge start X position
+  * @param  YA: edge start Y position
+  * @param  XB: edge end X position
+  * @param  YB: edge end Y position
+  * @param  Y: first row walked
+  */
+static void RASTER_EdgeInit(int64_t *pX, int64_t *pStep, int32_t XA, int32_t YA, int32_t XB, int32_t YB, int32_t Y)
+{
+  *pStep = (YB != YA) ? (((int64_t)(XB - XA) << 16) / (YB - YA)) : 0;
+  *pX    = ((int64_t)XA << 16) + *pStep * (Y - YA) + 0x8000;
+}
+
+/**
+  * @brief  Sets up a polygon edge for the rows inside the clip rectangle.
+  * @param  pEdge: edge to fill in
+  * @param  XA: edge start X position
+  * @param  YA: edge start Y position
+  * @param  XB: edge end X position
+  * @param  YB: edge end Y position, different from YA
+  * @param  pSurface: the surface
+  * @retval 0 if the edge crosses no row of the clip rectangle
+  */
+static uint8_t RASTER_EdgeSetup(RASTER_EdgeTypeDef *pEdge, int32_t XA, int32_t YA, int32_t XB, int32_t YB, const RASTER_SurfaceTypeDef *pSurface)
+{
+  int32_t tmp;
+
+  pEdge->Winding = 1;
+  if(YA > YB)
+  {
+    tmp = XA; XA = XB; XB = tmp;
+    tmp = YA; YA = YB; YB = tmp;
+    pEdge->Winding = -1;
+  }
+
+  if((YB <= pSurface->ClipY0) || (YA > pSurface->ClipY1))
+  {
+    return 0;
+  }
+
+  pEdge->YTop    = RASTER_MAX(YA, pSurface->ClipY0);
+  pEdge->YBottom = YB;
+  pEdge->Step    = ((int64_t)(XB - XA) << 16) / (YB - YA);
+  pEdge->X       = ((int64_t)XA << 16) + pEdge->Step * (pEdge->YTop - YA) + 0xFFFF;
+
+  return 1;
+}
+
+/**
+  * @brief  Fills a triangle, one span per row.
+  * @param  pCtx: drawing context
+  * @param  X0: the point 0 X position
+  * @param  Y0: the point 0 Y position
+  * @param  X1: the point 1 X position
+  * @param  Y1: the point 1 Y position
+  * @param  X2: the point 2 X position
+  * @param  Y2: the point 2 Y position
+  */
+static void RASTER_Triangle(const RASTER_ContextTypeDef *pCtx, int32_t X0, int32_t Y0, int32_t X1, int32_t Y1, int32_t X2, int32_t Y2)
+{
+  const RASTER_SurfaceTypeDef *s = pCtx->pSurface;
+  int64_t xlong, steplong, xshort, stepshort;
+  int32_t tmp, y, ystart, yend;
+
+  /* Sort the points by Y */
+  if(Y0 > Y1)
+  {
+    tmp = X0; X0 = X1; X1 = tmp;
+    tmp = Y0; Y0 = Y1; Y1 = tmp;
+  }
+  if(Y1 > Y2)
+  {
+    tmp = X1; X1 = X2; X2 = tmp;
+    tmp = Y1; Y1 = Y2; Y2 = tmp;
+  }
+  if(Y0 > Y1)
+  {
+    tmp = X0; X0 = X1; X1 = tmp;
+    tmp = Y0; Y0 = Y1; Y1 = tmp;
+  }
+
+  if(Y0 == Y2)
+  {
+    RASTER_Span(pCtx, RASTER_MIN(X0, RASTER_MIN(X1, X2)), RASTER_MAX(X0, RASTER_MAX(X1, X2)), Y0);
+    return;
+  }
+
+  /* Only the rows inside the clip rectangle are walked */
+  ystart = RASTER_MAX(Y0, s->ClipY0);
+  yend   = RASTER_MIN(Y2, s->ClipY1);
+  if(ystart > yend)
+  {
+    return;
+  }
+
+  RASTER_EdgeInit(&xlong, &steplong, X0, Y0, X2, Y2, ystart);
+  if(ystart < Y1)
+  {
+    RASTER_EdgeInit(&xshort, &stepshort, X0, Y0, X1, Y1, ystart);
+  }
+  else
+  {
+    RASTER_EdgeInit(&xshort, &stepshort, X1, Y1, X2, Y2, ystart);
+  }
+
+  for(y = ystart; y <= yend; y++)
+  {
+    if((y == Y1) && (y != ystart))
+    {
+      RASTER_EdgeInit(&xshort, &stepshort, X1, Y1, X2, Y2, y);
+    }
+    RASTER_Span(pCtx, (int32_t)(xlong >> 16), (int32_t)(xshort >> 16), y);
+    xlong  += steplong;
+    xshort += stepshort;
+  }
+}
+
+/**
+  * @brief  Draws the spans of an ellipse row and of its mirror row.
+  * @param  pCtx: drawing context
+  * @param  Xpos: the center X position
+  * @param  Ypos: the center Y position
+  * @param  Y: row offset from the center
+  * @param  XMin: smallest X offset of the outline on that row
+  * @param  XMax: largest X offset of the outline on that row
+  * @param  Fill: 1 to fill the ellipse, 0 for the outline only
+  */
+static void RASTER_EllipseRow(const RASTER_ContextTypeDef *pCtx, int32_t Xpos, int32_t Ypos, int32_t Y, int32_t XMin, int32_t XMax, uint8_t Fill)
+{
+  if(Fill)
+  {
+    RASTER_Span(pCtx, Xpos - XMax, Xpos + XMax, Ypos + Y);
+    if(Y != 0)
+    {
+      RASTER_Span(pCtx, Xpos - XMax, Xpos + XMax, Ypos - Y);
+    }
+  }
+  else
+  {
+    RASTER_Span(pCtx, Xpos + XMin, Xpos + XMax, Ypos + Y);
+    RASTER_Span(pCtx, Xpos - XMax, Xpos - XMin, Ypos + Y);
+    if(Y != 0)
+    {
+      RASTER_Span(pCtx, Xpos + XMin, Xpos + XMax, Ypos - Y);
+      RASTER_Span(pCtx, Xpos - XMax, Xpos - XMin, Ypos - Y);
+    }
+  }
+}
+
+/**
+  * @brief  Rasterizes an ellipse with the midpoint error algorithm, the
+  *         pixels of a quadrant are merged into one span per row.
+  * @param  pCtx: drawing context
+  * @param  Xpos: the center X position
+  * @param  Ypos: the center Y position
+  * @param  XRadius: the X radius
+  * @param  YRadius: the Y radius
+  * @param  Fill: 1 to fill the ellipse, 0 for the outline only
+  */
+static void RASTER_Ellipse(const RASTER_ContextTypeDef *pCtx, int32_t Xpos, int32_t Ypos, int32_t XRadius, int32_t YRadius, uint8_t Fill)
+{
+  int64_t a2 = (int64_t)XRadius * XRadius;
+  int64_t b2 = (int64_t)YRadius * YRadius;
+  int64_t err, e2;
+  int32_t x = -XRadius, y = 0;
+  int32_t rowy = 0, rowmin = XRadius, rowmax = XRadius;
+
+  /* Quadrant walked from (XRadius, 0) to (0, YRadius) */
+  err = (int64_t)x * (2 * b2 + x) + b2;
+  do
+  {
+    if(y != rowy)
+    {
+      RASTER_EllipseRow(pCtx, Xpos, Ypos, rowy, rowmin, rowmax, Fill);
+      rowy = y;
+      rowmax = -x;
+    }
+    rowmin = -x;
+
+    e2 = 2 * err;
+    if(e2 >= (x * 2 + 1) * b2)
+    {
+      x++;
+      err += (x * 2 + 1) * b2;
+    }
+    if(e2 <= (y * 2 + 1) * a2)
+    {
+      y++;
+      err += (y * 2 + 1) * a2;
+    }
+  }
+  while(x <= 0);
+
+  RASTER_EllipseRow(pCtx, Xpos, Ypos, rowy, rowmin, rowmax, Fill);
+
+  /* Finish the tip of flat ellipses */
+  while(y++ < YRadius)
+  {
+    RASTER_EllipseRow(pCtx, Xpos, Ypos, y, 0, 0, Fill);
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
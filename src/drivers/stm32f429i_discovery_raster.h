@@ -0,0 +1,148 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_raster.h
+  * @brief   This file contains all the functions prototypes for the
+  *          stm32f429i_discovery_raster.c driver.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F429I_DISCOVERY_RASTER_H
+#define __STM32F429I_DISCOVERY_RASTER_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery_lcd.h"
+#include "stm32f429i_discovery_dma2d.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY_RASTER
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_RASTER_Exported_Types STM32F429I DISCOVERY RASTER Exported Types
+  * @{
+  */
+
+/**
+  * @brief  Raster status structure definition
+  */
+typedef enum
+{
+  RASTER_OK    = 0,
+  RASTER_ERROR = 1
+}RASTER_StatusTypeDef;
+
+/**
+  * @brief  Polygon fill rules
+  */
+typedef enum
+{
+  RASTER_FILL_EVENODD = 0,   /*!< Inside when crossed an odd number of edges   */
+  RASTER_FILL_NONZERO = 1    /*!< Inside when the edges winding is not zero    */
+}RASTER_FillRuleTypeDef;
+
+/**
+  * @brief  Pixel buffer the primitives are drawn into
+  */
+typedef struct
+{
+  uint32_t Address;        /*!< Address of pixel (0, 0)                                 */
+  uint32_t Pitch;          /*!< Pixels per line                                         */
+  uint32_t ColorMode;      /*!< DMA2D_ARGB8888, DMA2D_RGB888, DMA2D_RGB565,
+                                DMA2D_ARGB1555 or DMA2D_ARGB4444                        */
+  int16_t  ClipX0;         /*!< Clip rectangle, all bounds inclusive. Nothing is drawn
+                                when ClipX0 > ClipX1 or ClipY0 > ClipY1                 */
+  int16_t  ClipY0;
+  int16_t  ClipX1;
+  int16_t  ClipY1;
+}RASTER_SurfaceTypeDef;
+
+/**
+  * @brief  Source image of a blit
+  */
+typedef struct
+{
+  uint32_t Address;        /*!< Address of the first pixel of the top line              */
+  int32_t  Pitch;          /*!< Bytes from a line to the line below it, negative for
+                                bottom-up images                                        */
+  uint16_t Width;          /*!< Image width                                             */
+  uint16_t Height;         /*!< Image height                                            */
+  uint32_t ColorMode;      /*!< Input color mode, CM_ARGB8888 ... CM_ARGB4444           */
+}RASTER_ImageTypeDef;
+
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_RASTER_Exported_Constants STM32F429I DISCOVERY RASTER Exported Constants
+  * @{
+  */
+
+/**
+  * @brief  Spans at least this long are filled by the DMA2D, shorter ones by
+  *         CPU stores when the DMA2D queue is empty.
+  */
+#ifndef RASTER_DMA2D_MIN_SPAN
+ #define RASTER_DMA2D_MIN_SPAN             32
+#endif /* RASTER_DMA2D_MIN_SPAN */
+
+/**
+  * @brief  Maximum number of non horizontal edges of a filled polygon
+  */
+#ifndef RASTER_MAX_EDGES
+ #define RASTER_MAX_EDGES                  128
+#endif /* RASTER_MAX_EDGES */
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_RASTER_Exported_Functions STM32F429I DISCOVERY RASTER Exported Functions
+  * @{
+  */
+void BSP_RASTER_GetLayerSurface(uint32_t LayerIndex, RASTER_SurfaceTypeDef *pSurface);
+void BSP_RASTER_IntersectClip(RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, int32_t Width, int32_t Height);
+
+/* Colors are ARGB8888, converted once per call to the surface color mode */
+void BSP_RASTER_FillSpan(const RASTER_SurfaceTypeDef *pSurface, int32_t X0, int32_t X1, int32_t Ypos, uint32_t Color);
+void BSP_RASTER_FillRect(const RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, int32_t Width, int32_t Height, uint32_t Color);
+void BSP_RASTER_DrawLine(const RASTER_SurfaceTypeDef *pSurface, int32_t X0, int32_t Y0, int32_t X1, int32_t Y1, uint32_t Color);
+void BSP_RASTER_FillTriangle(const RASTER_SurfaceTypeDef *pSurface, int32_t X0, int32_t Y0, int32_t X1, int32_t Y1, int32_t X2, int32_t Y2, uint32_t Color);
+void BSP_RASTER_DrawImage(const RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, const RASTER_ImageTypeDef *pImage);
+uint8_t BSP_RASTER_ImageFromBmp(RASTER_ImageTypeDef *pImage, const uint8_t *pBmp);
+void BSP_RASTER_DrawChar(const RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, const sFONT *pFont, uint8_t Ascii, uint32_t TextColor, uint32_t BackColor);
+uint8_t BSP_RASTER_FillPolygon(const RASTER_SurfaceTypeDef *pSurface, const Point *pPoints, uint16_t PointCount, RASTER_FillRuleTypeDef Rule, uint32_t Color);
+void BSP_RASTER_DrawEllipse(const RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, int32_t XRadius, int32_t YRadius, uint32_t Color);
+void BSP_RASTER_FillEllipse(const RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, int32_t XRadius, int32_t YRadius, uint32_t Color);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F429I_DISCOVERY_RASTER_H */
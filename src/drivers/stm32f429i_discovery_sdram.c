@@ -36,6 +36,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f429i_discovery_sdram.h"
+#include "cmsis_nvic.h" // Added for mbed
 
 // mbed
 void wait_ms(int ms);
@@ -315,6 +316,40 @@ void BSP_SDRAM_DMA_IRQHandler(void)
   HAL_DMA_IRQHandler(SdramHandle.hdma); 
 }
 
+/**
+  * @brief  DMA transfer complete callback, from the SDRAM DMA interrupt.
+  * @param  hdma: DMA handle
+  */
+void HAL_SDRAM_DMA_XferCpltCallback(DMA_HandleTypeDef *hdma)
+{
+  BSP_SDRAM_DMA_XferCpltCallback();
+}
+
+/**
+  * @brief  DMA transfer error callback, from the SDRAM DMA interrupt.
+  * @param  hdma: DMA handle
+  */
+void HAL_SDRAM_DMA_XferErrorCallback(DMA_HandleTypeDef *hdma)
+{
+  BSP_SDRAM_DMA_XferErrorCallback();
+}
+
+/**
+  * @brief  BSP_SDRAM_WriteData_DMA() or BSP_SDRAM_ReadData_DMA() transfer
+  *         complete. A new transfer may be started from here.
+  */
+__weak void BSP_SDRAM_DMA_XferCpltCallback(void)
+{
+}
+
+/**
+  * @brief  BSP_SDRAM_WriteData_DMA() or BSP_SDRAM_ReadData_DMA() transfer
+  *         error.
+  */
+__weak void BSP_SDRAM_DMA_XferErrorCallback(void)
+{
+}
+
 /**
   * @brief  Initializes SDRAM MSP.
   * @note   This function can be surcharged by application code.
@@ -431,6 +466,7 @@ __weak void BSP_SDRAM_MspInit(SDRAM_HandleTypeDef  *hsdram, void *Params)
   HAL_DMA_Init(&dmaHandle); 
   
   /* NVIC configuration for DMA transfer complete interrupt */
+  NVIC_SetVector(SDRAM_DMAx_IRQn, (uint32_t)BSP_SDRAM_DMA_IRQHandler); // Added for mbed
   HAL_NVIC_SetPriority(SDRAM_DMAx_IRQn, 0x0F, 0);
   HAL_NVIC_EnableIRQ(SDRAM_DMAx_IRQn);
   } /* of if(hsdram != (SDRAM_HandleTypeDef  *)NULL) */
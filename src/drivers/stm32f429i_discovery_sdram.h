@@ -79,6 +79,16 @@
   */   
 #define SDRAM_DEVICE_ADDR         ((uint32_t)0xD0000000)
 #define SDRAM_DEVICE_SIZE         ((uint32_t)0x800000)  /* SDRAM device size in Bytes */
+
+/**
+  * @brief  SDRAM memory map
+  */
+#define SDRAM_LCD_LAYER1_ADDR     SDRAM_DEVICE_ADDR                       /* Foreground layer frame buffer */
+#define SDRAM_LCD_LAYER0_ADDR     (SDRAM_DEVICE_ADDR + 0x130000)          /* Background layer frame buffer */
+#define SDRAM_LCD_CONVERTED_ADDR  (SDRAM_DEVICE_ADDR + 0x260000)          /* Pixel format conversion buffer */
+#define SDRAM_STRIPCHART_ADDR     (SDRAM_DEVICE_ADDR + 0x390000)          /* Strip chart ring surface */
+#define SDRAM_STRIPCHART_SIZE     ((uint32_t)0x100000)
+#define SDRAM_FREE_ADDR           (SDRAM_STRIPCHART_ADDR + SDRAM_STRIPCHART_SIZE)
   
 /**
   * @brief  FMC SDRAM Memory Width
@@ -158,6 +168,11 @@ uint8_t           BSP_SDRAM_WriteData_DMA(uint32_t uwStartAddress, uint32_t* pDa
 uint8_t           BSP_SDRAM_Sendcmd(FMC_SDRAM_CommandTypeDef *SdramCmd);
 void              BSP_SDRAM_DMA_IRQHandler(void);
 
+/* USER Callbacks: declared as __weak in the SDRAM driver, from the SDRAM DMA
+   interrupt */
+void              BSP_SDRAM_DMA_XferCpltCallback(void);
+void              BSP_SDRAM_DMA_XferErrorCallback(void);
+
 /* These function can be modified in case the current settings (e.g. DMA stream)
    need to be changed for specific application needs */
 void    BSP_SDRAM_MspInit(SDRAM_HandleTypeDef  *hsdram, void *Params);
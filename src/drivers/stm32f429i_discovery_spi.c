@@ -0,0 +1,475 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_spi.c
+  * @brief   This file provides the arbiter of the SPI5 bus shared by the
+  *          L3GD20 gyroscope and the ILI9341 LCD controller.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this driver:
+--------------------------
+   - SPIx_Init() calls BSP_SPI_BUS_Init() once the SPI is configured. Nothing
+     else may access the SPI5 registers or pins afterwards.
+   - Describe each device with a SPI_BUS_DeviceTypeDef. Fill a transaction
+     and BSP_SPI_BUS_Submit() it, then BSP_SPI_BUS_Wait() for it or let its
+     callback run. BSP_SPI_BUS_Transfer() does both.
+   - BSP_SPI_BUS_GetStats() gives the worst wait and completion times seen
+     per priority since BSP_SPI_BUS_ResetStats().
+
+2. Driver description:
+---------------------
+   - Transactions wait in one FIFO list per priority. The next one is always
+     taken from the highest priority list, and runs with DMA: the CPU only
+     sets the chip select, the data/command line and the clock and mode of
+     the device, and the DMA interrupts chain the transactions.
+   - A running transaction is not interrupted, except those of devices with
+     a MaxChunk: they are sent MaxChunk bytes at a time, and a higher priority
+     transaction queued in the meantime runs between two chunks, the chip
+     select going high. A high priority transaction therefore waits at most
+     for the longest low priority transaction, or chunk.
+   - Times are measured with the DWT cycle counter.
+   - BSP_SPI_BUS_Submit() may be called from interrupt context, including
+     from a completion callback. BSP_SPI_BUS_Wait() may not.
+
+------------------------------------------------------------------------------*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery_spi.h"
+#include "cmsis_nvic.h" // Added for mbed
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_SPI STM32F429I DISCOVERY SPI
+  * @brief This file includes the SPI bus arbiter
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_SPI_Private_Variables STM32F429I DISCOVERY SPI Private Variables
+  * @{
+  */
+static SPI_HandleTypeDef           *SpiBusHandle;
+static DMA_HandleTypeDef            SpiBusDmaRx;
+static DMA_HandleTypeDef            SpiBusDmaTx;
+static SPI_BUS_TransactionTypeDef  *SpiBusHead[SPI_BUS_PRIORITIES];
+static SPI_BUS_TransactionTypeDef  *SpiBusTail[SPI_BUS_PRIORITIES];
+static SPI_BUS_TransactionTypeDef  *SpiBusCurrent;
+static const SPI_BUS_DeviceTypeDef *SpiBusConfigured;
+static uint16_t                     SpiBusChunk;
+static SPI_BUS_StatsTypeDef         SpiBusStats[SPI_BUS_PRIORITIES];
+static uint32_t                     SpiBusCyclesPerUs;
+static const uint8_t                SpiBusZero[SPI_BUS_ZERO_SIZE];
+static uint8_t                      SpiBusDiscard;
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_SPI_Private_FunctionPrototypes STM32F429I DISCOVERY SPI Private FunctionPrototypes
+  * @{
+  */
+static void SPI_BUS_StartNext(void);
+static void SPI_BUS_Run(SPI_BUS_TransactionTypeDef *pTransaction);
+static void SPI_BUS_ChunkComplete(DMA_HandleTypeDef *hdma);
+static void SPI_BUS_Error(DMA_HandleTypeDef *hdma);
+static void SPI_BUS_Configure(const SPI_BUS_DeviceTypeDef *pDevice);
+static void SPI_BUS_RxIRQHandler(void);
+static void SPI_BUS_TxIRQHandler(void);
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_SPI_Private_Functions STM32F429I DISCOVERY SPI Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Takes the bus over: DMA streams, interrupts and cycle counter.
+  * @param  hspi: SPI handle, initialized
+  */
+void BSP_SPI_BUS_Init(SPI_HandleTypeDef *hspi)
+{
+  SpiBusHandle     = hspi;
+  SpiBusConfigured = NULL;
+
+  /* Cycle counter for the statistics */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  SpiBusCyclesPerUs = SystemCoreClock / 1000000;
+
+  SPI_BUS_DMA_CLK_ENABLE();
+
+  SpiBusDmaRx.Instance                 = SPI_BUS_DMA_RX_STREAM;
+  SpiBusDmaRx.Init.Channel             = SPI_BUS_DMA_CHANNEL;
+  SpiBusDmaRx.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+  SpiBusDmaRx.Init.PeriphInc           = DMA_PINC_DISABLE;
+  SpiBusDmaRx.Init.MemInc              = DMA_MINC_ENABLE;
+  SpiBusDmaRx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  SpiBusDmaRx.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  SpiBusDmaRx.Init.Mode                = DMA_NORMAL;
+  SpiBusDmaRx.Init.Priority            = DMA_PRIORITY_HIGH;
+  SpiBusDmaRx.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;
+  SpiBusDmaRx.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
+  SpiBusDmaRx.Init.MemBurst            = DMA_MBURST_SINGLE;
+  SpiBusDmaRx.Init.PeriphBurst         = DMA_PBURST_SINGLE;
+  HAL_DMA_DeInit(&SpiBusDmaRx);
+  HAL_DMA_Init(&SpiBusDmaRx);
+  SpiBusDmaRx.XferCpltCallback  = SPI_BUS_ChunkComplete;
+  SpiBusDmaRx.XferErrorCallback = SPI_BUS_Error;
+
+  SpiBusDmaTx.Instance  = SPI_BUS_DMA_TX_STREAM;
+  SpiBusDmaTx.Init      = SpiBusDmaRx.Init;
+  SpiBusDmaTx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  HAL_DMA_DeInit(&SpiBusDmaTx);
+  HAL_DMA_Init(&SpiBusDmaTx);
+  SpiBusDmaTx.XferCpltCallback  = SPI_BUS_ChunkComplete;
+  SpiBusDmaTx.XferErrorCallback = SPI_BUS_Error;
+
+  NVIC_SetVector(SPI_BUS_DMA_RX_IRQn, (uint32_t)SPI_BUS_RxIRQHandler);
+  NVIC_SetPriority(SPI_BUS_DMA_RX_IRQn, SPI_BUS_IRQ_PREPRIO);
+  NVIC_EnableIRQ(SPI_BUS_DMA_RX_IRQn);
+  NVIC_SetVector(SPI_BUS_DMA_TX_IRQn, (uint32_t)SPI_BUS_TxIRQHandler);
+  NVIC_SetPriority(SPI_BUS_DMA_TX_IRQn, SPI_BUS_IRQ_PREPRIO);
+  NVIC_EnableIRQ(SPI_BUS_DMA_TX_IRQn);
+}
+
+/**
+  * @brief  Queues a transaction, started at once if the bus is free.
+  * @param  pTransaction: transaction, must stay valid until it completes
+  */
+void BSP_SPI_BUS_Submit(SPI_BUS_TransactionTypeDef *pTransaction)
+{
+  uint8_t priority = pTransaction->pDevice->Priority;
+  uint32_t primask = __get_PRIMASK();
+
+  pTransaction->State        = SPI_BUS_QUEUED;
+  pTransaction->Done         = 0;
+  pTransaction->pNext        = NULL;
+  pTransaction->SubmitCycles = DWT->CYCCNT;
+  if(pTransaction->Length == 0)
+  {
+    pTransaction->State = SPI_BUS_DONE;
+    return;
+  }
+
+  __disable_irq();
+  if(SpiBusTail[priority] == NULL)
+  {
+    SpiBusHead[priority] = pTransaction;
+  }
+  else
+  {
+    SpiBusTail[priority]->pNext = pTransaction;
+  }
+  SpiBusTail[priority] = pTransaction;
+
+  if(SpiBusCurrent == NULL)
+  {
+    SPI_BUS_StartNext();
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Waits for a transaction to complete.
+  * @param  pTransaction: submitted transaction
+  * @retval SPI_BUS_DONE or SPI_BUS_ERROR
+  */
+uint8_t BSP_SPI_BUS_Wait(SPI_BUS_TransactionTypeDef *pTransaction)
+{
+  while(pTransaction->State < SPI_BUS_DONE)
+  {
+  }
+  return pTransaction->State;
+}
+
+/**
+  * @brief  Submits a transaction and waits for it.
+  * @param  pDevice: device
+  * @param  Dc: data/command line level
+  * @param  pTx: bytes sent, NULL for zeros
+  * @param  pRx: bytes received, NULL to discard them
+  * @param  Length: number of bytes
+  * @retval SPI_BUS_DONE or SPI_BUS_ERROR
+  */
+uint8_t BSP_SPI_BUS_Transfer(const SPI_BUS_DeviceTypeDef *pDevice, uint8_t Dc, const uint8_t *pTx, uint8_t *pRx, uint16_t Length)
+{
+  SPI_BUS_TransactionTypeDef transaction;
+
+  transaction.pDevice   = pDevice;
+  transaction.pTx       = pTx;
+  transaction.pRx       = pRx;
+  transaction.Length    = Length;
+  transaction.Dc        = Dc;
+  transaction.pCallback = NULL;
+  transaction.pContext  = NULL;
+  BSP_SPI_BUS_Submit(&transaction);
+
+  return BSP_SPI_BUS_Wait(&transaction);
+}
+
+/**
+  * @brief  Gets the timings of a priority level.
+  * @param  Priority: SPI_BUS_PRIORITY_HIGH or SPI_BUS_PRIORITY_LOW
+  * @param  pStats: timings
+  */
+void BSP_SPI_BUS_GetStats(uint8_t Priority, SPI_BUS_StatsTypeDef *pStats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *pStats = SpiBusStats[Priority];
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Restarts the timings of all the priority levels.
+  */
+void BSP_SPI_BUS_ResetStats(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t i;
+
+  __disable_irq();
+  for(i = 0; i < SPI_BUS_PRIORITIES; i++)
+  {
+    SpiBusStats[i].Count       = 0;
+    SpiBusStats[i].MaxWaitUs   = 0;
+    SpiBusStats[i].MaxTotalUs  = 0;
+    SpiBusStats[i].Preemptions = 0;
+    SpiBusStats[i].Errors      = 0;
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Starts the oldest transaction of the highest priority, interrupts
+  *         disabled or from the DMA interrupt.
+  */
+static void SPI_BUS_StartNext(void)
+{
+  SPI_BUS_TransactionTypeDef *next;
+  uint32_t i;
+
+  SpiBusCurrent = NULL;
+  for(i = 0; i < SPI_BUS_PRIORITIES; i++)
+  {
+    next = SpiBusHead[i];
+    if(next != NULL)
+    {
+      SpiBusHead[i] = next->pNext;
+      if(SpiBusHead[i] == NULL)
+      {
+        SpiBusTail[i] = NULL;
+      }
+      SPI_BUS_Run(next);
+      return;
+    }
+  }
+}
+
+/**
+  * @brief  Selects the device if needed and starts the next chunk.
+  */
+static void SPI_BUS_Run(SPI_BUS_TransactionTypeDef *pTransaction)
+{
+  const SPI_BUS_DeviceTypeDef *device = pTransaction->pDevice;
+  SPI_BUS_StatsTypeDef *stats = &SpiBusStats[device->Priority];
+  uint32_t length = pTransaction->Length - pTransaction->Done;
+  uint32_t wait, tx;
+
+  SpiBusCurrent = pTransaction;
+
+  /* New or preempted: the chip select is high */
+  if(pTransaction->State != SPI_BUS_RUNNING)
+  {
+    SPI_BUS_Configure(device);
+    if(device->DcPort != NULL)
+    {
+      HAL_GPIO_WritePin(device->DcPort, device->DcPin, pTransaction->Dc ? GPIO_PIN_SET : GPIO_PIN_RESET);
+    }
+    HAL_GPIO_WritePin(device->CsPort, device->CsPin, GPIO_PIN_RESET);
+
+    if(pTransaction->State == SPI_BUS_QUEUED)
+    {
+      wait = (DWT->CYCCNT - pTransaction->SubmitCycles) / SpiBusCyclesPerUs;
+      stats->MaxWaitUs = (wait > stats->MaxWaitUs) ? wait : stats->MaxWaitUs;
+    }
+    pTransaction->State = SPI_BUS_RUNNING;
+  }
+
+  if((device->MaxChunk != 0) && (length > device->MaxChunk))
+  {
+    length = device->MaxChunk;
+  }
+  if((pTransaction->pTx == NULL) && (length > SPI_BUS_ZERO_SIZE))
+  {
+    length = SPI_BUS_ZERO_SIZE;
+  }
+  SpiBusChunk = length;
+
+  /* The receive stream interrupt ends the chunk, unless nothing is received */
+  tx = (uint32_t)((pTransaction->pTx != NULL) ? (pTransaction->pTx + pTransaction->Done) : SpiBusZero);
+  if(pTransaction->pRx != NULL)
+  {
+    HAL_DMA_Start_IT(&SpiBusDmaRx, (uint32_t)&SpiBusHandle->Instance->DR, (uint32_t)(pTransaction->pRx + pTransaction->Done), length);
+    SpiBusHandle->Instance->CR2 |= SPI_CR2_RXDMAEN;
+    HAL_DMA_Start(&SpiBusDmaTx, tx, (uint32_t)&SpiBusHandle->Instance->DR, length);
+  }
+  else
+  {
+    HAL_DMA_Start_IT(&SpiBusDmaTx, tx, (uint32_t)&SpiBusHandle->Instance->DR, length);
+  }
+  SpiBusHandle->Instance->CR2 |= SPI_CR2_TXDMAEN;
+}
+
+/**
+  * @brief  End of a chunk: continues the transaction, lets a higher priority
+  *         one run, or completes it.
+  */
+static void SPI_BUS_ChunkComplete(DMA_HandleTypeDef *hdma)
+{
+  SPI_BUS_TransactionTypeDef *transaction = SpiBusCurrent;
+  const SPI_BUS_DeviceTypeDef *device = transaction->pDevice;
+  SPI_BUS_StatsTypeDef *stats = &SpiBusStats[device->Priority];
+  void (*callback)(SPI_BUS_TransactionTypeDef *) = transaction->pCallback;
+  uint32_t total, i;
+
+  if(transaction->pRx != NULL)
+  {
+    /* Everything is received, so the transmit stream is done too */
+    HAL_DMA_PollForTransfer(&SpiBusDmaTx, HAL_DMA_FULL_TRANSFER, 1);
+  }
+  else
+  {
+    /* The last bytes leave the shift register, then the overrun is cleared */
+    while(!__HAL_SPI_GET_FLAG(SpiBusHandle, SPI_FLAG_TXE) || __HAL_SPI_GET_FLAG(SpiBusHandle, SPI_FLAG_BSY))
+    {
+    }
+    SpiBusDiscard = SpiBusHandle->Instance->DR;
+    SpiBusDiscard = SpiBusHandle->Instance->SR;
+  }
+  SpiBusHandle->Instance->CR2 &= ~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+  transaction->Done += SpiBusChunk;
+
+  if(transaction->Done < transaction->Length)
+  {
+    for(i = 0; i < device->Priority; i++)
+    {
+      if(SpiBusHead[i] != NULL)
+      {
+        break;
+      }
+    }
+    if(i == device->Priority)
+    {
+      SPI_BUS_Run(transaction);
+      return;
+    }
+
+    /* Back to the head of its list, resumed after the higher priorities */
+    HAL_GPIO_WritePin(device->CsPort, device->CsPin, GPIO_PIN_SET);
+    transaction->State = SPI_BUS_PREEMPTED;
+    transaction->pNext = SpiBusHead[device->Priority];
+    SpiBusHead[device->Priority] = transaction;
+    if(SpiBusTail[device->Priority] == NULL)
+    {
+      SpiBusTail[device->Priority] = transaction;
+    }
+    stats->Preemptions++;
+    SPI_BUS_StartNext();
+    return;
+  }
+
+  HAL_GPIO_WritePin(device->CsPort, device->CsPin, GPIO_PIN_SET);
+  total = (DWT->CYCCNT - transaction->SubmitCycles) / SpiBusCyclesPerUs;
+  stats->MaxTotalUs = (total > stats->MaxTotalUs) ? total : stats->MaxTotalUs;
+  stats->Count++;
+
+  /* The next transaction starts before the callback, which may submit */
+  SPI_BUS_StartNext();
+  transaction->State = SPI_BUS_DONE;
+  if(callback != NULL)
+  {
+    callback(transaction);
+  }
+}
+
+/**
+  * @brief  DMA error: the transaction is dropped.
+  */
+static void SPI_BUS_Error(DMA_HandleTypeDef *hdma)
+{
+  SPI_BUS_TransactionTypeDef *transaction = SpiBusCurrent;
+  const SPI_BUS_DeviceTypeDef *device = transaction->pDevice;
+  void (*callback)(SPI_BUS_TransactionTypeDef *) = transaction->pCallback;
+
+  SpiBusHandle->Instance->CR2 &= ~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+  HAL_DMA_Abort(&SpiBusDmaRx);
+  HAL_DMA_Abort(&SpiBusDmaTx);
+  HAL_GPIO_WritePin(device->CsPort, device->CsPin, GPIO_PIN_SET);
+  SpiBusStats[device->Priority].Errors++;
+
+  SPI_BUS_StartNext();
+  transaction->State = SPI_BUS_ERROR;
+  if(callback != NULL)
+  {
+    callback(transaction);
+  }
+}
+
+/**
+  * @brief  Sets the clock and mode of a device, if not already set.
+  */
+static void SPI_BUS_Configure(const SPI_BUS_DeviceTypeDef *pDevice)
+{
+  uint32_t cr1;
+
+  if(pDevice == SpiBusConfigured)
+  {
+    return;
+  }
+  __HAL_SPI_DISABLE(SpiBusHandle);
+  cr1 = SpiBusHandle->Instance->CR1 & ~(SPI_CR1_BR | SPI_CR1_CPOL | SPI_CR1_CPHA);
+  SpiBusHandle->Instance->CR1 = cr1 | pDevice->BaudRatePrescaler | pDevice->CLKPolarity | pDevice->CLKPhase;
+  __HAL_SPI_ENABLE(SpiBusHandle);
+  SpiBusConfigured = pDevice;
+}
+
+/**
+  * @brief  Receive stream interrupt.
+  */
+static void SPI_BUS_RxIRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&SpiBusDmaRx);
+}
+
+/**
+  * @brief  Transmit stream interrupt.
+  */
+static void SPI_BUS_TxIRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&SpiBusDmaTx);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -0,0 +1,150 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_spi.h
+  * @brief   This file contains the common defines and functions prototypes for
+  *          the stm32f429i_discovery_spi.c driver.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F429I_DISCOVERY_SPI_H
+#define __STM32F429I_DISCOVERY_SPI_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY_SPI
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_SPI_Exported_Types STM32F429I DISCOVERY SPI Exported Types
+  * @{
+  */
+
+/**
+  * @brief  Device on the bus: chip select, optional data/command line, clock
+  *         and mode, priority of its transactions
+  */
+typedef struct
+{
+  GPIO_TypeDef *CsPort;             /*!< Chip select, active low                               */
+  uint16_t      CsPin;
+  GPIO_TypeDef *DcPort;             /*!< Data/command line, NULL if none                      */
+  uint16_t      DcPin;
+  uint32_t      BaudRatePrescaler;  /*!< SPI_BAUDRATEPRESCALER_2 ... SPI_BAUDRATEPRESCALER_256  */
+  uint32_t      CLKPolarity;        /*!< SPI_POLARITY_LOW or SPI_POLARITY_HIGH                 */
+  uint32_t      CLKPhase;           /*!< SPI_PHASE_1EDGE or SPI_PHASE_2EDGE                    */
+  uint8_t       Priority;           /*!< SPI_BUS_PRIORITY_HIGH or SPI_BUS_PRIORITY_LOW         */
+  uint16_t      MaxChunk;           /*!< Bytes sent before a higher priority transaction may
+                                         run, 0 if the device needs a single chip select frame */
+}SPI_BUS_DeviceTypeDef;
+
+/**
+  * @brief  One chip select frame: Length bytes sent from pTx, received into
+  *         pRx. Owned by the driver from BSP_SPI_BUS_Submit() until its State
+  *         is SPI_BUS_DONE or SPI_BUS_ERROR.
+  */
+typedef struct SPI_BUS_Transaction
+{
+  const SPI_BUS_DeviceTypeDef *pDevice;
+  const uint8_t   *pTx;             /*!< NULL to send zeros                                    */
+  uint8_t         *pRx;             /*!< NULL to discard what is received                      */
+  uint16_t         Length;
+  uint8_t          Dc;              /*!< Data/command line level                               */
+  void           (*pCallback)(struct SPI_BUS_Transaction *pTransaction); /*!< From the interrupt,
+                                         at completion, may be NULL                            */
+  void            *pContext;        /*!< Free for the callback                                 */
+
+  /* Driver state */
+  volatile uint8_t State;
+  uint16_t         Done;
+  uint32_t         SubmitCycles;
+  struct SPI_BUS_Transaction *pNext;
+}SPI_BUS_TransactionTypeDef;
+
+/**
+  * @brief  Timings of one priority level, in microseconds
+  */
+typedef struct
+{
+  uint32_t Count;
+  uint32_t MaxWaitUs;               /*!< Submission to first clock                             */
+  uint32_t MaxTotalUs;              /*!< Submission to completion                              */
+  uint32_t Preemptions;
+  uint32_t Errors;
+}SPI_BUS_StatsTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_SPI_Exported_Constants STM32F429I DISCOVERY SPI Exported Constants
+  * @{
+  */
+#define SPI_BUS_PRIORITY_HIGH           0
+#define SPI_BUS_PRIORITY_LOW            1
+#define SPI_BUS_PRIORITIES              2
+
+#define SPI_BUS_QUEUED                  0
+#define SPI_BUS_RUNNING                 1
+#define SPI_BUS_PREEMPTED               2
+#define SPI_BUS_DONE                    3
+#define SPI_BUS_ERROR                   4
+
+/* Zeros sent per DMA transfer when pTx is NULL */
+#define SPI_BUS_ZERO_SIZE               64
+
+/* SPI5 DMA streams */
+#define SPI_BUS_DMA_CLK_ENABLE()        __HAL_RCC_DMA2_CLK_ENABLE()
+#define SPI_BUS_DMA_CHANNEL             DMA_CHANNEL_2
+#define SPI_BUS_DMA_RX_STREAM           DMA2_Stream3
+#define SPI_BUS_DMA_RX_IRQn             DMA2_Stream3_IRQn
+#define SPI_BUS_DMA_TX_STREAM           DMA2_Stream4
+#define SPI_BUS_DMA_TX_IRQn             DMA2_Stream4_IRQn
+#define SPI_BUS_IRQ_PREPRIO             0x0D
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_SPI_Exported_Functions STM32F429I DISCOVERY SPI Exported Functions
+  * @{
+  */
+void    BSP_SPI_BUS_Init(SPI_HandleTypeDef *hspi);
+void    BSP_SPI_BUS_Submit(SPI_BUS_TransactionTypeDef *pTransaction);
+uint8_t BSP_SPI_BUS_Wait(SPI_BUS_TransactionTypeDef *pTransaction);
+uint8_t BSP_SPI_BUS_Transfer(const SPI_BUS_DeviceTypeDef *pDevice, uint8_t Dc, const uint8_t *pTx, uint8_t *pRx, uint16_t Length);
+void    BSP_SPI_BUS_GetStats(uint8_t Priority, SPI_BUS_StatsTypeDef *pStats);
+void    BSP_SPI_BUS_ResetStats(void);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F429I_DISCOVERY_SPI_H */
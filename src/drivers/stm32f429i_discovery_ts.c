@@ -61,6 +61,13 @@
 /** @defgroup STM32F429I_DISCOVERY_TS_Private_Defines STM32F429I DISCOVERY TS Private Defines
   * @{
   */ 
+/* BSP_TS_FifoDrainStart() steps, one I2C transaction each */
+#define TS_DRAIN_IDLE                   0
+#define TS_DRAIN_CLEAR                  1
+#define TS_DRAIN_STATUS                 2
+#define TS_DRAIN_DATA                   3
+
+#define TS_STATUS_SIZE                  (STMPE811_REG_FIFO_SIZE - STMPE811_REG_TSC_CTRL + 1)
 /**
   * @}
   */ 
@@ -77,6 +84,23 @@
   */
 static TS_DrvTypeDef     *TsDrv;
 static uint16_t          TsXBoundary, TsYBoundary; 
+
+/* Until BSP_TS_SetCalibration(), the BSP_TS_GetState() corrections are used */
+static TS_CalibrationTypeDef TsCalibration;
+static uint8_t           TsCalibrated = 0;
+static uint8_t           TsTouching;
+static uint16_t          TsLastX, TsLastY;
+
+/* BSP_TS_FifoDrainStart() state */
+static I2C_BUS_TransactionTypeDef TsTransaction;
+static volatile uint8_t  TsDrainStep = TS_DRAIN_IDLE;
+static uint8_t           TsClear = 0xFF;
+static uint8_t           TsStatus[TS_STATUS_SIZE];
+static uint8_t           TsData[TS_FIFO_BURST * 4];
+static TS_EventTypeDef   TsEvents[TS_FIFO_BURST + 1];
+static uint32_t          TsTimestamp;
+static TS_DrainCallbackTypeDef TsDrainCallback;
+static void             *TsDrainContext;
 /**
   * @}
   */
@@ -84,6 +108,10 @@ static uint16_t          TsXBoundary, TsYBoundary;
 /** @defgroup STM32F429I_DISCOVERY_TS_Private_Function_Prototypes STM32F429I DISCOVERY TS Private Function Prototypes
   * @{
   */
+static void TS_Map(uint32_t RawX, uint32_t RawY, TS_EventTypeDef *pEvent);
+static uint32_t TS_Convert(uint32_t Timestamp, const uint8_t *pStatus, const uint8_t *pData, uint32_t Count, TS_EventTypeDef *pEvents);
+static void TS_DrainNext(I2C_BUS_TransactionTypeDef *pTransaction);
+static int32_t TS_Solve(const TS_PointTypeDef *pRaw, const int64_t *pScreen, int64_t Det, int32_t *pA, int32_t *pB);
 /**
   * @}
   */
@@ -234,6 +262,339 @@ void BSP_TS_ITClear(void)
   TsDrv->ClearIT(TS_I2C_ADDRESS); 
 }
 
+/**
+  * @brief  Initializes the touch screen to deliver its samples through the
+  *         FIFO: the STMPE811 interrupt line goes low once Threshold samples
+  *         are waiting, and on touch and release. BSP_TS_FifoDrain() or
+  *         BSP_TS_FifoDrainStart() must then be called until the line goes
+  *         high again.
+  * @note   Samples are 4 times averaged and take about 1 ms each, a sample
+  *         is then delivered at most Threshold ms after its conversion.
+  * @param  XSize: The maximum X size of the TS area on LCD
+  * @param  YSize: The maximum Y size of the TS area on LCD
+  * @param  Threshold: FIFO threshold, 1 to TS_FIFO_BURST samples
+  * @retval TS_OK: if all initializations are OK. Other value if error.
+  */
+uint8_t BSP_TS_FifoInit(uint16_t XSize, uint16_t YSize, uint8_t Threshold)
+{
+  uint8_t value;
+
+  if((Threshold == 0) || (Threshold > TS_FIFO_BURST))
+  {
+    return TS_ERROR;
+  }
+
+  TsXBoundary = XSize;
+  TsYBoundary = YSize;
+  TsTouching  = 0;
+
+  IOE_Init();
+  if(((IOE_Read(TS_I2C_ADDRESS, STMPE811_REG_CHP_ID_LSB) << 8) | IOE_Read(TS_I2C_ADDRESS, STMPE811_REG_CHP_ID_MSB)) != STMPE811_ID)
+  {
+    return TS_ERROR;
+  }
+
+  /* Soft reset */
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_SYS_CTRL1, 0x02);
+  IOE_Delay(10);
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_SYS_CTRL1, 0x00);
+  IOE_Delay(2);
+
+  /* ADC and touch controller clocks on, GPIO and temperature sensor off */
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_SYS_CTRL2, STMPE811_IO_FCT | STMPE811_TEMPSENS_FCT);
+
+  /* Touch pins on their alternate function */
+  value = IOE_Read(TS_I2C_ADDRESS, STMPE811_REG_IO_AF);
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_IO_AF, value & ~STMPE811_TOUCH_IO_ALL);
+
+  /* 80 clock sample time, 12 bits, 3.25 MHz ADC clock */
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_ADC_CTRL1, 0x49);
+  IOE_Delay(2);
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_ADC_CTRL2, 0x01);
+
+  /* 4 samples averaged, 500 us touch detect delay, 500 us settling time */
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_TSC_CFG, 0x9A);
+
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_FIFO_TH, Threshold);
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_FIFO_STA, 0x01);
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_FIFO_STA, 0x00);
+
+  /* Z on 8 bits, 50 mA drive, X, Y and Z acquisition without window tracking */
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_TSC_FRACT_XYZ, 0x01);
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_TSC_I_DRIVE, 0x01);
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_TSC_CTRL, STMPE811_TS_CTRL_ENABLE);
+
+  /* Level interrupt, active low */
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_INT_STA, 0xFF);
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_INT_EN, STMPE811_GIT_TOUCH | STMPE811_GIT_FTH | STMPE811_GIT_FOV);
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_INT_CTRL, STMPE811_GIT_EN);
+
+  return TS_OK;
+}
+
+/**
+  * @brief  Reads up to TS_FIFO_BURST samples of the FIFO in one I2C burst and
+  *         converts them into events. A release gives a TS_EVENT_UP event
+  *         once the samples before it are read.
+  * @param  Timestamp: time given to the events
+  * @param  pEvents: events, TS_FIFO_BURST + 1 of them at most
+  * @param  MaxEvents: size of pEvents, at least 2
+  * @retval Number of events
+  */
+uint32_t BSP_TS_FifoDrain(uint32_t Timestamp, TS_EventTypeDef *pEvents, uint32_t MaxEvents)
+{
+  uint8_t data[TS_FIFO_BURST * 4];
+  uint8_t regs[TS_STATUS_SIZE];
+  uint32_t count;
+
+  /* Clear first: anything happening during the drain asserts the line again */
+  IOE_Write(TS_I2C_ADDRESS, STMPE811_REG_INT_STA, 0xFF);
+
+  /* TSC_CTRL to FIFO_SIZE in one read: touch status and FIFO level */
+  IOE_ReadMultiple(TS_I2C_ADDRESS, STMPE811_REG_TSC_CTRL, regs, sizeof(regs));
+  count = regs[STMPE811_REG_FIFO_SIZE - STMPE811_REG_TSC_CTRL];
+  if(count > TS_FIFO_BURST)
+  {
+    count = TS_FIFO_BURST;
+  }
+  if(count > MaxEvents - 1)
+  {
+    count = MaxEvents - 1;
+  }
+
+  if(count > 0)
+  {
+    IOE_ReadMultiple(TS_I2C_ADDRESS, STMPE811_REG_TSC_DATA_NON_INC, data, count * 4);
+  }
+
+  return TS_Convert(Timestamp, regs, data, count, pEvents);
+}
+
+/**
+  * @brief  Starts the same drain as BSP_TS_FifoDrain() without waiting: each
+  *         I2C transaction is queued from the completion of the one before,
+  *         ahead of the EEPROM transfers, and the events are given to
+  *         pCallback from the I2C interrupt. May be called from an interrupt.
+  * @note   pCallback may start the next drain. On an I2C error it is given
+  *         no events.
+  * @param  Timestamp: time given to the events
+  * @param  pCallback: called once the events are read
+  * @param  pContext: given to pCallback
+  * @retval TS_ERROR if a drain is already running
+  */
+uint8_t BSP_TS_FifoDrainStart(uint32_t Timestamp, TS_DrainCallbackTypeDef pCallback, void *pContext)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if(TsDrainStep != TS_DRAIN_IDLE)
+  {
+    __set_PRIMASK(primask);
+    return TS_ERROR;
+  }
+  TsDrainStep = TS_DRAIN_CLEAR;
+  __set_PRIMASK(primask);
+
+  TsTimestamp     = Timestamp;
+  TsDrainCallback = pCallback;
+  TsDrainContext  = pContext;
+
+  /* Clear first: anything happening during the drain asserts the line again */
+  TsTransaction.Type       = I2C_BUS_WRITE;
+  TsTransaction.DevAddress = TS_I2C_ADDRESS;
+  TsTransaction.MemAddress = STMPE811_REG_INT_STA;
+  TsTransaction.pData      = &TsClear;
+  TsTransaction.Length     = 1;
+  TsTransaction.Trials     = 0;
+  TsTransaction.pCallback  = TS_DrainNext;
+  TsTransaction.pContext   = NULL;
+  IOE_Submit(&TsTransaction);
+
+  return TS_OK;
+}
+
+/**
+  * @brief  Sets the raw to screen mapping of the FIFO drains.
+  * @param  pCalibration: mapping, see BSP_TS_ComputeCalibration()
+  */
+void BSP_TS_SetCalibration(const TS_CalibrationTypeDef *pCalibration)
+{
+  TsCalibration = *pCalibration;
+  TsCalibrated  = 1;
+}
+
+/**
+  * @brief  Computes the affine mapping going through 3 points, e.g. the raw
+  *         samples of 3 targets touched on the screen. Any rotation, scale,
+  *         skew and offset of the panel is corrected.
+  * @param  pRaw: 3 raw positions
+  * @param  pScreen: the 3 matching screen positions
+  * @param  pCalibration: the mapping
+  * @retval TS_ERROR if the points are aligned
+  */
+uint8_t BSP_TS_ComputeCalibration(const TS_PointTypeDef *pRaw, const TS_PointTypeDef *pScreen, TS_CalibrationTypeDef *pCalibration)
+{
+  int64_t det = (int64_t)(pRaw[0].X - pRaw[2].X) * (pRaw[1].Y - pRaw[2].Y) -
+                (int64_t)(pRaw[1].X - pRaw[2].X) * (pRaw[0].Y - pRaw[2].Y);
+  int64_t screen[3];
+  uint32_t i;
+
+  if(det == 0)
+  {
+    return TS_ERROR;
+  }
+
+  for(i = 0; i < 3; i++)
+  {
+    screen[i] = pScreen[i].X;
+  }
+  pCalibration->C = TS_Solve(pRaw, screen, det, &pCalibration->A, &pCalibration->B);
+  for(i = 0; i < 3; i++)
+  {
+    screen[i] = pScreen[i].Y;
+  }
+  pCalibration->F = TS_Solve(pRaw, screen, det, &pCalibration->D, &pCalibration->E);
+
+  return TS_OK;
+}
+
+/**
+  * @brief  Maps a raw sample to the screen, clamped to the TS area.
+  * @note   Uncalibrated, the corrections of BSP_TS_GetState() are applied:
+  *         X = (3870 - x) / 15, or (3800 - x) / 15 above 3000, and
+  *         Y = (y - 360) / 11, truncated. Raw values off the TS area are
+  *         clamped to its edge, where BSP_TS_GetState() wraps them.
+  */
+static void TS_Map(uint32_t RawX, uint32_t RawY, TS_EventTypeDef *pEvent)
+{
+  int32_t x, y;
+
+  if(TsCalibrated)
+  {
+    x = (int32_t)(((int64_t)TsCalibration.A * RawX + (int64_t)TsCalibration.B * RawY + TsCalibration.C) >> 16);
+    y = (int32_t)(((int64_t)TsCalibration.D * RawX + (int64_t)TsCalibration.E * RawY + TsCalibration.F) >> 16);
+  }
+  else
+  {
+    x = (((RawX <= 3000) ? 3870 : 3800) - (int32_t)RawX) / 15;
+    y = ((int32_t)RawY - 360) / 11;
+  }
+
+  pEvent->X = (x < 0) ? 0 : ((x >= TsXBoundary) ? TsXBoundary - 1 : x);
+  pEvent->Y = (y < 0) ? 0 : ((y >= TsYBoundary) ? TsYBoundary - 1 : y);
+}
+
+/**
+  * @brief  Converts FIFO samples into events. A release gives a TS_EVENT_UP
+  *         event once the samples before it are read.
+  * @param  pStatus: TSC_CTRL to FIFO_SIZE registers read before the samples
+  * @param  pData: Count samples, 12 bits X, 12 bits Y, 8 bits Z each
+  * @param  pEvents: Count + 1 events
+  * @retval Number of events
+  */
+static uint32_t TS_Convert(uint32_t Timestamp, const uint8_t *pStatus, const uint8_t *pData, uint32_t Count, TS_EventTypeDef *pEvents)
+{
+  uint32_t i, n = 0;
+
+  for(i = 0; i < Count; i++)
+  {
+    TS_Map((pData[4 * i] << 4) | (pData[4 * i + 1] >> 4), ((pData[4 * i + 1] & 0x0F) << 8) | pData[4 * i + 2], &pEvents[n]);
+    pEvents[n].Timestamp = Timestamp;
+    pEvents[n].Z         = pData[4 * i + 3];
+    pEvents[n].Event     = TsTouching ? TS_EVENT_MOVE : TS_EVENT_DOWN;
+    TsTouching = 1;
+    TsLastX    = pEvents[n].X;
+    TsLastY    = pEvents[n].Y;
+    n++;
+  }
+
+  if(TsTouching && !(pStatus[0] & STMPE811_TS_CTRL_STATUS) && (Count == pStatus[STMPE811_REG_FIFO_SIZE - STMPE811_REG_TSC_CTRL]))
+  {
+    pEvents[n].Timestamp = Timestamp;
+    pEvents[n].X         = TsLastX;
+    pEvents[n].Y         = TsLastY;
+    pEvents[n].Z         = 0;
+    pEvents[n].Event     = TS_EVENT_UP;
+    TsTouching = 0;
+    n++;
+  }
+
+  return n;
+}
+
+/**
+  * @brief  Completion of a BSP_TS_FifoDrainStart() transaction: queues the
+  *         next one, or converts the samples and calls back.
+  */
+static void TS_DrainNext(I2C_BUS_TransactionTypeDef *pTransaction)
+{
+  uint32_t count = 0, n = 0;
+
+  if(pTransaction->State == I2C_BUS_DONE)
+  {
+    switch(TsDrainStep)
+    {
+    case TS_DRAIN_CLEAR:
+      /* TSC_CTRL to FIFO_SIZE in one read: touch status and FIFO level */
+      TsDrainStep = TS_DRAIN_STATUS;
+      pTransaction->Type       = I2C_BUS_READ;
+      pTransaction->MemAddress = STMPE811_REG_TSC_CTRL;
+      pTransaction->pData      = TsStatus;
+      pTransaction->Length     = TS_STATUS_SIZE;
+      IOE_Submit(pTransaction);
+      return;
+
+    case TS_DRAIN_STATUS:
+      count = TsStatus[STMPE811_REG_FIFO_SIZE - STMPE811_REG_TSC_CTRL];
+      if(count > TS_FIFO_BURST)
+      {
+        count = TS_FIFO_BURST;
+      }
+      if(count > 0)
+      {
+        TsDrainStep = TS_DRAIN_DATA;
+        pTransaction->MemAddress = STMPE811_REG_TSC_DATA_NON_INC;
+        pTransaction->pData      = TsData;
+        pTransaction->Length     = count * 4;
+        IOE_Submit(pTransaction);
+        return;
+      }
+      n = TS_Convert(TsTimestamp, TsStatus, TsData, 0, TsEvents);
+      break;
+
+    case TS_DRAIN_DATA:
+      n = TS_Convert(TsTimestamp, TsStatus, TsData, pTransaction->Length / 4, TsEvents);
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  /* Idle before the callback, which may start the next drain */
+  TsDrainStep = TS_DRAIN_IDLE;
+  if(TsDrainCallback != NULL)
+  {
+    TsDrainCallback(TsEvents, n, TsDrainContext);
+  }
+}
+
+/**
+  * @brief  Solves Screen = A * RawX + B * RawY + C on 3 points, Cramer's rule.
+  * @retval C, in 16.16 fixed point with the rounding of TS_Map() included
+  */
+static int32_t TS_Solve(const TS_PointTypeDef *pRaw, const int64_t *pScreen, int64_t Det, int32_t *pA, int32_t *pB)
+{
+  int64_t dx0 = pRaw[0].X - pRaw[2].X, dy0 = pRaw[0].Y - pRaw[2].Y;
+  int64_t dx1 = pRaw[1].X - pRaw[2].X, dy1 = pRaw[1].Y - pRaw[2].Y;
+  int64_t ds0 = pScreen[0] - pScreen[2], ds1 = pScreen[1] - pScreen[2];
+
+  *pA = (int32_t)(((ds0 * dy1 - ds1 * dy0) * 65536) / Det);
+  *pB = (int32_t)(((dx0 * ds1 - dx1 * ds0) * 65536) / Det);
+
+  return (int32_t)(pScreen[2] * 65536 - (int64_t)*pA * pRaw[2].X - (int64_t)*pB * pRaw[2].Y + 0x8000);
+}
+
 /**
   * @}
   */ 
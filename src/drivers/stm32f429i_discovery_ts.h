@@ -44,6 +44,7 @@
    
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f429i_discovery.h"
+#include "stm32f429i_discovery_i2c.h"
 /* Include TouchScreen component driver */
 #include "stmpe811.h"   
    
@@ -69,6 +70,37 @@ typedef struct
   uint16_t Y;
   uint16_t Z;
 }TS_StateTypeDef;
+
+/* Raw to screen mapping, in 16.16 fixed point:
+   X = (A * RawX + B * RawY + C) >> 16, Y = (D * RawX + E * RawY + F) >> 16 */
+typedef struct
+{
+  int32_t A;
+  int32_t B;
+  int32_t C;
+  int32_t D;
+  int32_t E;
+  int32_t F;
+}TS_CalibrationTypeDef;
+
+typedef struct
+{
+  int32_t X;
+  int32_t Y;
+}TS_PointTypeDef;
+
+typedef struct
+{
+  uint32_t Timestamp;   /*!< Time of the interrupt that delivered the sample */
+  uint16_t X;
+  uint16_t Y;
+  uint8_t  Z;           /*!< Pressure, 0 for TS_EVENT_UP */
+  uint8_t  Event;       /*!< TS_EVENT_DOWN, TS_EVENT_MOVE or TS_EVENT_UP */
+}TS_EventTypeDef;
+
+/* Called from the I2C interrupt at the end of BSP_TS_FifoDrainStart(), the
+   events are only valid during the call */
+typedef void (*TS_DrainCallbackTypeDef)(const TS_EventTypeDef *pEvents, uint32_t Count, void *pContext);
 /**
   * @}
   */
@@ -81,6 +113,13 @@ typedef struct
 #define TS_SWAP_Y                       0x02
 #define TS_SWAP_XY                      0x04
 
+#define TS_EVENT_DOWN                   0x00
+#define TS_EVENT_MOVE                   0x01
+#define TS_EVENT_UP                     0x02
+
+#define TS_FIFO_DEPTH                   128   /* Samples */
+#define TS_FIFO_BURST                   32    /* Samples read per drain */
+
 typedef enum 
 {
   TS_OK       = 0x00,
@@ -107,10 +146,19 @@ uint8_t BSP_TS_ITConfig(void);
 uint8_t BSP_TS_ITGetStatus(void);
 void    BSP_TS_ITClear(void);
 
+uint8_t  BSP_TS_FifoInit(uint16_t XSize, uint16_t YSize, uint8_t Threshold);
+uint32_t BSP_TS_FifoDrain(uint32_t Timestamp, TS_EventTypeDef *pEvents, uint32_t MaxEvents);
+uint8_t  BSP_TS_FifoDrainStart(uint32_t Timestamp, TS_DrainCallbackTypeDef pCallback, void *pContext);
+void     BSP_TS_SetCalibration(const TS_CalibrationTypeDef *pCalibration);
+uint8_t  BSP_TS_ComputeCalibration(const TS_PointTypeDef *pRaw, const TS_PointTypeDef *pScreen, TS_CalibrationTypeDef *pCalibration);
+
 /**
   * @}
   */ 
 
+/* Link function for the IO expander, asynchronous */
+void     IOE_Submit(I2C_BUS_TransactionTypeDef *pTransaction);
+
 /**
   * @}
   */
@@ -0,0 +1,221 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_uart.c
+  * @brief   This file provides DMA transmission on USART1, the ST-LINK
+  *          virtual COM port.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this driver:
+--------------------------
+   - BSP_UART_TX_Init() takes USART1 over from the mbed console at the given
+     baud rate. printf() and the mbed serial classes may not be used on it
+     afterwards: their bytes would be mixed with those sent by the DMA.
+   - BSP_UART_TX_Send() starts sending a buffer, which must stay unchanged
+     until BSP_UART_TX_CpltCallback() is called, or BSP_UART_TX_IsBusy()
+     returns 0. Only one buffer is sent at a time.
+
+2. Driver description:
+---------------------
+   - The DMA stream writes the data register each time it is empty, so
+     sending takes no CPU time. The completion interrupt comes when the DMA
+     wrote the last byte, while it is still being shifted out: the next
+     buffer may be started at once.
+   - The receiver is left enabled, but nothing reads it.
+
+------------------------------------------------------------------------------*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery_uart.h"
+#include "cmsis_nvic.h" // Added for mbed
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_UART STM32F429I DISCOVERY UART
+  * @brief This file includes the USART1 DMA transmitter
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_UART_Private_Variables STM32F429I DISCOVERY UART Private Variables
+  * @{
+  */
+static UART_HandleTypeDef UartTxHandle;
+static DMA_HandleTypeDef  UartTxDma;
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_UART_Private_FunctionPrototypes STM32F429I DISCOVERY UART Private FunctionPrototypes
+  * @{
+  */
+static void UART_TX_Complete(DMA_HandleTypeDef *hdma);
+static void UART_TX_Error(DMA_HandleTypeDef *hdma);
+static void UART_TX_IRQHandler(void);
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_UART_Private_Functions STM32F429I DISCOVERY UART Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Configures USART1 and its transmit DMA stream.
+  * @param  BaudRate: bits per second, up to 5625000
+  * @retval UART_TX_OK or UART_TX_ERROR
+  */
+uint8_t BSP_UART_TX_Init(uint32_t BaudRate)
+{
+  GPIO_InitTypeDef gpio_init_structure;
+  uint32_t tickstart = HAL_GetTick();
+
+  UART_TX_CLK_ENABLE();
+  UART_TX_GPIO_CLK_ENABLE();
+  UART_TX_DMA_CLK_ENABLE();
+
+  /* Let the console finish its last byte */
+  if(UART_TX_INSTANCE->CR1 & USART_CR1_UE)
+  {
+    while(((UART_TX_INSTANCE->SR & USART_SR_TC) == 0) && ((HAL_GetTick() - tickstart) < UART_TX_TIMEOUT))
+    {
+    }
+  }
+
+  gpio_init_structure.Pin       = UART_TX_PIN;
+  gpio_init_structure.Mode      = GPIO_MODE_AF_PP;
+  gpio_init_structure.Pull      = GPIO_PULLUP;
+  gpio_init_structure.Speed     = GPIO_SPEED_FAST;
+  gpio_init_structure.Alternate = UART_TX_AF;
+  HAL_GPIO_Init(UART_TX_GPIO_PORT, &gpio_init_structure);
+
+  UartTxHandle.Instance          = UART_TX_INSTANCE;
+  UartTxHandle.Init.BaudRate     = BaudRate;
+  UartTxHandle.Init.WordLength   = UART_WORDLENGTH_8B;
+  UartTxHandle.Init.StopBits     = UART_STOPBITS_1;
+  UartTxHandle.Init.Parity       = UART_PARITY_NONE;
+  UartTxHandle.Init.Mode         = UART_MODE_TX_RX;
+  UartTxHandle.Init.HwFlowCtl    = UART_HWCONTROL_NONE;
+  UartTxHandle.Init.OverSampling = UART_OVERSAMPLING_16;
+  if(HAL_UART_Init(&UartTxHandle) != HAL_OK)
+  {
+    return UART_TX_ERROR;
+  }
+  SET_BIT(UART_TX_INSTANCE->CR3, USART_CR3_DMAT);
+
+  UartTxDma.Instance                 = UART_TX_DMA_STREAM;
+  UartTxDma.Init.Channel             = UART_TX_DMA_CHANNEL;
+  UartTxDma.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+  UartTxDma.Init.PeriphInc           = DMA_PINC_DISABLE;
+  UartTxDma.Init.MemInc              = DMA_MINC_ENABLE;
+  UartTxDma.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  UartTxDma.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  UartTxDma.Init.Mode                = DMA_NORMAL;
+  UartTxDma.Init.Priority            = DMA_PRIORITY_LOW;
+  UartTxDma.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;
+  UartTxDma.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
+  UartTxDma.Init.MemBurst            = DMA_MBURST_SINGLE;
+  UartTxDma.Init.PeriphBurst         = DMA_PBURST_SINGLE;
+  HAL_DMA_DeInit(&UartTxDma);
+  if(HAL_DMA_Init(&UartTxDma) != HAL_OK)
+  {
+    return UART_TX_ERROR;
+  }
+  UartTxDma.XferCpltCallback  = UART_TX_Complete;
+  UartTxDma.XferErrorCallback = UART_TX_Error;
+
+  NVIC_SetVector(UART_TX_DMA_IRQn, (uint32_t)UART_TX_IRQHandler);
+  NVIC_SetPriority(UART_TX_DMA_IRQn, UART_TX_IRQ_PREPRIO);
+  NVIC_EnableIRQ(UART_TX_DMA_IRQn);
+
+  return UART_TX_OK;
+}
+
+/**
+  * @brief  Starts sending a buffer.
+  * @param  pData: bytes sent, must stay unchanged until the end
+  * @param  Length: number of bytes, not 0
+  * @retval UART_TX_OK, UART_TX_BUSY if a buffer is being sent, UART_TX_ERROR
+  */
+uint8_t BSP_UART_TX_Send(const uint8_t *pData, uint16_t Length)
+{
+  HAL_StatusTypeDef status = HAL_DMA_Start_IT(&UartTxDma, (uint32_t)pData, (uint32_t)&UART_TX_INSTANCE->DR, Length);
+
+  if(status == HAL_BUSY)
+  {
+    return UART_TX_BUSY;
+  }
+  return (status == HAL_OK) ? UART_TX_OK : UART_TX_ERROR;
+}
+
+/**
+  * @brief  Tells whether a buffer is being sent.
+  * @retval 1 if so, 0 otherwise
+  */
+uint8_t BSP_UART_TX_IsBusy(void)
+{
+  return (HAL_DMA_GetState(&UartTxDma) == HAL_DMA_STATE_BUSY) ? 1 : 0;
+}
+
+/**
+  * @brief  BSP_UART_TX_Send() buffer sent, from the DMA interrupt.
+  */
+__weak void BSP_UART_TX_CpltCallback(void)
+{
+}
+
+/**
+  * @brief  BSP_UART_TX_Send() transfer failed, from the DMA interrupt.
+  */
+__weak void BSP_UART_TX_ErrorCallback(void)
+{
+}
+
+/**
+  * @brief  DMA transfer complete.
+  * @param  hdma: DMA handle
+  */
+static void UART_TX_Complete(DMA_HandleTypeDef *hdma)
+{
+  BSP_UART_TX_CpltCallback();
+}
+
+/**
+  * @brief  DMA transfer error.
+  * @param  hdma: DMA handle
+  */
+static void UART_TX_Error(DMA_HandleTypeDef *hdma)
+{
+  BSP_UART_TX_ErrorCallback();
+}
+
+/**
+  * @brief  Transmit stream interrupt.
+  */
+static void UART_TX_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&UartTxDma);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
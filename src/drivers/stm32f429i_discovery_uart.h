@@ -0,0 +1,91 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_uart.h
+  * @brief   This file contains the common defines and functions prototypes for
+  *          the stm32f429i_discovery_uart.c driver.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F429I_DISCOVERY_UART_H
+#define __STM32F429I_DISCOVERY_UART_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY
+  * @{
+  */
+
+/** @addtogroup STM32F429I_DISCOVERY_UART
+  * @{
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_UART_Exported_Constants STM32F429I DISCOVERY UART Exported Constants
+  * @{
+  */
+#define UART_TX_OK                      0
+#define UART_TX_BUSY                    1
+#define UART_TX_ERROR                   2
+
+/* USART1, the ST-LINK virtual COM port: TX on PA9 */
+#define UART_TX_INSTANCE                USART1
+#define UART_TX_CLK_ENABLE()            __HAL_RCC_USART1_CLK_ENABLE()
+#define UART_TX_GPIO_PORT               GPIOA
+#define UART_TX_GPIO_CLK_ENABLE()       __HAL_RCC_GPIOA_CLK_ENABLE()
+#define UART_TX_PIN                     GPIO_PIN_9
+#define UART_TX_AF                      GPIO_AF7_USART1
+
+/* USART1 transmit DMA stream */
+#define UART_TX_DMA_CLK_ENABLE()        __HAL_RCC_DMA2_CLK_ENABLE()
+#define UART_TX_DMA_CHANNEL             DMA_CHANNEL_4
+#define UART_TX_DMA_STREAM              DMA2_Stream7
+#define UART_TX_DMA_IRQn                DMA2_Stream7_IRQn
+#define UART_TX_IRQ_PREPRIO             0x0E
+
+/* Wait for the last byte sent by the console before a new baud rate */
+#define UART_TX_TIMEOUT                 ((uint32_t)100)
+/**
+  * @}
+  */
+
+/** @defgroup STM32F429I_DISCOVERY_UART_Exported_Functions STM32F429I DISCOVERY UART Exported Functions
+  * @{
+  */
+uint8_t BSP_UART_TX_Init(uint32_t BaudRate);
+uint8_t BSP_UART_TX_Send(const uint8_t *pData, uint16_t Length);
+uint8_t BSP_UART_TX_IsBusy(void);
+
+/* User callbacks, from the DMA interrupt */
+void    BSP_UART_TX_CpltCallback(void);
+void    BSP_UART_TX_ErrorCallback(void);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F429I_DISCOVERY_UART_H */
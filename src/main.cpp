@@ -8,118 +8,322 @@
 
 #include "mbed.h"
 #include "drivers/LCD_DISCO_F429ZI.h"
+#include "drivers/TS_DISCO_F429ZI.h"
+#include "drivers/l3gd20.h"
+#include "drivers/stm32f429i_discovery_spi.h"
+#include "ui/Compositor.h"
+#include "util/EepromLog.h"
+#include "util/Recorder.h"
+#include "util/Telemetry.h"
+#include "util/TremorPipeline.h"
+#include "util/TokenLog.h"
 #include "arm_math.h"
 
-// Serial communication for debugging
-BufferedSerial pc(USBTX, USBRX);
+// Binary records to the host on the ST-LINK virtual COM port, by DMA. Text
+// goes as records too: printf may not be used once it is started
+Telemetry telemetry;
+#define TELEMETRY_BAUD 921600
 
 // LCD instance
 LCD_DISCO_F429ZI lcd;
 
-// SPI and gyroscope configuration
-#define CTRL_REG1_ADDR 0x20
+// Static chrome on the background layer, values and traces on the color keyed
+// foreground layer. Both must be built after lcd
+Compositor screens(LCD_COLOR_WHITE);
+Label title(0, 24, 240, "Tremor Level", CENTER_MODE);
+Panel levelTrack(20, 96, 200, 12);
+Label axisName[3] = { Label(4, 152, 11, "X"), Label(4, 208, 11, "Y"), Label(4, 264, 11, "Z") };
+Panel axisTrack[3] = { Panel(20, 136, 216, 48), Panel(20, 192, 216, 48), Panel(20, 248, 216, 48) };
+
+Value level(0, 60, 240, 2, CENTER_MODE);
+Bar levelBar(20, 96, 200, 12, 0, 500);
+Plot axisPlot[3] = { Plot(20, 136, 216, 48, -8192, 8191), Plot(20, 192, 216, 48, -8192, 8191),
+                     Plot(20, 248, 216, 48, -8192, 8191) };
+const uint32_t axisColor[3] = { LCD_COLOR_RED, LCD_COLOR_DARKGREEN, LCD_COLOR_BLUE };
+
+// Touch screen, drained by the I2C interrupt: a touch is logged with the
+// sample it came at, for the host tools to line up with the capture
+TS_DISCO_F429ZI ts;
+
+// Records kept in the EEPROM across resets. The last four sessions are kept,
+// each under its own key
+EepromLog storage;
+#define KEY_BOOTS 0x01
+#define KEY_SESSION_BASE 0x10
+#define SESSIONS_KEPT 4
+#define SUMMARY_PERIOD_S 60
+
+struct SessionSummary {
+    uint32_t session;
+    uint32_t seconds;
+    uint32_t maxLevel;      // Hundredths
+    uint32_t mildSeconds;
+    uint32_t severeSeconds;
+};
+
+// Gyroscope configuration. The L3GD20 shares SPI5 with the LCD controller,
+// all the transfers go through the bus arbiter, gyroscope first
 #define CTRL_REG1_VAL 0x6F
-#define CTRL_REG4_ADDR 0x23
 #define CTRL_REG4_VAL 0x20
-#define CTRL_REG3_ADDR 0x22
 #define CTRL_REG3_VAL 0x08
-#define GYRO_OUT_X_L 0x28
-#define SPI_FLAG 1
-#define DATA_FLAG 2
+#define STATS_PERIOD 100
+
+// The FIFO in stream mode keeps the last 32 samples: the sampler thread
+// drains it well before it overflows and records every sample in SDRAM
+#define CTRL_REG5_VAL 0x40
+#define FIFO_CTRL_REG_VAL 0x40
+#define FIFO_SRC_OVRN 0x40
+#define FIFO_SRC_FSS 0x1F
+#define GYRO_FIFO_SIZE 32
+#define GYRO_RATE_HZ 190
+#define SAMPLER_PERIOD 20ms
+
+// Tremor onsets are kept with 5 s before and 10 s after
+#define MARK_ONSET 1
+#define ONSET_PRE_SAMPLES (5 * GYRO_RATE_HZ)
+#define ONSET_POST_SAMPLES (10 * GYRO_RATE_HZ)
+
+Recorder recorder;
+// Telemetry number of the recorder sample 0, they differ once the recorder drops samples
+uint32_t recorderBase = 0;
+Thread sampler(osPriorityAboveNormal, 2048, nullptr, "sampler");
+Mutex latestLock;
+int16_t latest[3];
+
+// Every sample is rated by the sampler thread, with the code that the host
+// tools run on captures
+TremorPipeline pipeline;
+
+void initializeGyro() {
+    uint8_t value;
+
+    GYRO_IO_Init();
+    value = CTRL_REG1_VAL;
+    GYRO_IO_Write(&value, L3GD20_CTRL_REG1_ADDR, 1);
+    value = CTRL_REG4_VAL;
+    GYRO_IO_Write(&value, L3GD20_CTRL_REG4_ADDR, 1);
+    value = CTRL_REG3_VAL;
+    GYRO_IO_Write(&value, L3GD20_CTRL_REG3_ADDR, 1);
+    value = CTRL_REG5_VAL;
+    GYRO_IO_Write(&value, L3GD20_CTRL_REG5_ADDR, 1);
+    value = FIFO_CTRL_REG_VAL;
+    GYRO_IO_Write(&value, L3GD20_FIFO_CTRL_REG_ADDR, 1);
+}
+
+// Reads the samples waiting in the FIFO, oldest first
+uint32_t readGyroFifo(int16_t *samples) {
+    uint8_t source;
+    uint8_t data[GYRO_FIFO_SIZE * 6];
+
+    GYRO_IO_Read(&source, L3GD20_FIFO_SRC_REG_ADDR, 1);
+    uint32_t count = (source & FIFO_SRC_OVRN) ? GYRO_FIFO_SIZE : (source & FIFO_SRC_FSS);
+    if (source & FIFO_SRC_OVRN) {
+        TOKEN_LOG("Gyro FIFO overrun after sample %u", telemetry.GetSamples());
+    }
+    if (count == 0) {
+        return 0;
+    }
+    // In FIFO mode the address wraps from OUT_Z_H back to OUT_X_L
+    GYRO_IO_Read(data, L3GD20_OUT_X_L_ADDR, count * 6);
+    for (uint32_t i = 0; i < count * 3; i++) {
+        samples[i] = (int16_t)(((uint16_t)data[2 * i + 1] << 8) | (uint16_t)data[2 * i]);
+    }
+    return count;
+}
+
+void sampleGyro() {
+    int16_t samples[GYRO_FIFO_SIZE * 3];
+
+    while (true) {
+        uint32_t count = readGyroFifo(samples);
+        if (count > 0) {
+            uint32_t now = (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+                Kernel::Clock::now().time_since_epoch()).count();
+            recorderBase = telemetry.GetSamples() - recorder.GetCount();
+            recorder.Push(samples, count, now);
+            latestLock.lock();
+            pipeline.Process(TremorPipeline::Interleaved(samples, count, telemetry.GetSamples()));
+            memcpy(latest, &samples[(count - 1) * 3], sizeof(latest));
+            latestLock.unlock();
+            telemetry.PushSamples(samples, count);
+        }
+        ThisThread::sleep_for(SAMPLER_PERIOD);
+    }
+}
 
-EventFlags eventFlags;
+// Latest sample, its level and its number in the telemetry stream
+uint32_t fetchGyroData(int16_t *raw, float &level, TremorPipeline::Summary &totals) {
+    latestLock.lock();
+    memcpy(raw, latest, sizeof(latest));
+    level = pipeline.GetLevel();
+    totals = pipeline.GetSummary();
+    uint32_t number = pipeline.GetLast();
+    latestLock.unlock();
+    return number;
+}
 
-void spiCallback(int event) {
-    eventFlags.set(SPI_FLAG);
+// From the sampler thread
+void onTremorOnset(uint32_t sample, float level, void *context) {
+    (void)context;
+    uint32_t mark = recorder.TriggerAt(sample - recorderBase, MARK_ONSET, ONSET_PRE_SAMPLES, ONSET_POST_SAMPLES);
+    TOKEN_LOG("Tremor onset: mark %u at sample %u, level %d", mark, sample, TremorDetector::Hundredths(level));
 }
 
-void setupSPI(SPI &spi, uint8_t *txBuffer, uint8_t *rxBuffer) {
-    spi.transfer(txBuffer, 2, rxBuffer, 2, spiCallback);
-    eventFlags.wait_all(SPI_FLAG);
+// Worst case gyroscope latency on the shared bus since the last report
+void reportBusLatency() {
+    SPI_BUS_StatsTypeDef stats;
+
+    BSP_SPI_BUS_GetStats(SPI_BUS_PRIORITY_HIGH, &stats);
+    BSP_SPI_BUS_ResetStats();
+    TOKEN_LOG("Gyro SPI: reads=%u, max wait=%uus, max total=%uus", stats.Count, stats.MaxWaitUs, stats.MaxTotalUs);
+    TOKEN_LOG("Gyro SPI: preemptions=%u, errors=%u, telemetry dropped=%u, log dropped=%u", stats.Preemptions,
+              stats.Errors, telemetry.GetDropped(), TokenLog::GetDropped());
+    TOKEN_LOG("Touch: events dropped=%u", ts.GetDropped());
 }
 
-void initializeGyro(SPI &spi) {
-    uint8_t txBuffer[2] = {0}, rxBuffer[2] = {0};
+// Log entries go out in as few records as they fit in
+void sendLogs() {
+    static uint8_t buffer[Telemetry::MAX_PAYLOAD];
+    uint32_t length;
 
-    txBuffer[0] = CTRL_REG1_ADDR;
-    txBuffer[1] = CTRL_REG1_VAL;
-    setupSPI(spi, txBuffer, rxBuffer);
+    while ((length = TokenLog::Read(buffer, sizeof(buffer))) > 0) {
+        telemetry.Send(Telemetry::RECORD_LOG, buffer, length);
+    }
+}
 
-    txBuffer[0] = CTRL_REG4_ADDR;
-    txBuffer[1] = CTRL_REG4_VAL;
-    setupSPI(spi, txBuffer, rxBuffer);
+// Touches since the last loop, each logged once
+void readTouches(uint32_t number) {
+    TS_EventTypeDef event;
 
-    txBuffer[0] = CTRL_REG3_ADDR;
-    txBuffer[1] = CTRL_REG3_VAL;
-    setupSPI(spi, txBuffer, rxBuffer);
+    while (ts.GetEvent(event)) {
+        if (event.Event == TS_EVENT_DOWN) {
+            TOKEN_LOG("Touch at %u,%u, sample %u", event.X, event.Y, number);
+        }
+    }
 }
 
-void fetchGyroData(SPI &spi, float &x, float &y, float &z) {
-    uint8_t txBuffer[7] = {0}, rxBuffer[7] = {0};
-    txBuffer[0] = GYRO_OUT_X_L | 0xC0;
+// Boot counter, also the number of the session that starts
+uint32_t loadBootCount() {
+    uint32_t boots = 0;
 
-    spi.transfer(txBuffer, 7, rxBuffer, 7, spiCallback);
-    eventFlags.wait_all(SPI_FLAG);
+    if (storage.Init() != EepromLog::LOG_OK) {
+        telemetry.Print("EEPROM not found, session summaries will not be kept.\n");
+        return 0;
+    }
+    storage.Get(KEY_BOOTS, &boots, sizeof(boots));
+    boots++;
+    storage.Put(KEY_BOOTS, &boots, sizeof(boots));
+    TOKEN_LOG("Session %u.", boots);
+    return boots;
+}
 
-    int16_t rawX = (int16_t)(((uint16_t)rxBuffer[2] << 8) | (uint16_t)rxBuffer[1]);
-    int16_t rawY = (int16_t)(((uint16_t)rxBuffer[4] << 8) | (uint16_t)rxBuffer[3]);
-    int16_t rawZ = (int16_t)(((uint16_t)rxBuffer[6] << 8) | (uint16_t)rxBuffer[5]);
+// Time at each level is counted in samples, stored in seconds
+void updateSession(SessionSummary &summary, const TremorPipeline::Summary &totals) {
+    summary.maxLevel = (uint32_t)totals.MaxLevel;
+    summary.mildSeconds = totals.MildSamples / GYRO_RATE_HZ;
+    summary.severeSeconds = totals.SevereSamples / GYRO_RATE_HZ;
+}
 
-    x = rawX * 0.0003054f;
-    y = rawY * 0.0003054f;
-    z = rawZ * 0.0003054f;
+void setScreenColors(uint32_t foreColor, uint32_t backColor) {
+    // Chrome only, the overlay keeps showing it through
+    screens.Chrome().SetColors(foreColor, backColor);
+    title.SetColors(foreColor, backColor);
+    for (int i = 0; i < 3; i++) {
+        axisName[i].SetColors(foreColor, backColor);
+    }
+    level.SetColors(foreColor, screens.GetTransparentColor());
 }
 
 void displayTremorLevel(float tremorLevel) {
-    char buffer[32];
-    if (tremorLevel > 1.0f && tremorLevel < 3.0f) {
-        lcd.Clear(LCD_COLOR_GREEN);
-        lcd.SetBackColor(LCD_COLOR_GREEN);
-        lcd.SetTextColor(LCD_COLOR_WHITE);
-        sprintf(buffer, "Mild Tremor: %.2f", tremorLevel);
-    } else if (tremorLevel >= 3.0f) {
-        lcd.Clear(LCD_COLOR_RED);
-        lcd.SetBackColor(LCD_COLOR_RED);
-        lcd.SetTextColor(LCD_COLOR_WHITE);
-        sprintf(buffer, "Severe Tremor: %.2f", tremorLevel);
+    uint8_t severity = TremorDetector::Severity(tremorLevel);
+
+    if (severity == TremorDetector::MILD) {
+        setScreenColors(LCD_COLOR_WHITE, LCD_COLOR_GREEN);
+        level.SetAffixes("Mild Tremor: ", "");
+    } else if (severity == TremorDetector::SEVERE) {
+        setScreenColors(LCD_COLOR_WHITE, LCD_COLOR_RED);
+        level.SetAffixes("Severe Tremor: ", "");
     } else {
-        lcd.Clear(LCD_COLOR_WHITE);
-        lcd.SetBackColor(LCD_COLOR_WHITE);
-        lcd.SetTextColor(LCD_COLOR_BLACK);
-        sprintf(buffer, "No Tremor: %.2f", tremorLevel);
+        setScreenColors(LCD_COLOR_BLACK, LCD_COLOR_WHITE);
+        level.SetAffixes("No Tremor: ", "");
     }
-    lcd.DisplayStringAt(0, LINE(5), (uint8_t *)"Tremor Level", CENTER_MODE);
-    lcd.DisplayStringAt(0, LINE(7), (uint8_t *)buffer, CENTER_MODE);
+    int32_t centi = TremorDetector::Hundredths(tremorLevel);
+    level.SetValue(centi);
+    levelBar.SetValue(centi);
+    screens.Render();
 }
 
 int main() {
-    // Initialize the serial port for debugging
-    pc.set_baud(9600);
-    printf("Starting application...\n");
+    // mbed_app.json gives the console the same rate, for the mbed error messages
+    telemetry.Init(TELEMETRY_BAUD);
+    telemetry.Print("Starting application...\n");
 
     // Initialize the LCD
-    lcd.Clear(LCD_COLOR_WHITE);
-    lcd.SetBackColor(LCD_COLOR_WHITE);
-    lcd.SetTextColor(LCD_COLOR_BLACK);
-    lcd.DisplayStringAt(0, LINE(5), (uint8_t *)"Tremor Detector Initialized", CENTER_MODE);
-    printf("LCD initialization complete.\n");
-
-    // Configure SPI device
-    SPI spiDevice(PF_9, PF_8, PF_7, PC_1, use_gpio_ssel);
-    printf("Initializing gyroscope...\n");
-    initializeGyro(spiDevice);
-    printf("Gyroscope initialization complete.\n");
-
-    float x = 0, y = 0, z = 0;
-    while (true) {
-        fetchGyroData(spiDevice, x, y, z);
-        printf("Gyro data: x=%f, y=%f, z=%f\n", x, y, z);
+    title.SetText("Initializing...");
+    // The chrome is redrawn whole on a severity change: compose it in SRAM tiles
+    screens.Chrome().SetTiled(true);
+    screens.Chrome().Add(title);
+    screens.Chrome().Add(levelTrack);
+    levelTrack.SetColors(LCD_COLOR_LIGHTGRAY, LCD_COLOR_LIGHTGRAY);
+    screens.Overlay().Add(level);
+    screens.Overlay().Add(levelBar);
+    levelBar.SetColors(LCD_COLOR_DARKGRAY, screens.GetTransparentColor());
+    for (int i = 0; i < 3; i++) {
+        screens.Chrome().Add(axisName[i]);
+        screens.Chrome().Add(axisTrack[i]);
+        axisTrack[i].SetColors(LCD_COLOR_LIGHTGRAY, LCD_COLOR_LIGHTGRAY);
+        screens.Overlay().Add(axisPlot[i]);
+        axisPlot[i].SetColors(axisColor[i], screens.GetTransparentColor());
+    }
+    screens.Render();
+    telemetry.Print("LCD initialization complete.\n");
+
+    telemetry.Print("Initializing gyroscope...\n");
+    recorder.Init();
+    initializeGyro();
+    pipeline.SetOnsetCallback(onTremorOnset, nullptr);
+    sampler.start(sampleGyro);
+    telemetry.Print("Gyroscope initialization complete.\n");
+    title.SetText("Tremor Level");
+    if (ts.Start(lcd.GetXSize(), lcd.GetYSize()) != TS_OK) {
+        telemetry.Print("Touch screen not found.\n");
+    }
 
-        // float tremorLevel = (fabs(x) + fabs(y) + fabs(z)) / 3.0f;
-        float tremorLevel = (fabs(x) + fabs(y) + fabs(z)) / 1.0f;
-        // float tremorLevel = (fabs(x) + fabs(z)) / 2.0f;
+    SessionSummary summary = {};
+    summary.session = loadBootCount();
+    uint8_t sessionKey = KEY_SESSION_BASE + summary.session % SESSIONS_KEPT;
+    Timer sessionTimer;
+    sessionTimer.start();
+
+    int16_t raw[3];
+    float tremorLevel;
+    TremorPipeline::Summary totals;
+    uint32_t samples = 0;
+    BSP_SPI_BUS_ResetStats();
+    while (true) {
+        uint32_t number = fetchGyroData(raw, tremorLevel, totals);
+        for (int i = 0; i < 3; i++) {
+            axisPlot[i].Push(raw[i]);
+        }
         displayTremorLevel(tremorLevel);
 
+        uint32_t now = (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(sessionTimer.elapsed_time()).count();
+        Telemetry::Level record = { now, number, TremorDetector::Hundredths(tremorLevel) };
+        telemetry.Send(Telemetry::RECORD_LEVEL, &record, sizeof(record));
+        updateSession(summary, totals);
+        if (now / 1000 >= summary.seconds + SUMMARY_PERIOD_S) {
+            summary.seconds = now / 1000;
+            storage.Put(sessionKey, &summary, sizeof(summary));
+        }
+
+        readTouches(number);
+
+        if (++samples == STATS_PERIOD) {
+            samples = 0;
+            reportBusLatency();
+        }
+        sendLogs();
+
         // ThisThread::sleep_for(500ms);
         ThisThread::sleep_for(150ms);
     }
@@ -0,0 +1,57 @@
+#include "Compositor.h"
+
+// Constructor
+Compositor::Compositor(uint32_t ChromeColor, ModeTypeDef Mode, uint32_t KeyColor)
+  : _transparent((Mode == KEYED) ? (KeyColor | 0xFF000000) : 0x00000000),
+    _chrome(LCD_BACKGROUND_LAYER, ChromeColor),
+    _overlay(LCD_FOREGROUND_LAYER, _transparent)
+{
+  // Same frame buffers as LCD_DISCO_F429ZI, the overlay window may have been narrowed
+  BSP_LCD_LayerDefaultInit(LCD_FOREGROUND_LAYER, SDRAM_LCD_LAYER1_ADDR);
+  if (Mode == KEYED) {
+    BSP_LCD_SetColorKeying(LCD_FOREGROUND_LAYER, _transparent & 0x00FFFFFF);
+  } else {
+    BSP_LCD_ResetColorKeying(LCD_FOREGROUND_LAYER);
+  }
+
+  // Both trees are drawn completely before the overlay shows
+  Render();
+  BSP_LCD_SetLayerVisible(LCD_BACKGROUND_LAYER, ENABLE);
+  BSP_LCD_SetLayerVisible(LCD_FOREGROUND_LAYER, ENABLE);
+}
+
+// Destructor
+Compositor::~Compositor()
+{
+  BSP_DMA2D_WaitIdle();
+  BSP_LCD_SetLayerVisible(LCD_FOREGROUND_LAYER, DISABLE);
+}
+
+//=================================================================================================================
+// Public methods
+//=================================================================================================================
+
+Screen &Compositor::Chrome(void)
+{
+  return _chrome;
+}
+
+Screen &Compositor::Overlay(void)
+{
+  return _overlay;
+}
+
+uint32_t Compositor::GetTransparentColor(void)
+{
+  return _transparent;
+}
+
+void Compositor::SetOverlayTransparency(uint8_t Transparency)
+{
+  BSP_LCD_SetTransparency(LCD_FOREGROUND_LAYER, Transparency);
+}
+
+uint32_t Compositor::Render(void)
+{
+  return _chrome.Render() + _overlay.Render();
+}
@@ -0,0 +1,96 @@
+#ifndef __COMPOSITOR_H
+#define __COMPOSITOR_H
+
+#include "mbed.h"
+#include "Widgets.h"
+
+/*
+  This class splits the screen into two widget trees, one per LCD layer, and
+  lets the LTDC merge them while scanning out:
+
+  - Chrome() on the background layer: titles, axes, legends. Drawn once and
+    again only when it changes, e.g. a new background color.
+  - Overlay() on the foreground layer, over the whole screen: values and
+    traces. Pixels in the transparent color, see GetTransparentColor(), show
+    the chrome through. Overlay widgets use it as their back color, so erasing
+    content uncovers the chrome instead of painting over it.
+
+  In KEYED mode the transparent color is an opaque color removed by the LTDC
+  color keying. In BLENDED mode it is 0x00000000 and the LTDC blends every
+  overlay pixel on its own alpha times the layer alpha, e.g. for a translucent
+  overlay. Neither the CPU nor the DMA2D read the chrome back.
+
+  Usage:
+
+  #include "mbed.h"
+  #include "LCD_DISCO_F429ZI.h"
+  #include "ui/Compositor.h"
+
+  LCD_DISCO_F429ZI lcd;
+  Compositor screens(LCD_COLOR_WHITE);
+  Label title(0, 20, 240, "Level", CENTER_MODE);
+  Value level(0, 60, 240, 2, CENTER_MODE);
+
+  int main()
+  {
+      screens.Chrome().Add(title);
+      screens.Overlay().Add(level);
+      level.SetColors(LCD_COLOR_BLACK, screens.GetTransparentColor());
+      while(1)
+      {
+          level.SetValue(read_sensor());
+          screens.Render();
+      }
+  }
+*/
+class Compositor
+{
+
+public:
+  typedef enum
+  {
+    KEYED   = 0,
+    BLENDED = 1
+  } ModeTypeDef;
+
+  //! Constructor, takes both layers over and makes the foreground layer full screen
+  Compositor(uint32_t ChromeColor, ModeTypeDef Mode = KEYED, uint32_t KeyColor = LCD_COLOR_MAGENTA);
+
+  //! Destructor
+  ~Compositor();
+
+  /**
+    * @brief  Gets the background layer tree.
+    */
+  Screen &Chrome(void);
+
+  /**
+    * @brief  Gets the foreground layer tree.
+    */
+  Screen &Overlay(void);
+
+  /**
+    * @brief  Gets the overlay color that shows the chrome.
+    * @retval Color code ARGB(8-8-8-8)
+    */
+  uint32_t GetTransparentColor(void);
+
+  /**
+    * @brief  Sets the overlay constant alpha, applied over the pixel alpha.
+    * @param  Transparency: 0 (invisible) to 255 (opaque)
+    */
+  void SetOverlayTransparency(uint8_t Transparency);
+
+  /**
+    * @brief  Draws what changed in both trees.
+    * @retval Number of fills and characters drawn
+    */
+  uint32_t Render(void);
+
+private:
+  uint32_t _transparent;
+  Screen   _chrome;
+  Screen   _overlay;
+};
+
+#endif
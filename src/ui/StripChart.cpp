@@ -0,0 +1,160 @@
+#include "StripChart.h"
+
+// Constructor
+StripChart::StripChart(uint32_t LayerIndex, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height,
+                       uint32_t BufferAddress, uint32_t BufferSize)
+  : _layer(LayerIndex), _height(Height), _head(0), _shownHead(0), _fence(0), _backColor(LCD_COLOR_BLACK)
+{
+  uint32_t total;
+
+  // The layer is ARGB8888, see BSP_LCD_LayerDefaultInit()
+  _rowBytes = Width * 4;
+  total = BufferSize / _rowBytes;
+  if (total > INT16_MAX) {
+    total = INT16_MAX;
+  }
+
+  // The history must at least fill the window once
+  MBED_ASSERT(total >= 2 * (uint32_t)Height);
+  _rows = total - Height;
+
+  _surface.Address   = BufferAddress;
+  _surface.Pitch     = Width;
+  _surface.ColorMode = DMA2D_ARGB8888;
+  _surface.ClipX0    = 0;
+  _surface.ClipY0    = 0;
+  _surface.ClipX1    = Width - 1;
+  _surface.ClipY1    = total - 1;
+
+  for (uint8_t i = 0; i < MAX_TRACES; i++) {
+    DisableTrace(i);
+  }
+
+  // The pitch of a windowed layer is the window width
+  BSP_LCD_LayerDefaultInit(LayerIndex, BufferAddress);
+  BSP_LCD_ResetColorKeying(LayerIndex);
+  BSP_LCD_SetLayerWindow(LayerIndex, Xpos, Ypos, Width, Height);
+  Clear();
+  BSP_LCD_SetLayerVisible(LayerIndex, ENABLE);
+}
+
+// Destructor
+StripChart::~StripChart()
+{
+  BSP_DMA2D_Wait(_fence);
+  BSP_LCD_SetLayerVisible(_layer, DISABLE);
+}
+
+//=================================================================================================================
+// Public methods
+//=================================================================================================================
+
+void StripChart::SetBackColor(uint32_t Color)
+{
+  _backColor = Color;
+}
+
+void StripChart::SetTrace(uint8_t Index, uint32_t Color, int16_t Min, int16_t Max)
+{
+  _traceColor[Index] = Color;
+  _traceMin[Index]   = Min;
+  _traceRange[Index] = (int32_t)Max - Min;
+  _lastX[Index]      = -1;
+}
+
+void StripChart::DisableTrace(uint8_t Index)
+{
+  _traceRange[Index] = 0;
+  _lastX[Index]      = -1;
+}
+
+void StripChart::Clear(void)
+{
+  BSP_RASTER_FillRect(&_surface, 0, 0, _surface.Pitch, _surface.ClipY1 + 1, _backColor);
+  _fence = BSP_DMA2D_GetLastFence();
+
+  for (uint8_t i = 0; i < MAX_TRACES; i++) {
+    _lastX[i] = -1;
+  }
+
+  // Window on rows 0 to _height - 1
+  _head = _height - 1;
+  BSP_DMA2D_Wait(_fence);
+  Scroll(_head);
+}
+
+void StripChart::Push(const int16_t *pValues, uint32_t Count)
+{
+  // Show the rows of the previous call, normally drawn by now
+  Flush();
+
+  while (Count--) {
+    _head = (_head + 1 < _rows) ? (_head + 1) : 0;
+    DrawRow(_head, pValues);
+    pValues += MAX_TRACES;
+  }
+  _fence = BSP_DMA2D_GetLastFence();
+}
+
+void StripChart::Flush(void)
+{
+  BSP_DMA2D_Wait(_fence);
+  if (_shownHead != _head) {
+    Scroll(_head);
+  }
+}
+
+uint32_t StripChart::GetHistoryLength(void)
+{
+  return _rows;
+}
+
+//=================================================================================================================
+// Private methods
+//=================================================================================================================
+
+void StripChart::DrawRow(uint32_t Row, const int16_t *pValues)
+{
+  int32_t x[MAX_TRACES];
+  int32_t width = _surface.Pitch;
+  int32_t y = Row;
+
+  for (uint8_t i = 0; i < MAX_TRACES; i++) {
+    if (_traceRange[i] != 0) {
+      x[i] = ((int32_t)pValues[i] - _traceMin[i]) * (width - 1) / _traceRange[i];
+      x[i] = (x[i] < 0) ? 0 : ((x[i] >= width) ? (width - 1) : x[i]);
+    }
+  }
+
+  // Rows seen by a wrapping window are drawn a second time after the ring end
+  for (;;) {
+    BSP_RASTER_FillSpan(&_surface, 0, width - 1, y, _backColor);
+    for (uint8_t i = 0; i < MAX_TRACES; i++) {
+      if (_traceRange[i] != 0) {
+        // Join the previous sample so fast signals stay continuous
+        BSP_RASTER_FillSpan(&_surface, (_lastX[i] < 0) ? x[i] : _lastX[i], x[i], y, _traceColor[i]);
+      }
+    }
+
+    if ((Row >= _height) || (y != (int32_t)Row)) {
+      break;
+    }
+    y = Row + _rows;
+  }
+
+  for (uint8_t i = 0; i < MAX_TRACES; i++) {
+    if (_traceRange[i] != 0) {
+      _lastX[i] = x[i];
+    }
+  }
+}
+
+void StripChart::Scroll(uint32_t Head)
+{
+  uint32_t first = (Head + _rows - (_height - 1)) % _rows;
+
+  // Applied at the next vertical blanking, no tearing
+  BSP_LCD_SetLayerAddress_NoReload(_layer, _surface.Address + first * _rowBytes);
+  BSP_LCD_Relaod(LCD_RELOAD_VERTICAL_BLANKING);
+  _shownHead = Head;
+}
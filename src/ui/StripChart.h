@@ -0,0 +1,119 @@
+#ifndef __STRIP_CHART_H
+#define __STRIP_CHART_H
+
+#include "mbed.h"
+#include "drivers/stm32f429i_discovery_raster.h"
+
+/*
+  This class draws a scrolling, oscilloscope-like chart of up to MAX_TRACES
+  signals into its own LCD layer. Time runs from top to bottom: each sample is
+  a new row at the bottom of the window and older rows move up.
+
+  The samples are drawn into a ring of rows in SDRAM, taller than the window.
+  Scrolling only moves the layer start address, so a sample costs one row of
+  pixels whatever the history length. The first rows of the ring are mirrored
+  after its end, so the window never has to wrap.
+
+  The chart owns its layer window and address: it cannot share the layer
+  with a Compositor, which takes both layers over.
+
+  Usage:
+
+  #include "mbed.h"
+  #include "LCD_DISCO_F429ZI.h"
+  #include "ui/StripChart.h"
+
+  LCD_DISCO_F429ZI lcd;
+  StripChart chart(LCD_FOREGROUND_LAYER, 0, 200, 240, 120);
+
+  int main()
+  {
+      chart.SetTrace(0, LCD_COLOR_RED, -32768, 32767);
+      chart.Clear();
+      while(1)
+      {
+          int16_t sample = read_sensor();
+          chart.Push(&sample, 1);
+      }
+  }
+*/
+class StripChart
+{
+
+public:
+  static const uint8_t MAX_TRACES = 3;
+
+  //! Constructor
+  StripChart(uint32_t LayerIndex, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height,
+             uint32_t BufferAddress = SDRAM_STRIPCHART_ADDR, uint32_t BufferSize = SDRAM_STRIPCHART_SIZE);
+
+  //! Destructor
+  ~StripChart();
+
+  /**
+    * @brief  Sets the chart background color.
+    * @param  Color: color code ARGB(8-8-8-8), applied from the next row or Clear()
+    */
+  void SetBackColor(uint32_t Color);
+
+  /**
+    * @brief  Configures a trace.
+    * @param  Index: trace index, 0 to MAX_TRACES - 1
+    * @param  Color: color code ARGB(8-8-8-8)
+    * @param  Min: value drawn on the left edge
+    * @param  Max: value drawn on the right edge
+    */
+  void SetTrace(uint8_t Index, uint32_t Color, int16_t Min, int16_t Max);
+
+  /**
+    * @brief  Disables a trace.
+    * @param  Index: trace index, 0 to MAX_TRACES - 1
+    */
+  void DisableTrace(uint8_t Index);
+
+  /**
+    * @brief  Clears the whole history with the background color.
+    */
+  void Clear(void);
+
+  /**
+    * @brief  Appends samples. The rows are drawn by the DMA2D in the background,
+    *         they show up at the next Push() or Flush().
+    * @param  pValues: MAX_TRACES values per sample, one per trace
+    * @param  Count: number of samples
+    */
+  void Push(const int16_t *pValues, uint32_t Count);
+
+  /**
+    * @brief  Waits for the pushed rows to be drawn and scrolls them in view.
+    */
+  void Flush(void);
+
+  /**
+    * @brief  Gets the number of samples kept in the ring.
+    * @retval History length in rows
+    */
+  uint32_t GetHistoryLength(void);
+
+private:
+  void DrawRow(uint32_t Row, const int16_t *pValues);
+  void Scroll(uint32_t Head);
+
+  uint32_t _layer;
+  uint16_t _height;
+  uint32_t _rows;                 // Ring length, mirrored rows excluded
+  uint32_t _rowBytes;
+  RASTER_SurfaceTypeDef _surface; // Whole ring, mirrored rows included
+
+  uint32_t _head;                 // Last drawn row
+  uint32_t _shownHead;            // Last row in view
+  DMA2D_FenceTypeDef _fence;      // Completion of the rows up to _head
+
+  uint32_t _backColor;
+  uint32_t _traceColor[MAX_TRACES];
+  int32_t  _traceMin[MAX_TRACES];
+  int32_t  _traceRange[MAX_TRACES];
+  int32_t  _lastX[MAX_TRACES];    // Column of the previous sample, -1 if none
+};
+
+#endif
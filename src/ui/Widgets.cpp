@@ -0,0 +1,578 @@
+#include "Widgets.h"
+#include "util/Formatter.h"
+
+// Tiles are composed in SRAM, not in the CCM RAM that the DMA2D cannot reach
+static uint32_t TileBuffer[2][DrawBatch::TILE_SIZE * DrawBatch::TILE_SIZE];
+static DMA2D_FenceTypeDef TileFence[2];
+
+//=================================================================================================================
+// DrawBatch
+//=================================================================================================================
+
+DrawBatch::DrawBatch()
+  : _tiled(false), _depth(0), _count(0), _submitted(0)
+{
+  _surface.ClipX0 = 0;
+  _surface.ClipX1 = -1;
+}
+
+void DrawBatch::Begin(const RASTER_SurfaceTypeDef *pSurface)
+{
+  _surface = *pSurface;
+}
+
+void DrawBatch::SetDepth(uint8_t Depth)
+{
+  _depth = Depth;
+}
+
+void DrawBatch::SetTiled(bool Tiled)
+{
+  _tiled = Tiled;
+}
+
+void DrawBatch::Clear(int32_t Xpos, int32_t Ypos, int32_t Width, int32_t Height, uint32_t Color)
+{
+  Op op = { (int16_t)Xpos, (int16_t)Ypos, (uint16_t)Width, (uint16_t)Height, _depth, 0, 0, NULL, Color, 0 };
+
+  if ((Width > 0) && (Height > 0)) {
+    Push(op);
+  }
+}
+
+void DrawBatch::FillRect(int32_t Xpos, int32_t Ypos, int32_t Width, int32_t Height, uint32_t Color)
+{
+  Op op = { (int16_t)Xpos, (int16_t)Ypos, (uint16_t)Width, (uint16_t)Height, _depth, 1, 0, NULL, Color, 0 };
+
+  if ((Width > 0) && (Height > 0)) {
+    Push(op);
+  }
+}
+
+void DrawBatch::DrawChar(int32_t Xpos, int32_t Ypos, const sFONT *pFont, uint8_t Ascii, uint32_t TextColor, uint32_t BackColor)
+{
+  Op op = { (int16_t)Xpos, (int16_t)Ypos, pFont->Width, pFont->Height, _depth, 1, Ascii, pFont, TextColor, BackColor };
+
+  Push(op);
+}
+
+uint32_t DrawBatch::Submit(void)
+{
+  uint32_t drawn = _submitted;
+  uint16_t i, j, n;
+  Op op;
+
+  // Insertion sort: the widgets emit their operations almost in order
+  for (i = 1; i < _count; i++) {
+    op = _ops[i];
+    for (j = i; (j > 0) && Before(op, _ops[j - 1]); j--) {
+      _ops[j] = _ops[j - 1];
+    }
+    _ops[j] = op;
+  }
+
+  // Merge fills that continue the previous one on the right or below
+  for (i = 0, n = 0; i < _count; i++) {
+    const Op &cur = _ops[i];
+    Op &last = _ops[(n > 0) ? (n - 1) : 0];
+
+    if ((n > 0) && (cur.ascii == 0) && (last.ascii == 0) && (cur.depth == last.depth) &&
+        (cur.pass == last.pass) && (cur.color == last.color)) {
+      if ((cur.y == last.y) && (cur.height == last.height) && (cur.x == last.x + last.width)) {
+        last.width += cur.width;
+        continue;
+      }
+      if ((cur.x == last.x) && (cur.width == last.width) && (cur.y == last.y + last.height)) {
+        last.height += cur.height;
+        continue;
+      }
+    }
+    _ops[n++] = cur;
+  }
+
+  if (_tiled) {
+    DrawTiles(n);
+  } else {
+    for (i = 0; i < n; i++) {
+      Draw(&_surface, 0, 0, _ops[i]);
+    }
+  }
+
+  _count = 0;
+  _submitted = 0;
+  return drawn + n;
+}
+
+void DrawBatch::Push(const Op &op)
+{
+  // A full batch is drawn early, the emission order is kept across the split
+  if (_count == MAX_OPS) {
+    _submitted = Submit();
+  }
+  _ops[_count++] = op;
+}
+
+void DrawBatch::Draw(const RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, const Op &op)
+{
+  if (op.ascii == 0) {
+    BSP_RASTER_FillRect(pSurface, op.x - Xpos, op.y - Ypos, op.width, op.height, op.color);
+  } else {
+    BSP_RASTER_DrawChar(pSurface, op.x - Xpos, op.y - Ypos, op.pFont, op.ascii, op.color, op.back);
+  }
+}
+
+void DrawBatch::DrawTiles(uint16_t Count)
+{
+  RASTER_SurfaceTypeDef tile;
+  uint32_t dirty[MAX_TILE_ROWS];
+  uint32_t bpp = (_surface.ColorMode == DMA2D_ARGB8888) ? 4 : ((_surface.ColorMode == DMA2D_RGB888) ? 3 : 2);
+  uint32_t columns = (_surface.ClipX1 + TILE_SIZE) / TILE_SIZE;
+  uint32_t rows = (_surface.ClipY1 + TILE_SIZE) / TILE_SIZE;
+  uint32_t buffer = 0, frame;
+  int32_t x0, y0, x1, y1, width, height;
+  uint16_t i, first, end;
+  bool waited;
+
+  if ((_surface.ClipX0 > _surface.ClipX1) || (_surface.ClipY0 > _surface.ClipY1)) {
+    return;
+  }
+  MBED_ASSERT((_surface.ClipX0 == 0) && (_surface.ClipY0 == 0) && (columns <= 32) && (rows <= MAX_TILE_ROWS));
+
+  // Tiles touched by at least one operation
+  memset(dirty, 0, sizeof(dirty));
+  for (i = 0; i < Count; i++) {
+    if ((_ops[i].x + _ops[i].width <= 0) || (_ops[i].y + _ops[i].height <= 0)) {
+      continue;
+    }
+    x0 = (_ops[i].x < 0) ? 0 : (_ops[i].x / TILE_SIZE);
+    y0 = (_ops[i].y < 0) ? 0 : (_ops[i].y / TILE_SIZE);
+    x1 = (_ops[i].x + _ops[i].width - 1) / TILE_SIZE;
+    y1 = (_ops[i].y + _ops[i].height - 1) / TILE_SIZE;
+    x1 = (x1 >= (int32_t)columns) ? (columns - 1) : x1;
+    y1 = (y1 >= (int32_t)rows) ? (rows - 1) : y1;
+    for (int32_t y = y0; (y <= y1) && (x0 <= x1); y++) {
+      dirty[y] |= (0xFFFFFFFFu >> (31 - x1 + x0)) << x0;
+    }
+  }
+
+  tile.Pitch     = TILE_SIZE;
+  tile.ColorMode = _surface.ColorMode;
+  tile.ClipX0    = 0;
+  tile.ClipY0    = 0;
+
+  for (uint32_t ty = 0; ty < rows; ty++) {
+    for (uint32_t tx = 0; dirty[ty] != 0; tx++) {
+      if ((dirty[ty] & (1u << tx)) == 0) {
+        continue;
+      }
+      dirty[ty] &= ~(1u << tx);
+
+      x0 = tx * TILE_SIZE;
+      y0 = ty * TILE_SIZE;
+      width  = ((_surface.ClipX1 + 1 - x0) < TILE_SIZE) ? (_surface.ClipX1 + 1 - x0) : TILE_SIZE;
+      height = ((_surface.ClipY1 + 1 - y0) < TILE_SIZE) ? (_surface.ClipY1 + 1 - y0) : TILE_SIZE;
+      frame  = _surface.Address + (y0 * _surface.Pitch + x0) * bpp;
+
+      // The buffer may still be written back from two tiles ago
+      BSP_DMA2D_Wait(TileFence[buffer]);
+      tile.Address = (uint32_t)(uintptr_t)TileBuffer[buffer];
+      tile.ClipX1  = width - 1;
+      tile.ClipY1  = height - 1;
+
+      for (first = 0; first < Count; first++) {
+        const Op &op = _ops[first];
+        if ((op.x < x0 + width) && (op.x + op.width > x0) && (op.y < y0 + height) && (op.y + op.height > y0)) {
+          break;
+        }
+      }
+      const Op &op = _ops[first];
+      if ((op.ascii != 0) || (op.x > x0) || (op.y > y0) ||
+          (op.x + op.width < x0 + width) || (op.y + op.height < y0 + height)) {
+        BSP_DMA2D_Copy(frame, _surface.Pitch - width, tile.Address, TILE_SIZE - width, tile.ColorMode, width, height);
+      }
+
+      // The operations of a depth and pass do not overlap: the fills are queued
+      // first, then the CPU waits once for the DMA2D before the 1 bpp glyphs
+      for (i = first; i < Count; i = end) {
+        for (end = i; (end < Count) && (_ops[end].depth == _ops[i].depth) && (_ops[end].pass == _ops[i].pass); end++) {
+          if (_ops[end].ascii == 0) {
+            Draw(&tile, x0, y0, _ops[end]);
+          }
+        }
+        waited = false;
+        for (uint16_t j = i; j < end; j++) {
+          const Op &glyph = _ops[j];
+          if ((glyph.ascii == 0) || (glyph.x >= x0 + width) || (glyph.x + glyph.width <= x0) ||
+              (glyph.y >= y0 + height) || (glyph.y + glyph.height <= y0)) {
+            continue;
+          }
+          if (!waited && (glyph.pFont->Bpp != 4)) {
+            BSP_DMA2D_WaitIdle();
+            waited = true;
+          }
+          Draw(&tile, x0, y0, glyph);
+        }
+      }
+
+      BSP_DMA2D_Copy(tile.Address, TILE_SIZE - width, frame, _surface.Pitch - width, tile.ColorMode, width, height);
+      TileFence[buffer] = BSP_DMA2D_GetLastFence();
+      buffer ^= 1;
+    }
+  }
+}
+
+bool DrawBatch::Before(const Op &a, const Op &b)
+{
+  if (a.depth != b.depth) {
+    return a.depth < b.depth;
+  }
+  if (a.pass != b.pass) {
+    return a.pass < b.pass;
+  }
+  if (a.y != b.y) {
+    return a.y < b.y;
+  }
+  return a.x < b.x;
+}
+
+//=================================================================================================================
+// Widget
+//=================================================================================================================
+
+Widget::Widget(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height)
+  : _x(Xpos), _y(Ypos), _width(Width), _height(Height), _foreColor(LCD_COLOR_BLACK), _backColor(LCD_COLOR_WHITE),
+    _invalid(true), _child(NULL), _next(NULL)
+{
+}
+
+void Widget::Add(Widget &Child)
+{
+  Widget **ppLast = &_child;
+
+  while (*ppLast != NULL) {
+    ppLast = &(*ppLast)->_next;
+  }
+  *ppLast = &Child;
+  Child.Invalidate();
+}
+
+void Widget::SetColors(uint32_t ForeColor, uint32_t BackColor)
+{
+  if ((ForeColor != _foreColor) || (BackColor != _backColor)) {
+    _foreColor = ForeColor;
+    _backColor = BackColor;
+    _invalid = true;
+  }
+}
+
+void Widget::Invalidate(void)
+{
+  _invalid = true;
+}
+
+void Widget::Render(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, uint8_t Depth, bool Full)
+{
+  Xpos += _x;
+  Ypos += _y;
+  Full = Full || _invalid;
+  _invalid = false;
+
+  Batch.SetDepth(Depth);
+  if (Full) {
+    Batch.Clear(Xpos, Ypos, _width, _height, _backColor);
+  }
+  Draw(Batch, Xpos, Ypos, Full);
+
+  for (Widget *pChild = _child; pChild != NULL; pChild = pChild->_next) {
+    pChild->Render(Batch, Xpos, Ypos, Depth + 1, Full);
+  }
+}
+
+//=================================================================================================================
+// Panel and Screen
+//=================================================================================================================
+
+Panel::Panel(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height)
+  : Widget(Xpos, Ypos, Width, Height)
+{
+}
+
+void Panel::Draw(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, bool Full)
+{
+  // Nothing but the background cleared by Render()
+  (void)Batch;
+  (void)Xpos;
+  (void)Ypos;
+  (void)Full;
+}
+
+Screen::Screen(uint32_t LayerIndex, uint32_t BackColor)
+  : Panel(0, 0, BSP_LCD_GetXSize(), BSP_LCD_GetYSize()), _layer(LayerIndex)
+{
+  _backColor = BackColor;
+}
+
+void Screen::SetTiled(bool Tiled)
+{
+  _batch.SetTiled(Tiled);
+}
+
+uint32_t Screen::Render(void)
+{
+  RASTER_SurfaceTypeDef surface;
+
+  BSP_RASTER_GetLayerSurface(_layer, &surface);
+  _batch.Begin(&surface);
+  Widget::Render(_batch, 0, 0, 0, false);
+  return _batch.Submit();
+}
+
+//=================================================================================================================
+// Label and Value
+//=================================================================================================================
+
+Label::Label(int16_t Xpos, int16_t Ypos, uint16_t Width, const char *pText, Text_AlignModeTypdef Mode, sFONT *pFont)
+  : Widget(Xpos, Ypos, Width, pFont->Height), _mode(Mode), _pFont(pFont)
+{
+  _shown[0] = '\0';
+  SetText(pText);
+}
+
+void Label::SetText(const char *pText)
+{
+  uint32_t max = _width / _pFont->Width;
+  uint32_t i;
+
+  if (max > MAX_TEXT) {
+    max = MAX_TEXT;
+  }
+  for (i = 0; (i < max) && (pText[i] != '\0'); i++) {
+    _text[i] = pText[i];
+  }
+  _text[i] = '\0';
+}
+
+void Label::Draw(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, bool Full)
+{
+  uint32_t length = strlen(_text);
+  uint32_t shownLength = strlen(_shown);
+  int32_t x = Xpos + TextX(length);
+  int32_t shownX = Xpos + TextX(shownLength);
+  int32_t cell = _pFont->Width;
+  uint32_t i;
+
+  if (Full) {
+    shownLength = 0;
+    shownX = x;
+  }
+
+  if (x == shownX) {
+    // Same layout: only the characters that differ, then the cells left over
+    for (i = 0; i < length; i++) {
+      if ((i >= shownLength) || (_text[i] != _shown[i])) {
+        Batch.DrawChar(x + i * cell, Ypos, _pFont, _text[i], _foreColor, _backColor);
+      }
+    }
+    if (shownLength > length) {
+      Batch.FillRect(x + length * cell, Ypos, (shownLength - length) * cell, _height, _backColor);
+    }
+  } else {
+    // Moved text: all the characters, then what the old text covered outside
+    int32_t end = x + length * cell;
+    int32_t shownEnd = shownX + shownLength * cell;
+
+    for (i = 0; i < length; i++) {
+      Batch.DrawChar(x + i * cell, Ypos, _pFont, _text[i], _foreColor, _backColor);
+    }
+    if (shownX < x) {
+      Batch.FillRect(shownX, Ypos, ((shownEnd < x) ? shownEnd : x) - shownX, _height, _backColor);
+    }
+    if (shownEnd > end) {
+      int32_t from = (shownX > end) ? shownX : end;
+      Batch.FillRect(from, Ypos, shownEnd - from, _height, _backColor);
+    }
+  }
+
+  memcpy(_shown, _text, length + 1);
+}
+
+int32_t Label::TextX(uint32_t Length)
+{
+  int32_t room = _width - Length * _pFont->Width;
+
+  switch (_mode) {
+  case CENTER_MODE:
+    return room / 2;
+  case RIGHT_MODE:
+    return room;
+  default:
+    return 0;
+  }
+}
+
+Value::Value(int16_t Xpos, int16_t Ypos, uint16_t Width, uint8_t Decimals, Text_AlignModeTypdef Mode, sFONT *pFont)
+  : Label(Xpos, Ypos, Width, "", Mode, pFont), _decimals(Decimals), _value(0), _pPrefix(""), _pSuffix("")
+{
+  Format();
+}
+
+void Value::SetValue(int32_t Value)
+{
+  if (Value != _value) {
+    _value = Value;
+    Format();
+  }
+}
+
+void Value::SetAffixes(const char *pPrefix, const char *pSuffix)
+{
+  _pPrefix = pPrefix;
+  _pSuffix = pSuffix;
+  Format();
+}
+
+void Value::Format(void)
+{
+  char text[MAX_TEXT + 1];
+  Formatter formatter(text, sizeof(text));
+
+  formatter.Append(_pPrefix).Fixed(_value, _decimals).Append(_pSuffix);
+  SetText(text);
+}
+
+//=================================================================================================================
+// Bar and Gauge
+//=================================================================================================================
+
+Bar::Bar(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, int32_t Min, int32_t Max)
+  : Widget(Xpos, Ypos, Width, Height), _min(Min), _max(Max), _value(Min), _shown(0)
+{
+  MBED_ASSERT(Max > Min);
+}
+
+void Bar::SetValue(int32_t Value)
+{
+  _value = Value;
+}
+
+void Bar::Draw(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, bool Full)
+{
+  int32_t length = Position(_value);
+
+  if (Full) {
+    _shown = 0;
+  }
+
+  // Grow with the fore color, shrink with the back color
+  if (length > _shown) {
+    Batch.FillRect(Xpos + _shown, Ypos, length - _shown, _height, _foreColor);
+  } else if (length < _shown) {
+    Batch.FillRect(Xpos + length, Ypos, _shown - length, _height, _backColor);
+  }
+  _shown = length;
+}
+
+int32_t Bar::Position(int32_t Value)
+{
+  if (Value <= _min) {
+    return 0;
+  }
+  if (Value >= _max) {
+    return _width;
+  }
+  return (int32_t)((int64_t)(Value - _min) * _width / (_max - _min));
+}
+
+Gauge::Gauge(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, int32_t Min, int32_t Max)
+  : Bar(Xpos, Ypos, Width, Height, Min, Max)
+{
+  MBED_ASSERT(Width >= NEEDLE_WIDTH);
+}
+
+void Gauge::Draw(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, bool Full)
+{
+  // Left edge of the needle, kept inside of the box
+  int32_t x = Position(_value) * (_width - NEEDLE_WIDTH) / _width;
+
+  if (Full) {
+    Batch.FillRect(Xpos + x, Ypos, NEEDLE_WIDTH, _height, _foreColor);
+  } else if (x != _shown) {
+    // Only the columns that change color
+    if ((x >= _shown + NEEDLE_WIDTH) || (x + NEEDLE_WIDTH <= _shown)) {
+      Batch.FillRect(Xpos + _shown, Ypos, NEEDLE_WIDTH, _height, _backColor);
+      Batch.FillRect(Xpos + x, Ypos, NEEDLE_WIDTH, _height, _foreColor);
+    } else if (x > _shown) {
+      Batch.FillRect(Xpos + _shown, Ypos, x - _shown, _height, _backColor);
+      Batch.FillRect(Xpos + _shown + NEEDLE_WIDTH, Ypos, x - _shown, _height, _foreColor);
+    } else {
+      Batch.FillRect(Xpos + x, Ypos, _shown - x, _height, _foreColor);
+      Batch.FillRect(Xpos + x + NEEDLE_WIDTH, Ypos, _shown - x, _height, _backColor);
+    }
+  }
+  _shown = x;
+}
+
+//=================================================================================================================
+// Plot
+//=================================================================================================================
+
+Plot::Plot(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, int32_t Min, int32_t Max)
+  : Widget(Xpos, Ypos, Width, Height), _min(Min), _range(Max - Min), _cursor(0), _pending(0)
+{
+  MBED_ASSERT((Width <= MAX_WIDTH) && (Height > 0) && (Height <= 256) && (Max > Min));
+
+  for (uint16_t i = 0; i < Width; i++) {
+    _rows[i] = Height - 1;
+  }
+}
+
+void Plot::Push(int32_t Value)
+{
+  int32_t row = (int32_t)((int64_t)(Value - _min) * (_height - 1) / _range);
+
+  row = (row < 0) ? 0 : ((row >= _height) ? (_height - 1) : row);
+  // Row 0 is the top
+  _rows[_cursor] = _height - 1 - row;
+  _cursor = (_cursor + 1 < _width) ? (_cursor + 1) : 0;
+  if (_pending < _width) {
+    _pending++;
+  }
+}
+
+void Plot::Draw(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, bool Full)
+{
+  uint16_t column;
+
+  if (Full) {
+    for (column = 0; column < _width; column++) {
+      DrawColumn(Batch, Xpos, Ypos, column, false);
+    }
+  } else {
+    // The columns written since the last call, oldest first, then the one
+    // after them that joins the last written
+    column = (_cursor + _width - _pending) % _width;
+    if ((_pending > 0) && (_pending < _width)) {
+      _pending++;
+    }
+    while (_pending--) {
+      DrawColumn(Batch, Xpos, Ypos, column, true);
+      column = (column + 1 < _width) ? (column + 1) : 0;
+    }
+  }
+  _pending = 0;
+}
+
+void Plot::DrawColumn(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, uint16_t Column, bool Erase)
+{
+  // Vertical segment joining the previous column, split so the fills never overlap
+  int32_t y0 = _rows[Column];
+  int32_t y1 = (Column > 0) ? _rows[Column - 1] : y0;
+  int32_t top = (y0 < y1) ? y0 : y1;
+  int32_t bottom = (y0 < y1) ? y1 : y0;
+
+  Batch.FillRect(Xpos + Column, Ypos + top, 1, bottom - top + 1, _foreColor);
+  if (Erase) {
+    Batch.FillRect(Xpos + Column, Ypos, 1, top, _backColor);
+    Batch.FillRect(Xpos + Column, Ypos + bottom + 1, 1, _height - 1 - bottom, _backColor);
+  }
+}
@@ -0,0 +1,338 @@
+#ifndef __WIDGETS_H
+#define __WIDGETS_H
+
+#include "mbed.h"
+#include "drivers/stm32f429i_discovery_raster.h"
+
+/*
+  Retained widgets drawn into one LCD layer: labels, fixed point values, bars,
+  gauges and sweep plots, grouped in panels under a Screen.
+
+  Setters only store the new state. Screen::Render() compares it with what
+  each widget last drew and collects the pixels that changed as fills and
+  characters in a DrawBatch. The batch is sorted top to bottom, adjacent fills
+  are merged, then everything is drawn at once. A frame costs what changed,
+  a static screen costs nothing.
+
+  Usage:
+
+  #include "mbed.h"
+  #include "LCD_DISCO_F429ZI.h"
+  #include "ui/Widgets.h"
+
+  LCD_DISCO_F429ZI lcd;
+  Screen screen(LCD_BACKGROUND_LAYER, LCD_COLOR_WHITE);
+  Label title(0, 20, 240, "Level", CENTER_MODE);
+  Value level(0, 60, 240, 2, CENTER_MODE);
+  Bar bar(20, 100, 200, 16, 0, 500);
+
+  int main()
+  {
+      screen.Add(title);
+      screen.Add(level);
+      screen.Add(bar);
+      while(1)
+      {
+          int32_t centi = read_sensor();
+          level.SetValue(centi);
+          bar.SetValue(centi);
+          screen.Render();
+      }
+  }
+*/
+
+/*
+  Fills and characters of one Render() call. The operations of a same depth
+  and pass never overlap, which lets Submit() reorder them freely within it:
+  pass 0 clears whole widgets, pass 1 draws their content.
+
+  In tiled mode the surface is cut in TILE_SIZE squares. Each tile touched by
+  the batch is composed in internal SRAM, then written back with a single
+  DMA2D copy, so the frame buffer only sees burst writes, once per tile,
+  whatever the overdraw. A tile is first read back from the frame buffer,
+  unless its first operation covers it. Two tile buffers let the DMA2D write
+  a tile while the next one is composed.
+*/
+class DrawBatch
+{
+
+public:
+  static const uint16_t MAX_OPS = 128;
+  static const uint16_t TILE_SIZE = 32;
+  static const uint16_t MAX_TILE_ROWS = 16;
+
+  //! Constructor
+  DrawBatch();
+
+  /**
+    * @brief  Sets the surface drawn into, before the first operation.
+    */
+  void Begin(const RASTER_SurfaceTypeDef *pSurface);
+
+  /**
+    * @brief  Sets the tree depth of the next operations, deeper ones are drawn last.
+    */
+  void SetDepth(uint8_t Depth);
+
+  /**
+    * @brief  Clears a rectangle, before any content of the same depth.
+    */
+  void Clear(int32_t Xpos, int32_t Ypos, int32_t Width, int32_t Height, uint32_t Color);
+
+  /**
+    * @brief  Fills a rectangle.
+    */
+  void FillRect(int32_t Xpos, int32_t Ypos, int32_t Width, int32_t Height, uint32_t Color);
+
+  /**
+    * @brief  Draws a character cell.
+    */
+  void DrawChar(int32_t Xpos, int32_t Ypos, const sFONT *pFont, uint8_t Ascii, uint32_t TextColor, uint32_t BackColor);
+
+  /**
+    * @brief  Composes the operations in SRAM tiles or draws them in place.
+    * @param  Tiled: true for tiles, the surface must start at 0, 0 and be at
+    *         most 32 tiles wide and MAX_TILE_ROWS tiles high
+    */
+  void SetTiled(bool Tiled);
+
+  /**
+    * @brief  Sorts, merges and draws the pending operations.
+    * @retval Number of operations drawn
+    */
+  uint32_t Submit(void);
+
+private:
+  struct Op
+  {
+    int16_t  x, y;
+    uint16_t width, height;
+    uint8_t  depth;
+    uint8_t  pass;
+    uint8_t  ascii;       // 0 for a fill
+    const sFONT *pFont;
+    uint32_t color;
+    uint32_t back;
+  };
+
+  void Push(const Op &op);
+  void Draw(const RASTER_SurfaceTypeDef *pSurface, int32_t Xpos, int32_t Ypos, const Op &op);
+  void DrawTiles(uint16_t Count);
+  static bool Before(const Op &a, const Op &b);
+
+  RASTER_SurfaceTypeDef _surface;
+  bool     _tiled;
+  uint8_t  _depth;
+  uint16_t _count;
+  uint32_t _submitted;
+  Op       _ops[MAX_OPS];
+};
+
+class Widget
+{
+
+public:
+  //! Constructor, the position is relative to the parent
+  Widget(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height);
+
+  //! Destructor
+  virtual ~Widget() {}
+
+  /**
+    * @brief  Adds a child, drawn over this widget and inside of it.
+    * @param  Child: widget without parent, must outlive this one
+    */
+  void Add(Widget &Child);
+
+  /**
+    * @brief  Sets the colors.
+    * @param  ForeColor: content color code ARGB(8-8-8-8)
+    * @param  BackColor: background color code ARGB(8-8-8-8)
+    */
+  void SetColors(uint32_t ForeColor, uint32_t BackColor);
+
+  /**
+    * @brief  Redraws the widget and its children completely at next render.
+    */
+  void Invalidate(void);
+
+protected:
+  /**
+    * @brief  Emits the widget pixels.
+    * @param  Batch: batch to fill in
+    * @param  Xpos: absolute left X position
+    * @param  Ypos: absolute top Y position
+    * @param  Full: the box was cleared to the back color, draw all the content.
+    *         Otherwise emit only what changed since the last call.
+    */
+  virtual void Draw(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, bool Full) = 0;
+
+  void Render(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, uint8_t Depth, bool Full);
+
+  int16_t  _x;
+  int16_t  _y;
+  uint16_t _width;
+  uint16_t _height;
+  uint32_t _foreColor;
+  uint32_t _backColor;
+
+private:
+  bool     _invalid;
+  Widget  *_child;
+  Widget  *_next;
+};
+
+// Plain rectangle in the back color, to group widgets
+class Panel : public Widget
+{
+
+public:
+  Panel(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height);
+
+protected:
+  virtual void Draw(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, bool Full);
+};
+
+// Root of a widget tree, covers a whole LCD layer
+class Screen : public Panel
+{
+
+public:
+  //! Constructor
+  Screen(uint32_t LayerIndex, uint32_t BackColor);
+
+  /**
+    * @brief  Draws what changed since the previous call.
+    * @retval Number of fills and characters drawn
+    */
+  uint32_t Render(void);
+
+  /**
+    * @brief  Composes the changes in SRAM tiles, see DrawBatch.
+    */
+  void SetTiled(bool Tiled);
+
+private:
+  uint32_t  _layer;
+  DrawBatch _batch;
+};
+
+// Single line of text, one character cell per character
+class Label : public Widget
+{
+
+public:
+  static const uint8_t MAX_TEXT = 24;
+
+  //! Constructor, the height is the font height
+  Label(int16_t Xpos, int16_t Ypos, uint16_t Width, const char *pText = "",
+        Text_AlignModeTypdef Mode = LEFT_MODE, sFONT *pFont = &Font16);
+
+  /**
+    * @brief  Sets the text, truncated to MAX_TEXT characters.
+    */
+  void SetText(const char *pText);
+
+protected:
+  virtual void Draw(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, bool Full);
+
+  char _text[MAX_TEXT + 1];
+
+private:
+  int32_t TextX(uint32_t Length);
+
+  Text_AlignModeTypdef _mode;
+  sFONT   *_pFont;
+  char     _shown[MAX_TEXT + 1];
+};
+
+// Fixed point number, 1234 with 2 decimals shows as 12.34
+class Value : public Label
+{
+
+public:
+  //! Constructor
+  Value(int16_t Xpos, int16_t Ypos, uint16_t Width, uint8_t Decimals,
+        Text_AlignModeTypdef Mode = LEFT_MODE, sFONT *pFont = &Font16);
+
+  /**
+    * @brief  Sets the number.
+    * @param  Value: number times 10^Decimals
+    */
+  void SetValue(int32_t Value);
+
+  /**
+    * @brief  Sets the texts written before and after the number.
+    */
+  void SetAffixes(const char *pPrefix, const char *pSuffix);
+
+private:
+  void Format(void);
+
+  uint8_t     _decimals;
+  int32_t     _value;
+  const char *_pPrefix;
+  const char *_pSuffix;
+};
+
+// Horizontal bar growing from the left edge
+class Bar : public Widget
+{
+
+public:
+  //! Constructor
+  Bar(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, int32_t Min, int32_t Max);
+
+  void SetValue(int32_t Value);
+
+protected:
+  virtual void Draw(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, bool Full);
+
+  int32_t Position(int32_t Value);
+
+  int32_t _min;
+  int32_t _max;
+  int32_t _value;
+  int32_t _shown;         // Drawn length or needle position
+};
+
+// Horizontal scale with a needle
+class Gauge : public Bar
+{
+
+public:
+  static const uint8_t NEEDLE_WIDTH = 3;
+
+  //! Constructor
+  Gauge(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, int32_t Min, int32_t Max);
+
+protected:
+  virtual void Draw(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, bool Full);
+};
+
+// Sweep plot: each sample replaces one column, the cursor wraps at the right edge
+class Plot : public Widget
+{
+
+public:
+  static const uint16_t MAX_WIDTH = 240;
+
+  //! Constructor
+  Plot(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height, int32_t Min, int32_t Max);
+
+  void Push(int32_t Value);
+
+protected:
+  virtual void Draw(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, bool Full);
+
+private:
+  void DrawColumn(DrawBatch &Batch, int32_t Xpos, int32_t Ypos, uint16_t Column, bool Erase);
+
+  int32_t  _min;
+  int32_t  _range;
+  uint16_t _cursor;       // Next column written
+  uint16_t _pending;      // Columns written and not drawn
+  uint8_t  _rows[MAX_WIDTH];
+};
+
+#endif
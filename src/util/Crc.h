@@ -0,0 +1,22 @@
+#ifndef __CRC_H
+#define __CRC_H
+
+#include <stdint.h>
+
+/*
+  CRC-16/CCITT-FALSE: polynomial 0x1021, initial value 0xFFFF, no reflection,
+  no final XOR. "123456789" gives 0x29B1. One table lookup per byte.
+
+  Blocks are chained by passing the previous result:
+
+  uint16_t crc = Crc16(&header, sizeof(header));
+  crc = Crc16(payload, length, crc);
+*/
+static const uint16_t CRC16_INIT = 0xFFFF;
+
+/**
+  * @brief  Computes the CRC of a block, continuing a previous one.
+  */
+uint16_t Crc16(const void *pData, uint32_t Length, uint16_t Crc = CRC16_INIT);
+
+#endif
@@ -0,0 +1,459 @@
+#include "EepromLog.h"
+#include "Crc.h"
+
+static const uint8_t MAGIC[2] = { 'L', 'G' };
+
+// Little endian helpers for the image
+static void PutU16(uint8_t *p, uint16_t Value)
+{
+  p[0] = (uint8_t)Value;
+  p[1] = (uint8_t)(Value >> 8);
+}
+
+static void PutU32(uint8_t *p, uint32_t Value)
+{
+  PutU16(p, (uint16_t)Value);
+  PutU16(p + 2, (uint16_t)(Value >> 16));
+}
+
+static uint16_t GetU16(const uint8_t *p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t GetU32(const uint8_t *p)
+{
+  return GetU16(p) | ((uint32_t)GetU16(p + 2) << 16);
+}
+
+// CRC of a record, bound to the pass of its segment
+static uint16_t RecordCrc(uint32_t Sequence, const uint8_t *pRecord)
+{
+  uint8_t sequence[4];
+
+  PutU32(sequence, Sequence);
+  return Crc16(pRecord + 4, pRecord[1], Crc16(pRecord, 2, Crc16(sequence, 4)));
+}
+
+// Constructor
+EepromLog::EepromLog()
+  : _head(0), _offset(0), _live(0), _first(0), _count(0), _ready(false), _flushing(false), _errors(0),
+    _thread(osPriorityBelowNormal, 1536, NULL, "eeprom_log"), _queue(8 * EVENTS_EVENT_SIZE)
+{
+  memset(_index, 0, sizeof(_index));
+  memset(_sequence, 0, sizeof(_sequence));
+}
+
+//=================================================================================================================
+// Public methods
+//=================================================================================================================
+
+uint8_t EepromLog::Init(void)
+{
+  uint32_t last = 0, next, segment, i;
+  bool found = false;
+
+  if (BSP_EEPROM_Init() != EEPROM_OK) {
+    return LOG_FAIL;
+  }
+  // Segments without a valid header are never read from the image
+  memset(_image, 0xFF, sizeof(_image));
+  for (segment = 0; segment < SEGMENTS; segment++) {
+    const uint8_t *header = &_image[segment * SEGMENT_SIZE];
+    uint32_t sequence;
+
+    if (Read(segment * SEGMENT_SIZE, HEADER_SIZE) != EEPROM_REQUEST_DONE) {
+      return LOG_FAIL;
+    }
+    sequence = GetU32(header + 4);
+    _sequence[segment] = 0;
+    if ((header[0] == MAGIC[0]) && (header[1] == MAGIC[1]) && (sequence != 0) &&
+        (GetU16(header + 2) == Crc16(header + 4, 4))) {
+      if (Read(segment * SEGMENT_SIZE + HEADER_SIZE, SEGMENT_SIZE - HEADER_SIZE) != EEPROM_REQUEST_DONE) {
+        return LOG_FAIL;
+      }
+      _sequence[segment] = sequence;
+    }
+  }
+
+  // Oldest first, the newest record of a key wins
+  while (true) {
+    next = SEGMENTS;
+    for (segment = 0; segment < SEGMENTS; segment++) {
+      if ((_sequence[segment] > last) && ((next == SEGMENTS) || (_sequence[segment] < _sequence[next]))) {
+        next = segment;
+      }
+    }
+    if (next == SEGMENTS) {
+      break;
+    }
+    Replay(next);
+    last = _sequence[next];
+    _head = next;
+    found = true;
+  }
+
+  _mutex.lock();
+  if (!found) {
+    // Blank or foreign memory
+    _head = 0;
+    _offset = HEADER_SIZE;
+    _sequence[0] = 1;
+    WriteHeader(0);
+  }
+  for (i = 1; i < 255; i++) {
+    if (_index[i] != 0) {
+      _live += RecordSize(_image[_index[i] + 1]);
+    }
+  }
+  _ready = true;
+  _thread.start(callback(&_queue, &EventQueue::dispatch_forever));
+
+  // A reset may have come in the middle of a compaction
+  Relocate((_head + 1) % SEGMENTS);
+  _mutex.unlock();
+
+  return LOG_OK;
+}
+
+uint8_t EepromLog::Get(uint8_t Key, void *pData, uint8_t Size, uint8_t *pLength)
+{
+  uint32_t address;
+  uint8_t length;
+
+  _mutex.lock();
+  address = _index[Key];
+  if (address == 0) {
+    _mutex.unlock();
+    return LOG_NOT_FOUND;
+  }
+  length = _image[address + 1];
+  memcpy(pData, &_image[address + RECORD_HEADER], (length < Size) ? length : Size);
+  if (pLength != NULL) {
+    *pLength = length;
+  }
+  _mutex.unlock();
+
+  return LOG_OK;
+}
+
+uint8_t EepromLog::Put(uint8_t Key, const void *pData, uint8_t Length)
+{
+  uint32_t previous = 0;
+  uint8_t status;
+
+  if ((Key == 0x00) || (Key == 0xFF) || (Length > MAX_LENGTH)) {
+    return LOG_INVALID;
+  }
+
+  _mutex.lock();
+  if (!_ready) {
+    _mutex.unlock();
+    return LOG_FAIL;
+  }
+  if (_index[Key] != 0) {
+    previous = RecordSize(_image[_index[Key] + 1]);
+  }
+  // Two segments of slack: one being filled, one being compacted
+  if (_live - previous + RecordSize(Length) > (SEGMENTS - 2) * (SEGMENT_SIZE - HEADER_SIZE)) {
+    _mutex.unlock();
+    return LOG_FULL;
+  }
+  status = Append(Key, (const uint8_t *)pData, Length);
+  _mutex.unlock();
+
+  return status;
+}
+
+bool EepromLog::IsPending(void)
+{
+  bool pending;
+
+  _mutex.lock();
+  pending = _flushing;
+  _mutex.unlock();
+
+  return pending;
+}
+
+uint32_t EepromLog::GetErrors(void) const
+{
+  return _errors;
+}
+
+//=================================================================================================================
+// Private methods
+//=================================================================================================================
+
+uint32_t EepromLog::RecordSize(uint8_t Length)
+{
+  return (RECORD_HEADER + Length + EEPROM_PAGESIZE - 1) & ~(uint32_t)(EEPROM_PAGESIZE - 1);
+}
+
+bool EepromLog::Valid(uint32_t Segment, uint32_t Offset, uint32_t *pSize) const
+{
+  const uint8_t *record = &_image[Segment * SEGMENT_SIZE + Offset];
+  uint32_t size;
+
+  if ((Offset + RECORD_HEADER > SEGMENT_SIZE) || (record[0] == 0x00) || (record[0] == 0xFF) ||
+      (record[1] > MAX_LENGTH)) {
+    return false;
+  }
+  size = RecordSize(record[1]);
+  if ((Offset + size > SEGMENT_SIZE) || (GetU16(record + 2) != RecordCrc(_sequence[Segment], record))) {
+    return false;
+  }
+  *pSize = size;
+  return true;
+}
+
+uint8_t EepromLog::Append(uint8_t Key, const uint8_t *pData, uint8_t Length)
+{
+  uint32_t size = RecordSize(Length);
+  uint32_t address, opened = 0;
+  uint8_t *record;
+
+  while (_offset + size > SEGMENT_SIZE) {
+    if ((++opened > SEGMENTS) || (OpenSegment() != LOG_OK)) {
+      return LOG_FULL;
+    }
+  }
+
+  address = _head * SEGMENT_SIZE + _offset;
+  record = &_image[address];
+  record[0] = Key;
+  record[1] = Length;
+  memmove(record + RECORD_HEADER, pData, Length);
+  memset(record + RECORD_HEADER + Length, 0, size - RECORD_HEADER - Length);
+  PutU16(record + 2, RecordCrc(_sequence[_head], record));
+
+  if (_index[Key] != 0) {
+    _live -= RecordSize(_image[_index[Key] + 1]);
+  }
+  _index[Key] = address;
+  _live += size;
+  _offset += size;
+  Queue(address, size);
+
+  return LOG_OK;
+}
+
+uint8_t EepromLog::OpenSegment(void)
+{
+  uint32_t next = (_head + 1) % SEGMENTS;
+  uint32_t sequence = _sequence[_head] + 1;
+
+  if (HasLive(next)) {
+    return LOG_FULL;
+  }
+  _head = next;
+  _offset = HEADER_SIZE;
+  _sequence[next] = sequence;
+  WriteHeader(next);
+
+  // Keep the next segment free of current records
+  return Relocate((next + 1) % SEGMENTS);
+}
+
+uint8_t EepromLog::Relocate(uint32_t Segment)
+{
+  uint32_t offset = HEADER_SIZE, size, address;
+  uint8_t status;
+
+  if ((_sequence[Segment] == 0) || (Segment == _head)) {
+    return LOG_OK;
+  }
+  while (Valid(Segment, offset, &size)) {
+    address = Segment * SEGMENT_SIZE + offset;
+    if (_index[_image[address]] == address) {
+      status = Append(_image[address], &_image[address + RECORD_HEADER], _image[address + 1]);
+      if (status != LOG_OK) {
+        return status;
+      }
+    }
+    offset += size;
+  }
+  return LOG_OK;
+}
+
+bool EepromLog::HasLive(uint32_t Segment) const
+{
+  uint32_t offset = HEADER_SIZE, size, address;
+
+  if (_sequence[Segment] == 0) {
+    return false;
+  }
+  while (Valid(Segment, offset, &size)) {
+    address = Segment * SEGMENT_SIZE + offset;
+    if (_index[_image[address]] == address) {
+      return true;
+    }
+    offset += size;
+  }
+  return false;
+}
+
+void EepromLog::Replay(uint32_t Segment)
+{
+  uint32_t offset = HEADER_SIZE, size, address;
+
+  while (Valid(Segment, offset, &size)) {
+    address = Segment * SEGMENT_SIZE + offset;
+    _index[_image[address]] = address;
+    offset += size;
+  }
+  // Appends go after the last valid record of the head
+  _offset = offset;
+}
+
+void EepromLog::WriteHeader(uint32_t Segment)
+{
+  uint8_t *header = &_image[Segment * SEGMENT_SIZE];
+
+  header[0] = MAGIC[0];
+  header[1] = MAGIC[1];
+  PutU32(header + 4, _sequence[Segment]);
+  PutU16(header + 2, Crc16(header + 4, 4));
+  Queue(Segment * SEGMENT_SIZE, HEADER_SIZE);
+}
+
+void EepromLog::Queue(uint32_t Address, uint32_t Length, uint8_t Attempts)
+{
+  Range *last = (_count > 0) ? &_ranges[(_first + _count - 1) % RANGES] : NULL;
+
+  if ((last != NULL) && ((uint32_t)last->Address + last->Length == Address) && (last->Attempts == Attempts)) {
+    last->Length += Length;
+  } else {
+    if (_count == RANGES) {
+      // Out of ranges: the oldest is written now, the writes queued before
+      // it still go first
+      WriteNow(_ranges[_first]);
+      _first = (_first + 1) % RANGES;
+      _count--;
+    }
+    last = &_ranges[(_first + _count) % RANGES];
+    last->Address = Address;
+    last->Length = Length;
+    last->Attempts = Attempts;
+    _count++;
+  }
+
+  if (!_flushing) {
+    _flushing = true;
+    _queue.call(this, &EepromLog::Flush);
+  }
+}
+
+// Under the lock, which keeps the image as it is until the write is over
+void EepromLog::WriteNow(const Range &Changed)
+{
+  EEPROM_RequestTypeDef request;
+  uint32_t attempts;
+
+  for (attempts = Changed.Attempts; attempts < TRIALS; attempts++) {
+    request.Type = EEPROM_REQUEST_WRITE;
+    request.Address = Changed.Address;
+    request.pBuffer = &_image[Changed.Address];
+    request.Length = Changed.Length;
+    request.pCallback = SyncCompleted;
+    request.pContext = this;
+    _flags.clear(FLAG_SYNC);
+    BSP_EEPROM_Submit(&request);
+    if (Wait(&request, FLAG_SYNC) == EEPROM_REQUEST_DONE) {
+      return;
+    }
+  }
+  _errors++;
+}
+
+void EepromLog::Flush(void)
+{
+  EEPROM_RequestTypeDef *request;
+  uint8_t attempts[WRITES];
+  uint32_t next = 0, oldest = 0, inflight = 0;
+
+  while (true) {
+    _mutex.lock();
+    if ((_count == 0) && (inflight == 0)) {
+      _flushing = false;
+      _mutex.unlock();
+      return;
+    }
+    if ((_count > 0) && (inflight < WRITES)) {
+      // Copied under the lock, written without it
+      Range &range = _ranges[_first];
+      request = &_requests[next];
+      request->Type = EEPROM_REQUEST_WRITE;
+      request->Address = range.Address;
+      request->pBuffer = _buffers[next];
+      request->Length = (range.Length < CHUNK) ? range.Length : CHUNK;
+      request->pCallback = WriteCompleted;
+      request->pContext = this;
+      memcpy(_buffers[next], &_image[range.Address], request->Length);
+      attempts[next] = range.Attempts;
+      range.Address += request->Length;
+      range.Length -= request->Length;
+      if (range.Length == 0) {
+        _first = (_first + 1) % RANGES;
+        _count--;
+      }
+      _mutex.unlock();
+
+      _flags.clear(1UL << next);
+      BSP_EEPROM_Submit(request);
+      next = (next + 1) % WRITES;
+      inflight++;
+      continue;
+    }
+    _mutex.unlock();
+
+    // Requests complete in order. A failed one is written again from the
+    // image, which holds the latest bytes whatever was written since
+    if (Wait(&_requests[oldest], 1UL << oldest) != EEPROM_REQUEST_DONE) {
+      _mutex.lock();
+      if (attempts[oldest] + 1U < TRIALS) {
+        Queue(_requests[oldest].Address, _requests[oldest].Length, attempts[oldest] + 1);
+      } else {
+        _errors++;
+      }
+      _mutex.unlock();
+    }
+    oldest = (oldest + 1) % WRITES;
+    inflight--;
+  }
+}
+
+// Into the image, sleeping meanwhile
+uint8_t EepromLog::Read(uint32_t Address, uint32_t Length)
+{
+  EEPROM_RequestTypeDef request;
+
+  request.Type = EEPROM_REQUEST_READ;
+  request.Address = Address;
+  request.pBuffer = &_image[Address];
+  request.Length = Length;
+  request.pCallback = SyncCompleted;
+  request.pContext = this;
+  _flags.clear(FLAG_SYNC);
+  BSP_EEPROM_Submit(&request);
+  return Wait(&request, FLAG_SYNC);
+}
+
+uint8_t EepromLog::Wait(EEPROM_RequestTypeDef *pRequest, uint32_t Flag)
+{
+  _flags.wait_any(Flag);
+  return pRequest->State;
+}
+
+// From the I2C interrupt
+void EepromLog::SyncCompleted(EEPROM_RequestTypeDef *pRequest)
+{
+  ((EepromLog *)pRequest->pContext)->_flags.set(FLAG_SYNC);
+}
+
+void EepromLog::WriteCompleted(EEPROM_RequestTypeDef *pRequest)
+{
+  EepromLog *log = (EepromLog *)pRequest->pContext;
+
+  log->_flags.set(1UL << (pRequest - log->_requests));
+}
@@ -0,0 +1,163 @@
+#ifndef __EEPROM_LOG_H
+#define __EEPROM_LOG_H
+
+#include "mbed.h"
+#include "drivers/stm32f429i_discovery_eeprom.h"
+
+/*
+  This class keeps small keyed records, such as calibrations and session
+  summaries, in the I2C EEPROM as an append-only log.
+
+  The EEPROM is split in SEGMENTS segments used in turn, so that every cell
+  sees the same number of writes. A segment starts with a header holding its
+  sequence number, then records: key, length, CRC and data, padded to a
+  page. The CRC covers the segment sequence number, so that records left
+  over from an older pass over the segment are never taken for new ones.
+
+  Writing a record only updates a RAM image of the EEPROM and queues the
+  changed bytes: a writer thread hands them to the EEPROM driver in the
+  order they were changed, two requests ahead so that the driver can merge
+  them into the same pages, and sleeps until they complete. A write that
+  fails is queued again, from the image, up to TRIALS times in all. When
+  RANGES changes are already waiting, the oldest is written at once and the
+  caller waits for it.
+  Before the oldest segment is reused, the records still current in it
+  are appended again at the head of the log, then its header is rewritten.
+
+  At boot the segment headers are read, then each segment with a valid
+  header in a request of its own, so that other EEPROM users wait for one
+  segment at most. The segments are replayed in sequence order to rebuild
+  the key index.
+
+  Usage:
+
+  #include "mbed.h"
+  #include "util/EepromLog.h"
+
+  EepromLog storage;
+
+  int main()
+  {
+      Settings settings;
+
+      storage.Init();
+      if(storage.Get(KEY_SETTINGS, &settings, sizeof(settings)) != EepromLog::LOG_OK)
+      {
+          settings = default_settings();
+      }
+      ...
+      storage.Put(KEY_SETTINGS, &settings, sizeof(settings));
+  }
+*/
+class EepromLog
+{
+
+public:
+  static const uint32_t SIZE          = EEPROM_MAX_SIZE;
+  static const uint32_t SEGMENTS      = 16;
+  static const uint32_t SEGMENT_SIZE  = SIZE / SEGMENTS;
+  static const uint8_t  MAX_LENGTH    = 64;   // Record data bytes
+
+  // Status codes
+  static const uint8_t LOG_OK         = 0;
+  static const uint8_t LOG_FAIL       = 1;    // No EEPROM
+  static const uint8_t LOG_NOT_FOUND  = 2;
+  static const uint8_t LOG_FULL       = 3;
+  static const uint8_t LOG_INVALID    = 4;    // Reserved key or bad length
+
+  //! Constructor
+  EepromLog();
+
+  /**
+    * @brief  Reads the EEPROM, rebuilds the index and starts the writer.
+    * @retval LOG_OK, or LOG_FAIL if the EEPROM does not answer
+    */
+  uint8_t Init(void);
+
+  /**
+    * @brief  Copies the current data of a key, from RAM.
+    * @param  Key: 1 to 254
+    * @param  pData: receives at most Size bytes
+    * @param  pLength: receives the record length, may be NULL
+    * @retval LOG_OK or LOG_NOT_FOUND
+    */
+  uint8_t Get(uint8_t Key, void *pData, uint8_t Size, uint8_t *pLength = NULL);
+
+  /**
+    * @brief  Replaces the data of a key. Returns at once, the EEPROM is
+    *         written in the background, unless RANGES changes are waiting.
+    * @param  Key: 1 to 254
+    * @param  Length: 0 to MAX_LENGTH
+    * @retval LOG_OK, LOG_FULL if the live records would not leave two free
+    *         segments, LOG_INVALID, or LOG_FAIL
+    */
+  uint8_t Put(uint8_t Key, const void *pData, uint8_t Length);
+
+  /**
+    * @brief  Tells whether changes are still waiting to be written.
+    */
+  bool IsPending(void);
+
+  /**
+    * @brief  Gets the number of changes lost, their writes having failed
+    *         TRIALS times.
+    */
+  uint32_t GetErrors(void) const;
+
+private:
+  static const uint32_t HEADER_SIZE   = 8;
+  static const uint32_t RECORD_HEADER = 4;
+  static const uint32_t RANGES        = 32;
+  static const uint32_t CHUNK         = 64;
+  static const uint32_t WRITES        = 2;    // Requests in flight
+  static const uint32_t TRIALS        = 3;    // Writes of a change before it is lost
+
+  // Event flags, one per write request, then the request of the caller
+  static const uint32_t FLAG_SYNC     = 1UL << WRITES;
+
+  typedef struct
+  {
+    uint16_t Address;
+    uint16_t Length;
+    uint8_t  Attempts;   // Failed writes
+  } Range;
+
+  bool     Valid(uint32_t Segment, uint32_t Offset, uint32_t *pSize) const;
+  uint8_t  Append(uint8_t Key, const uint8_t *pData, uint8_t Length);
+  uint8_t  OpenSegment(void);
+  uint8_t  Relocate(uint32_t Segment);
+  bool     HasLive(uint32_t Segment) const;
+  void     Replay(uint32_t Segment);
+  void     WriteHeader(uint32_t Segment);
+  void     Queue(uint32_t Address, uint32_t Length, uint8_t Attempts = 0);
+  void     WriteNow(const Range &Changed);
+  void     Flush(void);
+  uint8_t  Read(uint32_t Address, uint32_t Length);
+  uint8_t  Wait(EEPROM_RequestTypeDef *pRequest, uint32_t Flag);
+
+  static void SyncCompleted(EEPROM_RequestTypeDef *pRequest);
+  static void WriteCompleted(EEPROM_RequestTypeDef *pRequest);
+
+  static uint32_t RecordSize(uint8_t Length);
+
+  uint8_t    _image[SIZE];
+  uint16_t   _index[256];      // Address of the current record of each key, 0 if none
+  uint32_t   _sequence[SEGMENTS];  // 0 if the segment has no valid header
+  uint32_t   _head;
+  uint32_t   _offset;
+  uint32_t   _live;
+  Range      _ranges[RANGES];
+  uint32_t   _first;
+  uint32_t   _count;
+  bool       _ready;
+  bool       _flushing;
+  uint32_t   _errors;
+  EEPROM_RequestTypeDef _requests[WRITES];
+  uint8_t    _buffers[WRITES][CHUNK];
+  EventFlags _flags;
+  Mutex      _mutex;
+  Thread     _thread;
+  EventQueue _queue;
+};
+
+#endif
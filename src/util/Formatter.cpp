@@ -0,0 +1,236 @@
+#include "mbed.h"
+#include "Formatter.h"
+
+static const uint32_t Pow10[Formatter::MAX_DECIMALS + 1] =
+{
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+static const char DigitPairs[] =
+  "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+static const char HexDigits[] = "0123456789ABCDEF";
+
+// Writes the decimal digits of Value backwards from pEnd, at least MinDigits of them
+static char *Digits(char *pEnd, uint32_t Value, uint32_t MinDigits)
+{
+  char *p = pEnd;
+
+  while (Value >= 100) {
+    uint32_t pair = Value % 100;
+    Value /= 100;
+    p -= 2;
+    p[0] = DigitPairs[2 * pair];
+    p[1] = DigitPairs[2 * pair + 1];
+  }
+  if (Value >= 10) {
+    p -= 2;
+    p[0] = DigitPairs[2 * Value];
+    p[1] = DigitPairs[2 * Value + 1];
+  } else {
+    *--p = '0' + Value;
+  }
+  while ((uint32_t)(pEnd - p) < MinDigits) {
+    *--p = '0';
+  }
+  return p;
+}
+
+// Same for 64 bits, 9 digits per 64 bit division while above 2^32
+static char *Digits64(char *pEnd, uint64_t Value)
+{
+  char *p = pEnd;
+
+  while (Value > 0xFFFFFFFFu) {
+    uint64_t high = Value / 1000000000u;
+    p = Digits(p, (uint32_t)(Value - high * 1000000000u), 9);
+    Value = high;
+  }
+  return Digits(p, (uint32_t)Value, 1);
+}
+
+// Constructor
+Formatter::Formatter(char *pBuffer, uint32_t Size)
+  : _pBuffer(pBuffer), _size(Size), _length(0), _overflowed(false)
+{
+  MBED_ASSERT(Size > 0);
+  _pBuffer[0] = '\0';
+}
+
+//=================================================================================================================
+// Public methods
+//=================================================================================================================
+
+Formatter &Formatter::Append(const char *pText)
+{
+  const char *p = pText;
+
+  while (*p != '\0') {
+    p++;
+  }
+  Write(pText, p - pText);
+  return *this;
+}
+
+Formatter &Formatter::Append(char Character)
+{
+  Write(&Character, 1);
+  return *this;
+}
+
+Formatter &Formatter::Int(int32_t Value)
+{
+  uint32_t magnitude = (Value < 0) ? (0u - (uint32_t)Value) : (uint32_t)Value;
+
+  return Number(Value < 0, magnitude, 0, 0);
+}
+
+Formatter &Formatter::Uint(uint32_t Value)
+{
+  return Number(false, Value, 0, 0);
+}
+
+Formatter &Formatter::Fixed(int32_t Value, uint8_t Decimals)
+{
+  uint32_t magnitude = (Value < 0) ? (0u - (uint32_t)Value) : (uint32_t)Value;
+  uint32_t scale;
+
+  if (Decimals > MAX_DECIMALS) {
+    Decimals = MAX_DECIMALS;
+  }
+  scale = Pow10[Decimals];
+  return Number(Value < 0, magnitude / scale, magnitude % scale, Decimals);
+}
+
+Formatter &Formatter::Float(float Value, uint8_t Decimals)
+{
+  float magnitude = (Value < 0.0f) ? -Value : Value;
+  float part;
+  uint64_t whole, scaled, rest, half;
+  uint32_t fraction, bits, exponent, shift;
+
+  if (Value != Value) {
+    return Append("nan");
+  }
+  // Also true for infinities
+  if (!(magnitude < 1.8e19f)) {
+    return Append((Value < 0.0f) ? "-inf" : "inf");
+  }
+  if (Decimals > MAX_DECIMALS) {
+    Decimals = MAX_DECIMALS;
+  }
+
+  // The integer part and the fraction are exact. The fraction is its 24 bit
+  // mantissa times 2^-shift: scaled in 64 bits, it is rounded half to even
+  // on its exact value, as printf does
+  whole = (uint64_t)magnitude;
+  part = magnitude - (float)whole;
+  memcpy(&bits, &part, sizeof(bits));
+  exponent = bits >> 23;
+  shift = (exponent != 0) ? (150 - exponent) : 149;
+  scaled = (uint64_t)((exponent != 0) ? ((bits & 0x007FFFFF) | 0x00800000) : bits) * Pow10[Decimals];
+  fraction = 0;
+  // Otherwise below 2^-10 units of the last decimal
+  if (shift < 64) {
+    fraction = (uint32_t)(scaled >> shift);
+    rest = scaled & ((1ull << shift) - 1);
+    half = 1ull << (shift - 1);
+    if ((rest > half) || ((rest == half) && ((((Decimals > 0) ? fraction : whole) & 1) != 0))) {
+      fraction++;
+    }
+  }
+  if (fraction >= Pow10[Decimals]) {
+    whole++;
+    fraction -= Pow10[Decimals];
+  }
+  return Number(Value < 0.0f, whole, fraction, Decimals);
+}
+
+Formatter &Formatter::Hex(uint32_t Value, uint8_t MinDigits)
+{
+  char digits[8];
+  uint32_t count = 0;
+
+  do {
+    digits[7 - count++] = HexDigits[Value & 0x0F];
+    Value >>= 4;
+  } while (Value != 0);
+  while ((count < MinDigits) && (count < 8)) {
+    digits[7 - count++] = '0';
+  }
+  // Zero padding past 8 digits
+  while (MinDigits-- > 8) {
+    Write("0", 1);
+  }
+  Write(&digits[8 - count], count);
+  return *this;
+}
+
+const char *Formatter::Data(void) const
+{
+  return _pBuffer;
+}
+
+uint32_t Formatter::Length(void) const
+{
+  return _length;
+}
+
+bool Formatter::Overflowed(void) const
+{
+  return _overflowed;
+}
+
+void Formatter::Clear(void)
+{
+  _length = 0;
+  _overflowed = false;
+  _pBuffer[0] = '\0';
+}
+
+//=================================================================================================================
+// Private methods
+//=================================================================================================================
+
+Formatter &Formatter::Number(bool Negative, uint64_t Whole, uint32_t Fraction, uint8_t Decimals)
+{
+  char digits[32];
+  char *end = digits + sizeof(digits);
+  char *p = end;
+
+  if (Decimals > 0) {
+    p = Digits(p, Fraction, Decimals);
+    *--p = '.';
+  }
+  // 32 bit divisions unless the number needs more
+  if (Whole <= 0xFFFFFFFFu) {
+    p = Digits(p, (uint32_t)Whole, 1);
+  } else {
+    p = Digits64(p, Whole);
+  }
+
+  // No "-0.00"
+  if (Negative && ((Whole != 0) || (Fraction != 0))) {
+    *--p = '-';
+  }
+  Write(p, end - p);
+  return *this;
+}
+
+void Formatter::Write(const char *pText, uint32_t Length)
+{
+  uint32_t room = _size - 1 - _length;
+  uint32_t i;
+
+  if (Length > room) {
+    Length = room;
+    _overflowed = true;
+  }
+  for (i = 0; i < Length; i++) {
+    _pBuffer[_length + i] = pText[i];
+  }
+  _length += Length;
+  _pBuffer[_length] = '\0';
+}
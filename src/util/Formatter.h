@@ -0,0 +1,114 @@
+#ifndef __FORMATTER_H
+#define __FORMATTER_H
+
+#include <stdint.h>
+
+/*
+  This class appends numbers and text to a caller buffer, for the display and
+  the serial logs: integers, fixed point numbers, floats with a fixed number
+  of decimals and hexadecimal. No heap, no varargs, no locale: each call only
+  converts its own argument, two digits per division.
+
+  Output that does not fit is dropped, the buffer always ends with a '\0'.
+
+  Usage:
+
+  #include "mbed.h"
+  #include "util/Formatter.h"
+
+  BufferedSerial pc(USBTX, USBRX);
+
+  int main()
+  {
+      char line[64];
+      while(1)
+      {
+          Formatter text(line, sizeof(line));
+          text.Append("x=").Float(read_sensor(), 4).Append(" raw=0x").Hex(read_raw(), 4).Append('\n');
+          pc.write(text.Data(), text.Length());
+      }
+  }
+*/
+class Formatter
+{
+
+public:
+  static const uint8_t MAX_DECIMALS = 9;
+
+  //! Constructor, empties the buffer
+  Formatter(char *pBuffer, uint32_t Size);
+
+  /**
+    * @brief  Appends a string.
+    */
+  Formatter &Append(const char *pText);
+
+  /**
+    * @brief  Appends a character.
+    */
+  Formatter &Append(char Character);
+
+  /**
+    * @brief  Appends a signed decimal integer.
+    */
+  Formatter &Int(int32_t Value);
+
+  /**
+    * @brief  Appends an unsigned decimal integer.
+    */
+  Formatter &Uint(uint32_t Value);
+
+  /**
+    * @brief  Appends a fixed point number, 1234 with 2 decimals is 12.34.
+    * @param  Value: number times 10^Decimals
+    * @param  Decimals: 0 to MAX_DECIMALS
+    */
+  Formatter &Fixed(int32_t Value, uint8_t Decimals);
+
+  /**
+    * @brief  Appends a float rounded to a number of decimals, as "%.*f" does.
+    * @param  Decimals: 0 to MAX_DECIMALS
+    * @note   The exact value of the float is rounded, halves to even: the
+    *         digits are those of printf. Zero is never negative, -0.001 with
+    *         2 decimals is "0.00". NaN is "nan", numbers of 1.8e19 or more
+    *         are "inf".
+    */
+  Formatter &Float(float Value, uint8_t Decimals);
+
+  /**
+    * @brief  Appends a hexadecimal number in upper case, without prefix.
+    * @param  MinDigits: minimum number of digits, zero padded
+    */
+  Formatter &Hex(uint32_t Value, uint8_t MinDigits = 1);
+
+  /**
+    * @brief  Gets the '\0' terminated text.
+    */
+  const char *Data(void) const;
+
+  /**
+    * @brief  Gets the text length, without the '\0'.
+    */
+  uint32_t Length(void) const;
+
+  /**
+    * @brief  Tells whether some output was dropped.
+    */
+  bool Overflowed(void) const;
+
+  /**
+    * @brief  Empties the buffer.
+    */
+  void Clear(void);
+
+private:
+  Formatter &Number(bool Negative, uint64_t Whole, uint32_t Fraction, uint8_t Decimals);
+  void Write(const char *pText, uint32_t Length);
+
+  char     *_pBuffer;
+  uint32_t  _size;
+  uint32_t  _length;
+  bool      _overflowed;
+};
+
+#endif
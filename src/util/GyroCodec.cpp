@@ -0,0 +1,281 @@
+#include "GyroCodec.h"
+#include <stddef.h>
+
+static void PutU16(uint8_t *p, uint16_t Value)
+{
+  p[0] = (uint8_t)Value;
+  p[1] = (uint8_t)(Value >> 8);
+}
+
+static uint16_t GetU16(const uint8_t *p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t Zigzag(int32_t Value)
+{
+  return ((uint32_t)Value << 1) ^ (uint32_t)(Value >> 31);
+}
+
+static int32_t Unzigzag(uint32_t Value)
+{
+  return (int32_t)(Value >> 1) ^ -(int32_t)(Value & 1);
+}
+
+//=================================================================================================================
+// GyroCodec
+//=================================================================================================================
+
+uint32_t GyroCodec::Index(const uint8_t *pStream, uint32_t Length, IndexEntry *pIndex, uint32_t MaxEntries)
+{
+  uint32_t offset = 0, sample = 0, entries = 0;
+  uint16_t length, count;
+
+  while ((entries < MaxEntries) && (offset + HEADER_SIZE <= Length)) {
+    length = GetU16(pStream + offset);
+    count = GetU16(pStream + offset + 2);
+    if ((length < HEADER_SIZE) || (offset + length > Length) || (count == 0)) {
+      break;
+    }
+    pIndex[entries].Sample = sample;
+    pIndex[entries].Offset = offset;
+    entries++;
+    sample += count;
+    offset += length;
+  }
+  return entries;
+}
+
+uint32_t GyroCodec::Seek(const IndexEntry *pIndex, uint32_t Entries, uint32_t Sample)
+{
+  uint32_t low = 0, high = Entries, middle;
+
+  if ((Entries == 0) || (pIndex[0].Sample > Sample)) {
+    return Entries;
+  }
+  // Last entry not after Sample, between low and high - 1
+  while (high - low > 1) {
+    middle = low + (high - low) / 2;
+    if (pIndex[middle].Sample <= Sample) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+void GyroCodec::Reset(Axis *pAxis, const int16_t *pSample)
+{
+  for (uint32_t i = 0; i < 3; i++) {
+    pAxis[i].Previous[0] = pSample[i];
+    pAxis[i].Previous[1] = pSample[i];
+    pAxis[i].Error[0] = 0;
+    pAxis[i].Error[1] = 0;
+    pAxis[i].Sum = 16;
+    pAxis[i].Count = 1;
+  }
+}
+
+int32_t GyroCodec::Predict(const Axis &axis)
+{
+  if (axis.Error[0] <= axis.Error[1]) {
+    return axis.Previous[0];
+  }
+  return 2 * axis.Previous[0] - axis.Previous[1];
+}
+
+uint8_t GyroCodec::RiceParameter(const Axis &axis)
+{
+  uint8_t k = 0;
+
+  while (((axis.Count << k) < axis.Sum) && (k < RAW_BITS - 1)) {
+    k++;
+  }
+  return k;
+}
+
+void GyroCodec::Update(Axis &axis, int32_t Value, uint32_t Zigzag)
+{
+  int32_t delta = Value - axis.Previous[0];
+  int32_t linear = Value - (2 * axis.Previous[0] - axis.Previous[1]);
+
+  // Decaying sums over about 16 samples
+  axis.Error[0] += (uint32_t)((delta < 0) ? -delta : delta) - (axis.Error[0] >> 4);
+  axis.Error[1] += (uint32_t)((linear < 0) ? -linear : linear) - (axis.Error[1] >> 4);
+  axis.Sum += Zigzag;
+  if (++axis.Count == 64) {
+    axis.Sum >>= 1;
+    axis.Count >>= 1;
+  }
+  axis.Previous[1] = axis.Previous[0];
+  axis.Previous[0] = Value;
+}
+
+//=================================================================================================================
+// GyroEncoder
+//=================================================================================================================
+
+// Constructor
+GyroEncoder::GyroEncoder(uint8_t *pBuffer, uint32_t Size, uint32_t BlockSamples)
+  : _buffer(pBuffer), _size(Size), _blockSamples(BlockSamples), _count(0), _length(0), _position(0), _bits(0),
+    _pending(0)
+{
+  if (_blockSamples > MAX_SAMPLES) {
+    _blockSamples = MAX_SAMPLES;
+  }
+  while ((_blockSamples > 1) && (MaxBlockSize(_blockSamples) > _size)) {
+    _blockSamples--;
+  }
+}
+
+bool GyroEncoder::Push(const int16_t *pSample)
+{
+  int32_t residual;
+  uint32_t zigzag, quotient, i;
+  uint8_t k;
+
+  if (_count == 0) {
+    // First sample as is
+    for (i = 0; i < 3; i++) {
+      PutU16(_buffer + 4 + 2 * i, (uint16_t)pSample[i]);
+    }
+    Reset(_axes, pSample);
+    _position = HEADER_SIZE;
+    _pending = 0;
+    _length = 0;
+  } else {
+    for (i = 0; i < 3; i++) {
+      residual = pSample[i] - Predict(_axes[i]);
+      zigzag = Zigzag(residual);
+      k = RiceParameter(_axes[i]);
+      quotient = zigzag >> k;
+      if (quotient < ESCAPE) {
+        // Unary quotient ended by a 0, then the k low bits
+        PutBits((1UL << (quotient + 1)) - 2, quotient + 1);
+        PutBits(zigzag & ((1UL << k) - 1), k);
+      } else {
+        PutBits((1UL << ESCAPE) - 1, ESCAPE);
+        PutBits(zigzag, RAW_BITS);
+      }
+      Update(_axes[i], pSample[i], zigzag);
+    }
+  }
+
+  if (++_count == _blockSamples) {
+    Close();
+    return true;
+  }
+  return false;
+}
+
+bool GyroEncoder::Flush(void)
+{
+  if (_count == 0) {
+    return false;
+  }
+  Close();
+  return true;
+}
+
+const uint8_t *GyroEncoder::Data(void) const
+{
+  return _buffer;
+}
+
+uint32_t GyroEncoder::Length(void) const
+{
+  return _length;
+}
+
+// At most 20 bits, 7 left over from the previous call
+void GyroEncoder::PutBits(uint32_t Value, uint32_t Bits)
+{
+  _bits = (_bits << Bits) | Value;
+  _pending += Bits;
+  while (_pending >= 8) {
+    _pending -= 8;
+    _buffer[_position++] = (uint8_t)(_bits >> _pending);
+  }
+}
+
+void GyroEncoder::Close(void)
+{
+  if (_pending > 0) {
+    _buffer[_position++] = (uint8_t)(_bits << (8 - _pending));
+    _pending = 0;
+  }
+  PutU16(_buffer, (uint16_t)_position);
+  PutU16(_buffer + 2, (uint16_t)_count);
+  _length = _position;
+  _count = 0;
+}
+
+//=================================================================================================================
+// GyroDecoder
+//=================================================================================================================
+
+uint32_t GyroDecoder::Decode(const uint8_t *pBlock, uint32_t Length, int16_t *pSamples, uint32_t MaxCount)
+{
+  Axis axes[3];
+  uint32_t length, count, position, bits = 0, pending = 0, quotient, zigzag, n, i;
+  int32_t value;
+  uint8_t k;
+
+  if (Length < HEADER_SIZE) {
+    return 0;
+  }
+  length = GetU16(pBlock);
+  count = GetU16(pBlock + 2);
+  if ((length < HEADER_SIZE) || (length > Length) || (count == 0) || (count > MaxCount)) {
+    return 0;
+  }
+  for (i = 0; i < 3; i++) {
+    pSamples[i] = (int16_t)GetU16(pBlock + 4 + 2 * i);
+  }
+  Reset(axes, pSamples);
+  position = HEADER_SIZE;
+
+// At least Bits bits pending, or the block is too short
+#define NEED(Bits)                             \
+  while (pending < (Bits)) {                   \
+    if (position >= length) {                  \
+      return 0;                                \
+    }                                          \
+    bits = (bits << 8) | pBlock[position++];   \
+    pending += 8;                              \
+  }
+
+  for (n = 1; n < count; n++) {
+    for (i = 0; i < 3; i++) {
+      quotient = 0;
+      while (quotient < ESCAPE) {
+        NEED(1);
+        pending--;
+        if (((bits >> pending) & 1) == 0) {
+          break;
+        }
+        quotient++;
+      }
+      if (quotient < ESCAPE) {
+        k = RiceParameter(axes[i]);
+        NEED(k);
+        pending -= k;
+        zigzag = (quotient << k) | ((bits >> pending) & ((1UL << k) - 1));
+      } else {
+        NEED(RAW_BITS);
+        pending -= RAW_BITS;
+        zigzag = (bits >> pending) & ((1UL << RAW_BITS) - 1);
+      }
+      value = Predict(axes[i]) + Unzigzag(zigzag);
+      if ((value < -32768) || (value > 32767)) {
+        return 0;
+      }
+      pSamples[3 * n + i] = (int16_t)value;
+      Update(axes[i], value, zigzag);
+    }
+  }
+#undef NEED
+
+  return count;
+}
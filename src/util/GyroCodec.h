@@ -0,0 +1,153 @@
+#ifndef __GYRO_CODEC_H
+#define __GYRO_CODEC_H
+
+#include <stdint.h>
+
+/*
+  Lossless coding of raw gyroscope samples, X, Y, Z triples of int16_t, in
+  blocks that decode on their own.
+
+  Block, little endian:
+    uint16_t Length       bytes of the block, these 2 included
+    uint16_t Count        samples
+    int16_t  X, Y, Z      first sample
+    bits                  the next samples, X, Y, Z residuals, MSB first
+
+  Each axis predicts its next value from the previous one (delta) or the
+  previous two (linear), whichever had the smaller residuals lately: noise
+  at rest favours the delta, a smooth tremor the linear prediction. The
+  residual is zigzag mapped and Rice coded, the Rice parameter following
+  the mean residual like JPEG-LS. Residuals too long for the code are
+  escaped and sent on RAW_BITS. The decoder runs the same adaptation, and
+  all of it restarts with each block.
+
+  GyroEncoder codes one sample per call, cheap enough for every sample at
+  the full output data rate. GyroDecoder builds for the board and the host.
+
+  In blocks of 512 samples, rest and tremor code to 1.6 to 2 bytes per
+  sample, 3 to 3.7 times less than raw, but voluntary movement leaves
+  residuals of hundreds of LSB and codes only 1.4 times smaller, and white
+  noise over the whole range grows by 8 % (test/host/test_gyro_codec.cpp).
+  Daily use mixes them, about 1.5 times overall: short of the 2 to 4 times
+  aimed at. The telemetry link codes its samples; Recorder keeps them raw,
+  its captures being DMA copies of windows of fixed size samples.
+
+  Usage:
+
+  #include "util/GyroCodec.h"
+
+  uint8_t block[GyroEncoder::MaxBlockSize(256)];
+  GyroEncoder encoder(block, sizeof(block), 256);
+
+  void on_sample(const int16_t *sample)
+  {
+      if(encoder.Push(sample))
+      {
+          send(encoder.Data(), encoder.Length());
+      }
+  }
+*/
+
+class GyroCodec
+{
+
+public:
+  static const uint32_t HEADER_SIZE = 10;
+  static const uint32_t MAX_SAMPLES = 4096;
+  static const uint32_t ESCAPE      = 16;   // Rice quotient that escapes
+  static const uint32_t RAW_BITS    = 20;
+
+  typedef struct
+  {
+    uint32_t Sample;      // First sample of the block in the stream
+    uint32_t Offset;      // Bytes from the start of the stream
+  } IndexEntry;
+
+  /**
+    * @brief  Worst case size of a block.
+    */
+  static constexpr uint32_t MaxBlockSize(uint32_t Samples)
+  {
+    return HEADER_SIZE + ((Samples - 1) * 3 * (ESCAPE + RAW_BITS) + 7) / 8;
+  }
+
+  /**
+    * @brief  Builds the seek index of blocks stored back to back.
+    * @retval Number of entries, blocks after the first invalid one ignored
+    */
+  static uint32_t Index(const uint8_t *pStream, uint32_t Length, IndexEntry *pIndex, uint32_t MaxEntries);
+
+  /**
+    * @brief  Finds the block holding a sample.
+    * @retval Index entry, or Entries if Sample is before the first block
+    */
+  static uint32_t Seek(const IndexEntry *pIndex, uint32_t Entries, uint32_t Sample);
+
+protected:
+  // Prediction and Rice parameter of one axis
+  typedef struct
+  {
+    int32_t  Previous[2];
+    uint32_t Error[2];    // Recent residual magnitudes, delta and linear
+    uint32_t Sum;         // Recent zigzag residuals
+    uint32_t Count;
+  } Axis;
+
+  static void    Reset(Axis *pAxis, const int16_t *pSample);
+  static int32_t Predict(const Axis &axis);
+  static uint8_t RiceParameter(const Axis &axis);
+  static void    Update(Axis &axis, int32_t Value, uint32_t Zigzag);
+};
+
+class GyroEncoder : public GyroCodec
+{
+
+public:
+  //! Constructor
+  GyroEncoder(uint8_t *pBuffer, uint32_t Size, uint32_t BlockSamples);
+
+  /**
+    * @brief  Codes one sample.
+    * @param  pSample: X, Y, Z
+    * @retval true if it completed a block, then in Data() until the next
+    *         call
+    */
+  bool Push(const int16_t *pSample);
+
+  /**
+    * @brief  Ends the current block early.
+    * @retval true if there was one, then in Data()
+    */
+  bool Flush(void);
+
+  const uint8_t *Data(void) const;
+  uint32_t Length(void) const;
+
+private:
+  void PutBits(uint32_t Value, uint32_t Bits);
+  void Close(void);
+
+  uint8_t  *_buffer;
+  uint32_t  _size;
+  uint32_t  _blockSamples;
+  uint32_t  _count;       // Samples of the open block, 0 if none
+  uint32_t  _length;      // Bytes of the last block closed
+  uint32_t  _position;    // Bytes written
+  uint32_t  _bits;
+  uint32_t  _pending;     // Bits in _bits
+  Axis      _axes[3];
+};
+
+class GyroDecoder : public GyroCodec
+{
+
+public:
+  /**
+    * @brief  Decodes a block.
+    * @param  pSamples: receives at most MaxCount X, Y, Z triples
+    * @retval Number of samples, 0 if the block is invalid or too long
+    */
+  static uint32_t Decode(const uint8_t *pBlock, uint32_t Length, int16_t *pSamples, uint32_t MaxCount);
+};
+
+#endif
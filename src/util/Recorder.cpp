@@ -0,0 +1,313 @@
+#include "Recorder.h"
+
+static const uint32_t INDEX_ADDR   = Recorder::REGION_ADDR;
+static const uint32_t CAPTURE_ADDR = INDEX_ADDR + Recorder::BLOCKS * sizeof(Recorder::Entry);
+static const uint32_t HISTORY_ADDR = CAPTURE_ADDR + Recorder::CAPTURES * Recorder::CAPTURE_SIZE;
+
+Recorder *Recorder::_active = NULL;
+
+// Constructor
+Recorder::Recorder()
+  : _current(0), _fill(0), _blockTime(0), _count(0), _queued(0), _stored(0), _index((Entry *)INDEX_ADDR),
+    _nextCapture(0), _markCount(0), _firstJob(0), _jobCount(0), _running(false), _dropped(0), _errors(0)
+{
+  for (uint32_t i = 0; i < STAGES; i++) {
+    _staged[i] = false;
+  }
+  for (uint32_t i = 0; i < CAPTURES; i++) {
+    _captures[i].State = CAPTURE_FREE;
+  }
+}
+
+//=================================================================================================================
+// Public methods
+//=================================================================================================================
+
+void Recorder::Init(void)
+{
+  CriticalSectionLock lock;
+
+  _active = this;
+  _current = 0;
+  _fill = 0;
+  _count = 0;
+  _queued = 0;
+  _stored = 0;
+  _markCount = 0;
+}
+
+void Recorder::Push(const int16_t *pSamples, uint32_t Count, uint32_t Time)
+{
+  uint32_t n, first;
+
+  while (Count > 0) {
+    if (_staged[_current]) {
+      // Both blocks still waiting for the DMA
+      _dropped += Count;
+      return;
+    }
+    if (_fill == 0) {
+      _blockTime = Time;
+    }
+    n = BLOCK_SAMPLES - _fill;
+    if (n > Count) {
+      n = Count;
+    }
+    memcpy((uint8_t *)_stage[_current] + _fill * SAMPLE_SIZE, pSamples, n * SAMPLE_SIZE);
+    pSamples += 3 * n;
+    Count -= n;
+    _fill += n;
+
+    CriticalSectionLock lock;
+    _count += n;
+    if (_fill == BLOCK_SAMPLES) {
+      first = _queued;
+      _index[(first / BLOCK_SAMPLES) % BLOCKS].Sample = first;
+      _index[(first / BLOCK_SAMPLES) % BLOCKS].Time = _blockTime;
+      _queued += BLOCK_SAMPLES;
+      _staged[_current] = true;
+      Queue((uint32_t)_stage[_current], HistoryAddress(first), BLOCK_SIZE, _current, -1);
+      _current = (_current + 1) % STAGES;
+      _fill = 0;
+    }
+  }
+}
+
+uint32_t Recorder::Trigger(uint8_t Type, uint32_t PreSamples, uint32_t PostSamples)
+{
+  return TriggerAt(_count, Type, PreSamples, PostSamples);
+}
+
+uint32_t Recorder::TriggerAt(uint32_t Sample, uint8_t Type, uint32_t PreSamples, uint32_t PostSamples)
+{
+  CriticalSectionLock lock;
+  Mark &mark = _marks[_markCount % MARKS];
+  uint32_t oldest = Oldest() + BLOCK_SAMPLES;
+  uint32_t first, count;
+
+  mark.Sample = Sample;
+  mark.Time = (_queued > 0) ? _index[(_queued / BLOCK_SAMPLES - 1) % BLOCKS].Time : 0;
+  mark.Type = Type;
+  mark.Capture = CAPTURES;
+
+  // Nothing to capture once the window has left the history
+  if ((PreSamples + PostSamples > 0) && (Sample + PostSamples > oldest) &&
+      (_captures[_nextCapture].State != CAPTURE_WAITING) && (_captures[_nextCapture].State != CAPTURE_COPYING)) {
+    // Whole words for the DMA: an even number of samples from an even sample
+    first = (Sample > PreSamples) ? Sample - PreSamples : 0;
+    if (first < oldest) {
+      first = oldest;
+    }
+    first &= ~1UL;
+    count = (Sample + PostSamples - first + 1) & ~1UL;
+    if (count > CAPTURE_SAMPLES) {
+      count = CAPTURE_SAMPLES;
+    }
+    _captures[_nextCapture].Mark = _markCount;
+    _captures[_nextCapture].First = first;
+    _captures[_nextCapture].Count = count;
+    _captures[_nextCapture].State = CAPTURE_WAITING;
+    mark.Capture = _nextCapture;
+    _nextCapture = (_nextCapture + 1) % CAPTURES;
+    CopyCaptures();
+  }
+
+  return _markCount++;
+}
+
+uint32_t Recorder::Read(uint32_t First, int16_t *pSamples, uint32_t Count) const
+{
+  uint32_t stored = _stored, done = 0, n;
+
+  if ((First < Oldest()) || (First >= stored)) {
+    return 0;
+  }
+  if (Count > stored - First) {
+    Count = stored - First;
+  }
+  while (done < Count) {
+    // Up to the end of the history area
+    n = HISTORY_SAMPLES - (First + done) % HISTORY_SAMPLES;
+    if (n > Count - done) {
+      n = Count - done;
+    }
+    memcpy(pSamples + 3 * done, (const void *)HistoryAddress(First + done), n * SAMPLE_SIZE);
+    done += n;
+  }
+  return Count;
+}
+
+uint32_t Recorder::Find(uint32_t Time) const
+{
+  uint32_t low = (Oldest() + BLOCK_SAMPLES - 1) / BLOCK_SAMPLES;
+  uint32_t high = _stored / BLOCK_SAMPLES;
+  uint32_t middle;
+
+  if ((low >= high) || (_index[low % BLOCKS].Time > Time)) {
+    return NONE;
+  }
+  // Last block not later than Time, between low and high - 1
+  while (high - low > 1) {
+    middle = low + (high - low) / 2;
+    if (_index[middle % BLOCKS].Time <= Time) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  return _index[low % BLOCKS].Sample;
+}
+
+bool Recorder::GetMark(uint32_t Number, Mark *pMark) const
+{
+  CriticalSectionLock lock;
+
+  if ((Number >= _markCount) || (_markCount - Number > MARKS)) {
+    return false;
+  }
+  *pMark = _marks[Number % MARKS];
+  return true;
+}
+
+const int16_t *Recorder::GetCapture(uint32_t Number, uint32_t *pFirst, uint32_t *pCount) const
+{
+  Mark mark;
+
+  if (!GetMark(Number, &mark) || (mark.Capture >= CAPTURES)) {
+    return NULL;
+  }
+  const Window &capture = _captures[mark.Capture];
+  if ((capture.Mark != Number) || (capture.State != CAPTURE_DONE)) {
+    return NULL;
+  }
+  *pFirst = capture.First;
+  *pCount = capture.Count;
+  return (const int16_t *)(CAPTURE_ADDR + mark.Capture * CAPTURE_SIZE);
+}
+
+uint32_t Recorder::GetCount(void) const
+{
+  return _count;
+}
+
+uint32_t Recorder::GetDropped(void) const
+{
+  return _dropped;
+}
+
+uint32_t Recorder::GetErrors(void) const
+{
+  return _errors;
+}
+
+//=================================================================================================================
+// Private methods
+//=================================================================================================================
+
+// Interrupts disabled
+void Recorder::Queue(uint32_t Source, uint32_t Destination, uint32_t Size, int8_t Stage, int8_t Capture)
+{
+  Job &job = _jobs[(_firstJob + _jobCount) % JOBS];
+
+  job.Source = Source;
+  job.Destination = Destination;
+  job.Size = Size;
+  job.Stage = Stage;
+  job.Capture = Capture;
+  _jobCount++;
+
+  if (!_running) {
+    Start();
+  }
+}
+
+// Interrupts disabled or from the DMA interrupt
+void Recorder::Start(void)
+{
+  Job *job;
+
+  // Jobs queued by a failed one are taken by the loop
+  _running = true;
+  while (_jobCount > 0) {
+    job = &_jobs[_firstJob];
+    if (BSP_SDRAM_WriteData_DMA(job->Destination, (uint32_t *)job->Source, job->Size / sizeof(uint32_t)) == SDRAM_OK) {
+      return;
+    }
+    Completed(false);
+  }
+  _running = false;
+}
+
+// The oldest job is over
+void Recorder::Completed(bool Ok)
+{
+  Job job = _jobs[_firstJob];
+
+  if (!Ok) {
+    _errors++;
+  }
+  _firstJob = (_firstJob + 1) % JOBS;
+  _jobCount--;
+
+  if (job.Stage >= 0) {
+    _staged[job.Stage] = false;
+    _stored += BLOCK_SAMPLES;
+    CopyCaptures();
+  }
+  if (job.Capture >= 0) {
+    _captures[job.Capture].State = CAPTURE_DONE;
+  }
+}
+
+// Starts the copy of the captures whose last sample is in the history
+void Recorder::CopyCaptures(void)
+{
+  uint32_t i, first, count, n, destination;
+
+  for (i = 0; i < CAPTURES; i++) {
+    Window &capture = _captures[i];
+    if ((capture.State != CAPTURE_WAITING) || (capture.First + capture.Count > _stored)) {
+      continue;
+    }
+    capture.State = CAPTURE_COPYING;
+    first = capture.First;
+    count = capture.Count;
+    destination = CAPTURE_ADDR + i * CAPTURE_SIZE;
+    // In two parts if the window wraps in the history
+    n = HISTORY_SAMPLES - first % HISTORY_SAMPLES;
+    if (n < count) {
+      Queue(HistoryAddress(first), destination, n * SAMPLE_SIZE, -1, -1);
+      destination += n * SAMPLE_SIZE;
+      first += n;
+      count -= n;
+    }
+    Queue(HistoryAddress(first), destination, count * SAMPLE_SIZE, -1, i);
+  }
+}
+
+uint32_t Recorder::HistoryAddress(uint32_t Sample) const
+{
+  return HISTORY_ADDR + (Sample % HISTORY_SAMPLES) * SAMPLE_SIZE;
+}
+
+// First sample that no block sent or being sent overwrites
+uint32_t Recorder::Oldest(void) const
+{
+  return (_queued > HISTORY_SAMPLES) ? _queued - HISTORY_SAMPLES : 0;
+}
+
+void BSP_SDRAM_DMA_XferCpltCallback(void)
+{
+  if (Recorder::_active != NULL) {
+    Recorder::_active->Completed(true);
+    Recorder::_active->Start();
+  }
+}
+
+void BSP_SDRAM_DMA_XferErrorCallback(void)
+{
+  if (Recorder::_active != NULL) {
+    Recorder::_active->Completed(false);
+    Recorder::_active->Start();
+  }
+}
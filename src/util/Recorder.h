@@ -0,0 +1,220 @@
+#ifndef __RECORDER_H
+#define __RECORDER_H
+
+#include "mbed.h"
+#include "drivers/stm32f429i_discovery_sdram.h"
+
+/*
+  This class keeps every raw gyroscope sample, an X, Y, Z triple of int16_t,
+  in the SDRAM left free by the LCD: a circular history of HISTORY_SAMPLES.
+  The samples are not coded, see util/GyroCodec.h for why.
+
+  Samples are gathered in SRAM blocks of BLOCK_SAMPLES. A full block is sent
+  to the history by the SDRAM DMA stream, and its first sample number and
+  time go to an index, so that any time of the history can be found.
+
+  A trigger marks a sample, a tremor onset for instance, and can capture a
+  window around it: PreSamples before it, PostSamples after it. Once the
+  last sample of the window is in the history, the DMA copies the window to
+  one of CAPTURES capture areas, used in turn, where the history moving on
+  does not overwrite it.
+
+  SDRAM layout from SDRAM_FREE_ADDR: index, capture areas, history.
+
+  Usage:
+
+  #include "mbed.h"
+  #include "util/Recorder.h"
+
+  Recorder recorder;
+
+  int main()
+  {
+      int16_t samples[32 * 3];
+
+      recorder.Init();
+      while(1)
+      {
+          uint32_t first = recorder.GetCount();
+          uint32_t count = read_gyro_fifo(samples);
+          recorder.Push(samples, count, time_ms());
+          for(uint32_t i = 0; i < count; i++)
+          {
+              if(onset(&samples[3 * i]))
+              {
+                  recorder.TriggerAt(first + i, ONSET, 1000, 2000);
+              }
+          }
+      }
+  }
+*/
+class Recorder
+{
+
+public:
+  typedef struct
+  {
+    uint32_t Sample;      // First sample of the block
+    uint32_t Time;        // Time given with it
+  } Entry;
+
+  typedef struct
+  {
+    uint32_t Sample;      // Sample marked
+    uint32_t Time;        // Time of the last block sent to the history
+    uint8_t  Type;
+    uint8_t  Capture;     // Capture area, CAPTURES if none
+  } Mark;
+
+  static const uint32_t SAMPLE_SIZE     = 3 * sizeof(int16_t);
+  static const uint32_t BLOCK_SAMPLES   = 512;
+  static const uint32_t BLOCK_SIZE      = BLOCK_SAMPLES * SAMPLE_SIZE;
+  static const uint32_t CAPTURES        = 4;
+  static const uint32_t CAPTURE_SAMPLES = 16384;
+  static const uint32_t CAPTURE_SIZE    = CAPTURE_SAMPLES * SAMPLE_SIZE;
+  static const uint32_t MARKS           = 32;
+
+  static const uint32_t REGION_ADDR     = SDRAM_FREE_ADDR;
+  static const uint32_t REGION_SIZE     = SDRAM_DEVICE_ADDR + SDRAM_DEVICE_SIZE - SDRAM_FREE_ADDR;
+  static const uint32_t BLOCKS          = (REGION_SIZE - CAPTURES * CAPTURE_SIZE) / (BLOCK_SIZE + sizeof(Entry));
+  static const uint32_t HISTORY_SAMPLES = BLOCKS * BLOCK_SAMPLES;
+
+  static const uint32_t NONE            = 0xFFFFFFFF;
+
+  //! Constructor
+  Recorder();
+
+  /**
+    * @brief  Empties the history and takes the SDRAM DMA over. The SDRAM
+    *         must be initialized, as the LCD does.
+    */
+  void Init(void);
+
+  /**
+    * @brief  Appends samples to the history.
+    * @param  pSamples: Count X, Y, Z triples
+    * @param  Time: time of the samples, kept in the index by block
+    */
+  void Push(const int16_t *pSamples, uint32_t Count, uint32_t Time);
+
+  /**
+    * @brief  Marks the next sample and captures a window around it.
+    * @param  PreSamples: samples kept before the mark
+    * @param  PostSamples: samples kept from the mark on
+    * @retval Mark number, for GetMark()
+    */
+  uint32_t Trigger(uint8_t Type, uint32_t PreSamples, uint32_t PostSamples);
+
+  /**
+    * @brief  Marks a sample and captures a window centred on it.
+    * @param  Sample: sample number, see GetCount(), pushed or not yet
+    * @param  PreSamples: samples kept before the mark
+    * @param  PostSamples: samples kept from the mark on
+    * @retval Mark number, for GetMark()
+    */
+  uint32_t TriggerAt(uint32_t Sample, uint8_t Type, uint32_t PreSamples, uint32_t PostSamples);
+
+  /**
+    * @brief  Copies samples of the history.
+    * @param  First: sample number
+    * @retval Number of samples copied: 0 if First is no longer or not yet in
+    *         the history
+    */
+  uint32_t Read(uint32_t First, int16_t *pSamples, uint32_t Count) const;
+
+  /**
+    * @brief  Finds the block of the history holding a time.
+    * @retval First sample of the last block not later than Time, or NONE
+    */
+  uint32_t Find(uint32_t Time) const;
+
+  /**
+    * @brief  Gets a mark, if still among the last MARKS.
+    */
+  bool GetMark(uint32_t Number, Mark *pMark) const;
+
+  /**
+    * @brief  Gets the completed capture of a mark, if its area has not been
+    *         taken by CAPTURES later captures.
+    * @param  pFirst: receives the number of its first sample
+    * @param  pCount: receives its number of samples
+    * @retval Samples in SDRAM, or NULL if the capture is not complete
+    */
+  const int16_t *GetCapture(uint32_t Number, uint32_t *pFirst, uint32_t *pCount) const;
+
+  /**
+    * @brief  Gets the number of samples pushed.
+    */
+  uint32_t GetCount(void) const;
+
+  /**
+    * @brief  Gets the number of samples lost, the SDRAM DMA being late.
+    */
+  uint32_t GetDropped(void) const;
+
+  /**
+    * @brief  Gets the number of failed DMA transfers.
+    */
+  uint32_t GetErrors(void) const;
+
+private:
+  static const uint32_t STAGES = 2;
+  static const uint32_t JOBS   = STAGES + 2 * CAPTURES;
+
+  static const uint8_t CAPTURE_FREE    = 0;
+  static const uint8_t CAPTURE_WAITING = 1;    // For its last samples
+  static const uint8_t CAPTURE_COPYING = 2;
+  static const uint8_t CAPTURE_DONE    = 3;
+
+  typedef struct
+  {
+    uint32_t Source;
+    uint32_t Destination;
+    uint32_t Size;
+    int8_t   Stage;       // Block sent, or -1
+    int8_t   Capture;     // Capture completed, or -1
+  } Job;
+
+  typedef struct
+  {
+    uint32_t Mark;
+    uint32_t First;
+    uint32_t Count;
+    volatile uint8_t State;
+  } Window;
+
+  void     Queue(uint32_t Source, uint32_t Destination, uint32_t Size, int8_t Stage, int8_t Capture);
+  void     Start(void);
+  void     Completed(bool Ok);
+  void     CopyCaptures(void);
+  uint32_t HistoryAddress(uint32_t Sample) const;
+  uint32_t Oldest(void) const;
+
+  // The SDRAM DMA interrupt
+  friend void ::BSP_SDRAM_DMA_XferCpltCallback(void);
+  friend void ::BSP_SDRAM_DMA_XferErrorCallback(void);
+
+  static Recorder *_active;
+
+  uint32_t          _stage[STAGES][BLOCK_SIZE / sizeof(uint32_t)];
+  volatile bool     _staged[STAGES];     // Block waiting for the DMA
+  uint32_t          _current;
+  uint32_t          _fill;
+  uint32_t          _blockTime;
+  uint32_t          _count;              // Samples pushed
+  uint32_t          _queued;             // Samples of the blocks sent or being sent
+  volatile uint32_t _stored;             // Samples of the blocks sent
+  Entry            *_index;
+  Window            _captures[CAPTURES];
+  uint32_t          _nextCapture;
+  Mark              _marks[MARKS];
+  uint32_t          _markCount;
+  Job               _jobs[JOBS];
+  uint32_t          _firstJob;
+  uint32_t          _jobCount;
+  bool              _running;
+  uint32_t          _dropped;
+  uint32_t          _errors;
+};
+
+#endif
@@ -0,0 +1,167 @@
+#include "Telemetry.h"
+#include "Crc.h"
+
+Telemetry *Telemetry::_active = NULL;
+
+// Constructor
+Telemetry::Telemetry()
+  : _head(0), _tail(0), _sending(0), _sequence(0), _encoder(_block + sizeof(uint32_t), MAX_PAYLOAD - sizeof(uint32_t),
+                                                            BLOCK_SAMPLES),
+    _samples(0), _blockFirst(0), _dropped(0), _errors(0)
+{
+}
+
+//=================================================================================================================
+// Public methods
+//=================================================================================================================
+
+bool Telemetry::Init(uint32_t BaudRate)
+{
+  _active = this;
+  return (BSP_UART_TX_Init(BaudRate) == UART_TX_OK);
+}
+
+bool Telemetry::Send(uint8_t Type, const void *pData, uint32_t Length)
+{
+  uint32_t length = OVERHEAD + Length;
+  uint32_t head, code, i;
+  uint16_t crc;
+
+  if (Length > MAX_PAYLOAD) {
+    return false;
+  }
+
+  _mutex.lock();
+  _record[0] = Type;
+  _record[1] = (uint8_t)_sequence;
+  _record[2] = (uint8_t)(_sequence >> 8);
+  _sequence++;
+  memcpy(_record + 3, pData, Length);
+  crc = Crc16(_record, length - 2);
+  _record[length - 2] = (uint8_t)crc;
+  _record[length - 1] = (uint8_t)(crc >> 8);
+
+  // COBS adds a byte per 254, plus the first code byte and the delimiter
+  if (BUFFER_SIZE - (_head - _tail) < length + length / 254 + 2) {
+    _dropped++;
+    _mutex.unlock();
+    return false;
+  }
+
+  // COBS: each code byte is the distance to the next zero, 0xFF for 254
+  // bytes without one
+  head = _head;
+  code = head++;
+  for (i = 0; i < length; i++) {
+    if (_record[i] == 0) {
+      _buffer[code % BUFFER_SIZE] = (uint8_t)(head - code);
+      code = head++;
+    } else {
+      _buffer[head++ % BUFFER_SIZE] = _record[i];
+      if (head - code == 0xFF) {
+        _buffer[code % BUFFER_SIZE] = 0xFF;
+        code = head++;
+      }
+    }
+  }
+  _buffer[code % BUFFER_SIZE] = (uint8_t)(head - code);
+  _buffer[head++ % BUFFER_SIZE] = 0;
+
+  {
+    CriticalSectionLock lock;
+    _head = head;
+    if (_sending == 0) {
+      Start();
+    }
+  }
+  _mutex.unlock();
+
+  return true;
+}
+
+bool Telemetry::Print(const char *pText)
+{
+  uint32_t length = strlen(pText);
+
+  return Send(RECORD_TEXT, pText, (length > MAX_PAYLOAD) ? MAX_PAYLOAD : length);
+}
+
+void Telemetry::PushSamples(const int16_t *pSamples, uint32_t Count)
+{
+  for (uint32_t i = 0; i < Count; i++) {
+    _samples++;
+    if (_encoder.Push(pSamples + 3 * i)) {
+      _block[0] = (uint8_t)_blockFirst;
+      _block[1] = (uint8_t)(_blockFirst >> 8);
+      _block[2] = (uint8_t)(_blockFirst >> 16);
+      _block[3] = (uint8_t)(_blockFirst >> 24);
+      Send(RECORD_SAMPLES, _block, sizeof(uint32_t) + _encoder.Length());
+      _blockFirst = _samples;
+    }
+  }
+}
+
+uint32_t Telemetry::GetSamples(void) const
+{
+  return _samples;
+}
+
+uint32_t Telemetry::GetDropped(void) const
+{
+  return _dropped;
+}
+
+uint32_t Telemetry::GetErrors(void) const
+{
+  return _errors;
+}
+
+//=================================================================================================================
+// Private methods
+//=================================================================================================================
+
+// Interrupts disabled or from the DMA interrupt. Sends up to the end of the
+// ring, the rest goes in the next transfer
+void Telemetry::Start(void)
+{
+  uint32_t tail, length;
+
+  while (_head != _tail) {
+    tail = _tail % BUFFER_SIZE;
+    length = _head - _tail;
+    if (length > BUFFER_SIZE - tail) {
+      length = BUFFER_SIZE - tail;
+    }
+    _sending = length;
+    if (BSP_UART_TX_Send(_buffer + tail, (uint16_t)length) == UART_TX_OK) {
+      return;
+    }
+    // The host skips to the next delimiter
+    Completed(false);
+  }
+}
+
+void Telemetry::Completed(bool Ok)
+{
+  if (!Ok) {
+    _errors++;
+  }
+  _tail += _sending;
+  _sending = 0;
+}
+
+void BSP_UART_TX_CpltCallback(void)
+{
+  if (Telemetry::_active != NULL) {
+    Telemetry::_active->Completed(true);
+    Telemetry::_active->Start();
+  }
+}
+
+void BSP_UART_TX_ErrorCallback(void)
+{
+  if (Telemetry::_active != NULL) {
+    Telemetry::_active->Completed(false);
+    Telemetry::_active->Start();
+  }
+}
@@ -0,0 +1,141 @@
+#ifndef __TELEMETRY_H
+#define __TELEMETRY_H
+
+#include "mbed.h"
+#include "drivers/stm32f429i_discovery_uart.h"
+#include "util/GyroCodec.h"
+
+/*
+  This class sends binary records to the host on the ST-LINK virtual COM
+  port, USART1, by DMA.
+
+  Record, before framing:
+    uint8_t  Type
+    uint16_t Sequence     one more for each record, sent or dropped
+    payload               at most MAX_PAYLOAD bytes
+    uint16_t Crc          Crc16() of all the above
+  all little endian. Each record is COBS encoded, so that it holds no zero
+  byte, and followed by a zero byte: the host finds the records again after
+  any lost or corrupted byte.
+
+  Records are framed straight into a ring buffer, and the DMA sends
+  whatever is in it: records that come while a transfer runs go together in
+  the next one. Nothing blocks. A record that does not fit in the free part
+  of the ring is dropped and counted, and the host sees the gap in the
+  sequence numbers.
+
+  Every gyroscope sample goes out in RECORD_SAMPLES records: the number of
+  the first sample, uint32_t, then a GyroCodec block of BLOCK_SAMPLES.
+
+  Usage:
+
+  #include "mbed.h"
+  #include "util/Telemetry.h"
+
+  Telemetry telemetry;
+
+  int main()
+  {
+      telemetry.Init(921600);
+      telemetry.Print("Starting...\n");
+      while(1)
+      {
+          telemetry.PushSamples(samples, count);
+          telemetry.Send(Telemetry::RECORD_LEVEL, &level, sizeof(level));
+      }
+  }
+*/
+class Telemetry
+{
+
+public:
+  // Record types
+  static const uint8_t RECORD_TEXT     = 0x01;    // Characters, no terminating zero
+  static const uint8_t RECORD_SAMPLES  = 0x02;
+  static const uint8_t RECORD_LEVEL    = 0x03;    // Telemetry::Level
+  static const uint8_t RECORD_LOG      = 0x04;    // TokenLog::Read() entries
+
+  static const uint32_t BUFFER_SIZE    = 4096;
+  static const uint32_t BLOCK_SAMPLES  = 64;
+  static const uint32_t MAX_PAYLOAD    = sizeof(uint32_t) + GyroCodec::MaxBlockSize(BLOCK_SAMPLES);
+
+  typedef struct
+  {
+    uint32_t Time;        // Milliseconds
+    uint32_t Sample;      // Sample it was computed from
+    int32_t  Level;       // Hundredths
+  } Level;
+
+  //! Constructor
+  Telemetry();
+
+  /**
+    * @brief  Takes USART1 over. printf() may not be used afterwards.
+    * @param  BaudRate: bits per second
+    * @retval true on success
+    */
+  bool Init(uint32_t BaudRate);
+
+  /**
+    * @brief  Queues a record, from thread context.
+    * @param  Length: payload bytes, at most MAX_PAYLOAD
+    * @retval false if the record was dropped
+    */
+  bool Send(uint8_t Type, const void *pData, uint32_t Length);
+
+  /**
+    * @brief  Queues a text record.
+    */
+  bool Print(const char *pText);
+
+  /**
+    * @brief  Codes gyroscope samples, sending a RECORD_SAMPLES record at the
+    *         end of each block. From a single thread.
+    * @param  pSamples: Count X, Y, Z triples
+    */
+  void PushSamples(const int16_t *pSamples, uint32_t Count);
+
+  /**
+    * @brief  Gets the number of samples pushed.
+    */
+  uint32_t GetSamples(void) const;
+
+  /**
+    * @brief  Gets the number of records dropped, the link being too slow.
+    */
+  uint32_t GetDropped(void) const;
+
+  /**
+    * @brief  Gets the number of failed DMA transfers.
+    */
+  uint32_t GetErrors(void) const;
+
+private:
+  // Type, sequence number and CRC
+  static const uint32_t OVERHEAD = 5;
+
+  void Start(void);
+  void Completed(bool Ok);
+
+  // The DMA interrupt
+  friend void ::BSP_UART_TX_CpltCallback(void);
+  friend void ::BSP_UART_TX_ErrorCallback(void);
+
+  static Telemetry *_active;
+
+  uint8_t           _buffer[BUFFER_SIZE];
+  uint32_t          _head;       // Bytes framed, only increasing
+  volatile uint32_t _tail;       // Bytes sent
+  uint32_t          _sending;    // Bytes of the transfer running, 0 if none
+  uint8_t           _record[OVERHEAD + MAX_PAYLOAD];
+  uint16_t          _sequence;
+  Mutex             _mutex;
+  uint8_t           _block[MAX_PAYLOAD];
+  GyroEncoder       _encoder;
+  uint32_t          _samples;
+  uint32_t          _blockFirst;
+  uint32_t          _dropped;
+  uint32_t          _errors;
+};
+
+#endif
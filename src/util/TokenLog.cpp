@@ -0,0 +1,68 @@
+#include "TokenLog.h"
+
+TokenLog::Entry TokenLog::_entries[ENTRIES];
+volatile uint32_t TokenLog::_reserved = 0;
+volatile uint32_t TokenLog::_read = 0;
+volatile uint32_t TokenLog::_dropped = 0;
+
+//=================================================================================================================
+// Public methods
+//=================================================================================================================
+
+uint32_t TokenLog::Read(uint8_t *pBuffer, uint32_t Size)
+{
+  uint32_t length = 0, size, i;
+
+  while (true) {
+    Entry &entry = _entries[_read % ENTRIES];
+    if (core_util_atomic_load_u32(&entry.Stamp) != _read + 1) {
+      // Not filled yet
+      break;
+    }
+    size = ENTRY_HEADER + 4 * entry.Count;
+    if (length + size > Size) {
+      break;
+    }
+    memcpy(pBuffer + length, &entry.Token, 4);
+    memcpy(pBuffer + length + 4, &entry.Time, 4);
+    pBuffer[length + 8] = (uint8_t)entry.Count;
+    for (i = 0; i < entry.Count; i++) {
+      memcpy(pBuffer + length + ENTRY_HEADER + 4 * i, &entry.Args[i], 4);
+    }
+    length += size;
+    // The entry is free for writers once _read moves past it
+    core_util_atomic_store_u32(&_read, _read + 1);
+  }
+  return length;
+}
+
+uint32_t TokenLog::GetDropped(void)
+{
+  return _dropped;
+}
+
+//=================================================================================================================
+// Private methods
+//=================================================================================================================
+
+void TokenLog::Store(uint32_t Token, const uint32_t *pArgs, uint32_t Count)
+{
+  uint32_t reserved = core_util_atomic_load_u32(&_reserved);
+  uint32_t i;
+
+  do {
+    if (reserved - core_util_atomic_load_u32(&_read) >= ENTRIES) {
+      core_util_atomic_incr_u32(&_dropped, 1);
+      return;
+    }
+  } while (!core_util_atomic_cas_u32(&_reserved, &reserved, reserved + 1));
+
+  Entry &entry = _entries[reserved % ENTRIES];
+  entry.Token = Token;
+  entry.Time = us_ticker_read();
+  entry.Count = Count;
+  for (i = 0; i < Count; i++) {
+    entry.Args[i] = pArgs[i];
+  }
+  core_util_atomic_store_u32(&entry.Stamp, reserved + 1);
+}
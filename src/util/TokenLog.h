@@ -0,0 +1,133 @@
+#ifndef __TOKEN_LOG_H
+#define __TOKEN_LOG_H
+
+#include "mbed.h"
+#include <type_traits>
+
+/*
+  Tokenized logging: a TOKEN_LOG() call keeps neither its format string nor
+  any formatting on the board. The format is hashed at compile time into a
+  32-bit token, and the call only stores the token, the time and its
+  arguments, 32 bits each, in a ring of fixed size entries. The host turns
+  them back into text with the dictionary that tools/tokens/tokens.py builds
+  from the sources before each build.
+
+  The ring takes entries from any thread or interrupt without a lock: a
+  writer reserves an entry with a compare and swap, fills it, then stamps
+  it with its reservation number. The reader takes entries in order, each
+  once its stamp is there. A writer that finds the ring full drops its
+  entry and counts it.
+
+  Arguments are integers up to 32 bits or floats, at most MAX_ARGS, used
+  with %d, %i, %u, %x, %X, %c, %f, %e and %g. No %s: the string would not be
+  in the dictionary. The format must be a single string literal, for the
+  dictionary script.
+
+  Usage:
+
+  #include "mbed.h"
+  #include "util/TokenLog.h"
+
+  void on_overrun(uint32_t sample)
+  {
+      TOKEN_LOG("FIFO overrun at sample %u", sample);
+  }
+
+  int main()
+  {
+      uint8_t buffer[256];
+      while(1)
+      {
+          uint32_t length = TokenLog::Read(buffer, sizeof(buffer));
+          send(buffer, length);
+      }
+  }
+*/
+#define TOKEN_LOG(Format, ...)                                                    \
+  do {                                                                            \
+    static constexpr uint32_t _token = TokenLog::Token(Format);                   \
+    TokenLog::Write(_token, ##__VA_ARGS__);                                       \
+  } while (0)
+
+class TokenLog
+{
+
+public:
+  static const uint32_t MAX_ARGS = 4;
+  static const uint32_t ENTRIES  = 64;
+
+  // Size of an entry given by Read(): token, time in microseconds, number
+  // of arguments (uint8_t), then the arguments, all little endian
+  static const uint32_t ENTRY_HEADER = 9;
+  static const uint32_t MAX_ENTRY    = ENTRY_HEADER + 4 * MAX_ARGS;
+
+  /**
+    * @brief  FNV-1a hash of a format string, as tools/tokens/tokens.py.
+    */
+  static constexpr uint32_t Token(const char *pFormat, uint32_t Hash = 2166136261UL)
+  {
+    return (*pFormat == '\0') ? Hash : Token(pFormat + 1, (Hash ^ (uint8_t)*pFormat) * 16777619UL);
+  }
+
+  /**
+    * @brief  Stores an entry, from any context. Use TOKEN_LOG().
+    */
+  template <typename... Args>
+  static void Write(uint32_t Token, Args... args)
+  {
+    static_assert(sizeof...(Args) <= MAX_ARGS, "too many arguments");
+    const uint32_t words[] = { Word(args)..., 0 };
+
+    Store(Token, words, sizeof...(Args));
+  }
+
+  /**
+    * @brief  Takes the entries stored, from a single thread.
+    * @param  pBuffer: receives whole entries
+    * @retval Number of bytes
+    */
+  static uint32_t Read(uint8_t *pBuffer, uint32_t Size);
+
+  /**
+    * @brief  Gets the number of entries dropped, the ring being full.
+    */
+  static uint32_t GetDropped(void);
+
+private:
+  typedef struct
+  {
+    volatile uint32_t Stamp;   // Reservation number + 1 once filled
+    uint32_t Token;
+    uint32_t Time;
+    uint32_t Count;
+    uint32_t Args[MAX_ARGS];
+  } Entry;
+
+  static void Store(uint32_t Token, const uint32_t *pArgs, uint32_t Count);
+
+  // Integers and enums as they are, floating point as float
+  template <typename T>
+  static uint32_t Word(T Value)
+  {
+    static_assert((std::is_integral<T>::value || std::is_enum<T>::value) && (sizeof(T) <= 4), "32-bit integers only");
+    return (uint32_t)Value;
+  }
+  static uint32_t Word(float Value)
+  {
+    uint32_t word;
+
+    memcpy(&word, &Value, sizeof(word));
+    return word;
+  }
+  static uint32_t Word(double Value)
+  {
+    return Word((float)Value);
+  }
+
+  static Entry             _entries[ENTRIES];
+  static volatile uint32_t _reserved;   // Entries reserved, only increasing
+  static volatile uint32_t _read;       // Entries taken
+  static volatile uint32_t _dropped;
+};
+
+#endif
@@ -0,0 +1,56 @@
+#include "TremorDetector.h"
+#include <math.h>
+
+// Constructor
+TremorDetector::TremorDetector() : _level(0.0f), _tremor(false), _onset(false)
+{
+}
+
+//=================================================================================================================
+// Public methods
+//=================================================================================================================
+
+float TremorDetector::Update(const int16_t *pSample)
+{
+  // Each rate scaled on its own, so that float rounding is the same on
+  // every compiler
+  float x = pSample[0] * SCALE;
+  float y = pSample[1] * SCALE;
+  float z = pSample[2] * SCALE;
+
+  _level = fabsf(x) + fabsf(y) + fabsf(z);
+  _onset = (_level > MILD_LEVEL) && !_tremor;
+  _tremor = (_level > MILD_LEVEL);
+  return _level;
+}
+
+float TremorDetector::GetLevel(void) const
+{
+  return _level;
+}
+
+uint8_t TremorDetector::GetSeverity(void) const
+{
+  return Severity(_level);
+}
+
+bool TremorDetector::IsOnset(void) const
+{
+  return _onset;
+}
+
+uint8_t TremorDetector::Severity(float Level)
+{
+  if (Level >= SEVERE_LEVEL) {
+    return SEVERE;
+  }
+  if (Level > MILD_LEVEL) {
+    return MILD;
+  }
+  return NONE;
+}
+
+int32_t TremorDetector::Hundredths(float Level)
+{
+  return (int32_t)(Level * 100.0f + 0.5f);
+}
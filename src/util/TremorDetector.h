@@ -0,0 +1,77 @@
+#ifndef __TREMOR_DETECTOR_H
+#define __TREMOR_DETECTOR_H
+
+#include <stdint.h>
+
+/*
+  This class rates the tremor of a raw gyroscope sample: the level is the
+  sum of the absolute angular rates of the three axes, and its severity
+  follows MILD_LEVEL and SEVERE_LEVEL. An onset is the first level above
+  MILD_LEVEL after one that was not.
+
+  It uses neither mbed nor the HAL, so that the host tools run the very same
+  code on recorded samples as the board does.
+
+  Usage:
+
+  #include "util/TremorDetector.h"
+
+  TremorDetector detector;
+
+  void on_sample(const int16_t *sample)
+  {
+      detector.Update(sample);
+      if(detector.IsOnset())
+      {
+          report(detector.GetLevel());
+      }
+  }
+*/
+class TremorDetector
+{
+
+public:
+  // Severities
+  static const uint8_t NONE   = 0;
+  static const uint8_t MILD   = 1;
+  static const uint8_t SEVERE = 2;
+
+  static constexpr float SCALE        = 0.0003054f;   // 17.5 mdps per LSB, in rad/s
+  static constexpr float MILD_LEVEL   = 1.0f;
+  static constexpr float SEVERE_LEVEL = 3.0f;
+
+  //! Constructor
+  TremorDetector();
+
+  /**
+    * @brief  Rates a sample.
+    * @param  pSample: X, Y, Z
+    * @retval Level
+    */
+  float Update(const int16_t *pSample);
+
+  float   GetLevel(void) const;
+  uint8_t GetSeverity(void) const;
+
+  /**
+    * @brief  Tells whether the last sample started a tremor.
+    */
+  bool IsOnset(void) const;
+
+  /**
+    * @brief  Gets the severity of a level.
+    */
+  static uint8_t Severity(float Level);
+
+  /**
+    * @brief  Rounds a level to hundredths, as displayed, stored and sent.
+    */
+  static int32_t Hundredths(float Level);
+
+private:
+  float _level;
+  bool  _tremor;
+  bool  _onset;
+};
+
+#endif
@@ -0,0 +1,90 @@
+#include "TremorPipeline.h"
+#include <stddef.h>
+
+// Constructor
+TremorPipeline::TremorPipeline() : _last(0), _onset(NULL), _context(NULL)
+{
+  Reset();
+}
+
+//=================================================================================================================
+// Public methods
+//=================================================================================================================
+
+TremorPipeline::Block TremorPipeline::Interleaved(const int16_t *pSamples, uint32_t Count, uint32_t First)
+{
+  Block block = { { pSamples, pSamples + 1, pSamples + 2 }, 3, Count, First };
+
+  return block;
+}
+
+void TremorPipeline::SetOnsetCallback(OnsetCallback pCallback, void *pContext)
+{
+  _onset = pCallback;
+  _context = pContext;
+}
+
+void TremorPipeline::Process(const Block &block)
+{
+  int16_t sample[3];
+  uint32_t i, offset = 0;
+  int32_t level;
+
+  for (i = 0; i < block.Count; i++, offset += block.Stride) {
+    sample[0] = block.pAxis[0][offset];
+    sample[1] = block.pAxis[1][offset];
+    sample[2] = block.pAxis[2][offset];
+    _detector.Update(sample);
+
+    level = TremorDetector::Hundredths(_detector.GetLevel());
+    if (level > _summary.MaxLevel) {
+      _summary.MaxLevel = level;
+    }
+    switch (_detector.GetSeverity()) {
+      case TremorDetector::MILD:
+        _summary.MildSamples++;
+        break;
+      case TremorDetector::SEVERE:
+        _summary.SevereSamples++;
+        break;
+      default:
+        break;
+    }
+    if (_detector.IsOnset()) {
+      _summary.Onsets++;
+      if (_onset != NULL) {
+        _onset(block.First + i, _detector.GetLevel(), _context);
+      }
+    }
+  }
+  _summary.Samples += block.Count;
+  if (block.Count > 0) {
+    _last = block.First + block.Count - 1;
+  }
+}
+
+void TremorPipeline::Reset(void)
+{
+  _detector = TremorDetector();
+  _summary.Samples = 0;
+  _summary.Onsets = 0;
+  _summary.MaxLevel = 0;
+  _summary.MildSamples = 0;
+  _summary.SevereSamples = 0;
+  _last = 0;
+}
+
+float TremorPipeline::GetLevel(void) const
+{
+  return _detector.GetLevel();
+}
+
+uint32_t TremorPipeline::GetLast(void) const
+{
+  return _last;
+}
+
+const TremorPipeline::Summary &TremorPipeline::GetSummary(void) const
+{
+  return _summary;
+}
@@ -0,0 +1,106 @@
+#ifndef __TREMOR_PIPELINE_H
+#define __TREMOR_PIPELINE_H
+
+#include <stdint.h>
+#include "TremorDetector.h"
+
+/*
+  This class runs the tremor detection on every gyroscope sample, block by
+  block: the level of each sample, the onsets, handed to a callback, and a
+  summary of the samples seen at each severity.
+
+  A block only points at the samples, which are read in place: Stride is
+  the number of int16_t from one sample to the next on each axis. The board
+  gives the X, Y, Z triples read from the FIFO, Interleaved(), the host
+  replay the columns of a capture file, stride 1. Like TremorDetector it
+  builds for the board and the host, so that both run the same code.
+
+  Usage:
+
+  #include "util/TremorPipeline.h"
+
+  TremorPipeline pipeline;
+
+  void on_onset(uint32_t sample, float level, void *context)
+  {
+      mark(sample);
+  }
+
+  int main()
+  {
+      pipeline.SetOnsetCallback(on_onset, NULL);
+      while(1)
+      {
+          uint32_t count = read_fifo(samples);
+          pipeline.Process(TremorPipeline::Interleaved(samples, count, number));
+          number += count;
+      }
+  }
+*/
+class TremorPipeline
+{
+
+public:
+  typedef struct
+  {
+    const int16_t *pAxis[3];  // X, Y, Z of the first sample
+    uint32_t       Stride;
+    uint32_t       Count;
+    uint32_t       First;     // Number of the first sample
+  } Block;
+
+  typedef struct
+  {
+    uint32_t Samples;
+    uint32_t Onsets;
+    int32_t  MaxLevel;        // Hundredths
+    uint32_t MildSamples;
+    uint32_t SevereSamples;
+  } Summary;
+
+  typedef void (*OnsetCallback)(uint32_t Sample, float Level, void *pContext);
+
+  //! Constructor
+  TremorPipeline();
+
+  /**
+    * @brief  Makes the block of Count X, Y, Z triples.
+    */
+  static Block Interleaved(const int16_t *pSamples, uint32_t Count, uint32_t First);
+
+  /**
+    * @brief  Sets the function called at each onset, from Process().
+    */
+  void SetOnsetCallback(OnsetCallback pCallback, void *pContext);
+
+  /**
+    * @brief  Rates the samples of a block.
+    */
+  void Process(const Block &block);
+
+  /**
+    * @brief  Forgets the samples seen, as after a reset of the board.
+    */
+  void Reset(void);
+
+  /**
+    * @brief  Gets the level of the last sample.
+    */
+  float GetLevel(void) const;
+
+  /**
+    * @brief  Gets the number of the last sample.
+    */
+  uint32_t GetLast(void) const;
+
+  const Summary &GetSummary(void) const;
+
+private:
+  TremorDetector _detector;
+  Summary        _summary;
+  uint32_t       _last;
+  OnsetCallback  _onset;
+  void          *_context;
+};
+
+#endif
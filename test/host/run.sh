@@ -0,0 +1,56 @@
+#!/bin/sh
+# Builds and runs the host tests, from the repository root. See host/README.md.
+#   test/host/run.sh          runs them all
+#   test/host/run.sh -u       writes the golden images again, then runs them
+set -e
+
+BUILD=${BUILD:-test/host/build}
+CFLAGS="-O2 -march=native -no-pie -DTARGET_DISCO_F429ZI -Ihost -Isrc -Isrc/drivers -Wno-int-to-pointer-cast -pthread"
+mkdir -p $BUILD
+
+# Host backend and LCD drivers, only the objects built here: $BUILD may hold old ones
+objects=
+for f in host/*.c src/drivers/stm32f429i_discovery_lcd.c src/drivers/stm32f429i_discovery_raster.c \
+         src/drivers/ili9341.c src/drivers/font*.c; do
+    gcc $CFLAGS -Wno-pointer-to-int-cast -c $f -o $BUILD/$(basename $f .c).o
+    objects="$objects $BUILD/$(basename $f .c).o"
+done
+LCD="src/drivers/LCD_DISCO_F429ZI.cpp src/ui/*.cpp src/util/Formatter.cpp src/util/TremorDetector.cpp $objects"
+
+g++ $CFLAGS -o $BUILD/test_screens test/host/test_screens.cpp $LCD
+g++ $CFLAGS -o $BUILD/test_formatter test/host/test_formatter.cpp src/util/Formatter.cpp
+g++ $CFLAGS -o $BUILD/test_gyro_codec test/host/test_gyro_codec.cpp src/util/GyroCodec.cpp
+gcc $CFLAGS -c src/drivers/l3gd20.c -o $BUILD/l3gd20.o
+g++ $CFLAGS -o $BUILD/test_gyro test/host/test_gyro.cpp $BUILD/host_gyro.o $BUILD/l3gd20.o
+g++ $CFLAGS -o $BUILD/test_clock test/host/test_clock.cpp $BUILD/host_clock.o $BUILD/host_gyro.o $BUILD/l3gd20.o
+
+# host_dma2d.c for each SIMD level: all must give the pixels of the scalar reference
+DMA2D_FLAGS=$(echo "$CFLAGS" | sed 's/-march=native//')
+reference=
+for simd in "-DHOST_DMA2D_NO_SIMD" "-march=x86-64" "-march=x86-64 -mssse3" "-march=native"; do
+    gcc $DMA2D_FLAGS $simd -Wno-pointer-to-int-cast -o $BUILD/test_dma2d test/host/test_dma2d.c host/host_dma2d.c
+    result=$($BUILD/test_dma2d)
+    echo "dma2d $simd: $result"
+    if [ -z "$reference" ]; then
+        reference=$result
+    elif [ "$result" != "$reference" ]; then
+        echo "dma2d $simd differs from the scalar reference"
+        exit 1
+    fi
+done
+
+if [ "$1" = "-u" ]; then
+    $BUILD/test_screens -u test/host/golden
+fi
+$BUILD/test_screens test/host/golden
+$BUILD/test_formatter
+$BUILD/test_gyro_codec
+$BUILD/test_gyro
+# One hour of virtual time: two runs must give the same output
+first=$($BUILD/test_clock)
+echo "$first"
+if [ "$($BUILD/test_clock)" != "$first" ]; then
+    echo "test_clock differs from one run to the next"
+    exit 1
+fi
+echo "host tests passed"
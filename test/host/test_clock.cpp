@@ -0,0 +1,205 @@
+/**
+  ******************************************************************************
+  * @file    test_clock.cpp
+  * @brief   Host test of host/host_clock.c: an hour of a sampler thread and a
+  *          main loop, as in main.cpp, on the virtual clock.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this test:
+--------------------------
+   test/host/run.sh builds and runs it twice: both runs must print the same.
+   ./test_clock
+
+2. Description:
+---------------------
+   - A sampler thread above normal priority drains the FIFO of the gyroscope
+     model every 20 ms, as readGyroFifo() of main.cpp, the model following
+     HOST_CLOCK_Now(). The main loop copies the latest sample every 150 ms,
+     holding the Mutex 10 ms so that the sampler sometimes waits for it.
+   - A stall of the gyroscope is scheduled at 10 min for 500 ms with
+     HOST_CLOCK_Schedule(), and the run ends at 1 h with HOST_CLOCK_SetEnd().
+   - At the end every sample of the hour must have been drained once, in
+     order, or still be in the FIFO, but those of the stall. The sampler
+     must have run every 20 ms, later only after waiting for the Mutex, which
+     it must have done, and the main loop 24000 times.
+   - The counts, the clock counters and a checksum of the samples are
+     printed; the host time taken goes to stderr.
+
+------------------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "mbed.h"
+#include "host_gyro.h"
+
+#define NS_PER_MS             1000000ULL
+#define RUN_NS                (3600ULL * 1000 * NS_PER_MS)
+#define STALL_AT_NS           (600ULL * 1000 * NS_PER_MS)
+#define STALL_NS              (500 * NS_PER_MS)
+#define SAMPLER_PERIOD        20ms
+#define MAIN_PERIOD           150ms
+#define MAIN_HOLD             10ms
+
+// As initializeGyro() of main.cpp: 190 Hz, 2000 dps, FIFO in stream mode
+#define CTRL_REG1_VAL         0x6F
+#define CTRL_REG4_VAL         0x20
+#define CTRL_REG5_VAL         0x40
+#define FIFO_CTRL_REG_VAL     0x40
+#define FIFO_SRC_OVRN         0x40
+#define FIFO_SRC_FSS          0x1F
+#define GYRO_FIFO_SIZE        32
+#define GYRO_RATE_HZ          190
+
+static Thread sampler(osPriorityAboveNormal, 2048, nullptr, "sampler");
+static Mutex latestLock;
+static int16_t latest;
+
+static uint32_t Produced = 0;     // Counter source: sample n reads n on X
+static uint32_t Drained = 0;
+static uint32_t Disorders = 0;
+static uint32_t SamplerRuns = 0;
+static uint32_t SamplerWaits = 0;
+static uint32_t MainRuns = 0;
+static uint32_t Checksum = 0;
+static struct timespec Started;
+
+static uint8_t CounterSource(void *pContext, uint64_t Time, float *pDps)
+{
+  (void)pContext;
+  (void)Time;
+  Produced++;
+  pDps[0] = (float)(Produced & 0x3FFF) * (L3GD20_SENSITIVITY_2000DPS / 1000.0f);
+  pDps[1] = 0.0f;
+  pDps[2] = 0.0f;
+  return 1;
+}
+
+static void WriteRegister(uint8_t Address, uint8_t Value)
+{
+  GYRO_IO_Write(&Value, Address, 1);
+}
+
+// As readGyroFifo() of main.cpp, X of each sample in pX
+static uint32_t ReadFifo(int16_t *pX)
+{
+  uint8_t source, data[GYRO_FIFO_SIZE * 6];
+  uint32_t count;
+
+  GYRO_IO_Read(&source, L3GD20_FIFO_SRC_REG_ADDR, 1);
+  count = (source & FIFO_SRC_OVRN) ? GYRO_FIFO_SIZE : (source & FIFO_SRC_FSS);
+  if (count == 0) {
+    return 0;
+  }
+  GYRO_IO_Read(data, L3GD20_OUT_X_L_ADDR, count * 6);
+  for (uint32_t i = 0; i < count; i++) {
+    pX[i] = (int16_t)(((uint16_t)data[6 * i + 1] << 8) | data[6 * i]);
+  }
+  return count;
+}
+
+static void sampleGyro()
+{
+  int16_t x[GYRO_FIFO_SIZE];
+  uint64_t before;
+
+  while (true) {
+    uint32_t count = ReadFifo(x);
+    SamplerRuns++;
+    for (uint32_t i = 0; i < count; i++) {
+      // 1 to 0x3FFF, 0, then again
+      if ((uint16_t)x[i] != ((Drained + 1) & 0x3FFF)) {
+        Disorders++;
+      }
+      Drained++;
+      Checksum = Checksum * 31 + (uint16_t)x[i];
+    }
+    if (count > 0) {
+      before = HOST_CLOCK_Now();
+      latestLock.lock();
+      if (HOST_CLOCK_Now() != before) {
+        SamplerWaits++;
+      }
+      latest = x[count - 1];
+      latestLock.unlock();
+    }
+    ThisThread::sleep_for(SAMPLER_PERIOD);
+  }
+}
+
+static void Stall(void *pContext)
+{
+  (void)pContext;
+  HOST_GYRO_InjectFault(HOST_GYRO_FAULT_STALL, STALL_NS);
+}
+
+static void Report(void)
+{
+  HOST_GYRO_StatsTypeDef gyro;
+  HOST_CLOCK_StatsTypeDef clock;
+  struct timespec ended;
+  int16_t x[GYRO_FIFO_SIZE];
+  uint32_t failures = 0, waiting;
+
+  // The sampler drained the FIFO less than 20 ms ago
+  waiting = ReadFifo(x);
+  HOST_GYRO_GetStats(&gyro);
+  HOST_CLOCK_GetStats(&clock);
+  clock_gettime(CLOCK_MONOTONIC, &ended);
+
+  printf("clock: %u samples drained, %u waiting, %u stalled, %u lost, checksum %08X\n", Drained, waiting,
+         gyro.Stalled, gyro.Lost, Checksum);
+  printf("clock: sampler %u runs, %u waits, main loop %u runs\n", SamplerRuns, SamplerWaits, MainRuns);
+  printf("clock: %llu switches, %llu sleeps, %llu events\n", (unsigned long long)clock.Switches,
+         (unsigned long long)clock.Sleeps, (unsigned long long)clock.Events);
+  fprintf(stderr, "clock: 1 h in %.2f s\n",
+          (ended.tv_sec - Started.tv_sec) + (ended.tv_nsec - Started.tv_nsec) * 1e-9);
+
+  // A stalled sample is not produced: the counter goes on after the stall
+  if ((gyro.Samples != 3600 * GYRO_RATE_HZ) || (Drained + waiting + gyro.Stalled != gyro.Samples) || (gyro.Lost != 0) ||
+      (gyro.Stalled < STALL_NS * GYRO_RATE_HZ / (1000 * NS_PER_MS) - 1) || (Disorders != 0)) {
+    printf("clock: samples failed, %u out of order\n", Disorders);
+    failures++;
+  }
+  // Each wait delays the next runs of the sampler by less than a period
+  if ((SamplerRuns > 3600 * 50 + 1) || (SamplerRuns + SamplerWaits < 3600 * 50) || (MainRuns != 3600 * 1000 / 150) || (SamplerWaits == 0) ||
+      (clock.Events != 1)) {
+    printf("clock: scheduling failed\n");
+    failures++;
+  }
+  fflush(NULL);
+  if (failures > 0) {
+    exit(1);
+  }
+}
+
+int main(void)
+{
+  int16_t shown = 0;
+
+  clock_gettime(CLOCK_MONOTONIC, &Started);
+  HOST_GYRO_SetSource(CounterSource, NULL);
+  HOST_GYRO_SetClock(HOST_CLOCK_Now);
+  L3GD20_Init((CTRL_REG4_VAL << 8) | CTRL_REG1_VAL);
+  WriteRegister(L3GD20_CTRL_REG5_ADDR, CTRL_REG5_VAL);
+  WriteRegister(L3GD20_FIFO_CTRL_REG_ADDR, FIFO_CTRL_REG_VAL);
+
+  HOST_CLOCK_Schedule(STALL_AT_NS, Stall, NULL);
+  HOST_CLOCK_SetEnd(RUN_NS, Report);
+  sampler.start(sampleGyro);
+
+  // Out of step with the sampler, so that it sometimes finds the Mutex taken
+  ThisThread::sleep_for(5ms);
+  while (true) {
+    MainRuns++;
+    latestLock.lock();
+    shown = latest;
+    ThisThread::sleep_for(MAIN_HOLD);
+    latestLock.unlock();
+    (void)shown;
+    ThisThread::sleep_for(MAIN_PERIOD - MAIN_HOLD);
+  }
+}
@@ -0,0 +1,153 @@
+/**
+  ******************************************************************************
+  * @file    test_dma2d.c
+  * @brief   Host test of host_dma2d.c: random fills, copies, conversions and
+  *          blends, hashed, so that the SIMD kernels can be checked against
+  *          the scalar reference.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this test:
+--------------------------
+   test/host/run.sh builds it against host_dma2d.c with -DHOST_DMA2D_NO_SIMD,
+   for SSE2 only, for SSSE3 and with -march=native, and fails unless the
+   four print the same hash.
+   ./test_dma2d [cases]                       4000 cases by default
+
+2. Description:
+---------------------
+   - The cases come from a fixed seed: the same on every build. Each draws
+     an operation, the input and output color modes, alpha modes and
+     colors, CLUTs, offsets and a size up to 100 x 4 pixels, which covers
+     the vector bodies and their tails.
+   - Sources and CLUTs hold random bytes. The destination is filled with
+     random bytes too, so that pixels written where they should not be
+     change the hash.
+   - The hash covers the destination, the DMA2D error count and the
+     counters of HOST_DMA2D_GetCounters().
+
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32f429i_discovery_dma2d.h"
+#include "host_lcd.h"
+
+#define TEST_CASES            4000
+#define TEST_MAX_WIDTH        100
+#define TEST_MAX_HEIGHT       4
+#define TEST_MAX_OFFSET       7
+#define TEST_BUFFER_SIZE      ((TEST_MAX_WIDTH + TEST_MAX_OFFSET) * TEST_MAX_HEIGHT * 4)
+
+/* Below 4 GB, the program being linked without PIE */
+static uint8_t  Foreground[TEST_BUFFER_SIZE];
+static uint8_t  Background[TEST_BUFFER_SIZE];
+static uint8_t  Destination[TEST_BUFFER_SIZE];
+static uint32_t ForegroundCLUT[256];
+static uint32_t BackgroundCLUT[256];
+
+static uint32_t Seed = 0x2545F491;
+
+static uint32_t Random(void)
+{
+  Seed ^= Seed << 13;
+  Seed ^= Seed >> 17;
+  Seed ^= Seed << 5;
+  return Seed;
+}
+
+static void RandomBytes(void *pBuffer, uint32_t Size)
+{
+  uint8_t *p = (uint8_t *)pBuffer;
+  uint32_t i;
+
+  for(i = 0; i < Size; i++)
+  {
+    p[i] = (uint8_t)Random();
+  }
+}
+
+static uint64_t Hash(uint64_t State, const void *pData, uint32_t Size)
+{
+  const uint8_t *p = (const uint8_t *)pData;
+  uint32_t i;
+
+  for(i = 0; i < Size; i++)
+  {
+    State = (State ^ p[i]) * 0x100000001B3ULL;
+  }
+  return State;
+}
+
+static void RandomLayer(DMA2D_LayerTypeDef *pLayer, uint8_t *pBuffer, uint32_t *pClut)
+{
+  pLayer->Address       = (uint32_t)(uintptr_t)pBuffer;
+  pLayer->Offset        = Random() % (TEST_MAX_OFFSET + 1);
+  pLayer->ColorMode     = Random() % (CM_A4 + 1);
+  pLayer->AlphaMode     = Random() % (DMA2D_COMBINE_ALPHA + 1);
+  pLayer->Color         = Random();
+  pLayer->CLUTAddress   = (uint32_t)(uintptr_t)pClut;
+  pLayer->CLUTColorMode = Random() % 2;
+  pLayer->CLUTSize      = 1 + Random() % 256;
+}
+
+int main(int argc, char **argv)
+{
+  HOST_LCD_CountersTypeDef counters;
+  DMA2D_LayerTypeDef fg, bg;
+  uint32_t cases = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : TEST_CASES;
+  uint32_t n, width, height, offset, mode, errors;
+  uint64_t hash = 0xCBF29CE484222325ULL;
+
+  BSP_DMA2D_Init();
+  HOST_DMA2D_ResetCounters();
+
+  for(n = 0; n < cases; n++)
+  {
+    RandomBytes(Foreground, sizeof(Foreground));
+    RandomBytes(Background, sizeof(Background));
+    RandomBytes(Destination, sizeof(Destination));
+    RandomBytes(ForegroundCLUT, sizeof(ForegroundCLUT));
+    RandomBytes(BackgroundCLUT, sizeof(BackgroundCLUT));
+    BSP_DMA2D_InvalidateCLUT();
+
+    width  = 1 + Random() % TEST_MAX_WIDTH;
+    height = 1 + Random() % TEST_MAX_HEIGHT;
+    offset = Random() % (TEST_MAX_OFFSET + 1);
+    mode   = Random() % (DMA2D_ARGB4444 + 1);
+    RandomLayer(&fg, Foreground, ForegroundCLUT);
+    RandomLayer(&bg, Background, BackgroundCLUT);
+
+    switch(Random() % 4)
+    {
+    case 0:
+      BSP_DMA2D_Fill((uint32_t)(uintptr_t)Destination, offset, mode, width, height, Random());
+      break;
+    case 1:
+      BSP_DMA2D_Copy(fg.Address, fg.Offset, (uint32_t)(uintptr_t)Destination, offset, mode, width, height);
+      break;
+    case 2:
+      BSP_DMA2D_Convert(&fg, (uint32_t)(uintptr_t)Destination, offset, mode, width, height);
+      break;
+    default:
+      BSP_DMA2D_Blend(&fg, &bg, (uint32_t)(uintptr_t)Destination, offset, mode, width, height);
+      break;
+    }
+    BSP_DMA2D_WaitIdle();
+    hash = Hash(hash, Destination, sizeof(Destination));
+  }
+
+  errors = BSP_DMA2D_GetErrorCount();
+  HOST_DMA2D_GetCounters(&counters);
+  hash = Hash(hash, &errors, sizeof(errors));
+  hash = Hash(hash, &counters.Transfers, sizeof(counters.Transfers));
+  hash = Hash(hash, &counters.PixelsWritten, sizeof(counters.PixelsWritten));
+  hash = Hash(hash, &counters.BytesRead, sizeof(counters.BytesRead));
+  hash = Hash(hash, &counters.BytesWritten, sizeof(counters.BytesWritten));
+
+  printf("%u cases, %u errors, hash %016llx\n", (unsigned)cases, (unsigned)errors, (unsigned long long)hash);
+  return 0;
+}
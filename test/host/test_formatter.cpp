@@ -0,0 +1,216 @@
+/**
+  ******************************************************************************
+  * @file    test_formatter.cpp
+  * @brief   Host test of src/util/Formatter.cpp against snprintf.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this test:
+--------------------------
+   test/host/run.sh builds and runs it.
+   ./test_formatter [cases]                   200000 random cases by default
+
+2. Description:
+---------------------
+   - Int, Uint and Hex must give the text of "%d", "%u" and "%0*X" for the
+     limits, the powers of 10 and 2 with their neighbours and random values.
+   - Fixed must give the digits of the integer split by snprintf.
+   - Float must give the text of "%.*f" for the limits, ties, values just
+     below and above the rounding boundaries and random values, up to
+     MAX_DECIMALS. The header allows one difference: no "-0".
+   - Outputs cut by a small buffer must be a prefix of the whole text.
+
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "util/Formatter.h"
+
+#define TEST_CASES            200000
+
+static uint32_t Seed = 0x6D2B79F5;
+static uint32_t Failures = 0;
+static uint32_t Checks = 0;
+
+static uint32_t Random(void)
+{
+  Seed ^= Seed << 13;
+  Seed ^= Seed >> 17;
+  Seed ^= Seed << 5;
+  return Seed;
+}
+
+static void Expect(const char *pGot, const char *pWanted, const char *pCase)
+{
+  Checks++;
+  if (strcmp(pGot, pWanted) != 0) {
+    if (Failures++ < 20) {
+      printf("%s: got \"%s\", wanted \"%s\"\n", pCase, pGot, pWanted);
+    }
+  }
+}
+
+static void CheckInt(int32_t Value)
+{
+  char got[32], wanted[32], name[48];
+  Formatter text(got, sizeof(got));
+
+  text.Int(Value);
+  snprintf(wanted, sizeof(wanted), "%d", (int)Value);
+  snprintf(name, sizeof(name), "Int(%d)", (int)Value);
+  Expect(got, wanted, name);
+}
+
+static void CheckUint(uint32_t Value)
+{
+  char got[32], wanted[32], name[48];
+  Formatter text(got, sizeof(got));
+
+  text.Uint(Value);
+  snprintf(wanted, sizeof(wanted), "%u", (unsigned)Value);
+  snprintf(name, sizeof(name), "Uint(%u)", (unsigned)Value);
+  Expect(got, wanted, name);
+}
+
+static void CheckHex(uint32_t Value, uint8_t MinDigits)
+{
+  char got[32], wanted[32], name[48];
+  Formatter text(got, sizeof(got));
+
+  text.Hex(Value, MinDigits);
+  snprintf(wanted, sizeof(wanted), "%0*X", (int)MinDigits, (unsigned)Value);
+  snprintf(name, sizeof(name), "Hex(0x%X, %u)", (unsigned)Value, (unsigned)MinDigits);
+  Expect(got, wanted, name);
+}
+
+static void CheckFixed(int32_t Value, uint8_t Decimals)
+{
+  static const uint32_t scale[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+  char got[32], wanted[32], name[48];
+  Formatter text(got, sizeof(got));
+  uint32_t magnitude = (Value < 0) ? (0u - (uint32_t)Value) : (uint32_t)Value;
+
+  text.Fixed(Value, Decimals);
+  if (Decimals == 0) {
+    snprintf(wanted, sizeof(wanted), "%d", (int)Value);
+  } else {
+    snprintf(wanted, sizeof(wanted), "%s%u.%0*u", (Value < 0) ? "-" : "", (unsigned)(magnitude / scale[Decimals]),
+             (int)Decimals, (unsigned)(magnitude % scale[Decimals]));
+  }
+  snprintf(name, sizeof(name), "Fixed(%d, %u)", (int)Value, (unsigned)Decimals);
+  Expect(got, wanted, name);
+}
+
+static void CheckFloat(float Value, uint8_t Decimals)
+{
+  char got[48], wanted[48], name[64];
+  Formatter text(got, sizeof(got));
+
+  text.Float(Value, Decimals);
+  snprintf(wanted, sizeof(wanted), "%.*f", (int)Decimals, (double)Value);
+  snprintf(name, sizeof(name), "Float(%.9g, %u)", (double)Value, (unsigned)Decimals);
+
+  // No negative zero, whatever the decimals
+  if ((wanted[0] == '-') && (strspn(wanted + 1, "0.") == strlen(wanted + 1))) {
+    memmove(wanted, wanted + 1, strlen(wanted));
+  }
+  Expect(got, wanted, name);
+}
+
+static void CheckTruncated(void)
+{
+  char whole[64], cut[8];
+  Formatter full(whole, sizeof(whole));
+  Formatter part(cut, sizeof(cut));
+
+  full.Append("level=").Float(-12.345f, 2).Append(' ').Hex(0xBEEF, 6);
+  part.Append("level=").Float(-12.345f, 2).Append(' ').Hex(0xBEEF, 6);
+  Checks++;
+  if (!part.Overflowed() || full.Overflowed() || (part.Length() != sizeof(cut) - 1) ||
+      (strncmp(whole, cut, part.Length()) != 0) || (cut[part.Length()] != '\0')) {
+    Failures++;
+    printf("truncation: got \"%s\" of \"%s\"\n", cut, whole);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  static const float edges[] = { 0.0f, -0.0f, 0.5f, 1.5f, 2.5f, -2.5f, 0.125f, 0.375f, -0.625f, 0.05f, 0.005f,
+                                 1.005f, 9.995f, 99.995f, 0.995f, -0.004f, -0.0049f, 1e-6f, 123456.7f,
+                                 999999.5f, 16777216.0f, 4294967296.0f, 1.7e19f, 3.14159265f, -273.15f };
+  uint32_t cases = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : TEST_CASES;
+  uint32_t i, p;
+  uint8_t d;
+
+  // Limits, powers of 10 and 2 and their neighbours
+  CheckInt(INT32_MIN);
+  CheckInt(INT32_MAX);
+  CheckUint(UINT32_MAX);
+  for (p = 1; p <= 1000000000u; p *= 10) {
+    for (int32_t delta = -1; delta <= 1; delta++) {
+      CheckInt((int32_t)p + delta);
+      CheckInt(-(int32_t)p + delta);
+      CheckUint(p + delta);
+      for (d = 0; d <= Formatter::MAX_DECIMALS; d++) {
+        CheckFixed((int32_t)p + delta, d);
+        CheckFixed(-(int32_t)p + delta, d);
+      }
+    }
+    if (p == 1000000000u) {
+      break;
+    }
+  }
+  for (p = 0; p < 32; p++) {
+    CheckUint((1u << p) - 1);
+    CheckUint(1u << p);
+    CheckHex(1u << p, (uint8_t)(p % 11));
+  }
+  CheckFixed(INT32_MIN, 2);
+  CheckFixed(INT32_MAX, 9);
+  CheckHex(0, 0);
+  CheckHex(0, 1);
+  CheckHex(0xFFFFFFFF, 8);
+  CheckHex(0xABC, 10);
+
+  // Ties and rounding boundaries, and their neighbours
+  for (i = 0; i < sizeof(edges) / sizeof(edges[0]); i++) {
+    for (d = 0; d <= Formatter::MAX_DECIMALS; d++) {
+      CheckFloat(edges[i], d);
+      CheckFloat(nextafterf(edges[i], INFINITY), d);
+      CheckFloat(nextafterf(edges[i], -INFINITY), d);
+    }
+  }
+  for (uint32_t n = 0; n < 20000; n++) {
+    // k + 1/2 units of the last decimal, exact or nearest
+    d = n % 5;
+    float tie = ((float)(n / 5) + 0.5f) / powf(10.0f, d);
+    CheckFloat(tie, d);
+    CheckFloat(-tie, d);
+    CheckFloat(nextafterf(tie, INFINITY), d);
+    CheckFloat(nextafterf(tie, 0.0f), d);
+  }
+
+  // Random
+  for (i = 0; i < cases; i++) {
+    int32_t value = (int32_t)Random();
+    CheckInt(value);
+    CheckInt(value >> (Random() % 32));
+    CheckUint(Random() >> (Random() % 32));
+    CheckHex(Random() >> (Random() % 32), (uint8_t)(Random() % 12));
+    CheckFixed(value >> (Random() % 32), (uint8_t)(Random() % (Formatter::MAX_DECIMALS + 1)));
+
+    // Magnitudes from 1e-6 to 1e9
+    float f = (float)((double)(Random() % 1000000) * pow(10.0, (double)(Random() % 16) - 12.0));
+    CheckFloat((Random() & 1) ? -f : f, (uint8_t)(Random() % (Formatter::MAX_DECIMALS + 1)));
+  }
+
+  CheckTruncated();
+
+  printf("formatter: %u checks, %u failed\n", (unsigned)Checks, (unsigned)Failures);
+  return (Failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,335 @@
+/**
+  ******************************************************************************
+  * @file    test_gyro.cpp
+  * @brief   Host test of host/host_gyro.c through l3gd20.c and the GYRO_IO
+  *          functions: identification, ODR, FIFO, faults and INT1.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this test:
+--------------------------
+   test/host/run.sh builds and runs it.
+   ./test_gyro
+
+2. Description:
+---------------------
+   - WHO_AM_I must read I_AM_L3GD20, and each CTRL_REG1 DR setting must give
+     its ODR over one second of virtual time.
+   - The FIFO in stream mode, set as initializeGyro() of main.cpp does, is
+     drained every 20 ms for 10 s as readGyroFifo() does: every sample due
+     must come out once, in order, none lost.
+   - An overrun fault must fill the FIFO: FIFO_SRC reads OVRN and FSS 31,
+     the drain gets the last 32 samples and the others are counted lost.
+   - A stall must produce no sample for its duration, a bus fault must read
+     0xFF and lose writes; both end on time.
+   - INT1 must follow the X threshold, with and without latching, and wait
+     for the samples of INT1_DURATION.
+
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "host_gyro.h"
+
+#define NS_PER_MS             1000000ULL
+#define NS_PER_S              1000000000ULL
+
+// As initializeGyro() of main.cpp: 190 Hz, 2000 dps, FIFO in stream mode
+#define CTRL_REG1_VAL         0x6F
+#define CTRL_REG4_VAL         0x20
+#define CTRL_REG5_VAL         0x40
+#define FIFO_CTRL_REG_VAL     0x40
+#define FIFO_SRC_OVRN         0x40
+#define FIFO_SRC_FSS          0x1F
+#define GYRO_FIFO_SIZE        32
+#define GYRO_RATE_HZ          190
+
+#define INT1_CFG_XHIE         0x02
+#define INT1_CFG_LIR          0x40
+#define INT1_SRC_IA           0x40
+#define INT1_SRC_XH           0x02
+
+static uint32_t Failures = 0;
+static uint32_t Checks = 0;
+
+static uint64_t Now = 0;
+static uint32_t Produced = 0;     // Counter source: sample n reads n on each axis
+static float Level = 0;           // Level source, LSB
+static uint32_t Int1Edges = 0;
+
+static void Expect(bool Ok, const char *pCase, uint32_t Value)
+{
+  Checks++;
+  if (!Ok && (Failures++ < 20)) {
+    printf("%s: failed at %u\n", pCase, Value);
+  }
+}
+
+static uint64_t Clock(void)
+{
+  return Now;
+}
+
+static uint8_t CounterSource(void *pContext, uint64_t Time, float *pDps)
+{
+  (void)pContext;
+  (void)Time;
+  Produced++;
+  for (uint32_t i = 0; i < 3; i++) {
+    pDps[i] = Produced * (L3GD20_SENSITIVITY_2000DPS / 1000.0f);
+  }
+  return 1;
+}
+
+static uint8_t LevelSource(void *pContext, uint64_t Time, float *pDps)
+{
+  (void)pContext;
+  (void)Time;
+  for (uint32_t i = 0; i < 3; i++) {
+    pDps[i] = Level * (L3GD20_SENSITIVITY_2000DPS / 1000.0f);
+  }
+  return 1;
+}
+
+extern "C" void HOST_GYRO_PinCallback(uint8_t IntPin, uint8_t State)
+{
+  if ((IntPin == L3GD20_INT1) && State) {
+    Int1Edges++;
+  }
+}
+
+static uint8_t ReadRegister(uint8_t Address)
+{
+  uint8_t value;
+
+  GYRO_IO_Read(&value, Address, 1);
+  return value;
+}
+
+static void WriteRegister(uint8_t Address, uint8_t Value)
+{
+  GYRO_IO_Write(&Value, Address, 1);
+}
+
+static void Start(HOST_GYRO_SourceTypeDef pSource)
+{
+  Now = 0;
+  Produced = 0;
+  HOST_GYRO_SetSource(pSource, NULL);
+  HOST_GYRO_SetClock(Clock);
+  HOST_GYRO_Reset();
+  L3GD20_Init((CTRL_REG4_VAL << 8) | CTRL_REG1_VAL);
+  WriteRegister(L3GD20_CTRL_REG5_ADDR, CTRL_REG5_VAL);
+  WriteRegister(L3GD20_FIFO_CTRL_REG_ADDR, FIFO_CTRL_REG_VAL);
+}
+
+// As readGyroFifo() of main.cpp, X of each sample in pX
+static uint32_t ReadFifo(int16_t *pX)
+{
+  uint8_t source = ReadRegister(L3GD20_FIFO_SRC_REG_ADDR);
+  uint32_t count = (source & FIFO_SRC_OVRN) ? GYRO_FIFO_SIZE : (source & FIFO_SRC_FSS);
+  uint8_t data[GYRO_FIFO_SIZE * 6];
+
+  if (count == 0) {
+    return 0;
+  }
+  GYRO_IO_Read(data, L3GD20_OUT_X_L_ADDR, count * 6);
+  for (uint32_t i = 0; i < count; i++) {
+    pX[i] = (int16_t)(((uint16_t)data[6 * i + 1] << 8) | data[6 * i]);
+  }
+  return count;
+}
+
+//=================================================================================================================
+// Checks
+//=================================================================================================================
+
+static void Identification(void)
+{
+  static const uint8_t rates[4] = { L3GD20_OUTPUT_DATARATE_1, L3GD20_OUTPUT_DATARATE_2, L3GD20_OUTPUT_DATARATE_3,
+                                    L3GD20_OUTPUT_DATARATE_4 };
+  static const uint32_t hz[4] = { 95, 190, 380, 760 };
+  HOST_GYRO_StatsTypeDef stats;
+
+  Start(NULL);
+  Expect(L3GD20_ReadID() == I_AM_L3GD20, "WHO_AM_I", 0);
+
+  for (uint32_t i = 0; i < 4; i++) {
+    Now = 0;
+    HOST_GYRO_Reset();
+    L3GD20_Init(rates[i] | L3GD20_MODE_ACTIVE | L3GD20_AXES_ENABLE);
+    Expect(ReadRegister(L3GD20_CTRL_REG1_ADDR) == (rates[i] | L3GD20_MODE_ACTIVE | L3GD20_AXES_ENABLE), "CTRL_REG1",
+           i);
+    Now = NS_PER_S;
+    HOST_GYRO_GetStats(&stats);
+    Expect(stats.Samples == hz[i], "ODR", hz[i]);
+  }
+
+  // Powered down: no sample
+  WriteRegister(L3GD20_CTRL_REG1_ADDR, L3GD20_AXES_ENABLE);
+  HOST_GYRO_ResetStats();
+  Now += NS_PER_S;
+  HOST_GYRO_GetStats(&stats);
+  Expect(stats.Samples == 0, "power down", stats.Samples);
+}
+
+static void StreamDrain(void)
+{
+  int16_t x[GYRO_FIFO_SIZE];
+  HOST_GYRO_StatsTypeDef stats;
+  uint32_t drained = 0, count, i, period;
+
+  Start(CounterSource);
+  for (period = 1; period <= 500; period++) {
+    Now = period * 20 * NS_PER_MS;
+    count = ReadFifo(x);
+    Expect(count <= 4, "stream, samples per 20 ms", count);
+    for (i = 0; i < count; i++) {
+      Expect(x[i] == (int16_t)(drained + i + 1), "stream, order", drained + i);
+    }
+    drained += count;
+  }
+  HOST_GYRO_GetStats(&stats);
+  Expect(drained == 10 * GYRO_RATE_HZ, "stream, samples in 10 s", drained);
+  Expect(stats.Samples == drained, "stream, samples produced", stats.Samples);
+  Expect(stats.Lost == 0, "stream, samples lost", stats.Lost);
+  Expect(ReadFifo(x) == 0, "stream, empty", 0);
+}
+
+static void Overrun(void)
+{
+  int16_t x[GYRO_FIFO_SIZE];
+  HOST_GYRO_StatsTypeDef before, after;
+  uint8_t source;
+  uint32_t count;
+
+  Start(CounterSource);
+  Now = 20 * NS_PER_MS;
+  ReadFifo(x);
+  HOST_GYRO_GetStats(&before);
+  HOST_GYRO_InjectFault(HOST_GYRO_FAULT_OVERRUN, 300 * NS_PER_MS);
+  HOST_GYRO_GetStats(&after);
+
+  source = ReadRegister(L3GD20_FIFO_SRC_REG_ADDR);
+  Expect((source & FIFO_SRC_OVRN) != 0, "overrun, OVRN", source);
+  Expect((source & FIFO_SRC_FSS) == 31, "overrun, FSS", source);
+  count = ReadFifo(x);
+  Expect(count == GYRO_FIFO_SIZE, "overrun, samples", count);
+  Expect(after.Samples - before.Samples == 300 * GYRO_RATE_HZ / 1000, "overrun, samples produced",
+         after.Samples - before.Samples);
+  Expect(after.Lost - before.Lost == after.Samples - before.Samples - GYRO_FIFO_SIZE, "overrun, lost",
+         after.Lost - before.Lost);
+  // The newest 32, in order
+  Expect(x[GYRO_FIFO_SIZE - 1] == (int16_t)Produced, "overrun, last", x[GYRO_FIFO_SIZE - 1]);
+  for (uint32_t i = 1; i < count; i++) {
+    Expect(x[i] == x[i - 1] + 1, "overrun, order", i);
+  }
+
+  // Nothing more until the end of the burst
+  Now = 300 * NS_PER_MS;
+  Expect(ReadFifo(x) == 0, "overrun, burst end", 0);
+  Now = 330 * NS_PER_MS;
+  Expect(ReadFifo(x) > 0, "overrun, after", 0);
+}
+
+static void Faults(void)
+{
+  int16_t x[GYRO_FIFO_SIZE];
+  HOST_GYRO_StatsTypeDef before, after;
+  uint8_t value = 0;
+
+  // Stall: no sample for 1 s, then samples again
+  Start(CounterSource);
+  Now = 20 * NS_PER_MS;
+  ReadFifo(x);
+  HOST_GYRO_GetStats(&before);
+  HOST_GYRO_InjectFault(HOST_GYRO_FAULT_STALL, NS_PER_S);
+  for (Now = 40 * NS_PER_MS; Now <= 1000 * NS_PER_MS; Now += 20 * NS_PER_MS) {
+    Expect(ReadFifo(x) == 0, "stall, samples", (uint32_t)(Now / NS_PER_MS));
+  }
+  HOST_GYRO_GetStats(&after);
+  Expect(after.Stalled - before.Stalled == after.Samples - before.Samples, "stall, stalled", after.Stalled);
+  Expect(after.Stalled - before.Stalled >= GYRO_RATE_HZ - 5, "stall, duration", after.Stalled);
+  Now = 1100 * NS_PER_MS;
+  Expect(ReadFifo(x) > 0, "stall, end", 0);
+
+  // Bus fault: reads 0xFF, writes lost, for 100 ms
+  HOST_GYRO_GetStats(&before);
+  HOST_GYRO_InjectFault(HOST_GYRO_FAULT_BUS, 100 * NS_PER_MS);
+  Expect(ReadRegister(L3GD20_WHO_AM_I_ADDR) == 0xFF, "bus, WHO_AM_I", 0);
+  WriteRegister(L3GD20_CTRL_REG3_ADDR, L3GD20_INT1INTERRUPT_ENABLE);
+  GYRO_IO_Read(&value, L3GD20_CTRL_REG3_ADDR, 1);
+  Expect(value == 0xFF, "bus, read", value);
+  HOST_GYRO_GetStats(&after);
+  Expect(after.BusErrors - before.BusErrors == 3, "bus, errors", after.BusErrors - before.BusErrors);
+  Now += 100 * NS_PER_MS;
+  Expect(ReadRegister(L3GD20_WHO_AM_I_ADDR) == I_AM_L3GD20, "bus, end", 0);
+  Expect(ReadRegister(L3GD20_CTRL_REG3_ADDR) == 0, "bus, write lost", 0);
+}
+
+// Moves the time on by Samples periods at Value LSB
+static void Hold(float Value, uint32_t Samples)
+{
+  Level = Value;
+  Now += (uint64_t)Samples * NS_PER_S / GYRO_RATE_HZ + 1;
+  HOST_GYRO_GetTime();
+}
+
+static void Int1(void)
+{
+  HOST_GYRO_StatsTypeDef stats;
+  uint8_t source;
+
+  // X above 1000 LSB, latched
+  Start(LevelSource);
+  Int1Edges = 0;
+  WriteRegister(L3GD20_INT1_TSH_XH_ADDR, 1000 >> 8);
+  WriteRegister(L3GD20_INT1_TSH_XL_ADDR, 1000 & 0xFF);
+  WriteRegister(L3GD20_INT1_CFG_ADDR, INT1_CFG_LIR | INT1_CFG_XHIE);
+  L3GD20_EnableIT(L3GD20_INT1);
+
+  Hold(500, 10);
+  Expect(HOST_GYRO_GetPin(L3GD20_INT1) == 0, "INT1 below", 0);
+  Hold(1500, 1);
+  Expect(HOST_GYRO_GetPin(L3GD20_INT1) == 1, "INT1 above", 0);
+  Hold(500, 10);
+  Expect(HOST_GYRO_GetPin(L3GD20_INT1) == 1, "INT1 latched", 0);
+  source = ReadRegister(L3GD20_INT1_SRC_ADDR);
+  Expect(source == (INT1_SRC_IA | INT1_SRC_XH), "INT1_SRC latched", source);
+  Expect(HOST_GYRO_GetPin(L3GD20_INT1) == 0, "INT1 released by INT1_SRC", 0);
+  Expect((ReadRegister(L3GD20_INT1_SRC_ADDR) & INT1_SRC_IA) == 0, "INT1_SRC cleared", 0);
+
+  // Not latched: follows the signal
+  WriteRegister(L3GD20_INT1_CFG_ADDR, INT1_CFG_XHIE);
+  Hold(1500, 1);
+  Expect(HOST_GYRO_GetPin(L3GD20_INT1) == 1, "INT1 unlatched above", 0);
+  Hold(500, 1);
+  Expect(HOST_GYRO_GetPin(L3GD20_INT1) == 0, "INT1 unlatched below", 0);
+
+  // Duration: 3 samples above before the event
+  WriteRegister(L3GD20_INT1_DURATION_ADDR, 3);
+  Hold(1500, 2);
+  Expect(HOST_GYRO_GetPin(L3GD20_INT1) == 0, "INT1 duration, 2 samples", 0);
+  Hold(1500, 1);
+  Expect(HOST_GYRO_GetPin(L3GD20_INT1) == 1, "INT1 duration, 3 samples", 0);
+  Hold(500, 1);
+
+  HOST_GYRO_GetStats(&stats);
+  Expect(stats.Int1Events == 3, "INT1 events", stats.Int1Events);
+  Expect(Int1Edges == 3, "INT1 pin edges", Int1Edges);
+}
+
+int main(void)
+{
+  Identification();
+  StreamDrain();
+  Overrun();
+  Faults();
+  Int1();
+
+  printf("gyro model: %u checks, %u failed\n", Checks, Failures);
+  return (Failures == 0) ? 0 : 1;
+}
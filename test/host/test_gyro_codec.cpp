@@ -0,0 +1,247 @@
+/**
+  ******************************************************************************
+  * @file    test_gyro_codec.cpp
+  * @brief   Host test of src/util/GyroCodec.cpp: round trips, truncated and
+  *          damaged blocks, and the compression of typical signals.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this test:
+--------------------------
+   test/host/run.sh builds and runs it.
+   ./test_gyro_codec
+
+2. Description:
+---------------------
+   - Signals at rest, with a tremor, with hand motion, at full scale, random
+     over the whole int16_t range and constant are coded in blocks of 1, 2,
+     3, 255, 512 and MAX_SAMPLES samples, Flush() ending the last one. Each
+     block must decode to its samples, and so must the stream through
+     Index() and Seek().
+   - Every truncation of a block must decode to 0 samples, and so must a
+     block longer than MaxCount or with a damaged header. Index() must stop
+     at a truncated last block.
+   - The bytes per sample of each signal are printed, in blocks of 512
+     samples as the telemetry sends them.
+
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "util/GyroCodec.h"
+
+#define SIGNAL_SAMPLES        20000
+#define RATE_HZ               190.0
+#define MAX_BLOCKS            (SIGNAL_SAMPLES + 1)
+
+static uint32_t Seed = 0x2545F491;
+static uint32_t Failures = 0;
+static uint32_t Checks = 0;
+
+static uint8_t Stream[SIGNAL_SAMPLES * 6 * 5];
+static int16_t Decoded[GyroCodec::MAX_SAMPLES * 3];
+static GyroCodec::IndexEntry Blocks[MAX_BLOCKS];
+
+static uint32_t Random(void)
+{
+  Seed ^= Seed << 13;
+  Seed ^= Seed >> 17;
+  Seed ^= Seed << 5;
+  return Seed;
+}
+
+// Normal, Box-Muller
+static double Gaussian(double Sigma)
+{
+  double u = (Random() + 1.0) / 4294967297.0, v = Random() / 4294967296.0;
+
+  return Sigma * sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * v);
+}
+
+static int16_t Clamp(double Value)
+{
+  return (int16_t)((Value > 32767.0) ? 32767 : ((Value < -32768.0) ? -32768 : lround(Value)));
+}
+
+static void Expect(bool Ok, const char *pCase, uint32_t Value)
+{
+  Checks++;
+  if (!Ok && (Failures++ < 20)) {
+    printf("%s: failed at %u\n", pCase, Value);
+  }
+}
+
+//=================================================================================================================
+// Signals, X, Y, Z triples
+//=================================================================================================================
+
+static const char *const SIGNALS[] = { "rest", "tremor", "motion", "full scale", "random", "constant" };
+
+static void MakeSignal(uint32_t Signal, int16_t *pSamples, uint32_t Count)
+{
+  double phase = 0, walk[3] = { 0, 0, 0 }, value;
+  uint32_t n, i;
+
+  for (n = 0; n < Count; n++) {
+    phase += 2.0 * M_PI * (5.0 + 0.5 * sin(n / 400.0)) / RATE_HZ;
+    for (i = 0; i < 3; i++) {
+      switch (Signal) {
+      case 0:
+        // Sensor noise and zero rate offset
+        value = 12.0 * i - 20.0 + Gaussian(2.5);
+        break;
+      case 1:
+        // 5 Hz tremor of a few dps at 70 mdps/LSB
+        value = 60.0 * (i + 1) * sin(phase + i) + Gaussian(2.5);
+        break;
+      case 2:
+        // Voluntary movement: filtered random walk, hundreds of dps
+        walk[i] = 0.98 * walk[i] + Gaussian(400.0);
+        value = walk[i] + Gaussian(2.5);
+        break;
+      case 3:
+        // Fast sweeps clipping at full scale
+        value = 40000.0 * sin(phase * 0.5 + i);
+        break;
+      case 4:
+        value = (int16_t)Random();
+        break;
+      default:
+        value = -1234.0;
+        break;
+      }
+      pSamples[3 * n + i] = (Signal == 4) ? (int16_t)value : Clamp(value);
+    }
+  }
+}
+
+//=================================================================================================================
+// Checks
+//=================================================================================================================
+
+// Codes the signal, checks each block and the stream; returns the bytes
+static uint32_t RoundTrip(const int16_t *pSamples, uint32_t Count, uint32_t BlockSamples, const char *pName)
+{
+  static uint8_t block[GyroCodec::MaxBlockSize(GyroCodec::MAX_SAMPLES)];
+  GyroEncoder encoder(block, sizeof(block), BlockSamples);
+  char name[64];
+  uint32_t length = 0, first = 0, n, entries, entry, i;
+  bool closed;
+
+  snprintf(name, sizeof(name), "%s, blocks of %u", pName, BlockSamples);
+  for (n = 0; n < Count; n++) {
+    closed = encoder.Push(&pSamples[3 * n]);
+    if (!closed && (n + 1 == Count)) {
+      closed = encoder.Flush();
+    }
+    if (!closed) {
+      continue;
+    }
+    Expect(encoder.Length() <= GyroCodec::MaxBlockSize(n + 1 - first), name, n);
+    Expect(GyroDecoder::Decode(encoder.Data(), encoder.Length(), Decoded, GyroCodec::MAX_SAMPLES) == n + 1 - first,
+           name, n);
+    Expect(memcmp(Decoded, &pSamples[3 * first], (n + 1 - first) * 6) == 0, name, n);
+    memcpy(Stream + length, encoder.Data(), encoder.Length());
+    length += encoder.Length();
+    first = n + 1;
+  }
+  Expect(!encoder.Flush(), name, Count);
+
+  // Random access through the index
+  entries = GyroCodec::Index(Stream, length, Blocks, MAX_BLOCKS);
+  Expect(entries == (Count + BlockSamples - 1) / BlockSamples, name, entries);
+  for (i = 0; i < 50; i++) {
+    n = (i == 0) ? 0 : ((i == 1) ? Count - 1 : Random() % Count);
+    entry = GyroCodec::Seek(Blocks, entries, n);
+    if (entry >= entries) {
+      Expect(false, name, n);
+      continue;
+    }
+    GyroDecoder::Decode(Stream + Blocks[entry].Offset, length - Blocks[entry].Offset, Decoded,
+                        GyroCodec::MAX_SAMPLES);
+    Expect(memcmp(&Decoded[3 * (n - Blocks[entry].Sample)], &pSamples[3 * n], 6) == 0, name, n);
+  }
+  return length;
+}
+
+// Every truncation of one block, then damaged headers
+static void Truncations(const int16_t *pSamples, uint32_t Count, const char *pName)
+{
+  static uint8_t block[GyroCodec::MaxBlockSize(512)];
+  GyroEncoder encoder(block, sizeof(block), Count);
+  char name[64];
+  uint32_t length, entries, cut;
+  uint16_t saved;
+
+  for (uint32_t n = 0; n < Count; n++) {
+    encoder.Push(&pSamples[3 * n]);
+  }
+  encoder.Flush();
+  length = encoder.Length();
+
+  snprintf(name, sizeof(name), "%s, truncated", pName);
+  for (cut = 0; cut < length; cut++) {
+    Expect(GyroDecoder::Decode(block, cut, Decoded, GyroCodec::MAX_SAMPLES) == 0, name, cut);
+  }
+  snprintf(name, sizeof(name), "%s, too many samples", pName);
+  Expect(GyroDecoder::Decode(block, length, Decoded, Count - 1) == 0, name, Count);
+
+  // The length field says less than the data: the bits run out
+  snprintf(name, sizeof(name), "%s, short length field", pName);
+  saved = (uint16_t)(block[0] | (block[1] << 8));
+  if (saved > GyroCodec::HEADER_SIZE + 1) {
+    block[0] = (uint8_t)(saved - 2);
+    block[1] = (uint8_t)((saved - 2) >> 8);
+    Expect(GyroDecoder::Decode(block, length, Decoded, GyroCodec::MAX_SAMPLES) == 0, name, saved);
+  }
+  block[0] = 0;
+  block[1] = 0;
+  Expect(GyroDecoder::Decode(block, length, Decoded, GyroCodec::MAX_SAMPLES) == 0, name, 0);
+  block[0] = (uint8_t)saved;
+  block[1] = (uint8_t)(saved >> 8);
+
+  snprintf(name, sizeof(name), "%s, no samples", pName);
+  block[2] = 0;
+  block[3] = 0;
+  Expect(GyroDecoder::Decode(block, length, Decoded, GyroCodec::MAX_SAMPLES) == 0, name, 0);
+  block[2] = (uint8_t)Count;
+  block[3] = (uint8_t)(Count >> 8);
+
+  // A stream cut in its second block indexes the first only
+  snprintf(name, sizeof(name), "%s, truncated stream", pName);
+  memcpy(Stream, block, length);
+  memcpy(Stream + length, block, length);
+  for (cut = length; cut < 2 * length; cut++) {
+    entries = GyroCodec::Index(Stream, cut, Blocks, MAX_BLOCKS);
+    Expect(entries == 1, name, cut);
+  }
+  Expect(GyroCodec::Index(Stream, 2 * length, Blocks, MAX_BLOCKS) == 2, name, 2 * length);
+}
+
+int main(void)
+{
+  static int16_t samples[SIGNAL_SAMPLES * 3];
+  static const uint32_t sizes[] = { 1, 2, 3, 255, 512, GyroCodec::MAX_SAMPLES };
+  uint32_t signal, size, length;
+
+  for (signal = 0; signal < sizeof(SIGNALS) / sizeof(SIGNALS[0]); signal++) {
+    MakeSignal(signal, samples, SIGNAL_SAMPLES);
+    for (size = 0; size < sizeof(sizes) / sizeof(sizes[0]); size++) {
+      length = RoundTrip(samples, SIGNAL_SAMPLES, sizes[size], SIGNALS[signal]);
+      if (sizes[size] == 512) {
+        printf("gyro codec %-10s %.2f bytes/sample, %.2f times smaller\n", SIGNALS[signal],
+               (double)length / SIGNAL_SAMPLES, 6.0 * SIGNAL_SAMPLES / length);
+      }
+    }
+    Truncations(samples, 512, SIGNALS[signal]);
+    Truncations(samples, 2, SIGNALS[signal]);
+  }
+
+  printf("gyro codec: %u checks, %u failed\n", Checks, Failures);
+  return (Failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,180 @@
+/**
+  ******************************************************************************
+  * @file    test_screens.cpp
+  * @brief   Host test of the screens of main.cpp: renders them with the LCD
+  *          drivers and the host backend, compares the panel with golden
+  *          images and reports what each frame cost.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this test:
+--------------------------
+   test/host/run.sh builds and runs it from the repository root.
+   ./test_screens test/host/golden            compares, 0 if all match
+   ./test_screens -u test/host/golden         writes the golden images
+
+2. Description:
+---------------------
+   - The widgets are laid out as in main.cpp: chrome on the background
+     layer composed in SRAM tiles, values and traces on the color keyed
+     foreground layer.
+   - Each step renders one state of the screen: starting, then no, mild and
+     severe tremor with the traces moving on. The traces are triangles, so
+     that the pixels do not depend on the host libm.
+   - A step fails when a pixel differs from its golden image. The DMA2D
+     transfers, pixels and bytes moved and the SDRAM bytes changed are
+     printed for each step, to compare drawing strategies.
+
+------------------------------------------------------------------------------*/
+
+#include "mbed.h"
+#include "LCD_DISCO_F429ZI.h"
+#include "host_lcd.h"
+#include "ui/Compositor.h"
+#include "util/TremorDetector.h"
+
+LCD_DISCO_F429ZI lcd;
+
+Compositor screens(LCD_COLOR_WHITE);
+Label title(0, 24, 240, "Tremor Level", CENTER_MODE);
+Panel levelTrack(20, 96, 200, 12);
+Label axisName[3] = { Label(4, 152, 11, "X"), Label(4, 208, 11, "Y"), Label(4, 264, 11, "Z") };
+Panel axisTrack[3] = { Panel(20, 136, 216, 48), Panel(20, 192, 216, 48), Panel(20, 248, 216, 48) };
+
+Value level(0, 60, 240, 2, CENTER_MODE);
+Bar levelBar(20, 96, 200, 12, 0, 500);
+Plot axisPlot[3] = { Plot(20, 136, 216, 48, -8192, 8191), Plot(20, 192, 216, 48, -8192, 8191),
+                     Plot(20, 248, 216, 48, -8192, 8191) };
+const uint32_t axisColor[3] = { LCD_COLOR_RED, LCD_COLOR_DARKGREEN, LCD_COLOR_BLUE };
+
+static uint32_t sampleCount = 0;
+
+static void Layout(void)
+{
+  title.SetText("Initializing...");
+  screens.Chrome().SetTiled(true);
+  screens.Chrome().Add(title);
+  screens.Chrome().Add(levelTrack);
+  levelTrack.SetColors(LCD_COLOR_LIGHTGRAY, LCD_COLOR_LIGHTGRAY);
+  screens.Overlay().Add(level);
+  screens.Overlay().Add(levelBar);
+  levelBar.SetColors(LCD_COLOR_DARKGRAY, screens.GetTransparentColor());
+  for (int i = 0; i < 3; i++) {
+    screens.Chrome().Add(axisName[i]);
+    screens.Chrome().Add(axisTrack[i]);
+    axisTrack[i].SetColors(LCD_COLOR_LIGHTGRAY, LCD_COLOR_LIGHTGRAY);
+    screens.Overlay().Add(axisPlot[i]);
+    axisPlot[i].SetColors(axisColor[i], screens.GetTransparentColor());
+  }
+}
+
+static void SetScreenColors(uint32_t ForeColor, uint32_t BackColor)
+{
+  screens.Chrome().SetColors(ForeColor, BackColor);
+  title.SetColors(ForeColor, BackColor);
+  for (int i = 0; i < 3; i++) {
+    axisName[i].SetColors(ForeColor, BackColor);
+  }
+  level.SetColors(ForeColor, screens.GetTransparentColor());
+}
+
+// Same as displayTremorLevel() of main.cpp
+static void ShowLevel(float Level)
+{
+  uint8_t severity = TremorDetector::Severity(Level);
+
+  if (severity == TremorDetector::MILD) {
+    SetScreenColors(LCD_COLOR_WHITE, LCD_COLOR_GREEN);
+    level.SetAffixes("Mild Tremor: ", "");
+  } else if (severity == TremorDetector::SEVERE) {
+    SetScreenColors(LCD_COLOR_WHITE, LCD_COLOR_RED);
+    level.SetAffixes("Severe Tremor: ", "");
+  } else {
+    SetScreenColors(LCD_COLOR_BLACK, LCD_COLOR_WHITE);
+    level.SetAffixes("No Tremor: ", "");
+  }
+  int32_t centi = TremorDetector::Hundredths(Level);
+  level.SetValue(centi);
+  levelBar.SetValue(centi);
+}
+
+// Triangle of the amplitude and period given, one phase per axis
+static void PushSamples(uint32_t Count, int32_t Amplitude, uint32_t Period)
+{
+  for (uint32_t n = 0; n < Count; n++, sampleCount++) {
+    for (int i = 0; i < 3; i++) {
+      uint32_t phase = (sampleCount + i * Period / 3) % Period;
+      int32_t ramp = (int32_t)((phase < Period / 2) ? phase : Period - phase);
+      axisPlot[i].Push(Amplitude * (4 * ramp - (int32_t)Period) / (int32_t)Period);
+    }
+  }
+}
+
+static int Check(const char *pDir, const char *pStep, const char *pImage, bool Update)
+{
+  HOST_LCD_CountersTypeDef cost;
+  char path[256];
+  int32_t diff;
+
+  HOST_LCD_EndMeasure(&cost);
+  snprintf(path, sizeof(path), "%s/screens_%s.ppm", pDir, pImage);
+  if (Update) {
+    diff = HOST_LCD_WriteFramePPM(path) ? -1 : 0;
+  } else {
+    diff = HOST_LCD_CompareFramePPM(path);
+  }
+  printf("%-8s %5u transfers %8llu pixels %8llu B read %8llu B written %7llu B changed %8llu ns  %s\n",
+         pStep, (unsigned)cost.Transfers, (unsigned long long)cost.PixelsWritten,
+         (unsigned long long)cost.BytesRead, (unsigned long long)cost.BytesWritten,
+         (unsigned long long)cost.BytesChanged, (unsigned long long)cost.Nanoseconds,
+         (diff == 0) ? "ok" : "FAILED");
+  if (diff > 0) {
+    printf("         %d pixels differ from %s\n", (int)diff, path);
+  } else if (diff < 0) {
+    printf("         cannot %s %s\n", Update ? "write" : "read", path);
+  }
+  HOST_LCD_BeginMeasure();
+  return (diff == 0) ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+  bool update = (argc == 3) && (strcmp(argv[1], "-u") == 0);
+  const char *dir;
+  int failed = 0;
+
+  if ((argc != 2) && !update) {
+    fprintf(stderr, "usage: %s [-u] golden_directory\n", argv[0]);
+    return 2;
+  }
+  dir = argv[argc - 1];
+
+  HOST_LCD_BeginMeasure();
+  Layout();
+  screens.Render();
+  failed += Check(dir, "starting", "starting", update);
+
+  title.SetText("Tremor Level");
+  PushSamples(60, 1200, 40);
+  ShowLevel(0.42f);
+  screens.Render();
+  failed += Check(dir, "none", "none", update);
+
+  PushSamples(90, 4000, 36);
+  ShowLevel(1.85f);
+  screens.Render();
+  failed += Check(dir, "mild", "mild", update);
+
+  PushSamples(120, 8000, 30);
+  ShowLevel(4.3f);
+  screens.Render();
+  failed += Check(dir, "severe", "severe", update);
+
+  // Same state again: nothing to draw
+  screens.Render();
+  failed += Check(dir, "static", "severe", update);
+
+  return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,330 @@
+#include "Capture.h"
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static_assert(sizeof(CaptureHeader) == 80, "CaptureHeader layout");
+static_assert(sizeof(CaptureBlock) == 24, "CaptureBlock layout");
+static_assert(sizeof(CaptureIndexEntry) == 16, "CaptureIndexEntry layout");
+
+// Bytes of a block and its samples, padded
+static uint64_t BlockSize(uint32_t Count)
+{
+  return (sizeof(CaptureBlock) + 3 * sizeof(int16_t) * (uint64_t)Count + 7) & ~7ULL;
+}
+
+//=================================================================================================================
+// CaptureWriter
+//=================================================================================================================
+
+// Constructor
+CaptureWriter::CaptureWriter() : _file(NULL), _first(0), _time(0), _offset(0)
+{
+}
+
+CaptureWriter::~CaptureWriter()
+{
+  Close();
+}
+
+bool CaptureWriter::Open(const char *pPath, const CaptureHeader &Info)
+{
+  Close();
+  _file = fopen(pPath, "wb");
+  if (_file == NULL) {
+    return false;
+  }
+  _header = Info;
+  memcpy(_header.Magic, CAPTURE_MAGIC, sizeof(_header.Magic));
+  _header.HeaderSize = sizeof(CaptureHeader);
+  _header.Blocks = 0;
+  _header.Levels = 0;
+  _header.IndexOffset = 0;
+  _header.LevelsOffset = 0;
+  if (_header.BlockSamples == 0) {
+    _header.BlockSamples = 4096;
+  }
+  _offset = sizeof(CaptureHeader);
+  _index.clear();
+  _levels.clear();
+  for (uint32_t i = 0; i < 3; i++) {
+    _columns[i].clear();
+  }
+  return (fwrite(&_header, sizeof(_header), 1, _file) == 1);
+}
+
+void CaptureWriter::Append(uint32_t First, const int16_t *pSamples, uint32_t Count, int64_t Time)
+{
+  uint32_t i, j;
+
+  if (_file == NULL) {
+    return;
+  }
+  if (!_columns[0].empty() && (First != _first + _columns[0].size())) {
+    Flush();
+  }
+  for (i = 0; i < Count; i++) {
+    if (_columns[0].empty()) {
+      _first = First + i;
+      _time = Time;
+    }
+    for (j = 0; j < 3; j++) {
+      _columns[j].push_back(pSamples[3 * i + j]);
+    }
+    if (_columns[0].size() == _header.BlockSamples) {
+      Flush();
+    }
+  }
+}
+
+void CaptureWriter::AddLevel(const CaptureLevel &level)
+{
+  _levels.push_back(level);
+}
+
+bool CaptureWriter::Close(void)
+{
+  static const uint8_t zeros[8] = { 0 };
+  bool ok;
+  uint32_t i;
+
+  if (_file == NULL) {
+    return false;
+  }
+  Flush();
+
+  _header.IndexOffset = _offset;
+  fwrite(_index.data(), sizeof(CaptureIndexEntry), _index.size(), _file);
+  _header.LevelsOffset = _header.IndexOffset + _index.size() * sizeof(CaptureIndexEntry);
+  _header.Levels = _levels.size();
+  for (i = 0; i < _levels.size(); i++) {
+    fwrite(&_levels[i].Time, sizeof(uint32_t), 1, _file);
+  }
+  for (i = 0; i < _levels.size(); i++) {
+    fwrite(&_levels[i].Sample, sizeof(uint32_t), 1, _file);
+  }
+  for (i = 0; i < _levels.size(); i++) {
+    fwrite(&_levels[i].Board, sizeof(int32_t), 1, _file);
+  }
+  for (i = 0; i < _levels.size(); i++) {
+    fwrite(&_levels[i].Host, sizeof(int32_t), 1, _file);
+  }
+  fwrite(zeros, 1, (8 - (_levels.size() * 16) % 8) % 8, _file);
+
+  // The header last: a capture cut short keeps IndexOffset 0
+  fseek(_file, 0, SEEK_SET);
+  fwrite(&_header, sizeof(_header), 1, _file);
+  ok = (ferror(_file) == 0);
+  ok = (fclose(_file) == 0) && ok;
+  _file = NULL;
+  return ok;
+}
+
+bool CaptureWriter::IsOpen(void) const
+{
+  return (_file != NULL);
+}
+
+void CaptureWriter::Flush(void)
+{
+  static const uint8_t zeros[8] = { 0 };
+  CaptureBlock block;
+  CaptureIndexEntry entry;
+  uint32_t count = _columns[0].size();
+  uint64_t size = BlockSize(count);
+
+  if (count == 0) {
+    return;
+  }
+  block.Magic = CAPTURE_BLOCK_MAGIC;
+  block.First = _first;
+  block.Count = count;
+  block.Reserved = 0;
+  block.Time = _time;
+  fwrite(&block, sizeof(block), 1, _file);
+  for (uint32_t i = 0; i < 3; i++) {
+    fwrite(_columns[i].data(), sizeof(int16_t), count, _file);
+    _columns[i].clear();
+  }
+  fwrite(zeros, 1, size - sizeof(block) - 3 * sizeof(int16_t) * count, _file);
+
+  entry.First = _first;
+  entry.Count = count;
+  entry.Offset = _offset;
+  _index.push_back(entry);
+  _header.Blocks++;
+  _offset += size;
+}
+
+//=================================================================================================================
+// CaptureReader
+//=================================================================================================================
+
+// Constructor
+CaptureReader::CaptureReader() : _data(NULL), _size(0)
+{
+}
+
+CaptureReader::~CaptureReader()
+{
+  Close();
+}
+
+bool CaptureReader::Open(const char *pPath)
+{
+  struct stat info;
+  void *data;
+  int fd;
+
+  Close();
+  fd = open(pPath, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  if ((fstat(fd, &info) != 0) || ((uint64_t)info.st_size < sizeof(CaptureHeader))) {
+    close(fd);
+    return false;
+  }
+  data = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+  _data = (const uint8_t *)data;
+  _size = info.st_size;
+  // Read in order, ahead of the replay
+  madvise(data, _size, MADV_SEQUENTIAL);
+
+  memcpy(&_header, _data, sizeof(_header));
+  if ((memcmp(_header.Magic, CAPTURE_MAGIC, sizeof(_header.Magic)) != 0) ||
+      (_header.HeaderSize < sizeof(CaptureHeader)) || (_header.HeaderSize > _size)) {
+    Close();
+    return false;
+  }
+
+  if ((_header.IndexOffset == 0) ||
+      (_header.IndexOffset + (uint64_t)_header.Blocks * sizeof(CaptureIndexEntry) > _size) ||
+      (_header.LevelsOffset + (uint64_t)_header.Levels * sizeof(CaptureLevel) > _size)) {
+    // Not closed: the levels are lost
+    _header.Levels = 0;
+    return Scan();
+  }
+  _index.resize(_header.Blocks);
+  memcpy(_index.data(), _data + _header.IndexOffset, _index.size() * sizeof(CaptureIndexEntry));
+  for (uint32_t i = 0; i < _index.size(); i++) {
+    if ((_index[i].Offset + BlockSize(_index[i].Count) > _size) ||
+        (((const CaptureBlock *)(_data + _index[i].Offset))->Magic != CAPTURE_BLOCK_MAGIC)) {
+      _header.Levels = 0;
+      return Scan();
+    }
+  }
+  return true;
+}
+
+void CaptureReader::Close(void)
+{
+  if (_data != NULL) {
+    munmap((void *)_data, _size);
+  }
+  _data = NULL;
+  _size = 0;
+  _index.clear();
+}
+
+const CaptureHeader &CaptureReader::GetHeader(void) const
+{
+  return _header;
+}
+
+uint32_t CaptureReader::GetBlocks(void) const
+{
+  return _index.size();
+}
+
+TremorPipeline::Block CaptureReader::GetBlock(uint32_t Block) const
+{
+  const CaptureIndexEntry &entry = _index[Block];
+  const int16_t *x = (const int16_t *)(_data + entry.Offset + sizeof(CaptureBlock));
+  TremorPipeline::Block block = { { x, x + entry.Count, x + 2 * entry.Count }, 1, entry.Count, entry.First };
+
+  return block;
+}
+
+int64_t CaptureReader::GetTime(uint32_t Block) const
+{
+  return ((const CaptureBlock *)(_data + _index[Block].Offset))->Time;
+}
+
+uint32_t CaptureReader::Seek(uint32_t Sample) const
+{
+  uint32_t low = 0, high = _index.size(), middle;
+
+  // First block not ending before Sample
+  while (low < high) {
+    middle = low + (high - low) / 2;
+    if (_index[middle].First + _index[middle].Count <= Sample) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+bool CaptureReader::GetSample(uint32_t Sample, int16_t *pSample) const
+{
+  uint32_t block = Seek(Sample);
+  TremorPipeline::Block samples;
+
+  if ((block == _index.size()) || (_index[block].First > Sample)) {
+    return false;
+  }
+  samples = GetBlock(block);
+  for (uint32_t i = 0; i < 3; i++) {
+    pSample[i] = samples.pAxis[i][Sample - samples.First];
+  }
+  return true;
+}
+
+uint32_t CaptureReader::GetLevels(void) const
+{
+  return _header.Levels;
+}
+
+CaptureLevel CaptureReader::GetLevel(uint32_t Level) const
+{
+  const uint8_t *column = _data + _header.LevelsOffset + 4ULL * Level;
+  uint64_t size = 4ULL * _header.Levels;
+  CaptureLevel level;
+
+  memcpy(&level.Time, column, 4);
+  memcpy(&level.Sample, column + size, 4);
+  memcpy(&level.Board, column + 2 * size, 4);
+  memcpy(&level.Host, column + 3 * size, 4);
+  return level;
+}
+
+// Blocks found one after the other from the header on
+bool CaptureReader::Scan(void)
+{
+  const CaptureBlock *block;
+  CaptureIndexEntry entry;
+  uint64_t offset = _header.HeaderSize;
+
+  _index.clear();
+  while (offset + sizeof(CaptureBlock) <= _size) {
+    block = (const CaptureBlock *)(_data + offset);
+    if ((block->Magic != CAPTURE_BLOCK_MAGIC) || (block->Count == 0) || (offset + BlockSize(block->Count) > _size)) {
+      break;
+    }
+    entry.First = block->First;
+    entry.Count = block->Count;
+    entry.Offset = offset;
+    _index.push_back(entry);
+    offset += BlockSize(block->Count);
+  }
+  _header.Blocks = _index.size();
+  return true;
+}
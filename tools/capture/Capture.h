@@ -0,0 +1,188 @@
+#ifndef __CAPTURE_H
+#define __CAPTURE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+#include "util/TremorPipeline.h"
+
+/*
+  Capture files of timestamped gyroscope samples, for the host tools.
+
+  File, little endian:
+    CaptureHeader         rate, full scale and calibration of the samples
+    blocks                CaptureBlock, then int16_t X[Count], Y[Count],
+                          Z[Count], padded to 8 bytes
+    index                 CaptureIndexEntry per block
+    board levels          uint32_t Time[Levels], uint32_t Sample[Levels],
+                          int32_t Board[Levels], int32_t Host[Levels]
+
+  The samples of a block follow each other, none missing: a gap in the
+  telemetry starts a new block. Sample numbers only grow from one block to
+  the next, Seek() and GetSample() search them: a board reset, which
+  numbers them from 0 again, starts a new capture. The index and the levels are written when
+  the capture is closed. A capture that was not, its IndexOffset still 0,
+  is read all the same: the reader finds the blocks again from their magic
+  numbers.
+
+  CaptureReader maps the file: its blocks are TremorPipeline blocks that
+  point into the mapping, processed where they lie.
+
+  Usage:
+
+  #include "Capture.h"
+
+  CaptureReader capture;
+  TremorPipeline pipeline;
+
+  if(capture.Open("session.trc"))
+  {
+      for(uint32_t i = capture.Seek(first); i < capture.GetBlocks(); i++)
+      {
+          pipeline.Process(capture.GetBlock(i));
+      }
+  }
+*/
+
+#define CAPTURE_MAGIC         "TRC2"
+#define CAPTURE_BLOCK_MAGIC   0x324B4C42   // "BLK2"
+#define CAPTURE_NO_LEVEL      ((int32_t)0x80000000)
+
+typedef struct
+{
+  char     Magic[4];
+  uint32_t HeaderSize;
+  float    RateHz;          // Output data rate
+  uint16_t FullScaleDps;
+  uint16_t Reserved0;
+  float    Sensitivity;     // dps per LSB
+  int16_t  Bias[3];         // Zero-rate level, LSB, subtracted before Gain
+  uint16_t Reserved1;
+  float    Gain[3];
+  uint32_t BlockSamples;    // Most samples per block
+  uint32_t Blocks;
+  uint32_t Levels;
+  uint32_t Reserved2;
+  uint64_t IndexOffset;     // 0 if the capture was not closed
+  uint64_t LevelsOffset;
+  int64_t  StartTime;       // Unix time, microseconds
+} CaptureHeader;
+
+typedef struct
+{
+  uint32_t Magic;
+  uint32_t First;           // Number of the first sample
+  uint32_t Count;
+  uint32_t Reserved;
+  int64_t  Time;            // Arrival, microseconds after StartTime
+} CaptureBlock;
+
+typedef struct
+{
+  uint32_t First;
+  uint32_t Count;
+  uint64_t Offset;          // Of the CaptureBlock
+} CaptureIndexEntry;
+
+typedef struct
+{
+  uint32_t Time;            // Board time, milliseconds
+  uint32_t Sample;          // Sample rated
+  int32_t  Board;           // Level, hundredths
+  int32_t  Host;            // CAPTURE_NO_LEVEL if the sample was lost
+} CaptureLevel;
+
+class CaptureWriter
+{
+
+public:
+  //! Constructor
+  CaptureWriter();
+  ~CaptureWriter();
+
+  /**
+    * @brief  Creates a capture.
+    * @param  Info: rate, full scale, calibration and block size, the rest
+    *         is filled
+    */
+  bool Open(const char *pPath, const CaptureHeader &Info);
+
+  /**
+    * @brief  Appends X, Y, Z triples.
+    * @param  First: number of the first one
+    * @param  Time: arrival, microseconds after StartTime
+    */
+  void Append(uint32_t First, const int16_t *pSamples, uint32_t Count, int64_t Time);
+
+  void AddLevel(const CaptureLevel &level);
+
+  /**
+    * @brief  Writes the last block, the index and the levels.
+    */
+  bool Close(void);
+
+  bool IsOpen(void) const;
+
+private:
+  void Flush(void);
+
+  FILE                          *_file;
+  CaptureHeader                  _header;
+  std::vector<int16_t>           _columns[3];
+  uint32_t                       _first;
+  int64_t                        _time;
+  uint64_t                       _offset;
+  std::vector<CaptureIndexEntry> _index;
+  std::vector<CaptureLevel>      _levels;
+};
+
+class CaptureReader
+{
+
+public:
+  //! Constructor
+  CaptureReader();
+  ~CaptureReader();
+
+  bool Open(const char *pPath);
+  void Close(void);
+
+  const CaptureHeader &GetHeader(void) const;
+  uint32_t GetBlocks(void) const;
+
+  /**
+    * @brief  Gets a block, pointing into the mapping.
+    */
+  TremorPipeline::Block GetBlock(uint32_t Block) const;
+
+  /**
+    * @brief  Gets the arrival time of a block.
+    */
+  int64_t GetTime(uint32_t Block) const;
+
+  /**
+    * @brief  Finds the block holding a sample, or the next one if it was
+    *         lost.
+    * @retval Block, GetBlocks() if none
+    */
+  uint32_t Seek(uint32_t Sample) const;
+
+  /**
+    * @brief  Gets one sample.
+    * @retval false if it is not in the capture
+    */
+  bool GetSample(uint32_t Sample, int16_t *pSample) const;
+
+  uint32_t GetLevels(void) const;
+  CaptureLevel GetLevel(uint32_t Level) const;
+
+private:
+  bool Scan(void);
+
+  const uint8_t                 *_data;
+  uint64_t                       _size;
+  CaptureHeader                  _header;
+  std::vector<CaptureIndexEntry> _index;
+};
+
+#endif
@@ -0,0 +1,302 @@
+/**
+  ******************************************************************************
+  * @file    fontgen.c
+  * @brief   Host tool generating the src/drivers/fontNN.c glyph atlases from
+  *          the fixed cell 1 bpp tables in tools/fontgen/tables.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this tool:
+--------------------------
+   gcc -O2 -o fontgen tools/fontgen/fontgen.c
+   ./fontgen src/drivers            1 bpp fonts, drawn by the CPU
+   ./fontgen -a4 src/drivers        4 bpp alpha fonts, drawn by the DMA2D
+
+2. Output format:
+---------------------
+   - Each glyph is trimmed to the bounding box of its set pixels. The box
+     position in the cell goes in the sGLYPH, blank glyphs have no box.
+   - Rows start on a byte. At 1 bpp the first pixel is the MSB, at 4 bpp the
+     low nibble, and boxes are widened to an even width, one transparent
+     column to the right: a glyph is then a plain DMA2D A4 image.
+   - The glyph table is indexed by the character minus FirstChar.
+   - The tables only have two levels, so the 4 bpp alpha is 0 or 15. The
+     format is ready for antialiased sources.
+
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "tables/font8.c"
+#include "tables/font12.c"
+#include "tables/font16.c"
+#include "tables/font20.c"
+#include "tables/font24.c"
+
+#define FIRST_CHAR    ' '
+#define GLYPH_COUNT   95
+#define MAX_BITMAP    65536
+
+typedef struct
+{
+  const char    *Name;
+  const uint8_t *Table;
+  int            Width;
+  int            Height;
+} SourceFont;
+
+typedef struct
+{
+  int Offset;
+  int X;
+  int Y;
+  int Width;
+  int Height;
+} Glyph;
+
+static const SourceFont Fonts[] =
+{
+  { "Font8",  Font8_Table,   5,  8 },
+  { "Font12", Font12_Table,  7, 12 },
+  { "Font16", Font16_Table, 11, 16 },
+  { "Font20", Font20_Table, 14, 20 },
+  { "Font24", Font24_Table, 17, 24 },
+};
+
+static uint8_t Bitmap[MAX_BITMAP];
+static Glyph   Glyphs[GLYPH_COUNT];
+
+/**
+  * @brief  Reads a pixel of the source table.
+  */
+static int SourcePixel(const SourceFont *pFont, int Index, int X, int Y)
+{
+  int stride = (pFont->Width + 7) / 8;
+  const uint8_t *row = pFont->Table + (Index * pFont->Height + Y) * stride;
+
+  /* Rows are left aligned on the first byte */
+  return (row[X / 8] >> (7 - (X % 8))) & 1;
+}
+
+/**
+  * @brief  Trims and packs all the glyphs of a font.
+  * @retval Bitmap size in bytes, -1 on overflow
+  */
+static int Pack(const SourceFont *pFont, int Bpp)
+{
+  int size = 0, i, x, y, x0, y0, x1, y1, stride;
+  Glyph *g;
+
+  for(i = 0; i < GLYPH_COUNT; i++)
+  {
+    g = &Glyphs[i];
+    x0 = pFont->Width;
+    y0 = pFont->Height;
+    x1 = -1;
+    y1 = -1;
+    for(y = 0; y < pFont->Height; y++)
+    {
+      for(x = 0; x < pFont->Width; x++)
+      {
+        if(SourcePixel(pFont, i, x, y))
+        {
+          x0 = (x < x0) ? x : x0;
+          y0 = (y < y0) ? y : y0;
+          x1 = (x > x1) ? x : x1;
+          y1 = (y > y1) ? y : y1;
+        }
+      }
+    }
+
+    memset(g, 0, sizeof(*g));
+    if(x1 < 0)
+    {
+      continue;
+    }
+
+    /* A4 boxes have an even width, the extra column is transparent and may
+       go one pixel past the cell */
+    if((Bpp == 4) && ((x1 - x0 + 1) & 1))
+    {
+      x1++;
+    }
+
+    g->Offset = size;
+    g->X      = x0;
+    g->Y      = y0;
+    g->Width  = x1 - x0 + 1;
+    g->Height = y1 - y0 + 1;
+    stride    = (g->Width * Bpp + 7) / 8;
+    if((size + stride * g->Height > MAX_BITMAP) || (size > 0xFFFF))
+    {
+      return -1;
+    }
+
+    for(y = 0; y < g->Height; y++)
+    {
+      memset(&Bitmap[size], 0, stride);
+      for(x = 0; x < g->Width; x++)
+      {
+        if((x0 + x >= pFont->Width) || !SourcePixel(pFont, i, x0 + x, y0 + y))
+        {
+          continue;
+        }
+        if(Bpp == 1)
+        {
+          Bitmap[size + x / 8] |= 0x80 >> (x % 8);
+        }
+        else
+        {
+          Bitmap[size + x / 2] |= 0x0F << (4 * (x % 2));
+        }
+      }
+      size += stride;
+    }
+  }
+
+  return size;
+}
+
+/**
+  * @brief  Writes the C file of a font.
+  * @retval 0 on success
+  */
+static int Write(const SourceFont *pFont, int Bpp, int Size, const char *pPath)
+{
+  FILE *f = fopen(pPath, "w");
+  int i, j, line;
+
+  if(f == NULL)
+  {
+    return -1;
+  }
+
+  fprintf(f, "/**\n");
+  fprintf(f, "  ******************************************************************************\n");
+  fprintf(f, "  * @file    %s\n", strrchr(pPath, '/') ? strrchr(pPath, '/') + 1 : pPath);
+  fprintf(f, "  * @brief   %s glyphs, %dx%d cells, %d bpp, %d bytes of bitmap.\n", pFont->Name, pFont->Width, pFont->Height, Bpp, Size);
+  fprintf(f, "  *          Generated by tools/fontgen from the STMicroelectronics\n");
+  fprintf(f, "  *          tables, do not edit.\n");
+  fprintf(f, "  ******************************************************************************\n");
+  fprintf(f, "  * @attention\n");
+  fprintf(f, "  *\n");
+  fprintf(f, "  * <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>\n");
+  fprintf(f, "  *\n");
+  fprintf(f, "  * Redistribution and use in source and binary forms, with or without modification,\n");
+  fprintf(f, "  * are permitted provided that the following conditions are met:\n");
+  fprintf(f, "  *   1. Redistributions of source code must retain the above copyright notice,\n");
+  fprintf(f, "  *      this list of conditions and the following disclaimer.\n");
+  fprintf(f, "  *   2. Redistributions in binary form must reproduce the above copyright notice,\n");
+  fprintf(f, "  *      this list of conditions and the following disclaimer in the documentation\n");
+  fprintf(f, "  *      and/or other materials provided with the distribution.\n");
+  fprintf(f, "  *   3. Neither the name of STMicroelectronics nor the names of its contributors\n");
+  fprintf(f, "  *      may be used to endorse or promote products derived from this software\n");
+  fprintf(f, "  *      without specific prior written permission.\n");
+  fprintf(f, "  *\n");
+  fprintf(f, "  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS \"AS IS\"\n");
+  fprintf(f, "  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE\n");
+  fprintf(f, "  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE\n");
+  fprintf(f, "  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE\n");
+  fprintf(f, "  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL\n");
+  fprintf(f, "  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR\n");
+  fprintf(f, "  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER\n");
+  fprintf(f, "  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,\n");
+  fprintf(f, "  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE\n");
+  fprintf(f, "  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.\n");
+  fprintf(f, "  *\n");
+  fprintf(f, "  ******************************************************************************\n");
+  fprintf(f, "  */\n\n");
+  fprintf(f, "#include \"fonts.h\"\n\n");
+
+  fprintf(f, "static const uint8_t %s_Bitmap[] =\n{\n", pFont->Name);
+  for(i = 0; i < GLYPH_COUNT; i++)
+  {
+    const Glyph *g = &Glyphs[i];
+    int stride = (g->Width * Bpp + 7) / 8;
+
+    if(g->Width == 0)
+    {
+      continue;
+    }
+    fprintf(f, "  /* '%s%c' */\n", ((FIRST_CHAR + i) == '\\') ? "\\" : "", FIRST_CHAR + i);
+    for(line = 0; line < g->Height; line++)
+    {
+      fprintf(f, " ");
+      for(j = 0; j < stride; j++)
+      {
+        fprintf(f, " 0x%02X,", Bitmap[g->Offset + line * stride + j]);
+      }
+      fprintf(f, "\n");
+    }
+  }
+  fprintf(f, "};\n\n");
+
+  fprintf(f, "static const sGLYPH %s_Glyphs[] =\n{\n", pFont->Name);
+  fprintf(f, "  /* Offset, XOffset, YOffset, Width, Height */\n");
+  for(i = 0; i < GLYPH_COUNT; i++)
+  {
+    const Glyph *g = &Glyphs[i];
+
+    fprintf(f, "  { %5d, %2d, %2d, %2d, %2d }, /* '%s%c' */\n", g->Offset, g->X, g->Y, g->Width, g->Height,
+            ((FIRST_CHAR + i) == '\\') ? "\\" : "", FIRST_CHAR + i);
+  }
+  fprintf(f, "};\n\n");
+
+  fprintf(f, "sFONT %s = {\n", pFont->Name);
+  fprintf(f, "  %s_Bitmap,\n", pFont->Name);
+  fprintf(f, "  %s_Glyphs,\n", pFont->Name);
+  fprintf(f, "  %d, /* Width */\n", pFont->Width);
+  fprintf(f, "  %d, /* Height */\n", pFont->Height);
+  fprintf(f, "  %d, /* FirstChar */\n", FIRST_CHAR);
+  fprintf(f, "  %d, /* GlyphCount */\n", GLYPH_COUNT);
+  fprintf(f, "  %d, /* Bpp */\n", Bpp);
+  fprintf(f, "};\n");
+
+  return fclose(f);
+}
+
+int main(int argc, char **argv)
+{
+  char path[1024];
+  const char *dir;
+  int bpp = 1, size, i;
+
+  if((argc == 3) && (strcmp(argv[1], "-a4") == 0))
+  {
+    bpp = 4;
+    dir = argv[2];
+  }
+  else if(argc == 2)
+  {
+    dir = argv[1];
+  }
+  else
+  {
+    fprintf(stderr, "usage: %s [-a4] output-directory\n", argv[0]);
+    return 2;
+  }
+
+  for(i = 0; i < (int)(sizeof(Fonts) / sizeof(Fonts[0])); i++)
+  {
+    size = Pack(&Fonts[i], bpp);
+    if(size < 0)
+    {
+      fprintf(stderr, "%s: bitmap too large\n", Fonts[i].Name);
+      return 1;
+    }
+    snprintf(path, sizeof(path), "%s/font%s.c", dir, Fonts[i].Name + 4);
+    if(Write(&Fonts[i], bpp, size, path) != 0)
+    {
+      fprintf(stderr, "%s: cannot write\n", path);
+      return 1;
+    }
+    printf("%s: %d bytes of bitmap, %d of glyphs (was %d)\n", path, size, GLYPH_COUNT * 6,
+           GLYPH_COUNT * Fonts[i].Height * ((Fonts[i].Width + 7) / 8));
+  }
+  return 0;
+}
@@ -0,0 +1,140 @@
+/**
+  ******************************************************************************
+  * @file    gyrodec.cpp
+  * @brief   Host tool coding and decoding gyroscope sample streams with the
+  *          firmware codec, src/util/GyroCodec.cpp.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this tool:
+--------------------------
+   g++ -O2 -Isrc -o gyrodec tools/gyrodec/gyrodec.cpp src/util/GyroCodec.cpp
+   ./gyrodec stream.bin > samples.csv         all the samples
+   ./gyrodec -s 1200 -n 500 stream.bin        500 samples from sample 1200
+   ./gyrodec -e 256 < samples.csv > stream.bin   code x,y,z lines in blocks
+                                              of 256 samples
+
+2. Stream format:
+---------------------
+   - Blocks back to back, as GyroEncoder makes them. A stream that ends in
+     the middle of a block is decoded up to the last whole block.
+   - The CSV has a "sample,x,y,z" header line when decoding. When coding,
+     lines with fewer than three numbers are skipped and a leading sample
+     number column, if any, is dropped.
+   - The coding statistics go to stderr.
+
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "util/GyroCodec.h"
+
+static int Encode(uint32_t BlockSamples)
+{
+  static uint8_t block[GyroCodec::MaxBlockSize(GyroCodec::MAX_SAMPLES)];
+  GyroEncoder encoder(block, sizeof(block), BlockSamples);
+  char line[256];
+  long values[4];
+  int16_t sample[3];
+  uint32_t samples = 0, bytes = 0, blocks = 0;
+  int n, i;
+
+  while (fgets(line, sizeof(line), stdin) != NULL) {
+    n = sscanf(line, "%ld ,%ld ,%ld ,%ld", &values[0], &values[1], &values[2], &values[3]);
+    if (n < 3) {
+      continue;
+    }
+    for (i = 0; i < 3; i++) {
+      sample[i] = (int16_t)values[n - 3 + i];
+    }
+    samples++;
+    if (encoder.Push(sample)) {
+      fwrite(encoder.Data(), 1, encoder.Length(), stdout);
+      bytes += encoder.Length();
+      blocks++;
+    }
+  }
+  if (encoder.Flush()) {
+    fwrite(encoder.Data(), 1, encoder.Length(), stdout);
+    bytes += encoder.Length();
+    blocks++;
+  }
+
+  fprintf(stderr, "%u samples, %u blocks, %u bytes: %.2f bytes per sample, %.2fx\n", samples, blocks, bytes,
+          samples ? (double)bytes / samples : 0.0, bytes ? 6.0 * samples / bytes : 0.0);
+  return 0;
+}
+
+static int Decode(const char *pPath, uint32_t First, uint32_t Count)
+{
+  static int16_t samples[3 * GyroCodec::MAX_SAMPLES];
+  FILE *file = fopen(pPath, "rb");
+  uint8_t *stream;
+  GyroCodec::IndexEntry *index;
+  uint32_t length, entries, entry, decoded, sample, i;
+  long size;
+
+  if (file == NULL) {
+    perror(pPath);
+    return 1;
+  }
+  fseek(file, 0, SEEK_END);
+  size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  stream = (uint8_t *)malloc(size + 1);
+  length = (uint32_t)fread(stream, 1, size, file);
+  fclose(file);
+
+  // At most one entry per header
+  index = (GyroCodec::IndexEntry *)malloc((length / GyroCodec::HEADER_SIZE + 1) * sizeof(GyroCodec::IndexEntry));
+  entries = GyroCodec::Index(stream, length, index, length / GyroCodec::HEADER_SIZE + 1);
+
+  printf("sample,x,y,z\n");
+  entry = GyroCodec::Seek(index, entries, First);
+  for (; (entry < entries) && (Count > 0); entry++) {
+    decoded = GyroDecoder::Decode(stream + index[entry].Offset, length - index[entry].Offset, samples,
+                                  GyroCodec::MAX_SAMPLES);
+    if (decoded == 0) {
+      fprintf(stderr, "invalid block at offset %u\n", index[entry].Offset);
+      break;
+    }
+    for (i = 0; (i < decoded) && (Count > 0); i++) {
+      sample = index[entry].Sample + i;
+      if (sample < First) {
+        continue;
+      }
+      printf("%u,%d,%d,%d\n", sample, samples[3 * i], samples[3 * i + 1], samples[3 * i + 2]);
+      Count--;
+    }
+  }
+  fprintf(stderr, "%u blocks, %u bytes\n", entries, length);
+
+  free(index);
+  free(stream);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t first = 0, count = 0xFFFFFFFF;
+  int i;
+
+  for (i = 1; i < argc; i++) {
+    if ((strcmp(argv[i], "-e") == 0) && (i + 1 < argc)) {
+      return Encode((uint32_t)strtoul(argv[i + 1], NULL, 0));
+    } else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc)) {
+      first = (uint32_t)strtoul(argv[++i], NULL, 0);
+    } else if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc)) {
+      count = (uint32_t)strtoul(argv[++i], NULL, 0);
+    } else {
+      return Decode(argv[i], first, count);
+    }
+  }
+  fprintf(stderr, "usage: gyrodec [-s first] [-n count] stream.bin\n       gyrodec -e block_samples < samples.csv\n");
+  return 1;
+}
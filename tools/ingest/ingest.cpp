@@ -0,0 +1,661 @@
+/**
+  ******************************************************************************
+  * @file    ingest.cpp
+  * @brief   Host tool reading the board telemetry, src/util/Telemetry.h: it
+  *          writes every sample to a capture file and runs the board tremor
+  *          detection on them, side by side with the board results.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this tool:
+--------------------------
+   g++ -O2 -Isrc -o ingest tools/ingest/ingest.cpp tools/capture/Capture.cpp \
+       src/util/GyroCodec.cpp src/util/Crc.cpp src/util/TremorDetector.cpp \
+       src/util/TremorPipeline.cpp
+   ./ingest -o session.trc /dev/ttyACM0       the board, at 921600 baud
+   ./ingest -b 115200 /dev/pts/3              a pty, at another rate
+   ./ingest -o session.trc - < telemetry.bin  a raw dump of the link
+   ./ingest -t .pio/build/disco_f429zi/tokens.txt /dev/ttyACM0
+                                              TOKEN_LOG() entries as text
+   Ctrl-C ends the capture, the file is closed. tools/replay/replay.cpp
+   runs the detection on it again.
+
+   - The board text records go to stdout, prefixed with "board: ", as do
+     the tremor onsets the host finds and the levels that do not match.
+   - TOKEN_LOG() entries are formatted with the dictionary that the build
+     writes, tools/tokens/tokens.py, and go to stdout prefixed with the
+     board time in seconds. Without it, or for a token missing from it, the
+     token and the arguments are shown in hexadecimal.
+   - Once a second a status line goes to stderr: records, CRC errors, lost
+     records and samples, samples per second and level comparisons.
+
+2. Detection:
+---------------------
+   - The host runs the board TremorPipeline on every sample, as the board
+     does. Each board level record names the sample it was computed from:
+     the host rates that sample on its own and compares the hundredths,
+     once the sample has arrived.
+   - The host onsets are those of the board, but for the samples lost on
+     the link.
+
+3. Capture file:
+---------------------
+   tools/capture/Capture.h: the samples in blocks of columns, a new block
+   at each gap in the telemetry, then the board level records with the
+   host level of the same sample. The header gives the rate and the full
+   scale that main.cpp sets on the L3GD20.
+   A board reset numbers the samples from 0 again: the capture is closed
+   and the next run of the board goes to a new one, session-2.trc, then
+   session-3.trc and so on.
+
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "util/Crc.h"
+#include "util/GyroCodec.h"
+#include "util/TremorDetector.h"
+#include "util/TremorPipeline.h"
+#include "../capture/Capture.h"
+
+// Record types and sizes of src/util/Telemetry.h, which needs mbed
+#define RECORD_TEXT           0x01
+#define RECORD_SAMPLES        0x02
+#define RECORD_LEVEL          0x03
+#define RECORD_LOG            0x04
+#define LOG_ENTRY_HEADER      9
+#define RECORD_OVERHEAD       5
+#define BLOCK_SAMPLES         64
+#define MAX_RECORD            (RECORD_OVERHEAD + 4 + GyroCodec::MaxBlockSize(BLOCK_SAMPLES))
+
+// L3GD20 as main.cpp sets it: 190 Hz, 2000 dps
+#define RATE_HZ               190
+#define FULL_SCALE_DPS        2000
+#define SENSITIVITY_DPS       0.07f
+#define CAPTURE_BLOCK         4096
+#define RING_SAMPLES          8192     // Kept for the board levels to come
+#define PENDING_LEVELS        256
+#define MAX_TOKENS            4096
+
+typedef struct
+{
+  // Link
+  uint64_t Bytes;
+  uint64_t Records;
+  uint64_t BadRecords;      // CRC, COBS or length
+  uint64_t LostRecords;     // Sequence gaps
+  int32_t  Sequence;        // Last one, -1 before the first record
+
+  // Samples
+  uint64_t Samples;
+  uint64_t LostSamples;
+  uint32_t Next;            // Number of the next sample expected
+  bool     Started;
+  int16_t  Ring[RING_SAMPLES][3];
+  uint32_t RingNumber[RING_SAMPLES];
+  TremorPipeline Pipeline;
+
+  // Board levels, waiting for their sample
+  CaptureLevel Pending[PENDING_LEVELS];
+  uint32_t PendingFirst;
+  uint32_t PendingCount;
+  uint64_t Matches;
+  uint64_t Mismatches;
+  uint64_t Unrated;         // Sample lost
+
+  CaptureWriter Capture;
+  CaptureHeader CaptureInfo;
+  const char *pCapturePath;
+  uint32_t CapturePart;     // Runs of the board, 1 for the first capture
+  int64_t  Start;           // Unix time, microseconds, of the capture
+} State;
+
+typedef struct
+{
+  uint32_t Token;
+  char    *pFormat;
+} Token;
+
+static Token    Tokens[MAX_TOKENS];
+static uint32_t TokenCount = 0;
+
+static volatile sig_atomic_t Stop = 0;
+
+static void OnSignal(int Signal)
+{
+  (void)Signal;
+  Stop = 1;
+}
+
+static speed_t Speed(uint32_t Baud)
+{
+  switch (Baud) {
+    case 9600: return B9600;
+    case 19200: return B19200;
+    case 38400: return B38400;
+    case 57600: return B57600;
+    case 115200: return B115200;
+    case 230400: return B230400;
+    case 460800: return B460800;
+    case 921600: return B921600;
+    default: return B0;
+  }
+}
+
+// Raw mode at Baud if the input is a terminal, a serial port or a pty
+static int Open(const char *pPath, uint32_t Baud)
+{
+  struct termios tio;
+  int fd = (strcmp(pPath, "-") == 0) ? 0 : open(pPath, O_RDONLY | O_NOCTTY);
+
+  if ((fd < 0) || !isatty(fd)) {
+    return fd;
+  }
+  if (tcgetattr(fd, &tio) == 0) {
+    cfmakeraw(&tio);
+    tio.c_cc[VMIN] = 1;
+    tio.c_cc[VTIME] = 0;
+    if (Speed(Baud) != B0) {
+      cfsetspeed(&tio, Speed(Baud));
+    } else {
+      fprintf(stderr, "unsupported baud rate %u, left as is\n", Baud);
+    }
+    tcsetattr(fd, TCSANOW, &tio);
+  }
+  return fd;
+}
+
+// The dictionary keeps the C escapes of the sources
+static void Unescape(char *pText)
+{
+  char *out = pText;
+
+  for (; *pText != '\0'; pText++) {
+    if ((*pText != '\\') || (pText[1] == '\0')) {
+      *out++ = *pText;
+      continue;
+    }
+    pText++;
+    switch (*pText) {
+      case 'n': *out++ = '\n'; break;
+      case 't': *out++ = '\t'; break;
+      case 'r': *out++ = '\r'; break;
+      default: *out++ = *pText; break;
+    }
+  }
+  *out = '\0';
+}
+
+static bool LoadTokens(const char *pPath)
+{
+  char line[512];
+  char *tab;
+  FILE *file = fopen(pPath, "r");
+
+  if (file == NULL) {
+    perror(pPath);
+    return false;
+  }
+  while ((fgets(line, sizeof(line), file) != NULL) && (TokenCount < MAX_TOKENS)) {
+    line[strcspn(line, "\r\n")] = '\0';
+    tab = strchr(line, '\t');
+    if (tab == NULL) {
+      continue;
+    }
+    Unescape(tab + 1);
+    Tokens[TokenCount].Token = (uint32_t)strtoul(line, NULL, 16);
+    Tokens[TokenCount].pFormat = strdup(tab + 1);
+    TokenCount++;
+  }
+  fclose(file);
+  return true;
+}
+
+static const char *FindToken(uint32_t Value)
+{
+  for (uint32_t i = 0; i < TokenCount; i++) {
+    if (Tokens[i].Token == Value) {
+      return Tokens[i].pFormat;
+    }
+  }
+  return NULL;
+}
+
+// printf() of the format, one conversion at a time, each argument taken as
+// its conversion says
+static void Render(const char *pFormat, const uint32_t *pArgs, uint32_t Count)
+{
+  char spec[32];
+  uint32_t length, used = 0;
+  float value;
+
+  while (*pFormat != '\0') {
+    if (*pFormat != '%') {
+      putchar(*pFormat++);
+      continue;
+    }
+    if (pFormat[1] == '%') {
+      putchar('%');
+      pFormat += 2;
+      continue;
+    }
+    // Flags, width and precision kept, length modifiers left out
+    length = 0;
+    spec[length++] = *pFormat++;
+    while ((*pFormat != '\0') && (strchr("-+ #0123456789.", *pFormat) != NULL) && (length < sizeof(spec) - 2)) {
+      spec[length++] = *pFormat++;
+    }
+    while ((*pFormat != '\0') && (strchr("hlzjt", *pFormat) != NULL)) {
+      pFormat++;
+    }
+    if (*pFormat == '\0') {
+      break;
+    }
+    spec[length++] = *pFormat;
+    spec[length] = '\0';
+    if (used == Count) {
+      printf("<missing>");
+    } else if (strchr("di", *pFormat) != NULL) {
+      printf(spec, (int32_t)pArgs[used++]);
+    } else if (strchr("uxXoc", *pFormat) != NULL) {
+      printf(spec, pArgs[used++]);
+    } else if (strchr("feEgG", *pFormat) != NULL) {
+      memcpy(&value, &pArgs[used++], sizeof(value));
+      printf(spec, (double)value);
+    } else {
+      printf("<%s?>", spec);
+    }
+    pFormat++;
+  }
+}
+
+static uint32_t GetU32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Rates the board level records whose sample came or was lost, the
+// Forced first ones in any case
+static void RateLevels(State *pState, uint32_t Forced)
+{
+  TremorDetector detector;
+  uint32_t slot;
+
+  while (pState->PendingCount > 0) {
+    CaptureLevel &level = pState->Pending[pState->PendingFirst];
+    if ((Forced == 0) && (!pState->Started || ((int32_t)(level.Sample - pState->Next) >= 0))) {
+      // Not yet
+      break;
+    }
+    slot = level.Sample % RING_SAMPLES;
+    if (pState->Started && (pState->RingNumber[slot] == level.Sample)) {
+      level.Host = TremorDetector::Hundredths(detector.Update(pState->Ring[slot]));
+      if (level.Host == level.Board) {
+        pState->Matches++;
+      } else {
+        pState->Mismatches++;
+        printf("level mismatch at sample %u: board %d, host %d hundredths\n", level.Sample, level.Board, level.Host);
+      }
+    } else {
+      level.Host = CAPTURE_NO_LEVEL;
+      pState->Unrated++;
+    }
+    pState->Capture.AddLevel(level);
+    pState->PendingFirst = (pState->PendingFirst + 1) % PENDING_LEVELS;
+    pState->PendingCount--;
+    if (Forced > 0) {
+      Forced--;
+    }
+  }
+}
+
+static void OnOnset(uint32_t Sample, float Level, void *pContext)
+{
+  (void)pContext;
+  printf("host: tremor onset at sample %u, level %d\n", Sample, TremorDetector::Hundredths(Level));
+}
+
+static int64_t Microseconds(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_REALTIME, &now);
+  return (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+// The first run of the board goes to the path as given, the next ones get
+// their number before the extension
+static bool OpenCapture(State *pState)
+{
+  char path[4096];
+  const char *pDot = strrchr(pState->pCapturePath, '.');
+  const char *pSlash = strrchr(pState->pCapturePath, '/');
+  int base;
+
+  if ((pDot == NULL) || ((pSlash != NULL) && (pDot < pSlash))) {
+    pDot = pState->pCapturePath + strlen(pState->pCapturePath);
+  }
+  base = (int)(pDot - pState->pCapturePath);
+  if (pState->CapturePart <= 1) {
+    snprintf(path, sizeof(path), "%s", pState->pCapturePath);
+  } else {
+    snprintf(path, sizeof(path), "%.*s-%u%s", base, pState->pCapturePath, pState->CapturePart, pDot);
+  }
+  pState->Start = Microseconds();
+  pState->CaptureInfo.StartTime = pState->Start;
+  if (!pState->Capture.Open(path, pState->CaptureInfo)) {
+    perror(path);
+    return false;
+  }
+  if (pState->CapturePart > 1) {
+    printf("capture continues in %s\n", path);
+  }
+  return true;
+}
+
+static void OnSamples(State *pState, const uint8_t *pPayload, uint32_t Length)
+{
+  static int16_t samples[3 * GyroCodec::MAX_SAMPLES];
+  uint32_t first, count, i;
+
+  if (Length < 4) {
+    pState->BadRecords++;
+    return;
+  }
+  first = GetU32(pPayload);
+  count = GyroDecoder::Decode(pPayload + 4, Length - 4, samples, GyroCodec::MAX_SAMPLES);
+  if (count == 0) {
+    pState->BadRecords++;
+    return;
+  }
+
+  if (pState->Started && (first != pState->Next)) {
+    if (first > pState->Next) {
+      pState->LostSamples += first - pState->Next;
+    } else {
+      // The levels left are from before
+      printf("sample numbers restart at %u: board reset?\n", first);
+      RateLevels(pState, pState->PendingCount);
+      for (i = 0; i < RING_SAMPLES; i++) {
+        pState->RingNumber[i] = 0xFFFFFFFF;
+      }
+      pState->Pipeline.Reset();
+      // A capture only holds growing sample numbers, Seek() relies on it
+      if (pState->Capture.IsOpen()) {
+        if (!pState->Capture.Close()) {
+          perror(pState->pCapturePath);
+        }
+        pState->CapturePart++;
+        OpenCapture(pState);
+      }
+    }
+    pState->Next = first;
+  }
+  pState->Started = true;
+
+  for (i = 0; i < count; i++) {
+    memcpy(pState->Ring[(first + i) % RING_SAMPLES], &samples[3 * i], 3 * sizeof(int16_t));
+    pState->RingNumber[(first + i) % RING_SAMPLES] = first + i;
+  }
+  pState->Pipeline.Process(TremorPipeline::Interleaved(samples, count, first));
+  pState->Capture.Append(first, samples, count, Microseconds() - pState->Start);
+  pState->Next = first + count;
+  pState->Samples += count;
+  RateLevels(pState, 0);
+}
+
+static void OnLevel(State *pState, const uint8_t *pPayload, uint32_t Length)
+{
+  CaptureLevel level;
+
+  if (Length != 12) {
+    pState->BadRecords++;
+    return;
+  }
+  level.Time = GetU32(pPayload);
+  level.Sample = GetU32(pPayload + 4);
+  level.Board = (int32_t)GetU32(pPayload + 8);
+  level.Host = CAPTURE_NO_LEVEL;
+  if (pState->PendingCount == PENDING_LEVELS) {
+    // The samples stopped coming
+    RateLevels(pState, 1);
+  }
+  pState->Pending[(pState->PendingFirst + pState->PendingCount) % PENDING_LEVELS] = level;
+  pState->PendingCount++;
+  RateLevels(pState, 0);
+}
+
+static void OnLog(State *pState, const uint8_t *pPayload, uint32_t Length)
+{
+  uint32_t args[16];
+  uint32_t position = 0, token, time, count, i;
+  const char *format;
+
+  while (position + LOG_ENTRY_HEADER <= Length) {
+    token = GetU32(pPayload + position);
+    time = GetU32(pPayload + position + 4);
+    count = pPayload[position + 8];
+    if ((count > 16) || (position + LOG_ENTRY_HEADER + 4 * count > Length)) {
+      pState->BadRecords++;
+      return;
+    }
+    for (i = 0; i < count; i++) {
+      args[i] = GetU32(pPayload + position + LOG_ENTRY_HEADER + 4 * i);
+    }
+    position += LOG_ENTRY_HEADER + 4 * count;
+
+    printf("board %u.%06u: ", time / 1000000, time % 1000000);
+    format = FindToken(token);
+    if (format != NULL) {
+      Render(format, args, count);
+    } else {
+      printf("token %08x", token);
+      for (i = 0; i < count; i++) {
+        printf(" %08x", args[i]);
+      }
+    }
+    putchar('\n');
+  }
+}
+
+static void OnRecord(State *pState, const uint8_t *pRecord, uint32_t Length)
+{
+  uint16_t crc;
+  int32_t sequence;
+
+  if (Length < RECORD_OVERHEAD) {
+    pState->BadRecords++;
+    return;
+  }
+  crc = Crc16(pRecord, Length - 2);
+  if ((pRecord[Length - 2] != (uint8_t)crc) || (pRecord[Length - 1] != (uint8_t)(crc >> 8))) {
+    pState->BadRecords++;
+    return;
+  }
+  pState->Records++;
+  sequence = pRecord[1] | (pRecord[2] << 8);
+  if (pState->Sequence >= 0) {
+    pState->LostRecords += (uint16_t)(sequence - pState->Sequence - 1);
+  }
+  pState->Sequence = sequence;
+
+  switch (pRecord[0]) {
+    case RECORD_TEXT:
+      printf("board: %.*s%s", (int)(Length - RECORD_OVERHEAD), pRecord + 3,
+             (pRecord[Length - 3] == '\n') ? "" : "\n");
+      break;
+    case RECORD_SAMPLES:
+      OnSamples(pState, pRecord + 3, Length - RECORD_OVERHEAD);
+      break;
+    case RECORD_LEVEL:
+      OnLevel(pState, pRecord + 3, Length - RECORD_OVERHEAD);
+      break;
+    case RECORD_LOG:
+      OnLog(pState, pRecord + 3, Length - RECORD_OVERHEAD);
+      break;
+    default:
+      break;
+  }
+}
+
+static void Status(const State *pState, double Seconds, uint64_t Samples)
+{
+  fprintf(stderr,
+          "\r%llu records, %llu bad, %llu lost | %llu samples, %llu lost, %.0f/s | levels: %llu match, %llu differ, "
+          "%llu lost | %llu onsets  ",
+          (unsigned long long)pState->Records, (unsigned long long)pState->BadRecords,
+          (unsigned long long)pState->LostRecords, (unsigned long long)pState->Samples,
+          (unsigned long long)pState->LostSamples, (Seconds > 0) ? Samples / Seconds : 0.0,
+          (unsigned long long)pState->Matches, (unsigned long long)pState->Mismatches,
+          (unsigned long long)pState->Unrated, (unsigned long long)pState->Pipeline.GetSummary().Onsets);
+}
+
+static double Now(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+  static State state;
+  static uint8_t input[65536];
+  uint8_t record[MAX_RECORD + 256];
+  uint32_t baud = 921600, length = 0, remaining = 0, i;
+  const char *pCapture = NULL, *pInput = NULL;
+  bool framing = false, overflow = false, zero = false;
+  double last, now;
+  uint64_t lastSamples = 0;
+  struct sigaction action;
+  ssize_t n;
+  int fd;
+
+  for (i = 1; i < (uint32_t)argc; i++) {
+    if ((strcmp(argv[i], "-b") == 0) && (i + 1 < (uint32_t)argc)) {
+      baud = (uint32_t)strtoul(argv[++i], NULL, 0);
+    } else if ((strcmp(argv[i], "-t") == 0) && (i + 1 < (uint32_t)argc)) {
+      if (!LoadTokens(argv[++i])) {
+        return 1;
+      }
+    } else if ((strcmp(argv[i], "-o") == 0) && (i + 1 < (uint32_t)argc)) {
+      pCapture = argv[++i];
+    } else {
+      pInput = argv[i];
+    }
+  }
+  if (pInput == NULL) {
+    fprintf(stderr, "usage: ingest [-b baud] [-o capture.trc] [-t tokens.txt] device|file|-\n");
+    return 1;
+  }
+
+  fd = Open(pInput, baud);
+  if (fd < 0) {
+    perror(pInput);
+    return 1;
+  }
+  state.Sequence = -1;
+  for (i = 0; i < RING_SAMPLES; i++) {
+    state.RingNumber[i] = 0xFFFFFFFF;
+  }
+  state.Pipeline.SetOnsetCallback(OnOnset, NULL);
+  state.Start = Microseconds();
+  if (pCapture != NULL) {
+    CaptureHeader &info = state.CaptureInfo;
+    memset(&info, 0, sizeof(info));
+    info.RateHz = RATE_HZ;
+    info.FullScaleDps = FULL_SCALE_DPS;
+    info.Sensitivity = SENSITIVITY_DPS;
+    info.Gain[0] = info.Gain[1] = info.Gain[2] = 1.0f;
+    info.BlockSamples = CAPTURE_BLOCK;
+    state.pCapturePath = pCapture;
+    state.CapturePart = 1;
+    if (!OpenCapture(&state)) {
+      return 1;
+    }
+  }
+
+  // No SA_RESTART: read() returns on Ctrl-C
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = OnSignal;
+  sigaction(SIGINT, &action, NULL);
+  sigaction(SIGTERM, &action, NULL);
+
+  last = Now();
+  while (!Stop) {
+    n = read(fd, input, sizeof(input));
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      perror(pInput);
+      break;
+    }
+    if (n == 0) {
+      break;
+    }
+    state.Bytes += n;
+
+    // COBS, decoded as the bytes come. Each code byte gives the number of
+    // bytes of its group, the group ending with a zero unless its code is
+    // 0xFF or it is the last one: the zero is only added when another group
+    // follows
+    for (i = 0; i < (uint32_t)n; i++) {
+      uint8_t byte = input[i];
+      if (byte == 0) {
+        if (framing && !overflow && (remaining == 0)) {
+          OnRecord(&state, record, length);
+        } else if (framing) {
+          state.BadRecords++;
+        }
+        framing = false;
+        overflow = false;
+        zero = false;
+        remaining = 0;
+        length = 0;
+      } else if (overflow) {
+        continue;
+      } else if (length + 1 >= sizeof(record)) {
+        overflow = true;
+      } else if (remaining == 0) {
+        if (zero) {
+          record[length++] = 0;
+        }
+        framing = true;
+        zero = (byte != 0xFF);
+        remaining = byte - 1;
+      } else {
+        record[length++] = byte;
+        remaining--;
+      }
+    }
+
+    now = Now();
+    if (now - last >= 1.0) {
+      Status(&state, now - last, state.Samples - lastSamples);
+      lastSamples = state.Samples;
+      last = now;
+      fflush(stdout);
+    }
+  }
+
+  RateLevels(&state, state.PendingCount);
+  if (state.Capture.IsOpen() && !state.Capture.Close()) {
+    perror(pCapture);
+  }
+  Status(&state, 0, 0);
+  fprintf(stderr, "\n%llu bytes\n", (unsigned long long)state.Bytes);
+  return 0;
+}
@@ -0,0 +1,244 @@
+/**
+  ******************************************************************************
+  * @file    replay.cpp
+  * @brief   Host tool running the board tremor detection, src/util/
+  *          TremorPipeline.cpp, on a capture file, at the speed of the
+  *          board or as fast as it goes.
+  ******************************************************************************
+  */
+
+/* File Info : -----------------------------------------------------------------
+                                   User NOTES
+1. How To use this tool:
+--------------------------
+   g++ -O2 -Isrc -o replay tools/replay/replay.cpp tools/capture/Capture.cpp \
+       src/util/TremorDetector.cpp src/util/TremorPipeline.cpp
+   ./replay session.trc                       as fast as it goes
+   ./replay -x 1 session.trc                  at the rate of the board
+   ./replay -x 10 -s 120 -d 60 session.trc    one minute from 2 minutes in,
+                                              10 times faster
+   ./replay -n 22800 session.trc              from sample 22800
+
+2. Description:
+---------------------
+   - The capture is mapped, tools/capture/Capture.h, and its blocks go to
+     the pipeline where they lie, each axis a column of the block. Only a
+     capture with a bias or a gain in its header is copied, to apply them.
+   - -x gives the speed, 1 being the rate of the header, 0 as fast as it
+     goes, the default. Paced, the blocks are given 32 samples at a time.
+   - -s and -n start at a time, in seconds of samples, or a sample number;
+     -d gives the duration, in seconds of samples. The detection starts
+     fresh at the first sample.
+   - The onsets go to stdout, then the summary, the time taken and the
+     speed, in times the real time and samples per second.
+   - The board level records of the part replayed are checked against the
+     detection of the same samples: a difference is a change in the
+     detector since the capture.
+
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "util/TremorDetector.h"
+#include "util/TremorPipeline.h"
+#include "../capture/Capture.h"
+
+#define PACED_SAMPLES         32
+
+static double Now(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static void Wait(double Until)
+{
+  struct timespec delay;
+  double left = Until - Now();
+
+  if (left > 0) {
+    delay.tv_sec = (time_t)left;
+    delay.tv_nsec = (long)((left - delay.tv_sec) * 1e9);
+    nanosleep(&delay, NULL);
+  }
+}
+
+static void OnOnset(uint32_t Sample, float Level, void *pContext)
+{
+  const CaptureHeader *header = (const CaptureHeader *)pContext;
+
+  printf("onset at sample %u (%.2f s), level %d\n", Sample, Sample / header->RateHz,
+         TremorDetector::Hundredths(Level));
+}
+
+static bool IsCalibrated(const CaptureHeader &Header)
+{
+  for (uint32_t i = 0; i < 3; i++) {
+    if ((Header.Bias[i] != 0) || (Header.Gain[i] != 1.0f)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Bias and gain applied into pColumns, 3 columns of Count
+static TremorPipeline::Block Calibrate(const CaptureHeader &Header, const TremorPipeline::Block &block, int16_t *pColumns)
+{
+  TremorPipeline::Block copy = block;
+  float value;
+
+  for (uint32_t axis = 0; axis < 3; axis++) {
+    for (uint32_t i = 0; i < block.Count; i++) {
+      value = (block.pAxis[axis][i * block.Stride] - Header.Bias[axis]) * Header.Gain[axis];
+      value = (value > 32767.0f) ? 32767.0f : ((value < -32768.0f) ? -32768.0f : value);
+      pColumns[axis * block.Count + i] = (int16_t)((value < 0) ? value - 0.5f : value + 0.5f);
+    }
+    copy.pAxis[axis] = pColumns + axis * block.Count;
+    copy.Stride = 1;
+  }
+  return copy;
+}
+
+// Board levels of the samples replayed, rated again
+static void CheckLevels(const CaptureReader &Capture, uint32_t First, uint32_t End)
+{
+  TremorDetector detector;
+  CaptureLevel level;
+  int16_t sample[3];
+  uint64_t matches = 0, differences = 0, lost = 0;
+  int32_t host;
+
+  for (uint32_t i = 0; i < Capture.GetLevels(); i++) {
+    level = Capture.GetLevel(i);
+    if ((level.Sample < First) || (level.Sample >= End)) {
+      continue;
+    }
+    if (!Capture.GetSample(level.Sample, sample)) {
+      lost++;
+      continue;
+    }
+    host = TremorDetector::Hundredths(detector.Update(sample));
+    if (host == level.Board) {
+      matches++;
+    } else {
+      differences++;
+      if (differences <= 10) {
+        printf("level at sample %u: board %d, now %d hundredths\n", level.Sample, level.Board, host);
+      }
+    }
+  }
+  printf("board levels: %llu match, %llu differ, %llu samples lost\n", (unsigned long long)matches,
+         (unsigned long long)differences, (unsigned long long)lost);
+}
+
+int main(int argc, char **argv)
+{
+  static int16_t columns[3 * 65536];
+  CaptureReader capture;
+  TremorPipeline pipeline;
+  TremorPipeline::Block block, part;
+  double speed = 0, start = -1, duration = -1, began, elapsed, seconds;
+  uint32_t first = 0, end = 0xFFFFFFFF, chunk, offset, skip, i;
+  const char *pPath = NULL;
+  bool calibrated;
+
+  for (i = 1; i < (uint32_t)argc; i++) {
+    if ((strcmp(argv[i], "-x") == 0) && (i + 1 < (uint32_t)argc)) {
+      speed = atof(argv[++i]);
+    } else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < (uint32_t)argc)) {
+      start = atof(argv[++i]);
+    } else if ((strcmp(argv[i], "-n") == 0) && (i + 1 < (uint32_t)argc)) {
+      first = (uint32_t)strtoul(argv[++i], NULL, 0);
+    } else if ((strcmp(argv[i], "-d") == 0) && (i + 1 < (uint32_t)argc)) {
+      duration = atof(argv[++i]);
+    } else {
+      pPath = argv[i];
+    }
+  }
+  if ((pPath == NULL) || (speed < 0)) {
+    fprintf(stderr, "usage: replay [-x speed] [-s seconds|-n sample] [-d seconds] capture.trc\n");
+    return 1;
+  }
+  if (!capture.Open(pPath)) {
+    fprintf(stderr, "%s: not a capture\n", pPath);
+    return 1;
+  }
+
+  const CaptureHeader &header = capture.GetHeader();
+  if ((header.RateHz <= 0) || (header.BlockSamples > 65536)) {
+    fprintf(stderr, "%s: bad header\n", pPath);
+    return 1;
+  }
+  if (header.IndexOffset == 0) {
+    fprintf(stderr, "%s: not closed, %u blocks found\n", pPath, capture.GetBlocks());
+  }
+  printf("%s: %u blocks, %.0f Hz, %u dps, %.4f dps/LSB\n", pPath, capture.GetBlocks(), header.RateHz,
+         header.FullScaleDps, header.Sensitivity);
+  if (capture.GetBlocks() == 0) {
+    return 0;
+  }
+
+  if (start >= 0) {
+    first = capture.GetBlock(0).First + (uint32_t)(start * header.RateHz);
+  }
+  if (first < capture.GetBlock(0).First) {
+    first = capture.GetBlock(0).First;
+  }
+  if (duration >= 0) {
+    end = first + (uint32_t)(duration * header.RateHz);
+  }
+  calibrated = IsCalibrated(header);
+  pipeline.SetOnsetCallback(OnOnset, (void *)&header);
+
+  began = Now();
+  for (i = capture.Seek(first); i < capture.GetBlocks(); i++) {
+    block = capture.GetBlock(i);
+    if (block.First >= end) {
+      break;
+    }
+    if (!calibrated) {
+      block = Calibrate(header, block, columns);
+    }
+
+    // Cut to the samples asked for
+    skip = (block.First < first) ? first - block.First : 0;
+    if (block.First + block.Count > end) {
+      block.Count = end - block.First;
+    }
+    for (offset = skip; offset < block.Count; offset += chunk) {
+      chunk = block.Count - offset;
+      if ((speed > 0) && (chunk > PACED_SAMPLES)) {
+        chunk = PACED_SAMPLES;
+      }
+      part = block;
+      part.pAxis[0] += offset * block.Stride;
+      part.pAxis[1] += offset * block.Stride;
+      part.pAxis[2] += offset * block.Stride;
+      part.Count = chunk;
+      part.First = block.First + offset;
+      if (speed > 0) {
+        Wait(began + (part.First + chunk - first) / (header.RateHz * speed));
+      }
+      pipeline.Process(part);
+    }
+  }
+  elapsed = Now() - began;
+
+  const TremorPipeline::Summary &summary = pipeline.GetSummary();
+  seconds = summary.Samples / header.RateHz;
+  printf("%u samples, %.1f s: %u onsets, max level %.2f, %.1f s mild, %.1f s severe\n", summary.Samples, seconds,
+         summary.Onsets, summary.MaxLevel / 100.0, summary.MildSamples / header.RateHz,
+         summary.SevereSamples / header.RateHz);
+  printf("%.3f s taken, %.0f times real time, %.0f samples/s\n", elapsed, (elapsed > 0) ? seconds / elapsed : 0.0,
+         (elapsed > 0) ? summary.Samples / elapsed : 0.0);
+  if ((summary.Samples > 0) && (capture.GetLevels() > 0)) {
+    CheckLevels(capture, first, pipeline.GetLast() + 1);
+  }
+  return 0;
+}
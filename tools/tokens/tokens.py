@@ -0,0 +1,66 @@
+"""
+Token dictionary of the TOKEN_LOG() calls, src/util/TokenLog.h.
+
+Finds every TOKEN_LOG("format", ...) in the sources and writes one line
+per format: token in hexadecimal, a tab, the format as written in the
+source, escapes included. The token is the FNV-1a hash of the format, as
+TokenLog::Token() computes it at compile time. Two formats with the same
+token are an error: change one of them.
+
+PlatformIO runs it before each build, platformio.ini:
+    extra_scripts = pre:tools/tokens/tokens.py
+and the dictionary goes to the build directory, tokens.txt.
+
+By hand:
+    python3 tools/tokens/tokens.py src > tokens.txt
+"""
+
+import codecs
+import os
+import re
+import sys
+
+CALL = re.compile(r'\bTOKEN_LOG\(\s*"((?:[^"\\\n]|\\.)*)"')
+SOURCES = ('.c', '.cpp', '.h')
+
+
+def token(text):
+    value = 2166136261
+    for byte in codecs.decode(text, 'unicode_escape').encode('latin-1'):
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def scan(root):
+    formats = {}
+    for directory, _, files in sorted(os.walk(root)):
+        for name in sorted(files):
+            if not name.endswith(SOURCES):
+                continue
+            path = os.path.join(directory, name)
+            with open(path, encoding='utf-8', errors='replace') as source:
+                text = source.read()
+            for match in CALL.finditer(text):
+                value = token(match.group(1))
+                if formats.setdefault(value, match.group(1)) != match.group(1):
+                    line = text.count('\n', 0, match.start()) + 1
+                    raise SystemExit('%s:%d: token 0x%08x also used by "%s"' % (path, line, value, formats[value]))
+    return formats
+
+
+def write(formats, output):
+    for value in sorted(formats):
+        output.write('%08x\t%s\n' % (value, formats[value]))
+
+
+try:
+    Import('env')  # noqa: F821, SCons
+except NameError:
+    if __name__ == '__main__':
+        write(scan(sys.argv[1] if len(sys.argv) > 1 else 'src'), sys.stdout)
+else:
+    build = env.subst('$BUILD_DIR')  # noqa: F821
+    if not os.path.isdir(build):
+        os.makedirs(build)
+    with open(os.path.join(build, 'tokens.txt'), 'w') as dictionary:
+        write(scan(env.subst('$PROJECT_SRC_DIR')), dictionary)  # noqa: F821